@@ -38,29 +38,32 @@ constexpr auto binary_search(
         return nullptr;
     }
 
+    // Branchless halving: each round shrinks the candidate window [low, low + size)
+    // with a conditional move instead of a hard-to-predict branch, and the two
+    // possible next probes are prefetched so the comparison never waits on a
+    // cache miss it could have hidden.
     size_t low = 0;
-    size_t high = haystack.size() - 1;
-    while (low <= high) {
-        size_t middle = low + (high - low) / 2;
-
-        int comparison = comparator(needle, haystack[middle]);
-
-        if (comparison < 0)
-            if (middle != 0)
-                high = middle - 1;
-            else
-                break;
-        else if (comparison > 0)
-            low = middle + 1;
-        else {
-            if (nearby_index)
-                *nearby_index = middle;
-            return &haystack[middle];
+    size_t size = haystack.size();
+    while (size > 1) {
+        size_t half = size / 2;
+        size_t other_half = size - half;
+        if (!is_constant_evaluated()) {
+            __builtin_prefetch(&haystack[low + half / 2]);
+            __builtin_prefetch(&haystack[low + half + other_half / 2]);
         }
+        low += comparator(needle, haystack[low + half - 1]) > 0 ? half : 0;
+        size = other_half;
+    }
+
+    int comparison = comparator(needle, haystack[low]);
+    if (comparison == 0) {
+        if (nearby_index)
+            *nearby_index = low;
+        return &haystack[low];
     }
 
     if (nearby_index)
-        *nearby_index = min(low, high);
+        *nearby_index = comparison < 0 && low != 0 ? low - 1 : low;
 
     return nullptr;
 }
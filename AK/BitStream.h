@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/ByteBuffer.h>
 #include <AK/MaybeOwned.h>
+#include <AK/NumericLimits.h>
 #include <AK/OwnPtr.h>
 #include <AK/Stream.h>
 
@@ -25,16 +27,21 @@ public:
     // ^Stream
     virtual ErrorOr<Bytes> read(Bytes bytes) override
     {
-        if (m_current_byte.has_value() && is_aligned_to_byte_boundary()) {
-            bytes[0] = m_current_byte.release_value();
-            return m_stream->read(bytes.slice(1));
-        }
         align_to_byte_boundary();
-        return m_stream->read(bytes);
+
+        size_t bytes_from_buffer = 0;
+        while (m_bit_count > 0 && bytes_from_buffer < bytes.size()) {
+            bytes[bytes_from_buffer++] = static_cast<u8>(m_bit_buffer >> (m_bit_count - 8));
+            m_bit_count -= 8;
+            m_bit_buffer &= lsb_mask(m_bit_count);
+        }
+
+        auto read_bytes = TRY(m_stream->read(bytes.slice(bytes_from_buffer)));
+        return bytes.trim(bytes_from_buffer + read_bytes.size());
     }
     virtual ErrorOr<size_t> write(ReadonlyBytes bytes) override { return m_stream->write(bytes); }
     virtual ErrorOr<void> write_entire_buffer(ReadonlyBytes bytes) override { return m_stream->write_entire_buffer(bytes); }
-    virtual bool is_eof() const override { return m_stream->is_eof() && !m_current_byte.has_value(); }
+    virtual bool is_eof() const override { return m_stream->is_eof() && m_bit_count == 0; }
     virtual bool is_open() const override { return m_stream->is_open(); }
     virtual void close() override
     {
@@ -55,65 +62,91 @@ public:
         if constexpr (IsSame<bool, T>) {
             VERIFY(count == 1);
         }
+        VERIFY(count <= sizeof(T) * 8);
         T result = 0;
 
         size_t nread = 0;
         while (nread < count) {
-            if (m_current_byte.has_value()) {
-                if constexpr (!IsSame<bool, T> && !IsSame<u8, T>) {
-                    // read as many bytes as possible directly
-                    if (((count - nread) >= 8) && is_aligned_to_byte_boundary()) {
-                        // shift existing data over
-                        result <<= 8;
-                        result |= m_current_byte.value();
-                        nread += 8;
-                        m_current_byte.clear();
-                    } else {
-                        auto const bit = (m_current_byte.value() >> (7 - m_bit_offset)) & 1;
-                        result <<= 1;
-                        result |= bit;
-                        ++nread;
-                        if (m_bit_offset++ == 7)
-                            m_current_byte.clear();
-                    }
-                } else {
-                    // Always take this branch for booleans or u8: there's no purpose in reading more than a single bit
-                    auto const bit = (m_current_byte.value() >> (7 - m_bit_offset)) & 1;
-                    if constexpr (IsSame<bool, T>)
-                        result = bit;
-                    else {
-                        result <<= 1;
-                        result |= bit;
-                    }
-                    ++nread;
-                    if (m_bit_offset++ == 7)
-                        m_current_byte.clear();
-                }
+            if (m_bit_count == 0)
+                TRY(refill_buffer_from_stream());
+
+            size_t const bits_to_take = min(count - nread, static_cast<size_t>(m_bit_count));
+            u64 const taken = m_bit_buffer >> (m_bit_count - bits_to_take);
+            if constexpr (IsSame<bool, T>) {
+                result = taken != 0;
             } else {
-                auto temp_buffer = TRY(ByteBuffer::create_uninitialized(1));
-                TRY(m_stream->read(temp_buffer.bytes()));
-                m_current_byte = temp_buffer[0];
-                m_bit_offset = 0;
+                result = static_cast<T>((result << bits_to_take) | taken);
             }
+            m_bit_count -= bits_to_take;
+            m_bit_buffer &= lsb_mask(m_bit_count);
+            nread += bits_to_take;
         }
 
         return result;
     }
 
+    /// Reads a unary-encoded integer: the number of zero bits before the next set bit.
+    /// The set bit terminating the run is consumed as well.
+    /// This scans whole buffered words at a time instead of looping per bit.
+    ErrorOr<size_t> read_unary()
+    {
+        size_t result = 0;
+
+        while (true) {
+            if (m_bit_count == 0)
+                TRY(refill_buffer_from_stream());
+
+            if (m_bit_buffer == 0) {
+                // Everything in the buffer is part of the run; count it and move on.
+                result += m_bit_count;
+                m_bit_count = 0;
+                continue;
+            }
+
+            size_t const highest_set_bit = 63 - count_leading_zeroes(m_bit_buffer);
+            result += m_bit_count - 1 - highest_set_bit;
+            // Consume the zero bits along with the terminating set bit.
+            m_bit_count = static_cast<u8>(highest_set_bit);
+            m_bit_buffer &= lsb_mask(m_bit_count);
+            return result;
+        }
+    }
+
     /// Discards any sub-byte stream positioning the input stream may be keeping track of.
     /// Non-bitwise reads will implicitly call this.
     void align_to_byte_boundary()
     {
-        m_current_byte.clear();
-        m_bit_offset = 0;
+        m_bit_count -= m_bit_count % 8;
+        m_bit_buffer &= lsb_mask(m_bit_count);
     }
 
     /// Whether we are (accidentally or intentionally) at a byte boundary right now.
-    ALWAYS_INLINE bool is_aligned_to_byte_boundary() const { return m_bit_offset == 0; }
+    ALWAYS_INLINE bool is_aligned_to_byte_boundary() const { return m_bit_count % 8 == 0; }
 
 private:
-    Optional<u8> m_current_byte;
-    size_t m_bit_offset { 0 };
+    static constexpr u64 lsb_mask(u8 bits)
+    {
+        return bits == 64 ? NumericLimits<u64>::max() : (1ull << bits) - 1;
+    }
+
+    ALWAYS_INLINE ErrorOr<void> refill_buffer_from_stream()
+    {
+        // Note: We only ever read a single byte ahead, so that users who interleave bit reads
+        //       with whole-byte reads, or who hand the underlying stream to someone else
+        //       afterwards, never lose data that was buffered ahead of time.
+        u8 byte = 0;
+        Bytes bytes { &byte, 1 };
+        if (TRY(m_stream->read(bytes)).is_empty())
+            return Error::from_string_literal("Reached end-of-stream without collecting the required number of bits");
+
+        m_bit_buffer = (m_bit_buffer << 8) | byte;
+        m_bit_count += 8;
+        return {};
+    }
+
+    // The low m_bit_count bits of m_bit_buffer hold unconsumed bits; everything above them is zero.
+    u64 m_bit_buffer { 0 };
+    u8 m_bit_count { 0 };
     MaybeOwned<Stream> m_stream;
 };
 
@@ -38,6 +38,26 @@ public:
         move_from(move(other));
     }
 
+    // Moving from a buffer with a different inline capacity transfers a heap
+    // allocation as-is; contents that were stored inline have to be copied
+    // (and crash on allocation failure if they don't fit in our own inline
+    // buffer).
+    template<size_t other_inline_capacity>
+    explicit ByteBuffer(ByteBuffer<other_inline_capacity>&& other)
+    {
+        if (!other.m_inline) {
+            m_outline_buffer = other.m_outline_buffer;
+            m_outline_capacity = other.m_outline_capacity;
+            m_size = other.m_size;
+            m_inline = false;
+        } else {
+            MUST(try_resize(other.m_size));
+            __builtin_memcpy(data(), other.m_inline_buffer, other.m_size);
+        }
+        other.m_size = 0;
+        other.m_inline = true;
+    }
+
     ByteBuffer& operator=(ByteBuffer&& other)
     {
         if (this != &other) {
@@ -149,6 +169,12 @@ public:
         m_size = 0;
     }
 
+    // Unlike clear(), this keeps any heap allocation around for reuse.
+    void clear_with_capacity()
+    {
+        m_size = 0;
+    }
+
     ALWAYS_INLINE void resize(size_t new_size)
     {
         MUST(try_resize(new_size));
@@ -253,6 +279,9 @@ public:
     ALWAYS_INLINE size_t capacity() const { return m_inline ? inline_capacity : m_outline_capacity; }
 
 private:
+    template<size_t other_inline_capacity>
+    friend class ByteBuffer;
+
     void move_from(ByteBuffer&& other)
     {
         m_size = other.m_size;
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/HashTable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Traits.h>
+#include <AK/Types.h>
+#include <AK/kmalloc.h>
+
+namespace AK {
+
+// A swiss-table-style hash map. Unlike HashTable, which keeps one state byte
+// inline with every bucket, the per-bucket metadata lives in its own
+// contiguous array: one byte per bucket holding either a sentinel
+// (empty/deleted) or seven bits of the key's hash. A probe scans a 16-byte
+// group of control bytes at once with branchless whole-word matching, so a
+// lookup usually touches a single cache line of metadata and then only the
+// entries whose hash fragment matched.
+//
+// The bucket array itself stores bare key/value pairs, making iteration a
+// linear walk and successful lookups a single dependent load.
+
+template<typename K, typename V, typename KeyTraits = Traits<K>>
+class FlatHashMap {
+public:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+private:
+    static constexpr size_t group_size = 16;
+    static constexpr u8 control_empty = 0x80;
+    static constexpr u8 control_deleted = 0xfe;
+    static constexpr u64 repeated_0x01 = 0x0101010101010101ull;
+    static constexpr u64 repeated_0x80 = repeated_0x01 << 7;
+    static constexpr size_t invalid_index = ~static_cast<size_t>(0);
+
+    // Returns a word with 0x80 set for every byte of `word` equal to `byte`.
+    static constexpr u64 match_bytes(u64 word, u8 byte)
+    {
+        u64 x = word ^ (repeated_0x01 * byte);
+        return (x - repeated_0x01) & ~x & repeated_0x80;
+    }
+
+public:
+    FlatHashMap() = default;
+
+    FlatHashMap(FlatHashMap const& other)
+    {
+        ensure_capacity(other.size());
+        for (auto& entry : other)
+            set(entry.key, entry.value);
+    }
+
+    FlatHashMap& operator=(FlatHashMap const& other)
+    {
+        if (this != &other) {
+            clear();
+            ensure_capacity(other.size());
+            for (auto& entry : other)
+                set(entry.key, entry.value);
+        }
+        return *this;
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : m_control(exchange(other.m_control, nullptr))
+        , m_entries(exchange(other.m_entries, nullptr))
+        , m_capacity(exchange(other.m_capacity, 0))
+        , m_size(exchange(other.m_size, 0))
+        , m_deleted_count(exchange(other.m_deleted_count, 0))
+    {
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept
+    {
+        FlatHashMap temporary { move(other) };
+        swap(m_control, temporary.m_control);
+        swap(m_entries, temporary.m_entries);
+        swap(m_capacity, temporary.m_capacity);
+        swap(m_size, temporary.m_size);
+        swap(m_deleted_count, temporary.m_deleted_count);
+        return *this;
+    }
+
+    ~FlatHashMap() { clear(); }
+
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+
+    void clear()
+    {
+        if (!m_control)
+            return;
+        for (size_t index = 0; index < m_capacity; ++index) {
+            if ((m_control[index] & 0x80) == 0)
+                m_entries[index].~Entry();
+        }
+        kfree_sized(m_control, m_capacity);
+        kfree_sized(m_entries, m_capacity * sizeof(Entry));
+        m_control = nullptr;
+        m_entries = nullptr;
+        m_capacity = 0;
+        m_size = 0;
+        m_deleted_count = 0;
+    }
+
+    template<bool IsConst>
+    class IteratorBase {
+        using MapType = Conditional<IsConst, FlatHashMap const, FlatHashMap>;
+        using EntryType = Conditional<IsConst, Entry const, Entry>;
+
+    public:
+        EntryType& operator*() const { return m_map->m_entries[m_index]; }
+        EntryType* operator->() const { return &m_map->m_entries[m_index]; }
+        bool operator==(IteratorBase const& other) const { return m_index == other.m_index; }
+        bool operator!=(IteratorBase const& other) const { return m_index != other.m_index; }
+        IteratorBase& operator++()
+        {
+            m_index = m_map->next_occupied_index(m_index + 1);
+            return *this;
+        }
+
+    private:
+        friend FlatHashMap;
+        IteratorBase(MapType& map, size_t index)
+            : m_map(&map)
+            , m_index(index)
+        {
+        }
+        MapType* m_map;
+        size_t m_index;
+    };
+
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    [[nodiscard]] Iterator begin() { return { *this, next_occupied_index(0) }; }
+    [[nodiscard]] Iterator end() { return { *this, m_capacity }; }
+    [[nodiscard]] ConstIterator begin() const { return { *this, next_occupied_index(0) }; }
+    [[nodiscard]] ConstIterator end() const { return { *this, m_capacity }; }
+
+    [[nodiscard]] Iterator find(K const& key)
+    {
+        auto index = find_index(key, KeyTraits::hash(key));
+        return { *this, index == invalid_index ? m_capacity : index };
+    }
+
+    [[nodiscard]] ConstIterator find(K const& key) const
+    {
+        auto index = find_index(key, KeyTraits::hash(key));
+        return { *this, index == invalid_index ? m_capacity : index };
+    }
+
+    [[nodiscard]] bool contains(K const& key) const
+    {
+        return find_index(key, KeyTraits::hash(key)) != invalid_index;
+    }
+
+    [[nodiscard]] Optional<V> get(K const& key) const
+    {
+        auto index = find_index(key, KeyTraits::hash(key));
+        if (index == invalid_index)
+            return {};
+        return m_entries[index].value;
+    }
+
+    HashSetResult set(K const& key, V value)
+    {
+        auto hash = KeyTraits::hash(key);
+        auto index = find_index(key, hash);
+        if (index != invalid_index) {
+            m_entries[index].value = move(value);
+            return HashSetResult::ReplacedExistingEntry;
+        }
+        if (should_grow())
+            rehash(m_capacity == 0 ? group_size : m_capacity * 2);
+        insert_new_entry(K(key), move(value), hash);
+        return HashSetResult::InsertedNewEntry;
+    }
+
+    bool remove(K const& key)
+    {
+        auto index = find_index(key, KeyTraits::hash(key));
+        if (index == invalid_index)
+            return false;
+        remove_at(index);
+        return true;
+    }
+
+    void remove(Iterator iterator)
+    {
+        VERIFY(iterator.m_index < m_capacity);
+        remove_at(iterator.m_index);
+    }
+
+    void ensure_capacity(size_t capacity)
+    {
+        size_t needed = group_size;
+        // Aim below the 7/8 load factor for the requested entry count.
+        while (needed * 7 < capacity * 8)
+            needed *= 2;
+        if (needed > m_capacity)
+            rehash(needed);
+    }
+
+private:
+    [[nodiscard]] size_t next_occupied_index(size_t index) const
+    {
+        while (index < m_capacity && (m_control[index] & 0x80) != 0)
+            ++index;
+        return index;
+    }
+
+    [[nodiscard]] bool should_grow() const
+    {
+        // Grow at a 7/8 load factor, counting tombstones as occupied since
+        // they lengthen probe sequences just the same.
+        return (m_size + m_deleted_count + 1) * 8 > m_capacity * 7;
+    }
+
+    [[nodiscard]] size_t find_index(K const& key, u32 hash) const
+    {
+        if (m_capacity == 0)
+            return invalid_index;
+        u8 h2 = hash & 0x7f;
+        size_t group_count = m_capacity / group_size;
+        size_t group = (hash >> 7) & (group_count - 1);
+        for (size_t probes = 0; probes < group_count; ++probes) {
+            u64 halves[2];
+            __builtin_memcpy(halves, m_control + group * group_size, group_size);
+            for (size_t half = 0; half < 2; ++half) {
+                u64 match = match_bytes(halves[half], h2);
+                while (match != 0) {
+                    size_t index = group * group_size + half * 8 + count_trailing_zeroes(match) / 8;
+                    if (KeyTraits::equals(m_entries[index].key, key))
+                        return index;
+                    match &= match - 1;
+                }
+            }
+            // An empty slot means the key can't live in a later group.
+            if (match_bytes(halves[0], control_empty) != 0 || match_bytes(halves[1], control_empty) != 0)
+                return invalid_index;
+            group = (group + 1) & (group_count - 1);
+        }
+        return invalid_index;
+    }
+
+    void insert_new_entry(K&& key, V&& value, u32 hash)
+    {
+        u8 h2 = hash & 0x7f;
+        size_t group_count = m_capacity / group_size;
+        size_t group = (hash >> 7) & (group_count - 1);
+        for (;;) {
+            u64 halves[2];
+            __builtin_memcpy(halves, m_control + group * group_size, group_size);
+            for (size_t half = 0; half < 2; ++half) {
+                // Both empty and deleted slots have the high bit set, so the
+                // first such byte in probe order is the slot to claim.
+                u64 reusable = halves[half] & repeated_0x80;
+                if (reusable == 0)
+                    continue;
+                size_t index = group * group_size + half * 8 + count_trailing_zeroes(reusable) / 8;
+                if (m_control[index] == control_deleted)
+                    --m_deleted_count;
+                new (&m_entries[index]) Entry { move(key), move(value) };
+                m_control[index] = h2;
+                ++m_size;
+                return;
+            }
+            group = (group + 1) & (group_count - 1);
+        }
+    }
+
+    void remove_at(size_t index)
+    {
+        VERIFY((m_control[index] & 0x80) == 0);
+        m_entries[index].~Entry();
+        m_control[index] = control_deleted;
+        ++m_deleted_count;
+        --m_size;
+    }
+
+    void rehash(size_t new_capacity)
+    {
+        auto* old_control = m_control;
+        auto* old_entries = m_entries;
+        auto old_capacity = m_capacity;
+
+        m_control = static_cast<u8*>(kmalloc(new_capacity));
+        __builtin_memset(m_control, control_empty, new_capacity);
+        m_entries = static_cast<Entry*>(kmalloc(new_capacity * sizeof(Entry)));
+        m_capacity = new_capacity;
+        m_size = 0;
+        m_deleted_count = 0;
+
+        for (size_t index = 0; index < old_capacity; ++index) {
+            if ((old_control[index] & 0x80) != 0)
+                continue;
+            auto& entry = old_entries[index];
+            insert_new_entry(move(entry.key), move(entry.value), KeyTraits::hash(entry.key));
+            entry.~Entry();
+        }
+        if (old_control) {
+            kfree_sized(old_control, old_capacity);
+            kfree_sized(old_entries, old_capacity * sizeof(Entry));
+        }
+    }
+
+    u8* m_control { nullptr };
+    Entry* m_entries { nullptr };
+    size_t m_capacity { 0 };
+    size_t m_size { 0 };
+    size_t m_deleted_count { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::FlatHashMap;
+#endif
@@ -6,9 +6,12 @@
 
 #include <AK/FlyString.h>
 #include <AK/HashMap.h>
+#include <AK/NumericLimits.h>
 #include <AK/Singleton.h>
 #include <AK/StringView.h>
 #include <AK/Utf8View.h>
+#include <AK/Vector.h>
+#include <AK/kmalloc.h>
 
 namespace AK {
 
@@ -18,6 +21,60 @@ static auto& all_fly_strings()
     return *table;
 }
 
+// Atom texts live for the lifetime of the process, so they are carved out of
+// bump-allocated chunks instead of being individually heap-allocated.
+class AtomArena {
+public:
+    StringView allocate_copy(StringView text)
+    {
+        auto* destination = allocate(text.length());
+        __builtin_memcpy(destination, text.characters_without_null_termination(), text.length());
+        return { destination, text.length() };
+    }
+
+private:
+    static constexpr size_t chunk_size = 64 * KiB;
+    static constexpr size_t allocation_alignment = 8;
+
+    char* allocate(size_t size)
+    {
+        // Oversized atoms get their own allocation instead of wasting arena space.
+        if (size > chunk_size / 4)
+            return static_cast<char*>(kmalloc(size));
+
+        auto aligned_size = align_up_to(size, allocation_alignment);
+        if (m_current_chunk_free < aligned_size) {
+            m_current_chunk = static_cast<char*>(kmalloc(chunk_size));
+            m_current_chunk_free = chunk_size;
+        }
+        auto* data = m_current_chunk;
+        m_current_chunk += aligned_size;
+        m_current_chunk_free -= aligned_size;
+        return data;
+    }
+
+    char* m_current_chunk { nullptr };
+    size_t m_current_chunk_free { 0 };
+};
+
+static auto& atom_arena()
+{
+    static Singleton<AtomArena> arena;
+    return *arena;
+}
+
+static auto& atoms_by_id()
+{
+    static Singleton<Vector<StringView>> atoms;
+    return *atoms;
+}
+
+static auto& atom_ids_by_text()
+{
+    static Singleton<HashMap<StringView, u32>> table;
+    return *table;
+}
+
 FlyString::FlyString()
     : m_data(String {}.to_fly_string_data({}))
 {
@@ -156,6 +213,32 @@ size_t FlyString::number_of_fly_strings()
     return all_fly_strings().size();
 }
 
+u32 FlyString::atom_id() const
+{
+    auto text = bytes_as_string_view();
+    if (auto existing_id = atom_ids_by_text().get(text); existing_id.has_value())
+        return *existing_id;
+
+    // The atom table outlives any particular FlyString, so it keeps its own
+    // arena-backed copy of the text.
+    auto interned_text = atom_arena().allocate_copy(text);
+    VERIFY(atoms_by_id().size() <= NumericLimits<u32>::max());
+    auto id = static_cast<u32>(atoms_by_id().size());
+    atoms_by_id().append(interned_text);
+    atom_ids_by_text().set(interned_text, id);
+    return id;
+}
+
+StringView FlyString::text_of_atom_id(u32 id)
+{
+    return atoms_by_id()[id];
+}
+
+size_t FlyString::number_of_atoms()
+{
+    return atoms_by_id().size();
+}
+
 unsigned Traits<FlyString>::hash(FlyString const& fly_string)
 {
     return fly_string.bytes_as_string_view().hash();
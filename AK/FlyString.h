@@ -47,8 +47,16 @@ public:
     static void did_destroy_fly_string_data(Badge<Detail::StringData>, StringView);
     [[nodiscard]] uintptr_t data(Badge<String>) const;
 
+    // A dense process-wide identifier for this string's text, for callers that
+    // only ever need identity comparison and want a 32-bit token instead of a
+    // FlyString (e.g. attribute name and CSS identifier tables). Atom IDs are
+    // never reused and their text stays alive for the lifetime of the process.
+    [[nodiscard]] u32 atom_id() const;
+    [[nodiscard]] static StringView text_of_atom_id(u32);
+
     // This is primarily interesting to unit tests.
     [[nodiscard]] static size_t number_of_fly_strings();
+    [[nodiscard]] static size_t number_of_atoms();
 
 private:
     // This will hold either the pointer to the Detail::StringData it represents or the raw bytes of
@@ -108,16 +108,23 @@ StringView FormatParser::consume_literal()
     auto const begin = tell();
 
     while (!is_eof()) {
+        // Everything up to the next brace is literal text, so skip ahead to it
+        // in one go instead of looking at every character.
+        auto brace_index = m_input.substring_view(tell()).find_any_of("{}"sv);
+        if (!brace_index.has_value()) {
+            m_index = m_input.length();
+            return m_input.substring_view(begin);
+        }
+        m_index += *brace_index;
+
         if (consume_specific("{{"))
             continue;
 
         if (consume_specific("}}"))
             continue;
 
-        if (next_is(is_any_of("{}"sv)))
-            return m_input.substring_view(begin, tell() - begin);
-
-        consume();
+        // An unescaped brace ends the literal.
+        return m_input.substring_view(begin, tell() - begin);
     }
 
     return m_input.substring_view(begin);
@@ -197,6 +204,11 @@ ErrorOr<void> FormatBuilder::put_padding(char fill, size_t amount)
 }
 ErrorOr<void> FormatBuilder::put_literal(StringView value)
 {
+    // The only braces the parser leaves in a literal are escaped ones, so
+    // a literal without braces can be appended wholesale.
+    if (!value.contains('{') && !value.contains('}'))
+        return m_builder.try_append(value);
+
     for (size_t i = 0; i < value.length(); ++i) {
         TRY(m_builder.try_append(value[i]));
         if (value[i] == '{' || value[i] == '}')
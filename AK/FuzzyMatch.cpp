@@ -128,6 +128,18 @@ static FuzzyMatchResult fuzzy_match_recursive(StringView needle, StringView hays
 // from its score. Therefore, the longer the needle/haystack the greater the range of scores could be.
 FuzzyMatchResult fuzzy_match(StringView needle, StringView haystack)
 {
+    // When filtering large lists, almost every haystack fails to match at
+    // all. A match requires the needle to appear in the haystack as a
+    // (case-folded) subsequence, which a single linear scan can rule out
+    // without any of the recursive scoring machinery.
+    size_t needle_idx = 0;
+    for (size_t haystack_idx = 0; haystack_idx < haystack.length() && needle_idx < needle.length(); ++haystack_idx) {
+        if (to_ascii_lowercase(needle[needle_idx]) == to_ascii_lowercase(haystack[haystack_idx]))
+            ++needle_idx;
+    }
+    if (needle_idx < needle.length())
+        return { false, 0 };
+
     int recursion_count = 0;
     u8 matches[MAX_MATCHES] {};
     return fuzzy_match_recursive(needle, haystack, 0, 0, nullptr, matches, 0, recursion_count);
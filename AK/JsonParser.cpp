@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/CharacterTypes.h>
+#include <AK/Endian.h>
 #include <AK/FloatingPointStringConversions.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
@@ -18,6 +20,21 @@ constexpr bool is_space(int ch)
     return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
 }
 
+// Returns a word with the high bit set in every byte that is '"', '\' or a
+// C0 control, i.e. every byte that ends a run of plain string characters.
+// (SWAR "hasvalue"/"hasless" from the usual bit twiddling hacks.)
+static constexpr u64 string_scan_mask(u64 word)
+{
+    constexpr u64 ones = 0x0101010101010101ull;
+    constexpr u64 highs = 0x8080808080808080ull;
+    auto has_value = [&](u64 value) {
+        u64 xored = word ^ (ones * value);
+        return (xored - ones) & ~xored & highs;
+    };
+    u64 controls = (word - ones * 0x20) & ~word & highs;
+    return has_value('"') | has_value('\\') | controls;
+}
+
 ErrorOr<DeprecatedString> JsonParser::consume_and_unescape_string()
 {
     if (!consume_specific('"'))
@@ -27,6 +44,21 @@ ErrorOr<DeprecatedString> JsonParser::consume_and_unescape_string()
     for (;;) {
         size_t peek_index = m_index;
         char ch = 0;
+
+        // Scan for the end of the plain character run a word at a time; only
+        // '"', '\' and (invalid) control characters need a closer look.
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        while (peek_index + sizeof(u64) <= m_input.length()) {
+            u64 word;
+            __builtin_memcpy(&word, m_input.characters_without_null_termination() + peek_index, sizeof(word));
+            u64 mask = string_scan_mask(word);
+            if (mask != 0) {
+                peek_index += count_trailing_zeroes(mask) / 8;
+                break;
+            }
+            peek_index += sizeof(u64);
+        }
+#endif
         for (;;) {
             if (peek_index == m_input.length())
                 break;
@@ -38,19 +70,24 @@ ErrorOr<DeprecatedString> JsonParser::consume_and_unescape_string()
             ++peek_index;
         }
 
-        while (peek_index != m_index) {
-            final_sb.append(m_input[m_index]);
-            m_index++;
-        }
+        auto plain_run = m_input.substring_view(m_index, peek_index - m_index);
+        m_index = peek_index;
 
-        if (m_index == m_input.length())
+        if (m_index == m_input.length()) {
+            final_sb.append(plain_run);
             break;
-        if (ch == '"')
+        }
+        if (ch == '"') {
+            // Common case: the whole string is one run of plain characters.
+            if (final_sb.is_empty()) {
+                if (!consume_specific('"'))
+                    return Error::from_string_literal("JsonParser: Expected '\"'");
+                return DeprecatedString { plain_run };
+            }
+            final_sb.append(plain_run);
             break;
-        if (ch != '\\') {
-            final_sb.append(consume());
-            continue;
         }
+        final_sb.append(plain_run);
         ignore();
         if (next_is('"')) {
             ignore();
@@ -188,13 +225,10 @@ ErrorOr<JsonValue> JsonParser::parse_string()
 
 ErrorOr<JsonValue> JsonParser::parse_number()
 {
-    Vector<char, 32> number_buffer;
-
     auto start_index = tell();
 
     bool negative = false;
     if (peek() == '-') {
-        number_buffer.append('-');
         ++m_index;
         negative = true;
 
@@ -256,7 +290,6 @@ ErrorOr<JsonValue> JsonParser::parse_number()
             if (ch != '0')
                 all_zero = false;
 
-            number_buffer.append(ch);
             ++m_index;
             continue;
         }
@@ -268,7 +301,7 @@ ErrorOr<JsonValue> JsonParser::parse_number()
     if (negative && all_zero)
         return JsonValue(-0.0);
 
-    StringView number_string(number_buffer.data(), number_buffer.size());
+    auto number_string = m_input.substring_view(start_index, tell() - start_index);
 
     auto to_unsigned_result = number_string.to_uint<u64>();
     if (to_unsigned_result.has_value()) {
@@ -15,9 +15,55 @@
 #    include <string.h>
 #endif
 
+#if ARCH(X86_64) && !defined(KERNEL)
+namespace AK::Detail {
+
+inline bool cpu_supports_avx2()
+{
+    static bool const supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+__attribute__((target("avx2"))) inline void fast_u32_copy_avx2(u32* dest, u32 const* src, size_t count)
+{
+    while (count >= 8) {
+        u32 __attribute__((vector_size(32))) chunk;
+        __builtin_memcpy(&chunk, src, sizeof(chunk));
+        __builtin_memcpy(dest, &chunk, sizeof(chunk));
+        dest += 8;
+        src += 8;
+        count -= 8;
+    }
+    while (count > 0) {
+        *dest++ = *src++;
+        --count;
+    }
+}
+
+__attribute__((target("avx2"))) inline void fast_u32_fill_avx2(u32* dest, u32 value, size_t count)
+{
+    u32 __attribute__((vector_size(32))) const splat = { value, value, value, value, value, value, value, value };
+    while (count >= 8) {
+        __builtin_memcpy(dest, &splat, sizeof(splat));
+        dest += 8;
+        count -= 8;
+    }
+    while (count > 0) {
+        *dest++ = value;
+        --count;
+    }
+}
+
+}
+#endif
+
 ALWAYS_INLINE void fast_u32_copy(u32* dest, u32 const* src, size_t count)
 {
 #if ARCH(X86_64)
+#    if !defined(KERNEL)
+    if (count >= 16 && AK::Detail::cpu_supports_avx2())
+        return AK::Detail::fast_u32_copy_avx2(dest, src, count);
+#    endif
     asm volatile(
         "rep movsl\n"
         : "+S"(src), "+D"(dest), "+c"(count)::"memory");
@@ -29,6 +75,10 @@ ALWAYS_INLINE void fast_u32_copy(u32* dest, u32 const* src, size_t count)
 ALWAYS_INLINE void fast_u32_fill(u32* dest, u32 value, size_t count)
 {
 #if ARCH(X86_64)
+#    if !defined(KERNEL)
+    if (count >= 16 && AK::Detail::cpu_supports_avx2())
+        return AK::Detail::fast_u32_fill_avx2(dest, value, count);
+#    endif
     asm volatile(
         "rep stosl\n"
         : "=D"(dest), "=c"(count)
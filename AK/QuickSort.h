@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/InsertionSort.h>
 #include <AK/StdLibExtras.h>
 
@@ -22,11 +23,61 @@ namespace AK {
 // The value 7 here is a magic number. According to princeton's CS algorithm class
 // a value between 5 and 15 should work well in most situations:
 // https://algs4.cs.princeton.edu/23quicksort/
+//
+// As a pattern-defeating measure, both quick sorts fall back to heap sort once
+// the partitioning depth exceeds 2*log2(n). Inputs crafted (or unlucky enough)
+// to keep producing lopsided partitions therefore degrade to O(n log n)
+// instead of O(n^2), while well-behaved inputs never hit the fallback.
 
 static constexpr int INSERTION_SORT_CUTOFF = 7;
 
+namespace Detail {
+
 template<typename Collection, typename LessThan>
-void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_than)
+void sift_down(Collection& col, int start, int end, int root, LessThan& less_than)
+{
+    for (;;) {
+        int child = start + 2 * (root - start) + 1;
+        if (child > end)
+            return;
+        if (child < end && less_than(col[child], col[child + 1]))
+            ++child;
+        if (!less_than(col[root], col[child]))
+            return;
+        swap(col[root], col[child]);
+        root = child;
+    }
+}
+
+template<typename Collection, typename LessThan>
+void heap_sort(Collection& col, int start, int end, LessThan& less_than)
+{
+    for (int root = start + (end - start - 1) / 2; root >= start; --root)
+        sift_down(col, start, end, root, less_than);
+    for (int last = end; last > start; --last) {
+        swap(col[start], col[last]);
+        sift_down(col, start, last - 1, start, less_than);
+    }
+}
+
+// Allows the iterator-based quick sort to share the heap sort fallback.
+template<typename Iterator>
+struct IteratorPseudoCollection {
+    Iterator base;
+    decltype(auto) operator[](int index) const { return *(base + index); }
+};
+
+inline int depth_limit_for_size(int size)
+{
+    if (size <= 1)
+        return 0;
+    return 2 * (static_cast<int>(8 * sizeof(unsigned)) - count_leading_zeroes(static_cast<unsigned>(size)));
+}
+
+}
+
+template<typename Collection, typename LessThan>
+void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_than, int depth_limit)
 {
     if ((end + 1) - start <= INSERTION_SORT_CUTOFF) {
         AK::insertion_sort(col, start, end, less_than);
@@ -34,6 +85,10 @@ void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_th
     }
 
     while (start < end) {
+        if (depth_limit-- == 0) {
+            Detail::heap_sort(col, start, end, less_than);
+            return;
+        }
         int size = end - start + 1;
         if (size > 3) {
             int third = size / 3;
@@ -88,30 +143,42 @@ void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_th
         int right_size = (end + 1) - (right_pointer + 1);
 
         if (left_size >= middle_size && left_size >= right_size) {
-            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than);
-            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than);
+            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than, depth_limit);
+            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than, depth_limit);
             end = left_pointer - 1;
         } else if (middle_size >= right_size) {
-            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than);
-            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than);
+            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than, depth_limit);
+            dual_pivot_quick_sort(col, right_pointer + 1, end, less_than, depth_limit);
             start = left_pointer + 1;
             end = right_pointer - 1;
         } else {
-            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than);
-            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than);
+            dual_pivot_quick_sort(col, start, left_pointer - 1, less_than, depth_limit);
+            dual_pivot_quick_sort(col, left_pointer + 1, right_pointer - 1, less_than, depth_limit);
             start = right_pointer + 1;
         }
     }
 }
 
+template<typename Collection, typename LessThan>
+void dual_pivot_quick_sort(Collection& col, int start, int end, LessThan less_than)
+{
+    dual_pivot_quick_sort(col, start, end, move(less_than), Detail::depth_limit_for_size((end + 1) - start));
+}
+
 template<typename Iterator, typename LessThan>
-void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than)
+void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than, int depth_limit)
 {
     for (;;) {
         int size = end - start;
         if (size <= 1)
             return;
 
+        if (depth_limit-- == 0) {
+            Detail::IteratorPseudoCollection<Iterator> col { start };
+            Detail::heap_sort(col, 0, size - 1, less_than);
+            return;
+        }
+
         int pivot_point = size / 2;
         if (pivot_point)
             swap(*(start + pivot_point), *start);
@@ -130,15 +197,21 @@ void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than)
         // Recur into the shorter part of the remaining data
         // to ensure a stack depth of at most log(n).
         if (i > size / 2) {
-            single_pivot_quick_sort(start + i, end, less_than);
+            single_pivot_quick_sort(start + i, end, less_than, depth_limit);
             end = start + i - 1;
         } else {
-            single_pivot_quick_sort(start, start + i - 1, less_than);
+            single_pivot_quick_sort(start, start + i - 1, less_than, depth_limit);
             start = start + i;
         }
     }
 }
 
+template<typename Iterator, typename LessThan>
+void single_pivot_quick_sort(Iterator start, Iterator end, LessThan less_than)
+{
+    single_pivot_quick_sort(start, end, move(less_than), Detail::depth_limit_for_size(end - start));
+}
+
 template<typename Iterator>
 void quick_sort(Iterator start, Iterator end)
 {
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Span.h>
+
+namespace AK {
+
+// A refcounted byte buffer whose copies and slices all share one underlying
+// allocation, so passing data down a pipeline (network chunk -> decompressor
+// -> IPC payload) never duplicates it. Reading is always cheap; mutation has
+// to be requested explicitly with ensure_unique(), which copies the viewed
+// bytes only if the storage is actually shared.
+//
+// Like the rest of AK's RefCounted types, the reference count is not atomic,
+// so handles to the same storage must stay on one thread.
+class SharedByteBuffer {
+public:
+    SharedByteBuffer() = default;
+
+    // Takes over the ByteBuffer's storage without copying it.
+    static SharedByteBuffer adopt(ByteBuffer buffer)
+    {
+        SharedByteBuffer shared_buffer;
+        if (buffer.is_empty())
+            return shared_buffer;
+        auto impl = adopt_ref_if_nonnull(new (nothrow) Impl(move(buffer)));
+        if (!impl)
+            return shared_buffer;
+        shared_buffer.m_size = impl->buffer.size();
+        shared_buffer.m_impl = move(impl);
+        return shared_buffer;
+    }
+
+    static ErrorOr<SharedByteBuffer> copy(ReadonlyBytes bytes)
+    {
+        return adopt(TRY(ByteBuffer::copy(bytes)));
+    }
+
+    [[nodiscard]] u8 const* data() const { return m_impl ? m_impl->buffer.data() + m_offset : nullptr; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] ReadonlyBytes bytes() const { return { data(), size() }; }
+
+    u8 const& operator[](size_t index) const
+    {
+        VERIFY(index < m_size);
+        return data()[index];
+    }
+
+    // Returns a view of the given range that shares this buffer's storage.
+    [[nodiscard]] SharedByteBuffer slice(size_t offset, size_t size) const
+    {
+        VERIFY(offset + size <= m_size);
+        SharedByteBuffer sliced;
+        if (size == 0)
+            return sliced;
+        sliced.m_impl = m_impl;
+        sliced.m_offset = m_offset + offset;
+        sliced.m_size = size;
+        return sliced;
+    }
+
+    // After this returns successfully, the storage is not shared with any
+    // other handle and mutable_bytes() may be used freely.
+    ErrorOr<void> ensure_unique()
+    {
+        if (!m_impl)
+            return {};
+        if (m_impl->ref_count() == 1 && m_offset == 0 && m_size == m_impl->buffer.size())
+            return {};
+        *this = TRY(copy(bytes()));
+        return {};
+    }
+
+    [[nodiscard]] Bytes mutable_bytes()
+    {
+        if (!m_impl)
+            return {};
+        VERIFY(m_impl->ref_count() == 1);
+        return { m_impl->buffer.data() + m_offset, m_size };
+    }
+
+    ErrorOr<ByteBuffer> to_byte_buffer() const
+    {
+        return ByteBuffer::copy(bytes());
+    }
+
+private:
+    struct Impl : public RefCounted<Impl> {
+        explicit Impl(ByteBuffer buffer)
+            : buffer(move(buffer))
+        {
+        }
+
+        ByteBuffer buffer;
+    };
+
+    RefPtr<Impl> m_impl;
+    size_t m_offset { 0 };
+    size_t m_size { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::SharedByteBuffer;
+#endif
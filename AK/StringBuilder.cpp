@@ -65,9 +65,11 @@ ErrorOr<void> StringBuilder::try_append(char ch)
 
 ErrorOr<void> StringBuilder::try_append_repeated(char ch, size_t n)
 {
+    if (n == 0)
+        return {};
     TRY(will_append(n));
-    for (size_t i = 0; i < n; ++i)
-        TRY(try_append(ch));
+    auto bytes = TRY(m_buffer.get_bytes_for_writing(n));
+    __builtin_memset(bytes.data(), ch, n);
     return {};
 }
 
@@ -104,12 +106,17 @@ void StringBuilder::append_repeated(char ch, size_t n)
     MUST(try_append_repeated(ch, n));
 }
 
-ByteBuffer StringBuilder::to_byte_buffer() const
+ByteBuffer StringBuilder::to_byte_buffer() const&
 {
     // FIXME: Handle OOM failure.
     return ByteBuffer::copy(data(), length()).release_value_but_fixme_should_propagate_errors();
 }
 
+ByteBuffer StringBuilder::to_byte_buffer() &&
+{
+    return ByteBuffer { move(m_buffer) };
+}
+
 #ifndef KERNEL
 DeprecatedString StringBuilder::to_deprecated_string() const
 {
@@ -131,7 +138,7 @@ StringView StringBuilder::string_view() const
 
 void StringBuilder::clear()
 {
-    m_buffer.clear();
+    m_buffer.clear_with_capacity();
 }
 
 ErrorOr<void> StringBuilder::try_append_code_point(u32 code_point)
@@ -67,9 +67,14 @@ public:
 
     ErrorOr<String> to_string() const;
 
-    [[nodiscard]] ByteBuffer to_byte_buffer() const;
+    [[nodiscard]] ByteBuffer to_byte_buffer() const&;
+    // Hands over the internal buffer without copying; the builder is left
+    // empty, as if freshly constructed.
+    [[nodiscard]] ByteBuffer to_byte_buffer() &&;
 
     [[nodiscard]] StringView string_view() const;
+    // Keeps the allocated capacity around, so a builder can be reused in a
+    // loop without growing its buffer from scratch every iteration.
     void clear();
 
     [[nodiscard]] size_t length() const { return m_buffer.size(); }
@@ -48,5 +48,6 @@ constexpr u32 case_insensitive_string_hash(char const* characters, size_t length
 }
 
 #if USING_AK_GLOBALLY
+using AK::case_insensitive_string_hash;
 using AK::string_hash;
 #endif
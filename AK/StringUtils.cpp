@@ -258,6 +258,10 @@ bool equals_ignoring_case(StringView a, StringView b)
 {
     if (a.length() != b.length())
         return false;
+    // Most strings compared this way actually match exactly, and memcmp
+    // bails on the first differing byte, so it's a cheap fast path.
+    if (!memcmp(a.characters_without_null_termination(), b.characters_without_null_termination(), a.length()))
+        return true;
     for (size_t i = 0; i < a.length(); ++i) {
         if (to_ascii_lowercase(a.characters_without_null_termination()[i]) != to_ascii_lowercase(b.characters_without_null_termination()[i]))
             return false;
@@ -324,19 +328,24 @@ bool contains(StringView str, StringView needle, CaseSensitivity case_sensitivit
     if (case_sensitivity == CaseSensitivity::CaseSensitive)
         return memmem(str_chars, str.length(), needle_chars, needle.length()) != nullptr;
 
-    auto needle_first = to_ascii_lowercase(needle_chars[0]);
-    for (size_t si = 0; si < str.length(); si++) {
-        if (to_ascii_lowercase(str_chars[si]) != needle_first)
+    // Fold the needle once up front so the search only lowercases one side
+    // per comparison, and skip non-candidate positions on a raw two-variant
+    // first-byte check that doesn't fold the haystack at all.
+    Vector<u8, 64> folded_needle;
+    folded_needle.ensure_capacity(needle.length());
+    for (size_t i = 0; i < needle.length(); ++i)
+        folded_needle.unchecked_append(to_ascii_lowercase(static_cast<u8>(needle_chars[i])));
+
+    auto needle_first_lower = static_cast<char>(folded_needle[0]);
+    auto needle_first_upper = static_cast<char>(to_ascii_uppercase(static_cast<u8>(needle_chars[0])));
+    for (size_t si = 0; si + needle.length() <= str.length(); si++) {
+        if (str_chars[si] != needle_first_lower && str_chars[si] != needle_first_upper)
             continue;
-        for (size_t ni = 0; si + ni < str.length(); ni++) {
-            if (to_ascii_lowercase(str_chars[si + ni]) != to_ascii_lowercase(needle_chars[ni])) {
-                if (ni > 0)
-                    si += ni - 1;
-                break;
-            }
-            if (ni + 1 == needle.length())
-                return true;
-        }
+        size_t ni = 1;
+        while (ni < needle.length() && to_ascii_lowercase(static_cast<u8>(str_chars[si + ni])) == folded_needle[ni])
+            ni++;
+        if (ni == needle.length())
+            return true;
     }
     return false;
 }
@@ -586,7 +595,7 @@ size_t count(StringView str, StringView needle)
         return str.length();
 
     size_t count = 0;
-    for (size_t i = 0; i < str.length() - needle.length() + 1; ++i) {
+    for (size_t i = 0; i + needle.length() <= str.length(); ++i) {
         if (str.substring_view(i).starts_with(needle))
             count++;
     }
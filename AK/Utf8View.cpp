@@ -9,6 +9,7 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/Format.h>
+#include <AK/SIMD.h>
 #include <AK/Utf8View.h>
 
 namespace AK {
@@ -103,10 +104,42 @@ static inline bool decode_first_byte(
     return false;
 }
 
+// Returns the length of the longest ASCII-only prefix of the given bytes.
+// This looks at the input 16 bytes at a time, so that validation and length
+// calculation can step over runs of ASCII text instead of taking several
+// branches for every single character.
+static size_t length_of_ascii_prefix(u8 const* bytes, size_t length)
+{
+    using AK::SIMD::u8x16;
+
+    size_t offset = 0;
+    for (; offset + sizeof(u8x16) <= length; offset += sizeof(u8x16)) {
+        u8x16 chunk;
+        __builtin_memcpy(&chunk, bytes + offset, sizeof(chunk));
+        u64 chunk_halves[2];
+        __builtin_memcpy(chunk_halves, &chunk, sizeof(chunk_halves));
+        if ((chunk_halves[0] | chunk_halves[1]) & 0x8080808080808080ULL)
+            break;
+    }
+    for (; offset < length; ++offset) {
+        if (bytes[offset] & 0x80)
+            break;
+    }
+    return offset;
+}
+
 bool Utf8View::validate(size_t& valid_bytes) const
 {
     valid_bytes = 0;
-    for (auto ptr = begin_ptr(); ptr < end_ptr(); ptr++) {
+    auto ptr = begin_ptr();
+    while (ptr < end_ptr()) {
+        // Runs of ASCII bytes are always valid and can be skipped in bulk.
+        size_t ascii_run_length = length_of_ascii_prefix(ptr, end_ptr() - ptr);
+        ptr += ascii_run_length;
+        valid_bytes += ascii_run_length;
+        if (ptr >= end_ptr())
+            break;
+
         size_t code_point_length_in_bytes = 0;
         u32 code_point = 0;
         bool first_byte_makes_sense = decode_first_byte(*ptr, code_point_length_in_bytes, code_point);
@@ -128,6 +161,7 @@ bool Utf8View::validate(size_t& valid_bytes) const
             return false;
 
         valid_bytes += code_point_length_in_bytes;
+        ptr++;
     }
 
     return true;
@@ -136,7 +170,18 @@ bool Utf8View::validate(size_t& valid_bytes) const
 size_t Utf8View::calculate_length() const
 {
     size_t length = 0;
-    for ([[maybe_unused]] auto code_point : *this) {
+    for (size_t offset = 0; offset < m_string.length();) {
+        // Each byte in a run of ASCII text is exactly one code point.
+        size_t ascii_run_length = length_of_ascii_prefix(begin_ptr() + offset, m_string.length() - offset);
+        length += ascii_run_length;
+        offset += ascii_run_length;
+        if (offset >= m_string.length())
+            break;
+
+        // NOTE: Like the code point iterator, this treats each byte of an
+        //       invalid sequence as a separate (replacement) code point.
+        Utf8CodePointIterator iterator { begin_ptr() + offset, m_string.length() - offset };
+        offset += iterator.underlying_code_point_length_in_bytes();
         ++length;
     }
     return length;
@@ -114,4 +114,14 @@ ALWAYS_INLINE int fb_flush_head(int fd)
     return ioctl(fd, GRAPHICS_IOCTL_FLUSH_HEAD, nullptr);
 }
 
+ALWAYS_INLINE int graphics_connector_set_hardware_cursor_bitmap(int fd, GraphicsHardwareCursorBitmap* cursor_bitmap)
+{
+    return ioctl(fd, GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP, cursor_bitmap);
+}
+
+ALWAYS_INLINE int graphics_connector_set_hardware_cursor_position(int fd, GraphicsHardwareCursorPosition* cursor_position)
+{
+    return ioctl(fd, GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION, cursor_position);
+}
+
 __END_DECLS
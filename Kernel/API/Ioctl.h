@@ -24,6 +24,7 @@ struct GraphicsConnectorProperties {
     unsigned char flushing_support;
     unsigned char partial_flushing_support;
     unsigned char refresh_rate_support;
+    unsigned char hardware_cursor_support;
     unsigned max_buffer_bytes;
 };
 
@@ -60,6 +61,20 @@ struct FBRect {
     unsigned height;
 };
 
+struct GraphicsHardwareCursorBitmap {
+    int enabled;
+    unsigned width;
+    unsigned height;
+    unsigned hotspot_x;
+    unsigned hotspot_y;
+    unsigned const* argb_pixels;
+};
+
+struct GraphicsHardwareCursorPosition {
+    int x;
+    int y;
+};
+
 struct FBBufferOffset {
     int buffer_index;
     unsigned offset;
@@ -104,6 +119,8 @@ enum IOCtlNumber {
     GRAPHICS_IOCTL_SET_SAFE_HEAD_MODE_SETTING,
     GRAPHICS_IOCTL_SET_RESPONSIBLE,
     GRAPHICS_IOCTL_UNSET_RESPONSIBLE,
+    GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP,
+    GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION,
     KEYBOARD_IOCTL_GET_NUM_LOCK,
     KEYBOARD_IOCTL_SET_NUM_LOCK,
     KEYBOARD_IOCTL_GET_CAPS_LOCK,
@@ -134,6 +151,9 @@ enum IOCtlNumber {
     SOUNDCARD_IOCTL_GET_SAMPLE_RATE,
     STORAGE_DEVICE_GET_SIZE,
     STORAGE_DEVICE_GET_BLOCK_SIZE,
+    STORAGE_DEVICE_CREATE_SNAPSHOT_LAYER,
+    SNAPSHOT_LAYER_TAKE_SNAPSHOT,
+    SNAPSHOT_LAYER_RELEASE_SNAPSHOT,
     VIRGL_IOCTL_CREATE_CONTEXT,
     VIRGL_IOCTL_CREATE_RESOURCE,
     VIRGL_IOCTL_SUBMIT_CMD,
@@ -165,6 +185,8 @@ enum IOCtlNumber {
 #define GRAPHICS_IOCTL_SET_SAFE_HEAD_MODE_SETTING GRAPHICS_IOCTL_SET_SAFE_HEAD_MODE_SETTING
 #define GRAPHICS_IOCTL_SET_RESPONSIBLE GRAPHICS_IOCTL_SET_RESPONSIBLE
 #define GRAPHICS_IOCTL_UNSET_RESPONSIBLE GRAPHICS_IOCTL_UNSET_RESPONSIBLE
+#define GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP
+#define GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION
 #define KEYBOARD_IOCTL_GET_NUM_LOCK KEYBOARD_IOCTL_GET_NUM_LOCK
 #define KEYBOARD_IOCTL_SET_NUM_LOCK KEYBOARD_IOCTL_SET_NUM_LOCK
 #define KEYBOARD_IOCTL_GET_CAPS_LOCK KEYBOARD_IOCTL_GET_CAPS_LOCK
@@ -190,6 +212,9 @@ enum IOCtlNumber {
 #define SOUNDCARD_IOCTL_GET_SAMPLE_RATE SOUNDCARD_IOCTL_GET_SAMPLE_RATE
 #define STORAGE_DEVICE_GET_SIZE STORAGE_DEVICE_GET_SIZE
 #define STORAGE_DEVICE_GET_BLOCK_SIZE STORAGE_DEVICE_GET_BLOCK_SIZE
+#define STORAGE_DEVICE_CREATE_SNAPSHOT_LAYER STORAGE_DEVICE_CREATE_SNAPSHOT_LAYER
+#define SNAPSHOT_LAYER_TAKE_SNAPSHOT SNAPSHOT_LAYER_TAKE_SNAPSHOT
+#define SNAPSHOT_LAYER_RELEASE_SNAPSHOT SNAPSHOT_LAYER_RELEASE_SNAPSHOT
 #define VIRGL_IOCTL_CREATE_CONTEXT VIRGL_IOCTL_CREATE_CONTEXT
 #define VIRGL_IOCTL_CREATE_RESOURCE VIRGL_IOCTL_CREATE_RESOURCE
 #define VIRGL_IOCTL_SUBMIT_CMD VIRGL_IOCTL_SUBMIT_CMD
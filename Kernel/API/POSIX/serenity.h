@@ -37,6 +37,29 @@ enum {
 
 #define PERF_EVENT_MASK_ALL (~0ull)
 
+#define BATCH_IO_READ 0
+#define BATCH_IO_WRITE 1
+
+struct batch_io_op {
+    int fd;
+    uint16_t opcode;
+    uint16_t flags;
+    void* buffer;
+    size_t buffer_size;
+    ssize_t result;
+};
+
+struct stat;
+
+struct stat_batch_op {
+    const char* path;
+    size_t path_length;
+    int dirfd;
+    int follow_symlinks;
+    struct stat* statbuf;
+    ssize_t result;
+};
+
 #define THREAD_PRIORITY_MIN 1
 #define THREAD_PRIORITY_LOW 10
 #define THREAD_PRIORITY_NORMAL 30
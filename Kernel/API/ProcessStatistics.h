@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+// Fixed-layout binary process statistics, exposed by /sys/kernel/processes_stats.
+//
+// The file starts with a ProcessStatisticsHeader, followed by process_count
+// ProcessStatisticsProcess records, each immediately followed by its own
+// thread_count ProcessStatisticsThread records. All strings are NUL-terminated
+// and silently truncated to fit their fixed-size fields.
+//
+// Readers must reject any file whose version field doesn't match
+// PROCESS_STATISTICS_VERSION exactly; the layout below is not otherwise
+// negotiated. Bump the version whenever any of these structs change.
+
+#define PROCESS_STATISTICS_VERSION 1
+
+enum class ProcessStatisticsVeilState : u8 {
+    None = 0,
+    Dropped = 1,
+    Locked = 2,
+};
+
+struct [[gnu::packed]] ProcessStatisticsHeader {
+    u32 version;
+    u32 process_count;
+    u64 total_time_scheduled;
+    u64 total_time_scheduled_kernel;
+};
+
+struct [[gnu::packed]] ProcessStatisticsThread {
+    i32 tid;
+    u32 times_scheduled;
+    u32 cpu;
+    u32 priority;
+    u32 syscall_count;
+    u32 inode_faults;
+    u32 zero_faults;
+    u32 cow_faults;
+    u64 time_user;
+    u64 time_kernel;
+    u64 unix_socket_read_bytes;
+    u64 unix_socket_write_bytes;
+    u64 ipv4_socket_read_bytes;
+    u64 ipv4_socket_write_bytes;
+    u64 file_read_bytes;
+    u64 file_write_bytes;
+    char name[64];
+    char state[32];
+};
+
+struct [[gnu::packed]] ProcessStatisticsProcess {
+    i32 pid;
+    i32 pgid;
+    i32 pgp;
+    i32 sid;
+    u32 uid;
+    u32 gid;
+    i32 ppid;
+    u32 nfds;
+    u8 kernel;
+    u8 dumpable;
+    ProcessStatisticsVeilState veil;
+    u8 unused { 0 };
+    u32 thread_count;
+    u64 amount_virtual;
+    u64 amount_resident;
+    u64 amount_dirty_private;
+    u64 amount_clean_inode;
+    u64 amount_shared;
+    u64 amount_purgeable_volatile;
+    u64 amount_purgeable_nonvolatile;
+    char name[64];
+    char executable[128];
+    char tty[32];
+    char pledge[256];
+};
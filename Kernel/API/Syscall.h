@@ -15,7 +15,9 @@
 constexpr int syscall_vector = 0x82;
 
 extern "C" {
+struct batch_io_op;
 struct pollfd;
+struct stat_batch_op;
 struct timeval;
 struct timespec;
 struct sockaddr;
@@ -48,6 +50,8 @@ enum class NeedsBigProcessLock {
     S(allocate_tls, NeedsBigProcessLock::Yes)               \
     S(anon_create, NeedsBigProcessLock::No)                 \
     S(annotate_mapping, NeedsBigProcessLock::No)            \
+    S(batch_io, NeedsBigProcessLock::Yes)                   \
+    S(batch_stat, NeedsBigProcessLock::No)                  \
     S(beep, NeedsBigProcessLock::No)                        \
     S(bind, NeedsBigProcessLock::No)                        \
     S(chdir, NeedsBigProcessLock::No)                       \
@@ -82,6 +86,7 @@ enum class NeedsBigProcessLock {
     S(ftruncate, NeedsBigProcessLock::No)                   \
     S(futex, NeedsBigProcessLock::Yes)                      \
     S(get_dir_entries, NeedsBigProcessLock::Yes)            \
+    S(get_dir_entries_stat, NeedsBigProcessLock::Yes)       \
     S(get_process_name, NeedsBigProcessLock::No)            \
     S(get_root_session_id, NeedsBigProcessLock::No)         \
     S(get_stack_bounds, NeedsBigProcessLock::No)            \
@@ -154,6 +159,7 @@ enum class NeedsBigProcessLock {
     S(scheduler_get_parameters, NeedsBigProcessLock::No)    \
     S(scheduler_set_parameters, NeedsBigProcessLock::No)    \
     S(sendfd, NeedsBigProcessLock::No)                      \
+    S(sendfile, NeedsBigProcessLock::Yes)                   \
     S(sendmsg, NeedsBigProcessLock::Yes)                    \
     S(set_coredump_metadata, NeedsBigProcessLock::No)       \
     S(set_mmap_name, NeedsBigProcessLock::Yes)              \
@@ -255,6 +261,16 @@ struct SC_open_params {
     u16 mode;
 };
 
+struct SC_batch_io_params {
+    struct batch_io_op* ops;
+    unsigned op_count;
+};
+
+struct SC_batch_stat_params {
+    struct stat_batch_op* ops;
+    unsigned op_count;
+};
+
 struct SC_poll_params {
     struct pollfd* fds;
     unsigned nfds;
@@ -9,6 +9,7 @@
 namespace Kernel {
 
 enum class ProcessorSpecificDataID {
+    Kmalloc,
     MemoryManager,
     __Count,
 };
@@ -1009,7 +1009,7 @@ void Processor::flush_tlb_local(VirtualAddress vaddr, size_t page_count)
 
 void Processor::flush_tlb(Memory::PageDirectory const* page_directory, VirtualAddress vaddr, size_t page_count)
 {
-    if (s_smp_enabled && (!Memory::is_user_address(vaddr) || Process::current().thread_count() > 1))
+    if (s_smp_enabled)
         smp_broadcast_flush_tlb(page_directory, vaddr, page_count);
     else
         flush_tlb_local(vaddr, page_count);
@@ -1311,13 +1311,54 @@ void Processor::smp_unicast(u32 cpu, Function<void()> callback, bool async)
 
 void Processor::smp_broadcast_flush_tlb(Memory::PageDirectory const* page_directory, VirtualAddress vaddr, size_t page_count)
 {
+    auto& current_processor = Processor::current();
+
+    // A processor that isn't currently in the target address space cannot
+    // hold stale TLB entries for a user range: the CR3 load on its way in
+    // flushes its TLB wholesale. So for user ranges it is enough to interrupt
+    // the processors whose CR3 matches the page directory, which spares
+    // everyone else the IPI. Kernel ranges are mapped in every address space
+    // and still go to all processors.
+    // NOTE: The full barrier orders our page table updates before sampling
+    //       the CR3 shadows; see Processor::set_current_cr3() for the other
+    //       side of this bargain.
+    u32 target_count = 0;
+    u64 target_mask = 0;
+    static_assert(MAX_CPU_COUNT <= 64);
+    bool is_user_range = Memory::is_user_address(vaddr);
+    if (is_user_range) {
+        AK::full_memory_barrier();
+        for_each([&](Processor& proc) {
+            if (&proc == &current_processor)
+                return;
+            if (proc.current_cr3() == page_directory->cr3()) {
+                target_mask |= 1ull << proc.id();
+                target_count++;
+            }
+        });
+        if (target_count == 0) {
+            flush_tlb_local(vaddr, page_count);
+            return;
+        }
+    }
+
     auto& msg = smp_get_from_pool();
     msg.async = false;
     msg.type = ProcessorMessage::FlushTlb;
     msg.flush_tlb.page_directory = page_directory;
     msg.flush_tlb.ptr = vaddr.as_ptr();
     msg.flush_tlb.page_count = page_count;
-    smp_broadcast_message(msg);
+    if (is_user_range) {
+        msg.refs.store(target_count, AK::MemoryOrder::memory_order_release);
+        for_each([&](Processor& proc) {
+            if (!(target_mask & (1ull << proc.id())))
+                return;
+            if (proc.smp_enqueue_message(msg))
+                APIC::the().send_ipi(proc.id());
+        });
+    } else {
+        smp_broadcast_message(msg);
+    }
     // While the other processors handle this request, we'll flush ours
     flush_tlb_local(vaddr, page_count);
     // Now wait until everybody is done as well
@@ -1546,8 +1587,10 @@ extern "C" void enter_thread_context(Thread* from_thread, Thread* to_thread)
     MSR fs_base_msr(MSR_FS_BASE);
     fs_base_msr.set(to_thread->thread_specific_data().get());
 
-    if (from_regs.cr3 != to_regs.cr3)
+    if (from_regs.cr3 != to_regs.cr3) {
+        Processor::set_current_cr3(to_regs.cr3);
         write_cr3(to_regs.cr3);
+    }
 
     to_thread->set_cpu(processor.id());
 
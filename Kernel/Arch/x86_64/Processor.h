@@ -94,6 +94,12 @@ class Processor {
     Thread* m_current_thread;
     Thread* m_idle_thread;
 
+    // Shadow of this processor's CR3, used to target TLB shootdowns at the
+    // processors that are actually in the affected address space. Zero until
+    // the first tracked CR3 load (i.e. while still on the boot-time kernel
+    // page tables).
+    Atomic<FlatPtr> m_current_cr3 { 0 };
+
     Atomic<ProcessorMessageEntry*> m_message_queue;
 
     bool m_invoke_scheduler_async;
@@ -317,6 +323,22 @@ public:
         return Processor::current_id() == 0;
     }
 
+    ALWAYS_INLINE FlatPtr current_cr3() const
+    {
+        return m_current_cr3.load(AK::MemoryOrder::memory_order_relaxed);
+    }
+
+    // Must be called right before writing the same value to CR3. The CR3
+    // load is serializing, which publishes this store before any page walk
+    // the processor performs in the new address space; together with the
+    // full barrier in smp_broadcast_flush_tlb() this guarantees a flushing
+    // processor either observes us in the address space, or we switched in
+    // after its page table update and started out with a clean TLB.
+    ALWAYS_INLINE static void set_current_cr3(FlatPtr cr3)
+    {
+        current().m_current_cr3.store(cr3, AK::MemoryOrder::memory_order_relaxed);
+    }
+
     ALWAYS_INLINE static FlatPtr current_in_irq()
     {
         return read_gs_ptr(__builtin_offsetof(Processor, m_in_irq));
@@ -331,16 +331,30 @@ void init_stage2(void*)
 
     auto boot_profiling = kernel_command_line().is_boot_profiling_enabled();
 
+    // Probe device classes that aren't needed to reach the root filesystem on
+    // the I/O work queue, so they overlap with storage probing and the root
+    // mount below. The work queue runs them in order on its own thread, and
+    // we wait for all of them before sealing init-only memory, since most of
+    // the probing code is UNMAP_AFTER_INIT.
+    Atomic<size_t> pending_deferred_probes { 0 };
+    auto queue_deferred_probe = [&pending_deferred_probes](void (*probe)()) {
+        pending_deferred_probes.fetch_add(1, AK::memory_order_acq_rel);
+        MUST(g_io_work->try_queue([&pending_deferred_probes, probe] {
+            probe();
+            pending_deferred_probes.fetch_sub(1, AK::memory_order_acq_rel);
+        }));
+    };
+
     if (!PCI::Access::is_disabled()) {
-        USB::USBManagement::initialize();
+        queue_deferred_probe([] { USB::USBManagement::initialize(); });
     }
     FirmwareSysFSDirectory::initialize();
 
     if (!PCI::Access::is_disabled()) {
-        VirtIO::detect();
+        queue_deferred_probe([] { VirtIO::detect(); });
     }
 
-    NetworkingManagement::the().initialize();
+    queue_deferred_probe([] { NetworkingManagement::the().initialize(); });
 
 #ifdef ENABLE_KERNEL_COVERAGE_COLLECTION
     (void)KCOVDevice::must_create().leak_ref();
@@ -352,13 +366,18 @@ void init_stage2(void*)
     (void)SelfTTYDevice::must_create().leak_ref();
     PTYMultiplexer::initialize();
 
-    AudioManagement::the().initialize();
+    queue_deferred_probe([] { AudioManagement::the().initialize(); });
 
     StorageManagement::the().initialize(kernel_command_line().root_device(), kernel_command_line().is_force_pio(), kernel_command_line().is_nvme_polling_enabled());
     if (VirtualFileSystem::the().mount_root(StorageManagement::the().root_filesystem()).is_error()) {
         PANIC("VirtualFileSystem::mount_root failed");
     }
 
+    // All deferred probes have to finish before we seal init-only memory
+    // below and before userspace starts enumerating devices.
+    while (pending_deferred_probes.load(AK::memory_order_acquire) != 0)
+        Scheduler::yield();
+
     // Switch out of early boot mode.
     g_in_early_boot = false;
 
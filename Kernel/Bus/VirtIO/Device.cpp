@@ -269,6 +269,10 @@ bool Device::accept_device_features(u64 device_features, u64 accepted_features)
         // accepted_features |= VIRTIO_F_INDIRECT_DESC;
     }
 
+    if (is_feature_set(device_features, VIRTIO_F_EVENT_IDX)) {
+        accepted_features |= VIRTIO_F_EVENT_IDX;
+    }
+
     if (is_feature_set(device_features, VIRTIO_F_IN_ORDER)) {
         accepted_features |= VIRTIO_F_IN_ORDER;
     }
@@ -327,7 +331,7 @@ bool Device::setup_queue(u16 queue_index)
 
     u16 queue_notify_offset = config_read16(*m_common_cfg, COMMON_CFG_QUEUE_NOTIFY_OFF);
 
-    auto queue_or_error = Queue::try_create(queue_size, queue_notify_offset);
+    auto queue_or_error = Queue::try_create(queue_size, queue_notify_offset, is_feature_accepted(VIRTIO_F_EVENT_IDX));
     if (queue_or_error.is_error())
         return false;
     auto queue = queue_or_error.release_value();
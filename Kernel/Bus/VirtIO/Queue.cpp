@@ -9,34 +9,44 @@
 
 namespace Kernel::VirtIO {
 
-ErrorOr<NonnullOwnPtr<Queue>> Queue::try_create(u16 queue_size, u16 notify_offset)
+ErrorOr<NonnullOwnPtr<Queue>> Queue::try_create(u16 queue_size, u16 notify_offset, bool event_idx)
 {
     size_t size_of_descriptors = sizeof(QueueDescriptor) * queue_size;
-    size_t size_of_driver = sizeof(QueueDriver) + queue_size * sizeof(u16);
-    size_t size_of_device = sizeof(QueueDevice) + queue_size * sizeof(QueueDeviceItem);
-    auto queue_region_size = TRY(Memory::page_round_up(size_of_descriptors + size_of_driver + size_of_device));
+    // Note: The extra u16 per ring is the used_event/avail_event field, which
+    // the split ring layout reserves whether or not VIRTIO_F_EVENT_IDX was negotiated.
+    size_t size_of_driver = sizeof(QueueDriver) + queue_size * sizeof(u16) + sizeof(u16);
+    // The device (used) ring must be 4-byte aligned per the virtio spec, but
+    // the driver area ends on a u16 boundary, so pad up to the next 4 bytes.
+    size_t device_offset = align_up_to(size_of_descriptors + size_of_driver, 4);
+    size_t size_of_device = sizeof(QueueDevice) + queue_size * sizeof(QueueDeviceItem) + sizeof(u16);
+    auto queue_region_size = TRY(Memory::page_round_up(device_offset + size_of_device));
     OwnPtr<Memory::Region> queue_region;
     if (queue_region_size <= PAGE_SIZE)
         queue_region = TRY(MM.allocate_kernel_region(queue_region_size, "VirtIO Queue"sv, Memory::Region::Access::ReadWrite));
     else
         queue_region = TRY(MM.allocate_contiguous_kernel_region(queue_region_size, "VirtIO Queue"sv, Memory::Region::Access::ReadWrite));
-    return adopt_nonnull_own_or_enomem(new (nothrow) Queue(queue_region.release_nonnull(), queue_size, notify_offset));
+    return adopt_nonnull_own_or_enomem(new (nothrow) Queue(queue_region.release_nonnull(), queue_size, notify_offset, event_idx));
 }
 
-Queue::Queue(NonnullOwnPtr<Memory::Region> queue_region, u16 queue_size, u16 notify_offset)
+Queue::Queue(NonnullOwnPtr<Memory::Region> queue_region, u16 queue_size, u16 notify_offset, bool event_idx)
     : m_queue_size(queue_size)
     , m_notify_offset(notify_offset)
+    , m_event_idx(event_idx)
     , m_free_buffers(queue_size)
     , m_queue_region(move(queue_region))
 {
     size_t size_of_descriptors = sizeof(QueueDescriptor) * queue_size;
-    size_t size_of_driver = sizeof(QueueDriver) + queue_size * sizeof(u16);
-    // TODO: ensure alignment!!!
+    size_t size_of_driver = sizeof(QueueDriver) + queue_size * sizeof(u16) + sizeof(u16);
+    // Pad the device (used) ring out to 4-byte alignment, matching try_create().
+    size_t device_offset = align_up_to(size_of_descriptors + size_of_driver, 4);
     u8* ptr = m_queue_region->vaddr().as_ptr();
     memset(ptr, 0, m_queue_region->size());
+    size_t size_of_device = sizeof(QueueDevice) + queue_size * sizeof(QueueDeviceItem) + sizeof(u16);
     m_descriptors = reinterpret_cast<QueueDescriptor*>(ptr);
     m_driver = reinterpret_cast<QueueDriver*>(ptr + size_of_descriptors);
-    m_device = reinterpret_cast<QueueDevice*>(ptr + size_of_descriptors + size_of_driver);
+    m_device = reinterpret_cast<QueueDevice*>(ptr + device_offset);
+    m_used_event = reinterpret_cast<u16*>(ptr + size_of_descriptors + size_of_driver - sizeof(u16));
+    m_avail_event = reinterpret_cast<u16 const*>(ptr + device_offset + size_of_device - sizeof(u16));
 
     for (auto i = 0; i + 1 < queue_size; i++)
         m_descriptors[i].next = i + 1; // link all the descriptors in a line
@@ -49,12 +59,25 @@ Queue::~Queue() = default;
 void Queue::enable_interrupts()
 {
     SpinlockLocker lock(m_lock);
+    if (m_event_idx) {
+        // Ask for an interrupt as soon as the device pushes anything past what we've processed.
+        *m_used_event = m_used_tail;
+        full_memory_barrier();
+        return;
+    }
     m_driver->flags = 0;
 }
 
 void Queue::disable_interrupts()
 {
     SpinlockLocker lock(m_lock);
+    if (m_event_idx) {
+        // The device ignores the flags field when VIRTIO_F_EVENT_IDX is
+        // negotiated, so park the event index a full ring ahead instead.
+        *m_used_event = m_used_tail + m_queue_size;
+        full_memory_barrier();
+        return;
+    }
     m_driver->flags = 1;
 }
 
@@ -90,6 +113,11 @@ QueueChain Queue::pop_used_buffer_chain(size_t& used)
     // We are now done with this buffer chain
     m_used_tail++;
 
+    // Move the interrupt threshold along so the device coalesces interrupts
+    // for everything we've already caught up with.
+    if (m_event_idx)
+        *m_used_event = m_used_tail;
+
     return QueueChain(*this, descriptor_index, last_index, length_of_chain);
 }
 
@@ -132,6 +160,12 @@ Optional<u16> Queue::take_free_slot()
 bool Queue::should_notify() const
 {
     VERIFY(m_lock.is_locked());
+    if (m_event_idx) {
+        // Chains are published one at a time, so the spec's
+        // (new_index - avail_event - 1) < (new_index - old_index) check
+        // reduces to the device having asked for the index we just filled.
+        return *m_avail_event == static_cast<u16>(m_driver_index_shadow - 1);
+    }
     auto device_flags = m_device->flags;
     return !(device_flags & VIRTQ_USED_F_NO_NOTIFY);
 }
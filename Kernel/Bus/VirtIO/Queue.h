@@ -28,7 +28,7 @@ enum class BufferType {
 
 class Queue {
 public:
-    static ErrorOr<NonnullOwnPtr<Queue>> try_create(u16 queue_size, u16 notify_offset);
+    static ErrorOr<NonnullOwnPtr<Queue>> try_create(u16 queue_size, u16 notify_offset, bool event_idx);
 
     ~Queue();
 
@@ -52,7 +52,7 @@ public:
     bool should_notify() const;
 
 private:
-    Queue(NonnullOwnPtr<Memory::Region> queue_region, u16 queue_size, u16 notify_offset);
+    Queue(NonnullOwnPtr<Memory::Region> queue_region, u16 queue_size, u16 notify_offset, bool event_idx);
 
     void reclaim_buffer_chain(u16 chain_start_index, u16 chain_end_index, size_t length_of_chain);
 
@@ -87,6 +87,7 @@ private:
 
     const u16 m_queue_size;
     const u16 m_notify_offset;
+    const bool m_event_idx;
     u16 m_free_buffers;
     u16 m_free_head { 0 };
     u16 m_used_tail { 0 };
@@ -95,6 +96,12 @@ private:
     QueueDescriptor* m_descriptors { nullptr };
     QueueDriver* m_driver { nullptr };
     QueueDevice* m_device { nullptr };
+    // With VIRTIO_F_EVENT_IDX negotiated, the ring gains two trailing fields:
+    // the driver tells the device which used index it wants an interrupt for,
+    // and the device tells the driver which available index it wants a
+    // notification for. Both sides can then suppress everything in between.
+    u16* m_used_event { nullptr };
+    u16 const* m_avail_event { nullptr };
     NonnullOwnPtr<Memory::Region> m_queue_region;
     Spinlock<LockRank::None> m_lock {};
 
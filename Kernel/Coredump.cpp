@@ -154,7 +154,7 @@ ErrorOr<void> Coredump::write_elf_header()
     elf_file_header.e_shnum = 0;
     elf_file_header.e_shstrndx = SHN_UNDEF;
 
-    TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(reinterpret_cast<uint8_t*>(&elf_file_header)), sizeof(ElfW(Ehdr))));
+    TRY(m_output_stream->write(ReadonlyBytes { &elf_file_header, sizeof(ElfW(Ehdr)) }));
 
     return {};
 }
@@ -190,7 +190,7 @@ ErrorOr<void> Coredump::write_program_headers(size_t notes_size)
 
         offset += phdr.p_filesz;
 
-        [[maybe_unused]] auto rc = m_description->write(UserOrKernelBuffer::for_kernel_buffer(reinterpret_cast<uint8_t*>(&phdr)), sizeof(ElfW(Phdr)));
+        [[maybe_unused]] auto rc = m_output_stream->write(ReadonlyBytes { &phdr, sizeof(ElfW(Phdr)) });
     }
 
     ElfW(Phdr) notes_pheader {};
@@ -203,7 +203,7 @@ ErrorOr<void> Coredump::write_program_headers(size_t notes_size)
     notes_pheader.p_align = 0;
     notes_pheader.p_flags = 0;
 
-    TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(reinterpret_cast<uint8_t*>(&notes_pheader)), sizeof(ElfW(Phdr))));
+    TRY(m_output_stream->write(ReadonlyBytes { &notes_pheader, sizeof(ElfW(Phdr)) }));
 
     return {};
 }
@@ -212,6 +212,13 @@ ErrorOr<void> Coredump::write_regions()
 {
     u8 zero_buffer[PAGE_SIZE] = {};
 
+    // Copy regions through a bounded chunk buffer rather than one KBuffer per
+    // region; a WebContent-sized region would otherwise need a giant kernel
+    // allocation at the worst possible time. Pages are copied while holding
+    // the address space lock, but compressed and written out without it.
+    constexpr size_t chunk_page_count = 8;
+    auto chunk_buffer = TRY(KBuffer::try_create_with_size("Coredump Region Copy Buffer"sv, chunk_page_count * PAGE_SIZE));
+
     for (auto& region : m_regions) {
         VERIFY(!region.is_kernel());
 
@@ -223,39 +230,46 @@ ErrorOr<void> Coredump::write_regions()
         if (region.access() == Memory::Region::Access::None)
             continue;
 
-        auto buffer = TRY(KBuffer::try_create_with_size("Coredump Region Copy Buffer"sv, region.page_count() * PAGE_SIZE));
-
-        TRY(m_process->address_space().with([&](auto& space) -> ErrorOr<void> {
-            auto* real_region = space->region_tree().regions().find(region.vaddr().get());
-
-            if (!real_region)
-                return Error::from_string_view("Failed to find matching region in the process"sv);
-
-            if (!region.is_consistent_with_region(*real_region))
-                return Error::from_string_view("Found region does not match stored metadata"sv);
+        for (size_t first_page = 0; first_page < region.page_count(); first_page += chunk_page_count) {
+            auto pages_in_chunk = min(chunk_page_count, region.page_count() - first_page);
+
+            TRY(m_process->address_space().with([&](auto& space) -> ErrorOr<void> {
+                auto* real_region = space->region_tree().regions().find(region.vaddr().get());
+
+                if (!real_region)
+                    return Error::from_string_view("Failed to find matching region in the process"sv);
+
+                if (!region.is_consistent_with_region(*real_region))
+                    return Error::from_string_view("Found region does not match stored metadata"sv);
+
+                // If we crashed in the middle of mapping in Regions, they do not have a page directory yet, and will crash on a remap() call
+                if (!real_region->is_mapped()) {
+                    memset(chunk_buffer->data(), 0, pages_in_chunk * PAGE_SIZE);
+                    return {};
+                }
+
+                if (first_page == 0) {
+                    real_region->set_readable(true);
+                    real_region->remap();
+                }
+
+                for (size_t i = 0; i < pages_in_chunk; i++) {
+                    auto page_index = first_page + i;
+                    auto page = real_region->physical_page(page_index);
+                    auto src_buffer = [&]() -> ErrorOr<UserOrKernelBuffer> {
+                        if (page)
+                            return UserOrKernelBuffer::for_user_buffer(reinterpret_cast<uint8_t*>((region.vaddr().as_ptr() + (page_index * PAGE_SIZE))), PAGE_SIZE);
+                        // If the current page is not backed by a physical page, we zero it in the coredump file.
+                        return UserOrKernelBuffer::for_kernel_buffer(zero_buffer);
+                    }();
+                    TRY(src_buffer.value().read(chunk_buffer->bytes().slice(i * PAGE_SIZE, PAGE_SIZE)));
+                }
 
-            // If we crashed in the middle of mapping in Regions, they do not have a page directory yet, and will crash on a remap() call
-            if (!real_region->is_mapped())
                 return {};
+            }));
 
-            real_region->set_readable(true);
-            real_region->remap();
-
-            for (size_t i = 0; i < region.page_count(); i++) {
-                auto page = real_region->physical_page(i);
-                auto src_buffer = [&]() -> ErrorOr<UserOrKernelBuffer> {
-                    if (page)
-                        return UserOrKernelBuffer::for_user_buffer(reinterpret_cast<uint8_t*>((region.vaddr().as_ptr() + (i * PAGE_SIZE))), PAGE_SIZE);
-                    // If the current page is not backed by a physical page, we zero it in the coredump file.
-                    return UserOrKernelBuffer::for_kernel_buffer(zero_buffer);
-                }();
-                TRY(src_buffer.value().read(buffer->bytes().slice(i * PAGE_SIZE, PAGE_SIZE)));
-            }
-
-            return {};
-        }));
-
-        TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(buffer->data()), buffer->size()));
+            TRY(m_output_stream->write(chunk_buffer->bytes().trim(pages_in_chunk * PAGE_SIZE)));
+        }
     }
 
     return {};
@@ -263,7 +277,7 @@ ErrorOr<void> Coredump::write_regions()
 
 ErrorOr<void> Coredump::write_notes_segment(ReadonlyBytes notes_segment)
 {
-    TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(const_cast<u8*>(notes_segment.data())), notes_segment.size()));
+    TRY(m_output_stream->write(notes_segment));
     return {};
 }
 
@@ -383,12 +397,18 @@ ErrorOr<void> Coredump::write()
 {
     ScopedAddressSpaceSwitcher switcher(m_process);
 
+    m_output_stream = TRY(GzipCompressionStream::try_create([this](ReadonlyBytes bytes) -> ErrorOr<void> {
+        TRY(m_description->write(UserOrKernelBuffer::for_kernel_buffer(const_cast<u8*>(bytes.data())), bytes.size()));
+        return {};
+    }));
+
     auto builder = TRY(KBufferBuilder::try_create());
     TRY(create_notes_segment_data(builder));
     TRY(write_elf_header());
     TRY(write_program_headers(builder.bytes().size()));
     TRY(write_regions());
     TRY(write_notes_segment(builder.bytes()));
+    TRY(m_output_stream->finish());
 
     return m_description->chmod(Process::current().credentials(), 0600); // Make coredump file read/writable
 }
@@ -10,6 +10,7 @@
 #include <AK/OwnPtr.h>
 #include <AK/Vector.h>
 #include <Kernel/Forward.h>
+#include <Kernel/GzipCompressionStream.h>
 #include <Kernel/Library/NonnullLockRefPtr.h>
 #include <Kernel/Locking/SpinlockProtected.h>
 #include <Kernel/Memory/Region.h>
@@ -81,6 +82,9 @@ private:
 
     NonnullLockRefPtr<Process> m_process;
     NonnullLockRefPtr<OpenFileDescription> m_description;
+    // All dump contents are streamed through this, so the coredump on disk is
+    // a gzip file; LibCoredump's Reader transparently decompresses it.
+    OwnPtr<GzipCompressionStream> m_output_stream;
     size_t m_num_program_headers { 0 };
     Vector<FlatRegionData> m_regions;
 };
@@ -73,10 +73,17 @@ void Device::process_next_queued_request(Badge<AsyncDeviceRequest>, AsyncDeviceR
 {
     SpinlockLocker lock(m_requests_lock);
     VERIFY(!m_requests.is_empty());
-    VERIFY(m_requests.first().ptr() == &completed_request);
-    m_requests.remove(m_requests.begin());
+    // Note: The completed request is not necessarily at the front of the queue,
+    // since subclasses may dispatch requests out of arrival order
+    // (see StorageDevice::next_request_to_start).
+    for (auto it = m_requests.begin(); it != m_requests.end(); ++it) {
+        if (it->ptr() == &completed_request) {
+            m_requests.remove(it);
+            break;
+        }
+    }
     if (!m_requests.is_empty()) {
-        auto* next_request = m_requests.first().ptr();
+        auto* next_request = next_request_to_start(m_requests);
         next_request->do_start(move(lock));
     }
 
@@ -77,6 +77,11 @@ protected:
     virtual void after_inserting_add_symlink_to_device_identifier_directory() = 0;
     virtual void before_will_be_destroyed_remove_symlink_from_device_identifier_directory() = 0;
 
+    // Called with m_requests_lock held to select which queued request to start
+    // next. The default is FIFO; subclasses may reorder dispatch (for example,
+    // the LBA elevator in StorageDevice).
+    virtual AsyncDeviceRequest* next_request_to_start(DoublyLinkedList<LockRefPtr<AsyncDeviceRequest>>& requests) { return requests.first().ptr(); }
+
     // FIXME: These methods will be eventually removed after all nodes in /sys/dev/block/ and
     // /sys/dev/char/ are symlinks.
     virtual void after_inserting_add_to_device_identifier_directory() = 0;
@@ -36,6 +36,41 @@ DoubleBuffer::DoubleBuffer(size_t capacity, NonnullOwnPtr<KBuffer> storage)
     m_space_for_writing = capacity;
 }
 
+ErrorOr<void> DoubleBuffer::try_resize(size_t capacity)
+{
+    MutexLocker locker(m_lock);
+    if (capacity == m_capacity)
+        return {};
+    if (immediately_readable() > capacity)
+        return EBUSY;
+
+    auto storage = TRY(KBuffer::try_create_with_size("DoubleBuffer"sv, capacity * 2, Memory::Region::Access::ReadWrite));
+
+    // Move any unread data to the front of the new read buffer, so readers
+    // don't notice the storage being swapped out underneath them.
+    size_t unread_size = 0;
+    auto copy_unread = [&](InnerBuffer const& buffer, size_t start_index) {
+        memcpy(storage->data() + unread_size, buffer.data + start_index, buffer.size - start_index);
+        unread_size += buffer.size - start_index;
+    };
+    copy_unread(*m_read_buffer, m_read_buffer_index);
+    copy_unread(*m_write_buffer, 0);
+
+    m_storage = move(storage);
+    m_capacity = capacity;
+    m_buffer1.data = m_storage->data();
+    m_buffer1.size = unread_size;
+    m_buffer2.data = m_storage->data() + capacity;
+    m_buffer2.size = 0;
+    m_read_buffer = &m_buffer1;
+    m_write_buffer = &m_buffer2;
+    m_read_buffer_index = 0;
+    compute_lockfree_metadata();
+    if (m_unblock_callback && m_space_for_writing > 0)
+        m_unblock_callback();
+    return {};
+}
+
 void DoubleBuffer::flip()
 {
     VERIFY(m_read_buffer_index == m_read_buffer->size);
@@ -35,8 +35,11 @@ public:
         return peek(buffer, size);
     }
 
+    ErrorOr<void> try_resize(size_t capacity);
+
     bool is_empty() const { return m_empty; }
 
+    size_t capacity() const { return m_capacity; }
     size_t space_for_writing() const { return m_space_for_writing; }
     size_t immediately_readable() const
     {
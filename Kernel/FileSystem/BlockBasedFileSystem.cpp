@@ -5,6 +5,7 @@
  */
 
 #include <AK/IntrusiveList.h>
+#include <AK/QuickSort.h>
 #include <Kernel/Debug.h>
 #include <Kernel/FileSystem/BlockBasedFileSystem.h>
 #include <Kernel/Process.h>
@@ -236,6 +237,11 @@ ErrorOr<void> BlockBasedFileSystem::read_block(BlockIndex index, UserOrKernelBuf
         }
 
         auto* entry = TRY(cache->ensure(index));
+        if (!entry->has_data && index.value() == m_next_sequential_read_block) {
+            // This looks like a sequential scan, so fetch a whole cluster of
+            // blocks with a single device read and prime the cache with them.
+            read_ahead_into_cache(*cache, index);
+        }
         if (!entry->has_data) {
             auto base_offset = index.value() * block_size();
             auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry->data);
@@ -245,10 +251,38 @@ ErrorOr<void> BlockBasedFileSystem::read_block(BlockIndex index, UserOrKernelBuf
         }
         if (buffer)
             TRY(buffer->write(entry->data + offset, count));
+        m_next_sequential_read_block = index.value() + 1;
         return {};
     });
 }
 
+void BlockBasedFileSystem::read_ahead_into_cache(DiskCache& cache, BlockIndex index) const
+{
+    // NOTE: Read-ahead is purely opportunistic; any failure just means the
+    //       blocks will be fetched one at a time as before.
+    auto read_ahead_buffer_or_error = KBuffer::try_create_with_size("BlockBasedFS: Read-ahead"sv, max_read_ahead_block_count * block_size());
+    if (read_ahead_buffer_or_error.is_error())
+        return;
+    auto read_ahead_buffer = read_ahead_buffer_or_error.release_value();
+    auto base_offset = index.value() * block_size();
+    auto data_buffer = UserOrKernelBuffer::for_kernel_buffer(read_ahead_buffer->data());
+    auto nread_or_error = file_description().read(data_buffer, base_offset, max_read_ahead_block_count * block_size());
+    if (nread_or_error.is_error())
+        return;
+    size_t complete_blocks = nread_or_error.value() / block_size();
+    for (size_t i = 0; i < complete_blocks; ++i) {
+        auto entry_or_error = cache.ensure(BlockIndex { index.value() + i });
+        if (entry_or_error.is_error())
+            return;
+        auto* entry = entry_or_error.value();
+        // Don't clobber blocks that are already cached; they may hold newer (dirty) data.
+        if (entry->has_data)
+            continue;
+        memcpy(entry->data, read_ahead_buffer->data() + i * block_size(), block_size());
+        entry->has_data = true;
+    }
+}
+
 ErrorOr<void> BlockBasedFileSystem::read_blocks(BlockIndex index, unsigned count, UserOrKernelBuffer& buffer, bool allow_cache) const
 {
     VERIFY(m_logical_block_size);
@@ -287,12 +321,50 @@ void BlockBasedFileSystem::flush_writes_impl()
     m_cache.with_exclusive([&](auto& cache) {
         if (!cache->is_dirty())
             return;
+
+        // Cluster dirty blocks into runs of consecutive block indices, so each
+        // run can be written back with a single device write.
+        Vector<CacheEntry*> dirty_entries;
+        bool can_cluster_writes = true;
         cache->for_each_dirty_entry([&](CacheEntry& entry) {
-            auto base_offset = entry.block_index.value() * block_size();
-            auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry.data);
-            [[maybe_unused]] auto rc = file_description().write(base_offset, entry_data_buffer, block_size());
-            ++count;
+            if (can_cluster_writes && dirty_entries.try_append(&entry).is_error())
+                can_cluster_writes = false;
         });
+
+        OwnPtr<KBuffer> cluster_buffer;
+        if (can_cluster_writes) {
+            auto cluster_buffer_or_error = KBuffer::try_create_with_size("BlockBasedFS: Writeback cluster"sv, max_writeback_cluster_block_count * block_size());
+            if (cluster_buffer_or_error.is_error())
+                can_cluster_writes = false;
+            else
+                cluster_buffer = cluster_buffer_or_error.release_value();
+        }
+
+        if (!can_cluster_writes) {
+            cache->for_each_dirty_entry([&](CacheEntry& entry) {
+                auto base_offset = entry.block_index.value() * block_size();
+                auto entry_data_buffer = UserOrKernelBuffer::for_kernel_buffer(entry.data);
+                [[maybe_unused]] auto rc = file_description().write(base_offset, entry_data_buffer, block_size());
+                ++count;
+            });
+        } else {
+            quick_sort(dirty_entries, [](auto* a, auto* b) { return a->block_index < b->block_index; });
+            size_t i = 0;
+            while (i < dirty_entries.size()) {
+                size_t run_length = 1;
+                while (i + run_length < dirty_entries.size()
+                    && run_length < max_writeback_cluster_block_count
+                    && dirty_entries[i + run_length]->block_index.value() == dirty_entries[i]->block_index.value() + run_length)
+                    ++run_length;
+                for (size_t j = 0; j < run_length; ++j)
+                    memcpy(cluster_buffer->data() + j * block_size(), dirty_entries[i + j]->data, block_size());
+                auto base_offset = dirty_entries[i]->block_index.value() * block_size();
+                auto cluster_data_buffer = UserOrKernelBuffer::for_kernel_buffer(cluster_buffer->data());
+                [[maybe_unused]] auto rc = file_description().write(base_offset, cluster_data_buffer, run_length * block_size());
+                count += run_length;
+                i += run_length;
+            }
+        }
         cache->mark_all_clean();
         dbgln("{}: Flushed {} blocks to disk", class_name(), count);
     });
@@ -43,9 +43,15 @@ protected:
 
     void remove_disk_cache_before_last_unmount();
 
-private:
     void flush_specific_block_if_needed(BlockIndex index);
 
+private:
+    void read_ahead_into_cache(DiskCache&, BlockIndex) const;
+
+    static constexpr size_t max_read_ahead_block_count = 8;
+    static constexpr size_t max_writeback_cluster_block_count = 32;
+
+    mutable u64 m_next_sequential_read_block { 0 };
     mutable MutexProtected<OwnPtr<DiskCache>> m_cache;
 };
 
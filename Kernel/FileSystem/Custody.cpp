@@ -4,9 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/HashFunctions.h>
 #include <AK/RefPtr.h>
 #include <AK/Singleton.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringHash.h>
 #include <AK/StringView.h>
 #include <AK/Vector.h>
 #include <Kernel/FileSystem/Custody.h>
@@ -21,22 +24,51 @@ SpinlockProtected<Custody::AllCustodiesList, LockRank::None>& Custody::all_insta
     return s_all_instances;
 }
 
+// Custody reuse in try_create() used to scan every live custody in the system, which
+// made each path component during resolution cost O(live custodies). Instead, keep
+// the custodies hashed by (parent, name) in a set of buckets so reuse is a short
+// bucket walk. The buckets are guarded by their own lock, always taken while holding
+// the all_instances() lock; unref() upholds the same order when it removes a dying
+// custody from its bucket via remove_from_secondary_lists().
+static constexpr size_t custody_cache_bucket_count = 256;
+struct CustodyCacheBuckets {
+    Array<Custody::CacheBucketList, custody_cache_bucket_count> buckets;
+};
+static Singleton<SpinlockProtected<CustodyCacheBuckets, LockRank::None>> s_custody_cache;
+
+static size_t custody_cache_bucket_index(Custody const* parent, StringView name)
+{
+    auto name_hash = string_hash(name.characters_without_null_termination(), name.length());
+    return pair_int_hash(ptr_hash(parent), name_hash) % custody_cache_bucket_count;
+}
+
 ErrorOr<NonnullRefPtr<Custody>> Custody::try_create(Custody* parent, StringView name, Inode& inode, int mount_flags)
 {
     return all_instances().with([&](auto& all_custodies) -> ErrorOr<NonnullRefPtr<Custody>> {
-        for (Custody& custody : all_custodies) {
-            if (custody.parent() == parent
-                && custody.name() == name
-                && &custody.inode() == &inode
-                && custody.mount_flags() == mount_flags) {
-                return NonnullRefPtr { custody };
+        return s_custody_cache->with([&](auto& cache) -> ErrorOr<NonnullRefPtr<Custody>> {
+            auto& bucket = cache.buckets[custody_cache_bucket_index(parent, name)];
+            for (Custody& custody : bucket) {
+                if (custody.parent() == parent
+                    && custody.name() == name
+                    && &custody.inode() == &inode
+                    && custody.mount_flags() == mount_flags) {
+                    return NonnullRefPtr { custody };
+                }
             }
-        }
 
-        auto name_kstring = TRY(KString::try_create(name));
-        auto custody = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) Custody(parent, move(name_kstring), inode, mount_flags)));
-        all_custodies.prepend(*custody);
-        return custody;
+            auto name_kstring = TRY(KString::try_create(name));
+            auto custody = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) Custody(parent, move(name_kstring), inode, mount_flags)));
+            all_custodies.prepend(*custody);
+            bucket.prepend(*custody);
+            return custody;
+        });
+    });
+}
+
+void Custody::remove_from_secondary_lists()
+{
+    s_custody_cache->with([&](auto& cache) {
+        cache.buckets[custody_cache_bucket_index(m_parent.ptr(), m_name->view())].remove(*this);
     });
 }
 
@@ -32,6 +32,8 @@ public:
     int mount_flags() const { return m_mount_flags; }
     bool is_readonly() const;
 
+    void remove_from_secondary_lists();
+
 private:
     Custody(Custody* parent, NonnullOwnPtr<KString> name, Inode&, int mount_flags);
 
@@ -41,9 +43,11 @@ private:
     int m_mount_flags { 0 };
 
     mutable IntrusiveListNode<Custody> m_all_custodies_list_node;
+    mutable IntrusiveListNode<Custody> m_cache_bucket_list_node;
 
 public:
     using AllCustodiesList = IntrusiveList<&Custody::m_all_custodies_list_node>;
+    using CacheBucketList = IntrusiveList<&Custody::m_cache_bucket_list_node>;
     static SpinlockProtected<Custody::AllCustodiesList, LockRank::None>& all_instances();
 };
 
@@ -255,20 +255,36 @@ auto Ext2FS::allocate_blocks(GroupIndex preferred_group_index, size_t count) ->
         }
 
         VERIFY(found_a_group);
-        auto const& bgd = group_descriptor(group_index);
 
-        auto* cached_bitmap = TRY(get_bitmap_block(bgd.bg_block_bitmap));
-
-        int blocks_in_group = min(blocks_per_group(), super_block().s_blocks_count);
-        auto block_bitmap = cached_bitmap->bitmap(blocks_in_group);
+        auto* free_extents = TRY(free_extents_for_group(group_index));
+
+        // Best-fit: prefer the smallest free extent that can hold everything we
+        // still need, so that streaming writers get one contiguous run without
+        // carving up the larger extents. If no extent is big enough, take the
+        // largest one and keep going in the next group.
+        size_t blocks_needed = count - blocks.size();
+        Optional<BlockGroupFreeExtents::Extent> chosen_extent;
+        for (auto const& extent : free_extents->extents) {
+            if (!chosen_extent.has_value()) {
+                chosen_extent = extent;
+                continue;
+            }
+            bool chosen_fits = chosen_extent->length >= blocks_needed;
+            bool extent_fits = extent.length >= blocks_needed;
+            if (extent_fits != chosen_fits) {
+                if (extent_fits)
+                    chosen_extent = extent;
+            } else if (extent_fits ? extent.length < chosen_extent->length : extent.length > chosen_extent->length) {
+                chosen_extent = extent;
+            }
+        }
+        VERIFY(chosen_extent.has_value());
 
         BlockIndex first_block_in_group = (group_index.value() - 1) * blocks_per_group() + first_block_index().value();
-        size_t free_region_size = 0;
-        auto first_unset_bit_index = block_bitmap.find_longest_range_of_unset_bits(count - blocks.size(), free_region_size);
-        VERIFY(first_unset_bit_index.has_value());
+        size_t free_region_size = min(chosen_extent->length, blocks_needed);
         dbgln_if(EXT2_DEBUG, "Ext2FS: allocating free region of size: {} [{}]", free_region_size, group_index);
         for (size_t i = 0; i < free_region_size; ++i) {
-            BlockIndex block_index = (first_unset_bit_index.value() + i) + first_block_in_group.value();
+            BlockIndex block_index = (chosen_extent->first_bit + i) + first_block_in_group.value();
             TRY(set_block_allocation_state(block_index, true));
             blocks.unchecked_append(block_index);
             dbgln_if(EXT2_DEBUG, "  allocated > {}", block_index);
@@ -423,6 +439,108 @@ ErrorOr<Ext2FS::CachedBitmap*> Ext2FS::get_bitmap_block(BlockIndex bitmap_block_
     return m_cached_bitmaps.last().ptr();
 }
 
+ErrorOr<Ext2FS::BlockGroupFreeExtents*> Ext2FS::free_extents_for_group(GroupIndex group_index)
+{
+    VERIFY(m_lock.is_locked());
+    if (auto it = m_free_extents.find(group_index.value()); it != m_free_extents.end())
+        return it->value.ptr();
+
+    auto const& bgd = group_descriptor(group_index);
+    auto* cached_bitmap = TRY(get_bitmap_block(bgd.bg_block_bitmap));
+    size_t blocks_in_group = min(blocks_per_group(), super_block().s_blocks_count);
+    auto block_bitmap = cached_bitmap->bitmap(blocks_in_group);
+
+    auto free_extents = TRY(adopt_nonnull_own_or_enomem(new (nothrow) BlockGroupFreeExtents));
+    size_t run_start = 0;
+    size_t run_length = 0;
+    for (size_t i = 0; i < blocks_in_group; ++i) {
+        if (!block_bitmap.get(i)) {
+            if (run_length == 0)
+                run_start = i;
+            ++run_length;
+        } else if (run_length != 0) {
+            TRY(free_extents->extents.try_append({ run_start, run_length }));
+            run_length = 0;
+        }
+    }
+    if (run_length != 0)
+        TRY(free_extents->extents.try_append({ run_start, run_length }));
+
+    dbgln_if(EXT2_DEBUG, "Ext2FS: built free-extent index for group {} ({} extents)", group_index, free_extents->extents.size());
+    TRY(m_free_extents.try_set(group_index.value(), move(free_extents)));
+    return m_free_extents.find(group_index.value())->value.ptr();
+}
+
+void Ext2FS::update_free_extent_index(GroupIndex group_index, size_t bit_index, bool new_state)
+{
+    VERIFY(m_lock.is_locked());
+    auto it = m_free_extents.find(group_index.value());
+    if (it == m_free_extents.end())
+        return;
+    auto& extents = it->value->extents;
+
+    // Binary search for the first extent beginning after bit_index; the extent
+    // containing bit_index (if any) is then the one just before it.
+    size_t first_after = 0;
+    {
+        size_t low = 0;
+        size_t high = extents.size();
+        while (low < high) {
+            size_t middle = low + (high - low) / 2;
+            if (extents[middle].first_bit <= bit_index)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        first_after = low;
+    }
+
+    if (new_state) {
+        // The bit is being allocated; carve it out of the extent containing it.
+        if (first_after == 0)
+            return;
+        auto& extent = extents[first_after - 1];
+        if (bit_index >= extent.first_bit + extent.length)
+            return;
+        if (extent.length == 1) {
+            extents.remove(first_after - 1);
+        } else if (bit_index == extent.first_bit) {
+            ++extent.first_bit;
+            --extent.length;
+        } else if (bit_index == extent.first_bit + extent.length - 1) {
+            --extent.length;
+        } else {
+            // Splitting the extent needs an insertion, which can fail under
+            // memory pressure. Drop the whole index in that case; it will be
+            // rebuilt lazily on the next allocation in this group.
+            BlockGroupFreeExtents::Extent tail { bit_index + 1, extent.first_bit + extent.length - (bit_index + 1) };
+            extent.length = bit_index - extent.first_bit;
+            if (extents.try_insert(first_after, tail).is_error())
+                m_free_extents.remove(group_index.value());
+        }
+        return;
+    }
+
+    // The bit is being freed; extend or merge the neighboring extents.
+    auto* predecessor = first_after > 0 ? &extents[first_after - 1] : nullptr;
+    if (predecessor && bit_index < predecessor->first_bit + predecessor->length)
+        return;
+    bool adjacent_to_predecessor = predecessor && predecessor->first_bit + predecessor->length == bit_index;
+    bool adjacent_to_successor = first_after < extents.size() && extents[first_after].first_bit == bit_index + 1;
+
+    if (adjacent_to_predecessor && adjacent_to_successor) {
+        predecessor->length += 1 + extents[first_after].length;
+        extents.remove(first_after);
+    } else if (adjacent_to_predecessor) {
+        ++predecessor->length;
+    } else if (adjacent_to_successor) {
+        --extents[first_after].first_bit;
+        ++extents[first_after].length;
+    } else if (extents.try_insert(first_after, { bit_index, 1 }).is_error()) {
+        m_free_extents.remove(group_index.value());
+    }
+}
+
 ErrorOr<void> Ext2FS::set_block_allocation_state(BlockIndex block_index, bool new_state)
 {
     VERIFY(block_index != 0);
@@ -434,7 +552,9 @@ ErrorOr<void> Ext2FS::set_block_allocation_state(BlockIndex block_index, bool ne
     auto& bgd = const_cast<ext2_group_desc&>(group_descriptor(group_index));
 
     dbgln_if(EXT2_DEBUG, "Ext2FS: Block {} state -> {} (in bitmap block {})", block_index, new_state, bgd.bg_block_bitmap);
-    return update_bitmap_block(bgd.bg_block_bitmap, bit_index, new_state, m_super_block.s_free_blocks_count, bgd.bg_free_blocks_count);
+    TRY(update_bitmap_block(bgd.bg_block_bitmap, bit_index, new_state, m_super_block.s_free_blocks_count, bgd.bg_free_blocks_count));
+    update_free_extent_index(group_index, bit_index, new_state);
+    return {};
 }
 
 ErrorOr<NonnullLockRefPtr<Inode>> Ext2FS::create_directory(Ext2FSInode& parent_inode, StringView name, mode_t mode, UserID uid, GroupID gid)
@@ -542,6 +662,7 @@ ErrorOr<void> Ext2FS::prepare_to_clear_last_mount()
 
     BlockBasedFileSystem::remove_disk_cache_before_last_unmount();
     m_inode_cache.clear();
+    m_free_extents.clear();
     m_root_inode = nullptr;
     return {};
 }
@@ -591,33 +712,59 @@ void Ext2FS::flush_block_group_descriptor_table()
         dbgln("Ext2FS[{}]::flush_block_group_descriptor_table(): Failed to write blocks: {}", fsid(), result.error());
 }
 
-void Ext2FS::flush_writes()
+void Ext2FS::flush_filesystem_metadata()
 {
-    {
-        MutexLocker locker(m_lock);
-        if (m_super_block_dirty) {
-            auto result = flush_super_block();
-            if (result.is_error()) {
-                dbgln("Ext2FS[{}]::flush_writes(): Failed to write superblock: {}", fsid(), result.error());
-                // FIXME: We should handle this error.
-                VERIFY_NOT_REACHED();
-            }
-            m_super_block_dirty = false;
-        }
-        if (m_block_group_descriptors_dirty) {
-            flush_block_group_descriptor_table();
-            m_block_group_descriptors_dirty = false;
+    MutexLocker locker(m_lock);
+    if (m_super_block_dirty) {
+        auto result = flush_super_block();
+        if (result.is_error()) {
+            dbgln("Ext2FS[{}]::flush_writes(): Failed to write superblock: {}", fsid(), result.error());
+            // FIXME: We should handle this error.
+            VERIFY_NOT_REACHED();
         }
-        for (auto& cached_bitmap : m_cached_bitmaps) {
-            if (cached_bitmap->dirty) {
-                auto buffer = UserOrKernelBuffer::for_kernel_buffer(cached_bitmap->buffer->data());
-                if (auto result = write_block(cached_bitmap->bitmap_block_index, buffer, block_size()); result.is_error()) {
-                    dbgln("Ext2FS[{}]::flush_writes(): Failed to write blocks: {}", fsid(), result.error());
-                }
-                cached_bitmap->dirty = false;
-                dbgln_if(EXT2_DEBUG, "Ext2FS[{}]::flush_writes(): Flushed bitmap block {}", fsid(), cached_bitmap->bitmap_block_index);
+        m_super_block_dirty = false;
+    }
+    if (m_block_group_descriptors_dirty) {
+        flush_block_group_descriptor_table();
+        m_block_group_descriptors_dirty = false;
+    }
+    for (auto& cached_bitmap : m_cached_bitmaps) {
+        if (cached_bitmap->dirty) {
+            auto buffer = UserOrKernelBuffer::for_kernel_buffer(cached_bitmap->buffer->data());
+            if (auto result = write_block(cached_bitmap->bitmap_block_index, buffer, block_size()); result.is_error()) {
+                dbgln("Ext2FS[{}]::flush_writes(): Failed to write blocks: {}", fsid(), result.error());
             }
+            cached_bitmap->dirty = false;
+            dbgln_if(EXT2_DEBUG, "Ext2FS[{}]::flush_writes(): Flushed bitmap block {}", fsid(), cached_bitmap->bitmap_block_index);
         }
+    }
+}
+
+void Ext2FS::flush_writes_for_inode(Ext2FSInode& inode)
+{
+    flush_filesystem_metadata();
+
+    BlockIndex block_index;
+    unsigned offset;
+    if (find_block_containing_inode(inode.index(), block_index, offset))
+        flush_specific_block_if_needed(block_index);
+
+    auto block_list_or_error = inode.compute_block_list_with_meta_blocks();
+    if (block_list_or_error.is_error()) {
+        // If we can't tell which blocks belong to this inode, fall back to
+        // flushing everything rather than lose the durability guarantee.
+        flush_writes();
+        return;
+    }
+    for (auto block : block_list_or_error.value())
+        flush_specific_block_if_needed(block);
+}
+
+void Ext2FS::flush_writes()
+{
+    {
+        MutexLocker locker(m_lock);
+        flush_filesystem_metadata();
 
         // Uncache Inodes that are only kept alive by the index-to-inode lookup cache.
         // We don't uncache Inodes that are being watched by at least one InodeWatcher.
@@ -75,6 +75,8 @@ private:
     ErrorOr<NonnullLockRefPtr<Inode>> create_inode(Ext2FSInode& parent_inode, StringView name, mode_t, dev_t, UserID, GroupID);
     ErrorOr<NonnullLockRefPtr<Inode>> create_directory(Ext2FSInode& parent_inode, StringView name, mode_t, UserID, GroupID);
     virtual void flush_writes() override;
+    void flush_filesystem_metadata();
+    void flush_writes_for_inode(Ext2FSInode&);
 
     BlockIndex first_block_index() const;
     ErrorOr<InodeIndex> allocate_inode(GroupIndex preferred_group = 0);
@@ -124,7 +126,24 @@ private:
     ErrorOr<CachedBitmap*> get_bitmap_block(BlockIndex);
     ErrorOr<void> update_bitmap_block(BlockIndex bitmap_block, size_t bit_index, bool new_state, u32& super_block_counter, u16& group_descriptor_counter);
 
+    // An in-memory index of the free block runs within a block group, built
+    // lazily from the group's block bitmap the first time we allocate there.
+    // Keeping the runs as extents sorted by their first bit lets allocations
+    // pick a contiguous run directly instead of re-scanning the bitmap bit by
+    // bit, and lets state changes update the index with a binary search.
+    struct BlockGroupFreeExtents {
+        struct Extent {
+            size_t first_bit { 0 };
+            size_t length { 0 };
+        };
+        Vector<Extent> extents;
+    };
+
+    ErrorOr<BlockGroupFreeExtents*> free_extents_for_group(GroupIndex);
+    void update_free_extent_index(GroupIndex, size_t bit_index, bool new_state);
+
     Vector<OwnPtr<CachedBitmap>> m_cached_bitmaps;
+    HashMap<unsigned, NonnullOwnPtr<BlockGroupFreeExtents>> m_free_extents;
     LockRefPtr<Ext2FSInode> m_root_inode;
 };
 
@@ -507,6 +507,16 @@ ErrorOr<void> Ext2FSInode::flush_metadata()
     return {};
 }
 
+void Ext2FSInode::sync()
+{
+    if (is_metadata_dirty())
+        (void)flush_metadata();
+    // Only flush the blocks belonging to this inode (plus the filesystem's
+    // own metadata); fsync on one file shouldn't have to wait for every
+    // dirty block in the disk cache.
+    fs().flush_writes_for_inode(*this);
+}
+
 ErrorOr<void> Ext2FSInode::compute_block_list_with_exclusive_locking()
 {
     // Note: We verify that the inode mutex is being held locked. Because only the read_bytes_locked()
@@ -815,6 +825,92 @@ ErrorOr<void> Ext2FSInode::write_directory(Vector<Ext2FSDirectoryEntry>& entries
     return {};
 }
 
+// Inserting into or removing from a directory used to rebuild and rewrite the
+// entire entry list, which made populating a large directory O(n^2) in its
+// size. These helpers instead edit the single affected directory block in
+// place: insertion claims slack from an existing entry's rec_len (the last
+// entry of every block carries the block's free space), and removal folds the
+// removed entry's rec_len into its predecessor. Both return false when they
+// cannot help (no block has enough slack, or the on-disk entry walk looks
+// inconsistent), in which case the caller falls back to the full rewrite.
+ErrorOr<bool> Ext2FSInode::try_insert_directory_entry_in_place(StringView name, InodeIndex inode_index, u8 file_type)
+{
+    VERIFY(m_inode_lock.is_exclusively_locked_by_current_thread());
+
+    auto block_size = fs().block_size();
+    auto file_size = size();
+    size_t needed_length = EXT2_DIR_REC_LEN(name.length());
+
+    u8 buffer[max_block_size];
+    auto buf = UserOrKernelBuffer::for_kernel_buffer(buffer);
+
+    for (u64 offset = 0; offset < file_size; offset += block_size) {
+        TRY(read_bytes(offset, block_size, buf, nullptr));
+
+        auto* entry = reinterpret_cast<ext2_dir_entry_2*>(buffer);
+        auto* entries_end = reinterpret_cast<ext2_dir_entry_2*>(buffer + block_size);
+        while (entry < entries_end) {
+            if (entry->rec_len < EXT2_DIR_REC_LEN(0) || (entry->rec_len & EXT2_DIR_ROUND) || (u8*)entry + entry->rec_len > buffer + block_size)
+                return false;
+            size_t used_length = entry->inode ? EXT2_DIR_REC_LEN(entry->name_len) : 0;
+            if (entry->rec_len >= used_length + needed_length) {
+                auto* new_entry = reinterpret_cast<ext2_dir_entry_2*>(reinterpret_cast<u8*>(entry) + used_length);
+                new_entry->rec_len = entry->rec_len - used_length;
+                if (used_length)
+                    entry->rec_len = used_length;
+                new_entry->inode = inode_index.value();
+                new_entry->name_len = name.length();
+                new_entry->file_type = file_type;
+                memcpy(new_entry->name, name.characters_without_null_termination(), name.length());
+                dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]::try_insert_directory_entry_in_place(): Inserted '{}' into block at offset {}", identifier(), name, offset);
+                TRY(write_bytes(offset, block_size, buf, nullptr));
+                set_metadata_dirty(true);
+                return true;
+            }
+            entry = reinterpret_cast<ext2_dir_entry_2*>(reinterpret_cast<u8*>(entry) + entry->rec_len);
+        }
+    }
+
+    return false;
+}
+
+ErrorOr<bool> Ext2FSInode::try_remove_directory_entry_in_place(StringView name)
+{
+    VERIFY(m_inode_lock.is_exclusively_locked_by_current_thread());
+
+    auto block_size = fs().block_size();
+    auto file_size = size();
+
+    u8 buffer[max_block_size];
+    auto buf = UserOrKernelBuffer::for_kernel_buffer(buffer);
+
+    for (u64 offset = 0; offset < file_size; offset += block_size) {
+        TRY(read_bytes(offset, block_size, buf, nullptr));
+
+        ext2_dir_entry_2* previous_entry = nullptr;
+        auto* entry = reinterpret_cast<ext2_dir_entry_2*>(buffer);
+        auto* entries_end = reinterpret_cast<ext2_dir_entry_2*>(buffer + block_size);
+        while (entry < entries_end) {
+            if (entry->rec_len < EXT2_DIR_REC_LEN(0) || (entry->rec_len & EXT2_DIR_ROUND) || (u8*)entry + entry->rec_len > buffer + block_size)
+                return false;
+            if (entry->inode != 0 && name == StringView { entry->name, entry->name_len }) {
+                if (previous_entry)
+                    previous_entry->rec_len += entry->rec_len;
+                else
+                    entry->inode = 0;
+                dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]::try_remove_directory_entry_in_place(): Removed '{}' from block at offset {}", identifier(), name, offset);
+                TRY(write_bytes(offset, block_size, buf, nullptr));
+                set_metadata_dirty(true);
+                return true;
+            }
+            previous_entry = entry;
+            entry = reinterpret_cast<ext2_dir_entry_2*>(reinterpret_cast<u8*>(entry) + entry->rec_len);
+        }
+    }
+
+    return false;
+}
+
 ErrorOr<NonnullLockRefPtr<Inode>> Ext2FSInode::create_child(StringView name, mode_t mode, dev_t dev, UserID uid, GroupID gid)
 {
     if (Kernel::is_directory(mode))
@@ -832,22 +928,28 @@ ErrorOr<void> Ext2FSInode::add_child(Inode& child, StringView name, mode_t mode)
 
     dbgln_if(EXT2_DEBUG, "Ext2FSInode[{}]::add_child(): Adding inode {} with name '{}' and mode {:o} to directory {}", identifier(), child.index(), name, mode, index());
 
-    Vector<Ext2FSDirectoryEntry> entries;
-    TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
-        if (name == entry.name)
-            return EEXIST;
-        auto entry_name = TRY(KString::try_create(entry.name));
-        TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
-        return {};
-    }));
+    TRY(populate_lookup_cache());
+
+    if (m_lookup_cache.contains(name))
+        return EEXIST;
 
     TRY(child.increment_link_count());
 
-    auto entry_name = TRY(KString::try_create(name));
-    TRY(entries.try_empend(move(entry_name), child.index(), to_ext2_file_type(mode)));
+    if (!TRY(try_insert_directory_entry_in_place(name, child.index(), to_ext2_file_type(mode)))) {
+        // No existing block has room for the new entry, so rebuild the
+        // directory with an additional block appended.
+        Vector<Ext2FSDirectoryEntry> entries;
+        TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
+            auto entry_name = TRY(KString::try_create(entry.name));
+            TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
+            return {};
+        }));
+
+        auto entry_name = TRY(KString::try_create(name));
+        TRY(entries.try_empend(move(entry_name), child.index(), to_ext2_file_type(mode)));
 
-    TRY(write_directory(entries));
-    TRY(populate_lookup_cache());
+        TRY(write_directory(entries));
+    }
 
     auto cache_entry_name = TRY(KString::try_create(name));
     TRY(m_lookup_cache.try_set(move(cache_entry_name), child.index()));
@@ -870,16 +972,18 @@ ErrorOr<void> Ext2FSInode::remove_child(StringView name)
 
     InodeIdentifier child_id { fsid(), child_inode_index };
 
-    Vector<Ext2FSDirectoryEntry> entries;
-    TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
-        if (name != entry.name) {
-            auto entry_name = TRY(KString::try_create(entry.name));
-            TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
-        }
-        return {};
-    }));
+    if (!TRY(try_remove_directory_entry_in_place(name))) {
+        Vector<Ext2FSDirectoryEntry> entries;
+        TRY(traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
+            if (name != entry.name) {
+                auto entry_name = TRY(KString::try_create(entry.name));
+                TRY(entries.try_append({ move(entry_name), entry.inode.index(), entry.file_type }));
+            }
+            return {};
+        }));
 
-    TRY(write_directory(entries));
+        TRY(write_directory(entries));
+    }
 
     m_lookup_cache.remove(it);
 
@@ -110,12 +110,33 @@ ErrorOr<size_t> Inode::write_bytes(off_t offset, size_t length, UserOrKernelBuff
 {
     MutexLocker locker(m_inode_lock);
     TRY(prepare_to_write_data());
-    return write_bytes_locked(offset, length, target_buffer, open_description);
+    auto nwritten = TRY(write_bytes_locked(offset, length, target_buffer, open_description));
+    // Keep resident pages in the shared vmobject in sync with what was just
+    // written, so mmap() users and reads served from those pages see the new
+    // contents.
+    if (nwritten > 0) {
+        if (auto vmobject = shared_vmobject())
+            TRY(vmobject->write_to_resident_range(offset, nwritten, target_buffer));
+    }
+    return nwritten;
 }
 
 ErrorOr<size_t> Inode::read_bytes(off_t offset, size_t length, UserOrKernelBuffer& buffer, OpenFileDescription* open_description) const
 {
     MutexLocker locker(m_inode_lock, Mutex::Mode::Shared);
+    // If the file is mapped somewhere, resident pages in the shared vmobject
+    // are the most up-to-date copy of the contents (mmap writers dirty them
+    // without going through the file system). Serve reads straight from those
+    // pages when the whole range is resident; this also skips the copy
+    // through the file system's block cache.
+    if (auto vmobject = shared_vmobject()) {
+        auto file_size = size();
+        if (static_cast<u64>(offset) >= file_size)
+            return 0;
+        size_t read_length = min(length, file_size - offset);
+        if (read_length > 0 && TRY(vmobject->try_read_resident_range(offset, read_length, buffer)))
+            return read_length;
+    }
     return read_bytes_locked(offset, length, buffer, open_description);
 }
 
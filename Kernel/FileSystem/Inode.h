@@ -95,7 +95,7 @@ public:
     LockRefPtr<Memory::SharedInodeVMObject> shared_vmobject() const;
 
     static void sync_all();
-    void sync();
+    virtual void sync();
 
     bool has_watchers() const;
 
@@ -499,6 +499,16 @@ bool OpenFileDescription::is_blocking() const
     return m_state.with([](auto& state) { return state.is_blocking; });
 }
 
+bool OpenFileDescription::should_charge_block_io() const
+{
+    // Reads and writes through this description eventually hit a storage
+    // device, either directly or through a file-backed filesystem's block
+    // cache, so they count against the process' block I/O bandwidth limit.
+    if (m_file->is_block_device())
+        return true;
+    return m_inode && m_inode->fs().is_file_backed();
+}
+
 void OpenFileDescription::set_blocking(bool b)
 {
     m_state.with([&](auto& state) { state.is_blocking = b; });
@@ -96,6 +96,7 @@ public:
     ErrorOr<NonnullLockRefPtr<Memory::VMObject>> vmobject_for_mmap(Process&, Memory::VirtualRange const&, u64& offset, bool shared);
 
     bool is_blocking() const;
+    bool should_charge_block_io() const;
     void set_blocking(bool b);
 
     bool should_append() const;
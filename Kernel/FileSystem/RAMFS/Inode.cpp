@@ -91,10 +91,34 @@ ErrorOr<void> RAMFSInode::replace_child(StringView name, Inode& new_child)
 
 ErrorOr<NonnullOwnPtr<RAMFSInode::DataBlock>> RAMFSInode::DataBlock::create()
 {
-    auto data_block_buffer_vmobject = TRY(Memory::AnonymousVMObject::try_create_with_size(DataBlock::block_size, AllocationStrategy::AllocateNow));
+    // Note: The pages of a freshly created block are lazily committed
+    // placeholders, so a small write into a block only materializes the pages
+    // it actually touches (via the zero-fault path) instead of allocating the
+    // whole 128 KiB upfront.
+    auto data_block_buffer_vmobject = TRY(Memory::AnonymousVMObject::try_create_with_size(DataBlock::block_size, AllocationStrategy::Reserve));
     return TRY(adopt_nonnull_own_or_enomem(new (nothrow) DataBlock(move(data_block_buffer_vmobject))));
 }
 
+static bool physical_page_has_been_written(RefPtr<Memory::PhysicalPage> const& page)
+{
+    return page && !page->is_shared_zero_page() && !page->is_lazy_committed_page();
+}
+
+bool RAMFSInode::DataBlock::has_committed_pages(size_t offset_in_block, size_t length) const
+{
+    VERIFY(offset_in_block + length <= block_size);
+    if (length == 0)
+        return false;
+    auto physical_pages = m_content_buffer_vmobject->physical_pages();
+    size_t first_page_index = offset_in_block / PAGE_SIZE;
+    size_t last_page_index = (offset_in_block + length - 1) / PAGE_SIZE;
+    for (size_t page_index = first_page_index; page_index <= last_page_index; page_index++) {
+        if (physical_page_has_been_written(physical_pages[page_index]))
+            return true;
+    }
+    return false;
+}
+
 ErrorOr<void> RAMFSInode::ensure_allocated_blocks(size_t offset, size_t io_size)
 {
     VERIFY(m_inode_lock.is_locked());
@@ -208,6 +232,19 @@ ErrorOr<size_t> RAMFSInode::do_io_on_content_space(Memory::Region& mapping_regio
             return Error::from_errno(EIO);
         }
 
+        if (!write && !block->has_committed_pages(offset_in_block, current_io_size)) {
+            // Note: Every page under this span is still an untouched zero
+            // placeholder, so satisfy the read without mapping the block to
+            // avoid faulting those pages into existence.
+            TRY(current_buffer.memset(0, 0, current_io_size));
+            remaining_bytes -= current_io_size;
+            current_buffer = current_buffer.offset(current_io_size);
+            nio += current_io_size;
+            block_index++;
+            offset_in_block = 0;
+            continue;
+        }
+
         NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = block->vmobject();
         mapping_region.set_vmobject(block_vmobject);
         mapping_region.remap();
@@ -369,12 +406,26 @@ ErrorOr<void> RAMFSInode::truncate(u64 size)
 
     u64 last_possible_block_index = size / DataBlock::block_size;
     if ((size % DataBlock::block_size != 0) && m_blocks[last_possible_block_index]) {
-        auto mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "RAMFSInode Mapping Region"sv, Memory::Region::Access::Write, AllocationStrategy::Reserve));
-        VERIFY(m_blocks[last_possible_block_index]);
-        NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = m_blocks[last_possible_block_index]->vmobject();
-        mapping_region->set_vmobject(block_vmobject);
-        mapping_region->remap();
-        memset(mapping_region->vaddr().offset(size % DataBlock::block_size).as_ptr(), 0, DataBlock::block_size - (size % DataBlock::block_size));
+        // Note: Only zero out the pages beyond the new size that have actually
+        // been written; the rest still point at zero placeholder pages, and
+        // scribbling over them through the mapping would needlessly commit them.
+        auto& block = *m_blocks[last_possible_block_index];
+        auto physical_pages = block.vmobject().physical_pages();
+        size_t offset_in_block = size % DataBlock::block_size;
+        OwnPtr<Memory::Region> mapping_region;
+        for (size_t page_index = offset_in_block / PAGE_SIZE; page_index < physical_pages.size(); page_index++) {
+            if (!physical_page_has_been_written(physical_pages[page_index]))
+                continue;
+            if (!mapping_region) {
+                mapping_region = TRY(MM.allocate_kernel_region(DataBlock::block_size, "RAMFSInode Mapping Region"sv, Memory::Region::Access::Write, AllocationStrategy::Reserve));
+                NonnullLockRefPtr<Memory::AnonymousVMObject> block_vmobject = block.vmobject();
+                mapping_region->set_vmobject(block_vmobject);
+                mapping_region->remap();
+            }
+            size_t zero_start = max(offset_in_block, page_index * PAGE_SIZE);
+            size_t zero_end = (page_index + 1) * PAGE_SIZE;
+            memset(mapping_region->vaddr().offset(zero_start).as_ptr(), 0, zero_end - zero_start);
+        }
     }
     m_metadata.size = size;
     set_metadata_dirty(true);
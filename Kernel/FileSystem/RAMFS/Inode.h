@@ -74,6 +74,8 @@ private:
 
         constexpr static size_t block_size = 128 * KiB;
 
+        bool has_committed_pages(size_t offset_in_block, size_t length) const;
+
         Memory::AnonymousVMObject& vmobject() { return *m_content_buffer_vmobject; }
         Memory::AnonymousVMObject const& vmobject() const { return *m_content_buffer_vmobject; }
 
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BinarySearch.h>
+#include <AK/QuickSort.h>
 #include <Kernel/FileSystem/SysFS/Component.h>
 #include <Kernel/FileSystem/SysFS/DirectoryInode.h>
 #include <Kernel/FileSystem/SysFS/Inode.h>
@@ -129,12 +131,34 @@ ErrorOr<void> SysFSDirectory::traverse_as_directory(FileSystemID fsid, Function<
 LockRefPtr<SysFSComponent> SysFSDirectory::lookup(StringView name)
 {
     return m_child_components.with([&](auto& list) -> LockRefPtr<SysFSComponent> {
-        for (auto& child_component : list) {
-            if (child_component.name() == name) {
-                return child_component;
+        if (m_lookup_index_generation != list.generation()) {
+            m_lookup_index.clear_with_capacity();
+            for (auto& child_component : list) {
+                if (m_lookup_index.try_append(&child_component).is_error()) {
+                    // No memory for the index right now; fall back to a linear scan.
+                    m_lookup_index.clear_with_capacity();
+                    for (auto& fallback_child_component : list) {
+                        if (fallback_child_component.name() == name)
+                            return fallback_child_component;
+                    }
+                    return nullptr;
+                }
             }
+            quick_sort(m_lookup_index, [](auto* a, auto* b) { return a->name() < b->name(); });
+            m_lookup_index_generation = list.generation();
         }
-        return nullptr;
+
+        auto* const* result = binary_search(m_lookup_index, name, nullptr, [](StringView const& name, SysFSComponent* const& component) {
+            auto component_name = component->name();
+            if (name < component_name)
+                return -1;
+            if (component_name < name)
+                return 1;
+            return 0;
+        });
+        if (!result)
+            return nullptr;
+        return *result;
     });
 }
 
@@ -11,6 +11,7 @@
 #include <AK/Function.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
+#include <AK/Vector.h>
 #include <Kernel/FileSystem/File.h>
 #include <Kernel/FileSystem/FileSystem.h>
 #include <Kernel/FileSystem/OpenFileDescription.h>
@@ -80,7 +81,40 @@ public:
 
     virtual ErrorOr<NonnullLockRefPtr<SysFSInode>> to_inode(SysFS const& sysfs_instance) const override final;
 
-    using ChildList = SpinlockProtected<IntrusiveList<&SysFSComponent::m_list_node>, LockRank::None>;
+    // The child list shadows its mutating operations to stamp a new
+    // generation, so lookup() knows when its cached sorted index went stale.
+    class ChildComponentsList : public AK::IntrusiveList<&SysFSComponent::m_list_node> {
+        using BaseList = AK::IntrusiveList<&SysFSComponent::m_list_node>;
+
+    public:
+        u64 generation() const { return m_generation; }
+
+        void append(SysFSComponent& component)
+        {
+            ++m_generation;
+            BaseList::append(component);
+        }
+        void prepend(SysFSComponent& component)
+        {
+            ++m_generation;
+            BaseList::prepend(component);
+        }
+        void remove(SysFSComponent& component)
+        {
+            ++m_generation;
+            BaseList::remove(component);
+        }
+        void clear()
+        {
+            ++m_generation;
+            BaseList::clear();
+        }
+
+    private:
+        u64 m_generation { 0 };
+    };
+
+    using ChildList = SpinlockProtected<ChildComponentsList, LockRank::None>;
 
 protected:
     virtual bool is_root_directory() const { return false; }
@@ -88,6 +122,13 @@ protected:
     SysFSDirectory() {};
     explicit SysFSDirectory(SysFSDirectory const& parent_directory);
     ChildList m_child_components {};
+
+private:
+    // Sorted by name and rebuilt lazily whenever the child list generation
+    // changed, so directories with many children are searched in O(log n).
+    // Guarded by the m_child_components spinlock.
+    Vector<SysFSComponent*> m_lookup_index;
+    u64 m_lookup_index_generation { 0 };
 };
 
 }
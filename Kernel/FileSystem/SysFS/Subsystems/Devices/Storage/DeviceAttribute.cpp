@@ -20,6 +20,8 @@ StringView StorageDeviceAttributeSysFSComponent::name() const
         return "sector_size"sv;
     case Type::CommandSet:
         return "command_set"sv;
+    case Type::Statistics:
+        return "stats"sv;
     default:
         VERIFY_NOT_REACHED();
     }
@@ -62,6 +64,9 @@ ErrorOr<NonnullOwnPtr<KBuffer>> StorageDeviceAttributeSysFSComponent::try_to_gen
     case Type::CommandSet:
         value = TRY(KString::formatted("{}", m_device->command_set_to_string_view()));
         break;
+    case Type::Statistics:
+        value = TRY(KString::formatted("{} {} {} {}", m_device->read_requests(), m_device->blocks_read(), m_device->write_requests(), m_device->blocks_written()));
+        break;
     default:
         VERIFY_NOT_REACHED();
     }
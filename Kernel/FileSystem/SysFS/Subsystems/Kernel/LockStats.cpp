@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObjectSerializer.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/LockStats.h>
+#include <Kernel/Locking/LockProfiling.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSLockStats::SysFSLockStats(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSLockStats> SysFSLockStats::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSLockStats(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSLockStats::try_generate(KBufferBuilder& builder)
+{
+    auto obj = TRY(JsonObjectSerializer<>::try_create(builder));
+    TRY(obj.add("enabled"sv, LockProfiling::is_enabled()));
+    TRY(obj.add("dropped_records"sv, LockProfiling::dropped_records()));
+    auto sites = TRY(obj.add_array("sites"sv));
+    ErrorOr<void> result; // FIXME: Make this nicer
+    LockProfiling::for_each_site([&sites, &result](LockProfiling::SiteCounters const& site) {
+        if (result.is_error())
+            return;
+        result = ([&]() -> ErrorOr<void> {
+            auto site_obj = TRY(sites.add_object());
+            // Call sites are raw kernel addresses; userspace can symbolicate
+            // them against /sys/kernel/load_base like it does for profiles.
+            TRY(site_obj.add("call_site"sv, site.call_site));
+            TRY(site_obj.add("acquisitions"sv, site.acquisitions));
+            TRY(site_obj.add("contended_acquisitions"sv, site.contended_acquisitions));
+            TRY(site_obj.add("total_wait_cycles"sv, site.total_wait_cycles));
+            TRY(site_obj.finish());
+            return {};
+        })();
+    });
+    TRY(result);
+    TRY(sites.finish());
+    TRY(obj.finish());
+    return {};
+}
+
+}
@@ -6,6 +6,7 @@
 
 #include <AK/JsonObjectSerializer.h>
 #include <AK/Try.h>
+#include <Kernel/API/ProcessStatistics.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Processes.h>
 #include <Kernel/Process.h>
 #include <Kernel/Scheduler.h>
@@ -120,6 +121,7 @@ ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
             TRY(thread_object.add("tid"sv, thread.tid().value()));
             TRY(thread.name().with([&](auto& thread_name) { return thread_object.add("name"sv, thread_name->view()); }));
             TRY(thread_object.add("times_scheduled"sv, thread.times_scheduled()));
+            TRY(thread_object.add("involuntary_context_switches"sv, thread.involuntary_context_switches()));
             TRY(thread_object.add("time_user"sv, thread.time_in_user()));
             TRY(thread_object.add("time_kernel"sv, thread.time_in_kernel()));
             TRY(thread_object.add("state"sv, thread.state_string()));
@@ -162,4 +164,146 @@ ErrorOr<void> SysFSOverallProcesses::try_generate(KBufferBuilder& builder)
     return {};
 }
 
+UNMAP_AFTER_INIT SysFSProcessStatistics::SysFSProcessStatistics(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSProcessStatistics> SysFSProcessStatistics::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSProcessStatistics(parent_directory)).release_nonnull();
+}
+
+template<size_t N>
+static void copy_into_fixed_field(char (&destination)[N], StringView source)
+{
+    auto length = min(source.length(), N - 1);
+    memcpy(destination, source.characters_without_null_termination(), length);
+    memset(destination + length, 0, N - length);
+}
+
+ErrorOr<void> SysFSProcessStatistics::try_generate(KBufferBuilder& builder)
+{
+    // Keep the fields in sync with SysFSOverallProcesses::try_generate().
+    auto build_process = [&](KBufferBuilder& records, Process const& process) -> ErrorOr<void> {
+        ProcessStatisticsProcess record {};
+
+        if (process.is_user_process()) {
+            StringBuilder pledge_builder;
+
+#define __ENUMERATE_PLEDGE_PROMISE(promise)    \
+    if (process.has_promised(Pledge::promise)) \
+        TRY(pledge_builder.try_append(#promise " "sv));
+            ENUMERATE_PLEDGE_PROMISES
+#undef __ENUMERATE_PLEDGE_PROMISE
+
+            copy_into_fixed_field(record.pledge, pledge_builder.string_view());
+
+            switch (process.veil_state()) {
+            case VeilState::None:
+                record.veil = ProcessStatisticsVeilState::None;
+                break;
+            case VeilState::Dropped:
+                record.veil = ProcessStatisticsVeilState::Dropped;
+                break;
+            case VeilState::Locked:
+            case VeilState::LockedInherited:
+                // Note: We don't reveal if the locked state is either by our choice
+                // or someone else applied it.
+                record.veil = ProcessStatisticsVeilState::Locked;
+                break;
+            }
+        }
+
+        record.pid = process.pid().value();
+        record.pgid = process.tty() ? process.tty()->pgid().value() : 0;
+        record.pgp = process.pgid().value();
+        record.sid = process.sid().value();
+        auto credentials = process.credentials();
+        record.uid = credentials->uid().value();
+        record.gid = credentials->gid().value();
+        record.ppid = process.ppid().value();
+        if (process.tty()) {
+            auto tty_pseudo_name = TRY(process.tty()->pseudo_name());
+            copy_into_fixed_field(record.tty, tty_pseudo_name->view());
+        }
+        record.nfds = process.fds().with_shared([](auto& fds) { return fds.open_count(); });
+        process.name().with([&](auto& process_name) { copy_into_fixed_field(record.name, process_name->view()); });
+        if (process.executable())
+            copy_into_fixed_field(record.executable, TRY(process.executable()->try_serialize_absolute_path())->view());
+
+        TRY(process.address_space().with([&](auto& space) -> ErrorOr<void> {
+            record.amount_virtual = space->amount_virtual();
+            record.amount_resident = space->amount_resident();
+            record.amount_dirty_private = space->amount_dirty_private();
+            record.amount_clean_inode = TRY(space->amount_clean_inode());
+            record.amount_shared = space->amount_shared();
+            record.amount_purgeable_volatile = space->amount_purgeable_volatile();
+            record.amount_purgeable_nonvolatile = space->amount_purgeable_nonvolatile();
+            return {};
+        }));
+
+        record.dumpable = process.is_dumpable();
+        record.kernel = process.is_kernel_process();
+
+        Vector<ProcessStatisticsThread> threads;
+        TRY(process.try_for_each_thread([&](Thread const& thread) -> ErrorOr<void> {
+            SpinlockLocker locker(thread.get_lock());
+            ProcessStatisticsThread thread_record {};
+            thread_record.tid = thread.tid().value();
+            thread.name().with([&](auto& thread_name) { copy_into_fixed_field(thread_record.name, thread_name->view()); });
+            thread_record.times_scheduled = thread.times_scheduled();
+            thread_record.time_user = thread.time_in_user();
+            thread_record.time_kernel = thread.time_in_kernel();
+            copy_into_fixed_field(thread_record.state, thread.state_string());
+            thread_record.cpu = thread.cpu();
+            thread_record.priority = thread.priority();
+            thread_record.syscall_count = thread.syscall_count();
+            thread_record.inode_faults = thread.inode_faults();
+            thread_record.zero_faults = thread.zero_faults();
+            thread_record.cow_faults = thread.cow_faults();
+            thread_record.file_read_bytes = thread.file_read_bytes();
+            thread_record.file_write_bytes = thread.file_write_bytes();
+            thread_record.unix_socket_read_bytes = thread.unix_socket_read_bytes();
+            thread_record.unix_socket_write_bytes = thread.unix_socket_write_bytes();
+            thread_record.ipv4_socket_read_bytes = thread.ipv4_socket_read_bytes();
+            thread_record.ipv4_socket_write_bytes = thread.ipv4_socket_write_bytes();
+            return threads.try_append(thread_record);
+        }));
+
+        record.thread_count = threads.size();
+        TRY(records.append_bytes({ &record, sizeof(record) }));
+        TRY(records.append_bytes({ threads.data(), threads.size() * sizeof(ProcessStatisticsThread) }));
+        return {};
+    };
+
+    // The header carries the process count, which we only know after walking
+    // the process list, so the records go into their own buffer first.
+    auto records = TRY(KBufferBuilder::try_create());
+    u32 process_count = 0;
+
+    // FIXME: Do we actually want to expose the colonel process in a Jail environment?
+    TRY(build_process(records, *Scheduler::colonel()));
+    process_count++;
+    TRY(Process::for_each_in_same_jail([&](Process& process) -> ErrorOr<void> {
+        TRY(build_process(records, process));
+        process_count++;
+        return {};
+    }));
+
+    auto total_time_scheduled = Scheduler::get_total_time_scheduled();
+    ProcessStatisticsHeader header {};
+    header.version = PROCESS_STATISTICS_VERSION;
+    header.process_count = process_count;
+    header.total_time_scheduled = total_time_scheduled.total;
+    header.total_time_scheduled_kernel = total_time_scheduled.total_kernel;
+    TRY(builder.append_bytes({ &header, sizeof(header) }));
+
+    auto records_buffer = records.build();
+    if (!records_buffer)
+        return ENOMEM;
+    TRY(builder.append_bytes(records_buffer->bytes()));
+    return {};
+}
+
 }
@@ -27,4 +27,20 @@ private:
     virtual bool is_readable_by_jailed_processes() const override { return true; }
 };
 
+// The binary counterpart of SysFSOverallProcesses; see Kernel/API/ProcessStatistics.h
+// for the format. Generating and parsing the JSON is expensive enough to distort
+// what monitoring tools are trying to measure, so they read this one instead.
+class SysFSProcessStatistics final : public SysFSGlobalInformation {
+public:
+    virtual StringView name() const override { return "processes_stats"sv; }
+
+    static NonnullLockRefPtr<SysFSProcessStatistics> must_create(SysFSDirectory const& parent_directory);
+
+private:
+    explicit SysFSProcessStatistics(SysFSDirectory const& parent_directory);
+    virtual ErrorOr<void> try_generate(KBufferBuilder& builder) override;
+
+    virtual bool is_readable_by_jailed_processes() const override { return true; }
+};
+
 }
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObjectSerializer.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/SchedulerStats.h>
+#include <Kernel/Scheduler.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSSchedulerStats::SysFSSchedulerStats(SysFSDirectory const& parent_directory)
+    : SysFSGlobalInformation(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSSchedulerStats> SysFSSchedulerStats::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSSchedulerStats(parent_directory)).release_nonnull();
+}
+
+ErrorOr<void> SysFSSchedulerStats::try_generate(KBufferBuilder& builder)
+{
+    auto array = TRY(JsonArraySerializer<>::try_create(builder));
+    ErrorOr<void> result; // FIXME: Make this nicer
+    Scheduler::for_each_processor_stats([&array, &result](u32 processor_id, SchedulerPerProcessorStats const& stats) {
+        if (result.is_error())
+            return;
+        result = ([&]() -> ErrorOr<void> {
+            auto obj = TRY(array.add_object());
+            TRY(obj.add("cpu"sv, processor_id));
+            // Histogram buckets are powers of two; see SchedulerPerProcessorStats.
+            auto depth_histogram = TRY(obj.add_array("run_queue_depth_histogram"sv));
+            for (auto count : stats.run_queue_depth_histogram)
+                TRY(depth_histogram.add(count));
+            TRY(depth_histogram.finish());
+            auto latency_histogram = TRY(obj.add_array("wakeup_latency_histogram_us"sv));
+            for (auto count : stats.wakeup_latency_histogram)
+                TRY(latency_histogram.add(count));
+            TRY(latency_histogram.finish());
+            TRY(obj.add("involuntary_context_switches"sv, stats.involuntary_context_switches));
+            TRY(obj.finish());
+            return {};
+        })();
+    });
+    TRY(result);
+    TRY(array.finish());
+    return {};
+}
+
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/LockProfilingEnabled.h>
+#include <Kernel/Locking/LockProfiling.h>
+#include <Kernel/Sections.h>
+
+namespace Kernel {
+
+UNMAP_AFTER_INIT SysFSLockProfilingEnabled::SysFSLockProfilingEnabled(SysFSDirectory const& parent_directory)
+    : SysFSSystemBooleanVariable(parent_directory)
+{
+}
+
+UNMAP_AFTER_INIT NonnullLockRefPtr<SysFSLockProfilingEnabled> SysFSLockProfilingEnabled::must_create(SysFSDirectory const& parent_directory)
+{
+    return adopt_lock_ref_if_nonnull(new (nothrow) SysFSLockProfilingEnabled(parent_directory)).release_nonnull();
+}
+
+bool SysFSLockProfilingEnabled::value() const
+{
+    return LockProfiling::is_enabled();
+}
+
+void SysFSLockProfilingEnabled::set_value(bool new_value)
+{
+    LockProfiling::set_enabled(new_value);
+}
+
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+#include <Kernel/FileSystem/SysFS/Subsystems/Kernel/Variables/BooleanVariable.h>
+#include <Kernel/Library/LockRefPtr.h>
+#include <Kernel/UserOrKernelBuffer.h>
+
+namespace Kernel {
+
+class SysFSLockProfilingEnabled final : public SysFSSystemBooleanVariable {
+public:
+    virtual StringView name() const override { return "lock_profiling_enabled"sv; }
+    static NonnullLockRefPtr<SysFSLockProfilingEnabled> must_create(SysFSDirectory const&);
+
+private:
+    virtual bool value() const override;
+    virtual void set_value(bool new_value) override;
+
+    explicit SysFSLockProfilingEnabled(SysFSDirectory const&);
+};
+
+}
@@ -83,6 +83,7 @@ class PhysicalPage;
 class PhysicalRegion;
 class PrivateInodeVMObject;
 class Region;
+class RegionTree;
 class SharedInodeVMObject;
 class VMObject;
 class VirtualRange;
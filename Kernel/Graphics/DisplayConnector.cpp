@@ -10,6 +10,7 @@
 #include <Kernel/FileSystem/SysFS/Subsystems/Devices/Graphics/DisplayConnector/Directory.h>
 #include <Kernel/Graphics/DisplayConnector.h>
 #include <Kernel/Graphics/GraphicsManagement.h>
+#include <Kernel/KBuffer.h>
 #include <Kernel/Memory/MemoryManager.h>
 
 namespace Kernel {
@@ -257,6 +258,21 @@ ErrorOr<void> DisplayConnector::flush_rectangle(size_t, FBRect const&)
     return Error::from_errno(ENOTSUP);
 }
 
+ErrorOr<void> DisplayConnector::set_hardware_cursor_bitmap(size_t, size_t, size_t, size_t, ReadonlyBytes)
+{
+    return Error::from_errno(ENOTSUP);
+}
+
+ErrorOr<void> DisplayConnector::disable_hardware_cursor()
+{
+    return Error::from_errno(ENOTSUP);
+}
+
+ErrorOr<void> DisplayConnector::set_hardware_cursor_position(int, int)
+{
+    return Error::from_errno(ENOTSUP);
+}
+
 DisplayConnector::ModeSetting DisplayConnector::current_mode_setting() const
 {
     SpinlockLocker locker(m_modeset_lock);
@@ -287,6 +303,8 @@ static constexpr GraphicsIOCtlChecker s_checkers[] = {
     { GRAPHICS_IOCTL_SET_SAFE_HEAD_MODE_SETTING, "GRAPHICS_IOCTL_SET_SAFE_HEAD_MODE_SETTING"sv, true },
     { GRAPHICS_IOCTL_SET_RESPONSIBLE, "GRAPHICS_IOCTL_SET_RESPONSIBLE"sv, false },
     { GRAPHICS_IOCTL_UNSET_RESPONSIBLE, "GRAPHICS_IOCTL_UNSET_RESPONSIBLE"sv, true },
+    { GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP, "GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP"sv, true },
+    { GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION, "GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION"sv, true },
 };
 
 static StringView ioctl_to_stringview(unsigned request)
@@ -355,6 +373,7 @@ ErrorOr<void> DisplayConnector::ioctl(OpenFileDescription&, unsigned request, Us
         properties.doublebuffer_support = double_framebuffering_capable();
         properties.partial_flushing_support = partial_flush_support();
         properties.refresh_rate_support = refresh_rate_support();
+        properties.hardware_cursor_support = hardware_cursor_support();
         properties.max_buffer_bytes = m_shared_framebuffer_vmobject->size();
 
         return copy_to_user(user_properties, &properties);
@@ -505,6 +524,39 @@ ErrorOr<void> DisplayConnector::ioctl(OpenFileDescription&, unsigned request, Us
         TRY(flush_first_surface());
         return {};
     }
+    case GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_BITMAP: {
+        if (!hardware_cursor_support())
+            return Error::from_errno(ENOTSUP);
+        auto user_cursor_bitmap = static_ptr_cast<GraphicsHardwareCursorBitmap const*>(arg);
+        auto cursor_bitmap = TRY(copy_typed_from_user(user_cursor_bitmap));
+        if (!cursor_bitmap.enabled) {
+            SpinlockLocker control_locker(m_control_lock);
+            return disable_hardware_cursor();
+        }
+        if (cursor_bitmap.width == 0 || cursor_bitmap.height == 0)
+            return Error::from_errno(EINVAL);
+        if (cursor_bitmap.width > maximum_hardware_cursor_dimension || cursor_bitmap.height > maximum_hardware_cursor_dimension)
+            return Error::from_errno(EINVAL);
+        if (cursor_bitmap.hotspot_x >= cursor_bitmap.width || cursor_bitmap.hotspot_y >= cursor_bitmap.height)
+            return Error::from_errno(EINVAL);
+        size_t size_in_bytes = static_cast<size_t>(cursor_bitmap.width) * cursor_bitmap.height * sizeof(u32);
+        auto pixels_buffer = TRY(KBuffer::try_create_with_size("HardwareCursorBitmap"sv, size_in_bytes));
+        TRY(copy_from_user(pixels_buffer->data(), cursor_bitmap.argb_pixels, size_in_bytes));
+        SpinlockLocker control_locker(m_control_lock);
+        return set_hardware_cursor_bitmap(cursor_bitmap.width, cursor_bitmap.height, cursor_bitmap.hotspot_x, cursor_bitmap.hotspot_y, pixels_buffer->bytes());
+    }
+    case GRAPHICS_IOCTL_SET_HARDWARE_CURSOR_POSITION: {
+        if (!hardware_cursor_support())
+            return Error::from_errno(ENOTSUP);
+        auto user_cursor_position = static_ptr_cast<GraphicsHardwareCursorPosition const*>(arg);
+        auto cursor_position = TRY(copy_typed_from_user(user_cursor_position));
+        SpinlockLocker control_locker(m_control_lock);
+        // FIXME: We silently ignore the request if we are in console mode,
+        // just like the flushing ioctls do.
+        if (console_mode())
+            return {};
+        return set_hardware_cursor_position(cursor_position.x, cursor_position.y);
+    }
     }
     // Note: We already verify that the IOCTL is supported and not unknown in
     // the call to the ioctl_requires_ownership method, so if we reached this
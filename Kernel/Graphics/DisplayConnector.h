@@ -89,6 +89,12 @@ public:
     // a defined refresh rate being supplied when modesetting the screen resolution.
     // Paravirtualized hardware don't need such setting and can safely ignore this.
     virtual bool refresh_rate_support() const = 0;
+    // Note: This indicates to userland whether the underlying hardware can overlay
+    // a cursor plane on top of the framebuffer, so moving the mouse cursor doesn't
+    // require compositing and flushing the area beneath it.
+    virtual bool hardware_cursor_support() const { return false; }
+
+    static constexpr size_t maximum_hardware_cursor_dimension = 64;
 
     bool console_mode() const;
     ErrorOr<ByteBuffer> get_edid() const;
@@ -112,6 +118,10 @@ protected:
     virtual ErrorOr<void> flush_first_surface() = 0;
     virtual ErrorOr<void> flush_rectangle(size_t buffer_index, FBRect const& rect);
 
+    virtual ErrorOr<void> set_hardware_cursor_bitmap(size_t width, size_t height, size_t hotspot_x, size_t hotspot_y, ReadonlyBytes argb_pixels);
+    virtual ErrorOr<void> disable_hardware_cursor();
+    virtual ErrorOr<void> set_hardware_cursor_position(int x, int y);
+
     ErrorOr<void> initialize_edid_for_generic_monitor(Optional<Array<u8, 3>> manufacturer_id_string);
 
     mutable Spinlock<LockRank::None> m_control_lock {};
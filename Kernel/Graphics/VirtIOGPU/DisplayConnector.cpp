@@ -11,6 +11,7 @@
 #include <Kernel/Graphics/VirtIOGPU/DisplayConnector.h>
 #include <Kernel/Graphics/VirtIOGPU/GraphicsAdapter.h>
 #include <Kernel/Graphics/VirtIOGPU/Protocol.h>
+#include <Kernel/Memory/MemoryManager.h>
 #include <Kernel/Random.h>
 
 namespace Kernel {
@@ -131,6 +132,68 @@ ErrorOr<void> VirtIODisplayConnector::flush_rectangle(size_t buffer_index, FBRec
     return {};
 }
 
+ErrorOr<void> VirtIODisplayConnector::set_hardware_cursor_bitmap(size_t width, size_t height, size_t hotspot_x, size_t hotspot_y, ReadonlyBytes argb_pixels)
+{
+    VERIFY(m_control_lock.is_locked());
+    constexpr size_t cursor_dimension = maximum_hardware_cursor_dimension;
+    VERIFY(width <= cursor_dimension && height <= cursor_dimension);
+    VERIFY(argb_pixels.size() == width * height * sizeof(u32));
+
+    if (!m_cursor_buffer_region) {
+        auto cursor_buffer_size = TRY(Memory::page_round_up(cursor_dimension * cursor_dimension * sizeof(u32)));
+        m_cursor_buffer_region = TRY(MM.allocate_kernel_region(cursor_buffer_size, "VirtIOGPU cursor buffer"sv, Memory::Region::Access::ReadWrite));
+    }
+
+    // Note: The cursor resource is always 64x64, so center smaller bitmaps into
+    // a fully transparent canvas, row by row.
+    auto* cursor_data = m_cursor_buffer_region->vaddr().as_ptr();
+    memset(cursor_data, 0, m_cursor_buffer_region->size());
+    for (size_t row = 0; row < height; row++)
+        memcpy(cursor_data + (row * cursor_dimension * sizeof(u32)), argb_pixels.offset(row * width * sizeof(u32)), width * sizeof(u32));
+
+    SpinlockLocker locker(m_graphics_adapter->operation_lock());
+    if (m_cursor_resource_id.value() == 0) {
+        Graphics::VirtIOGPU::Protocol::Rect const cursor_rect {
+            .x = 0,
+            .y = 0,
+            .width = cursor_dimension,
+            .height = cursor_dimension,
+        };
+        auto resource_id = TRY(m_graphics_adapter->create_2d_resource(cursor_rect));
+        TRY(m_graphics_adapter->ensure_backing_storage(resource_id, *m_cursor_buffer_region, 0, m_cursor_buffer_region->size()));
+        m_cursor_resource_id = resource_id;
+    }
+
+    Graphics::VirtIOGPU::Protocol::Rect const whole_cursor_rect {
+        .x = 0,
+        .y = 0,
+        .width = cursor_dimension,
+        .height = cursor_dimension,
+    };
+    TRY(m_graphics_adapter->transfer_cursor_data_to_host({}, m_cursor_resource_id, whole_cursor_rect));
+    TRY(m_graphics_adapter->update_cursor({}, *this, m_cursor_resource_id, hotspot_x, hotspot_y));
+    return {};
+}
+
+ErrorOr<void> VirtIODisplayConnector::disable_hardware_cursor()
+{
+    VERIFY(m_control_lock.is_locked());
+    SpinlockLocker locker(m_graphics_adapter->operation_lock());
+    // Note: Updating the cursor with an invalid resource hides it on the host.
+    TRY(m_graphics_adapter->update_cursor({}, *this, 0, 0, 0));
+    return {};
+}
+
+ErrorOr<void> VirtIODisplayConnector::set_hardware_cursor_position(int x, int y)
+{
+    VERIFY(m_control_lock.is_locked());
+    if (m_cursor_resource_id.value() == 0)
+        return Error::from_errno(EINVAL);
+    SpinlockLocker locker(m_graphics_adapter->operation_lock());
+    TRY(m_graphics_adapter->move_cursor({}, *this, max(x, 0), max(y, 0)));
+    return {};
+}
+
 ErrorOr<void> VirtIODisplayConnector::flush_first_surface()
 {
     VERIFY(m_flushing_lock.is_locked());
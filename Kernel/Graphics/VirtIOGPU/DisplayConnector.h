@@ -54,10 +54,17 @@ private:
     virtual bool flush_support() const override { return true; }
     // Note: Paravirtualized hardware doesn't require a defined refresh rate for modesetting.
     virtual bool refresh_rate_support() const override { return false; }
+    // Note: The host composes the cursor plane for us, we only need to upload
+    // the cursor bitmap as a resource and send position updates.
+    virtual bool hardware_cursor_support() const override { return true; }
 
     virtual ErrorOr<void> flush_first_surface() override;
     virtual ErrorOr<void> flush_rectangle(size_t buffer_index, FBRect const& rect) override;
 
+    virtual ErrorOr<void> set_hardware_cursor_bitmap(size_t width, size_t height, size_t hotspot_x, size_t hotspot_y, ReadonlyBytes argb_pixels) override;
+    virtual ErrorOr<void> disable_hardware_cursor() override;
+    virtual ErrorOr<void> set_hardware_cursor_position(int x, int y) override;
+
     virtual void enable_console() override;
     virtual void disable_console() override;
 
@@ -80,6 +87,8 @@ private:
 
     NonnullLockRefPtr<VirtIOGraphicsAdapter> m_graphics_adapter;
     LockRefPtr<Graphics::VirtIOGPU::Console> m_console;
+    OwnPtr<Memory::Region> m_cursor_buffer_region;
+    Graphics::VirtIOGPU::ResourceID m_cursor_resource_id { 0 };
     Graphics::VirtIOGPU::Protocol::DisplayInfoResponse::Display m_display_info {};
     Graphics::VirtIOGPU::ScanoutID m_scanout_id;
 
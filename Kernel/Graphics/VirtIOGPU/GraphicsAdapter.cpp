@@ -411,17 +411,22 @@ ErrorOr<void> VirtIOGraphicsAdapter::flush_displayed_image(Graphics::VirtIOGPU::
 }
 
 ErrorOr<void> VirtIOGraphicsAdapter::synchronous_virtio_gpu_command(size_t microseconds_timeout, PhysicalAddress buffer_start, size_t request_size, size_t response_size)
+{
+    return synchronous_virtio_gpu_command_on_queue(CONTROLQ, microseconds_timeout, buffer_start, request_size, response_size);
+}
+
+ErrorOr<void> VirtIOGraphicsAdapter::synchronous_virtio_gpu_command_on_queue(u16 queue_index, size_t microseconds_timeout, PhysicalAddress buffer_start, size_t request_size, size_t response_size)
 {
     VERIFY(m_operation_lock.is_locked());
     VERIFY(microseconds_timeout > 10);
     VERIFY(microseconds_timeout < 100000);
-    auto& queue = get_queue(CONTROLQ);
+    auto& queue = get_queue(queue_index);
     queue.disable_interrupts();
     SpinlockLocker lock(queue.lock());
     VirtIO::QueueChain chain { queue };
     chain.add_buffer_to_chain(buffer_start, request_size, VirtIO::BufferType::DeviceReadable);
     chain.add_buffer_to_chain(buffer_start.offset(request_size), response_size, VirtIO::BufferType::DeviceWritable);
-    supply_chain_and_notify(CONTROLQ, chain);
+    supply_chain_and_notify(queue_index, chain);
     full_memory_barrier();
     size_t current_time = 0;
     ScopeGuard clear_used_buffers([&] {
@@ -444,6 +449,70 @@ ErrorOr<void> VirtIOGraphicsAdapter::flush_dirty_rectangle(Graphics::VirtIOGPU::
     return {};
 }
 
+ErrorOr<void> VirtIOGraphicsAdapter::transfer_cursor_data_to_host(Badge<VirtIODisplayConnector>, Graphics::VirtIOGPU::ResourceID resource_id, Graphics::VirtIOGPU::Protocol::Rect const& rect)
+{
+    VERIFY(m_operation_lock.is_locked());
+    auto writer = create_scratchspace_writer();
+    auto& request = writer.append_structure<Graphics::VirtIOGPU::Protocol::TransferToHost2D>();
+    auto& response = writer.append_structure<Graphics::VirtIOGPU::Protocol::ControlHeader>();
+
+    populate_virtio_gpu_request_header(request.header, Graphics::VirtIOGPU::Protocol::CommandType::VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D, 0);
+    request.offset = (rect.x + (rect.y * DisplayConnector::maximum_hardware_cursor_dimension)) * sizeof(u32);
+    request.resource_id = resource_id.value();
+    request.rect = rect;
+
+    TRY(synchronous_virtio_gpu_command(100, start_of_scratch_space(), sizeof(request), sizeof(response)));
+
+    if (response.type == to_underlying(Graphics::VirtIOGPU::Protocol::CommandType::VIRTIO_GPU_RESP_OK_NODATA))
+        return {};
+    return EIO;
+}
+
+ErrorOr<void> VirtIOGraphicsAdapter::update_cursor(Badge<VirtIODisplayConnector>, VirtIODisplayConnector& connector, Graphics::VirtIOGPU::ResourceID resource_id, size_t hotspot_x, size_t hotspot_y)
+{
+    VERIFY(m_operation_lock.is_locked());
+    auto writer = create_scratchspace_writer();
+    auto& request = writer.append_structure<Graphics::VirtIOGPU::Protocol::UpdateCursor>();
+    auto& response = writer.append_structure<Graphics::VirtIOGPU::Protocol::ControlHeader>();
+
+    populate_virtio_gpu_request_header(request.header, Graphics::VirtIOGPU::Protocol::CommandType::VIRTIO_GPU_CMD_UPDATE_CURSOR, 0);
+    request.pos.scanout_id = connector.scanout_id().value();
+    request.pos.x = 0;
+    request.pos.y = 0;
+    request.pos.padding = 0;
+    request.resource_id = resource_id.value();
+    request.hot_x = hotspot_x;
+    request.hot_y = hotspot_y;
+    request.padding = 0;
+
+    // Note: Cursor commands are processed on the cursor queue and the device
+    // doesn't write a response payload for them, so we only wait for the
+    // command to be consumed instead of checking the response header.
+    TRY(synchronous_virtio_gpu_command_on_queue(CURSORQ, 100, start_of_scratch_space(), sizeof(request), sizeof(response)));
+    return {};
+}
+
+ErrorOr<void> VirtIOGraphicsAdapter::move_cursor(Badge<VirtIODisplayConnector>, VirtIODisplayConnector& connector, size_t x, size_t y)
+{
+    VERIFY(m_operation_lock.is_locked());
+    auto writer = create_scratchspace_writer();
+    auto& request = writer.append_structure<Graphics::VirtIOGPU::Protocol::UpdateCursor>();
+    auto& response = writer.append_structure<Graphics::VirtIOGPU::Protocol::ControlHeader>();
+
+    populate_virtio_gpu_request_header(request.header, Graphics::VirtIOGPU::Protocol::CommandType::VIRTIO_GPU_CMD_MOVE_CURSOR, 0);
+    request.pos.scanout_id = connector.scanout_id().value();
+    request.pos.x = x;
+    request.pos.y = y;
+    request.pos.padding = 0;
+    request.resource_id = 0;
+    request.hot_x = 0;
+    request.hot_y = 0;
+    request.padding = 0;
+
+    TRY(synchronous_virtio_gpu_command_on_queue(CURSORQ, 100, start_of_scratch_space(), sizeof(request), sizeof(response)));
+    return {};
+}
+
 Graphics::VirtIOGPU::ResourceID VirtIOGraphicsAdapter::allocate_resource_id()
 {
     return m_resource_id_counter++;
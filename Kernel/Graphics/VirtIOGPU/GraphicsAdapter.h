@@ -49,6 +49,10 @@ public:
     ErrorOr<void> flush_displayed_image(Badge<VirtIODisplayConnector>, VirtIODisplayConnector&, Graphics::VirtIOGPU::Protocol::Rect const& dirty_rect, bool main_buffer);
     ErrorOr<void> transfer_framebuffer_data_to_host(Badge<VirtIODisplayConnector>, VirtIODisplayConnector&, Graphics::VirtIOGPU::Protocol::Rect const& rect, bool main_buffer);
 
+    ErrorOr<void> transfer_cursor_data_to_host(Badge<VirtIODisplayConnector>, Graphics::VirtIOGPU::ResourceID, Graphics::VirtIOGPU::Protocol::Rect const& rect);
+    ErrorOr<void> update_cursor(Badge<VirtIODisplayConnector>, VirtIODisplayConnector&, Graphics::VirtIOGPU::ResourceID, size_t hotspot_x, size_t hotspot_y);
+    ErrorOr<void> move_cursor(Badge<VirtIODisplayConnector>, VirtIODisplayConnector&, size_t x, size_t y);
+
 private:
     ErrorOr<void> attach_physical_range_to_framebuffer(VirtIODisplayConnector& connector, bool main_buffer, size_t framebuffer_offset, size_t framebuffer_size);
 
@@ -98,6 +102,7 @@ private:
         return { Bytes(m_scratch_space->vaddr().as_ptr(), m_scratch_space->size()) };
     }
     ErrorOr<void> synchronous_virtio_gpu_command(size_t microseconds_timeout, PhysicalAddress buffer_start, size_t request_size, size_t response_size);
+    ErrorOr<void> synchronous_virtio_gpu_command_on_queue(u16 queue_index, size_t microseconds_timeout, PhysicalAddress buffer_start, size_t request_size, size_t response_size);
 
     ErrorOr<Graphics::VirtIOGPU::ResourceID> create_2d_resource(Graphics::VirtIOGPU::Protocol::Rect rect);
     ErrorOr<Graphics::VirtIOGPU::ResourceID> create_3d_resource(Graphics::VirtIOGPU::Protocol::Resource3DSpecification const& resource_3d_specification);
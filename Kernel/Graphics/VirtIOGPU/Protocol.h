@@ -251,6 +251,26 @@ struct ResourceFlush {
     u32 padding;
 };
 
+// Specification equivalent: struct virtio_gpu_cursor_pos
+struct CursorPos {
+    u32 scanout_id;
+    u32 x;
+    u32 y;
+    u32 padding;
+};
+
+// Specification equivalent: struct virtio_gpu_update_cursor
+// Note: The same structure is used for VIRTIO_GPU_CMD_MOVE_CURSOR, which
+// only looks at the pos field.
+struct UpdateCursor {
+    ControlHeader header;
+    CursorPos pos;
+    u32 resource_id;
+    u32 hot_x;
+    u32 hot_y;
+    u32 padding;
+};
+
 // Specification equivalent: struct virtio_gpu_get_edid
 struct GetEDID {
     ControlHeader header;
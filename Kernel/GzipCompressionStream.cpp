@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/GzipCompressionStream.h>
+
+namespace Kernel {
+
+// Process input in sub-chunks no larger than this, with match distances
+// confined to the current sub-chunk. DEFLATE allows distances up to 32768,
+// so this keeps every match trivially in range without a sliding window.
+static constexpr size_t chunk_size = 32 * KiB;
+
+static constexpr size_t minimum_match_length = 3;
+static constexpr size_t maximum_match_length = 258;
+static constexpr u16 no_hash_head = 0xffff;
+
+// RFC 1951, section 3.2.5: base lengths and extra bit counts for the
+// length symbols 257..285.
+struct CodeDescriptor {
+    u16 base;
+    u8 extra_bits;
+};
+static constexpr CodeDescriptor length_codes[] = {
+    { 3, 0 }, { 4, 0 }, { 5, 0 }, { 6, 0 }, { 7, 0 }, { 8, 0 }, { 9, 0 }, { 10, 0 },
+    { 11, 1 }, { 13, 1 }, { 15, 1 }, { 17, 1 },
+    { 19, 2 }, { 23, 2 }, { 27, 2 }, { 31, 2 },
+    { 35, 3 }, { 43, 3 }, { 51, 3 }, { 59, 3 },
+    { 67, 4 }, { 83, 4 }, { 99, 4 }, { 115, 4 },
+    { 131, 5 }, { 163, 5 }, { 195, 5 }, { 227, 5 },
+    { 258, 0 }
+};
+
+// Base distances and extra bit counts for the distance symbols 0..29.
+static constexpr CodeDescriptor distance_codes[] = {
+    { 1, 0 }, { 2, 0 }, { 3, 0 }, { 4, 0 },
+    { 5, 1 }, { 7, 1 }, { 9, 2 }, { 13, 2 },
+    { 17, 3 }, { 25, 3 }, { 33, 4 }, { 49, 4 },
+    { 65, 5 }, { 97, 5 }, { 129, 6 }, { 193, 6 },
+    { 257, 7 }, { 385, 7 }, { 513, 8 }, { 769, 8 },
+    { 1025, 9 }, { 1537, 9 }, { 2049, 10 }, { 3073, 10 },
+    { 4097, 11 }, { 6145, 11 }, { 8193, 12 }, { 12289, 12 },
+    { 16385, 13 }, { 24577, 13 }
+};
+
+ErrorOr<NonnullOwnPtr<GzipCompressionStream>> GzipCompressionStream::try_create(Function<ErrorOr<void>(ReadonlyBytes)> write_callback)
+{
+    return adopt_nonnull_own_or_enomem(new (nothrow) GzipCompressionStream(move(write_callback)));
+}
+
+GzipCompressionStream::GzipCompressionStream(Function<ErrorOr<void>(ReadonlyBytes)> write_callback)
+    : m_write_callback(move(write_callback))
+{
+    // Build the table for the CRC-32 used by gzip (RFC 1952, section 8).
+    for (u32 i = 0; i < 256; ++i) {
+        u32 value = i;
+        for (size_t bit = 0; bit < 8; ++bit)
+            value = (value >> 1) ^ ((value & 1) ? 0xedb88320 : 0);
+        m_crc_table[i] = value;
+    }
+}
+
+ErrorOr<void> GzipCompressionStream::flush_output_buffer()
+{
+    if (m_output_buffer_used == 0)
+        return {};
+    TRY(m_write_callback(ReadonlyBytes { m_output_buffer, m_output_buffer_used }));
+    m_output_buffer_used = 0;
+    return {};
+}
+
+ErrorOr<void> GzipCompressionStream::write_bits(u32 bits, size_t count)
+{
+    // DEFLATE packs bits into bytes starting with the least significant bit.
+    m_bit_buffer |= bits << m_bit_count;
+    m_bit_count += count;
+    while (m_bit_count >= 8) {
+        if (m_output_buffer_used == output_buffer_size)
+            TRY(flush_output_buffer());
+        m_output_buffer[m_output_buffer_used++] = static_cast<u8>(m_bit_buffer);
+        m_bit_buffer >>= 8;
+        m_bit_count -= 8;
+    }
+    return {};
+}
+
+ErrorOr<void> GzipCompressionStream::write_huffman_code(u32 code, size_t length)
+{
+    // Huffman codes are emitted most significant bit first.
+    u32 reversed = 0;
+    for (size_t i = 0; i < length; ++i) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    return write_bits(reversed, length);
+}
+
+ErrorOr<void> GzipCompressionStream::write_literal(u8 literal)
+{
+    // RFC 1951, section 3.2.6: the fixed literal/length code.
+    if (literal < 144)
+        return write_huffman_code(0x30 + literal, 8);
+    return write_huffman_code(0x190 + (literal - 144), 9);
+}
+
+ErrorOr<void> GzipCompressionStream::write_match(size_t length, size_t distance)
+{
+    size_t length_index = array_size(length_codes) - 1;
+    while (length_codes[length_index].base > length)
+        --length_index;
+    size_t symbol = 257 + length_index;
+    if (symbol <= 279)
+        TRY(write_huffman_code(symbol - 256, 7));
+    else
+        TRY(write_huffman_code(0xc0 + (symbol - 280), 8));
+    TRY(write_bits(length - length_codes[length_index].base, length_codes[length_index].extra_bits));
+
+    size_t distance_index = array_size(distance_codes) - 1;
+    while (distance_codes[distance_index].base > distance)
+        --distance_index;
+    TRY(write_huffman_code(distance_index, 5));
+    TRY(write_bits(distance - distance_codes[distance_index].base, distance_codes[distance_index].extra_bits));
+    return {};
+}
+
+ErrorOr<void> GzipCompressionStream::write_gzip_header()
+{
+    // RFC 1952: magic, deflate, no flags, no mtime, no extra flags, OS = unix.
+    static constexpr u8 header[] = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03 };
+    TRY(m_write_callback(ReadonlyBytes { header, sizeof(header) }));
+    // Open the one (final) DEFLATE block, using the fixed Huffman codes.
+    TRY(write_bits(1, 1));
+    TRY(write_bits(1, 2));
+    m_header_written = true;
+    return {};
+}
+
+ErrorOr<void> GzipCompressionStream::compress_chunk(ReadonlyBytes chunk)
+{
+    for (auto& head : m_hash_heads)
+        head = no_hash_head;
+
+    auto const* data = chunk.data();
+    auto size = chunk.size();
+
+    auto hash_at = [&](size_t position) -> u16 {
+        return ((data[position] << 8) ^ (data[position + 1] << 4) ^ data[position + 2]) & (hash_bucket_count - 1);
+    };
+
+    size_t in = 0;
+    while (in < size) {
+        if (in + minimum_match_length <= size) {
+            auto hash = hash_at(in);
+            auto candidate = m_hash_heads[hash];
+            m_hash_heads[hash] = static_cast<u16>(in);
+
+            if (candidate != no_hash_head && candidate < in
+                && data[candidate] == data[in] && data[candidate + 1] == data[in + 1] && data[candidate + 2] == data[in + 2]) {
+                size_t maximum_length = min(maximum_match_length, size - in);
+                size_t match_length = minimum_match_length;
+                while (match_length < maximum_length && data[candidate + match_length] == data[in + match_length])
+                    ++match_length;
+
+                TRY(write_match(match_length, in - candidate));
+                for (size_t i = 1; i < match_length && in + i + minimum_match_length <= size; ++i)
+                    m_hash_heads[hash_at(in + i)] = static_cast<u16>(in + i);
+                in += match_length;
+                continue;
+            }
+        }
+
+        TRY(write_literal(data[in]));
+        ++in;
+    }
+
+    return {};
+}
+
+ErrorOr<void> GzipCompressionStream::write(ReadonlyBytes bytes)
+{
+    VERIFY(!m_finished);
+
+    if (!m_header_written)
+        TRY(write_gzip_header());
+
+    for (auto byte : bytes)
+        m_crc = m_crc_table[(m_crc ^ byte) & 0xff] ^ (m_crc >> 8);
+    m_total_input_size += bytes.size();
+
+    while (!bytes.is_empty()) {
+        auto chunk = bytes.trim(min(chunk_size, bytes.size()));
+        TRY(compress_chunk(chunk));
+        bytes = bytes.slice(chunk.size());
+    }
+
+    return {};
+}
+
+ErrorOr<void> GzipCompressionStream::finish()
+{
+    VERIFY(!m_finished);
+
+    if (!m_header_written)
+        TRY(write_gzip_header());
+
+    // End-of-block symbol (256), then pad the bit stream out to a byte.
+    TRY(write_huffman_code(0, 7));
+    if (m_bit_count > 0)
+        TRY(write_bits(0, 8 - m_bit_count));
+
+    u32 trailer[] = { ~m_crc, m_total_input_size };
+    for (auto value : trailer) {
+        for (size_t i = 0; i < 4; ++i) {
+            if (m_output_buffer_used == output_buffer_size)
+                TRY(flush_output_buffer());
+            m_output_buffer[m_output_buffer_used++] = static_cast<u8>(value >> (i * 8));
+        }
+    }
+
+    TRY(flush_output_buffer());
+    m_finished = true;
+    return {};
+}
+
+}
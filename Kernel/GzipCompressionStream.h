@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+
+namespace Kernel {
+
+// A minimal streaming gzip compressor for kernel use, where LibCompress is
+// not available. It emits a single DEFLATE block using the fixed Huffman
+// codes (RFC 1951, section 3.2.6) wrapped in a gzip container (RFC 1952),
+// so any standard gzip implementation can decompress the output.
+//
+// Compressed bytes are handed to the write callback in large batches; the
+// callback must not re-enter the stream. After finish() the stream must not
+// be written to again.
+class GzipCompressionStream {
+public:
+    static ErrorOr<NonnullOwnPtr<GzipCompressionStream>> try_create(Function<ErrorOr<void>(ReadonlyBytes)> write_callback);
+
+    ErrorOr<void> write(ReadonlyBytes);
+    ErrorOr<void> finish();
+
+private:
+    explicit GzipCompressionStream(Function<ErrorOr<void>(ReadonlyBytes)> write_callback);
+
+    ErrorOr<void> compress_chunk(ReadonlyBytes);
+    ErrorOr<void> write_bits(u32 bits, size_t count);
+    ErrorOr<void> write_huffman_code(u32 code, size_t length);
+    ErrorOr<void> write_literal(u8);
+    ErrorOr<void> write_match(size_t length, size_t distance);
+    ErrorOr<void> write_gzip_header();
+    ErrorOr<void> flush_output_buffer();
+
+    Function<ErrorOr<void>(ReadonlyBytes)> m_write_callback;
+
+    u32 m_crc_table[256];
+    u32 m_crc { 0xffffffff };
+    u32 m_total_input_size { 0 };
+
+    u32 m_bit_buffer { 0 };
+    size_t m_bit_count { 0 };
+
+    static constexpr size_t output_buffer_size = 64 * KiB;
+    u8 m_output_buffer[output_buffer_size];
+    size_t m_output_buffer_used { 0 };
+
+    // Most recent position of each three-byte hash within the current chunk.
+    static constexpr size_t hash_bucket_count = 1 << 12;
+    u16 m_hash_heads[hash_bucket_count];
+
+    bool m_header_written { false };
+    bool m_finished { false };
+};
+
+}
@@ -8,8 +8,10 @@
 #include <AK/Types.h>
 #include <Kernel/Arch/PageDirectory.h>
 #include <Kernel/Debug.h>
+#include <Kernel/Arch/Processor.h>
 #include <Kernel/Heap/Heap.h>
 #include <Kernel/Heap/kmalloc.h>
+#include <Kernel/InterruptDisabler.h>
 #include <Kernel/KSyms.h>
 #include <Kernel/Locking/Spinlock.h>
 #include <Kernel/Memory/MemoryManager.h>
@@ -205,6 +207,76 @@ private:
     KmallocSlabBlock::List m_full_blocks;
 };
 
+static constexpr size_t kmalloc_slab_sizes[] = { 16, 32, 64, 128, 256, 512 };
+static constexpr size_t kmalloc_slab_size_class_count = array_size(kmalloc_slab_sizes);
+
+// Each CPU keeps a small cache of recently freed slabs for every size class,
+// so the hot kmalloc/kfree paths for small objects can skip the global kmalloc
+// spinlock entirely. Only ever touched by the owning CPU with interrupts
+// disabled. Cached slabs count as allocated in the global statistics until
+// they are handed out again.
+struct KmallocCpuCache {
+    static ProcessorSpecificDataID processor_specific_data_id() { return ProcessorSpecificDataID::Kmalloc; }
+
+    struct FreeSlab {
+        FreeSlab* next;
+    };
+
+    struct SizeClass {
+        FreeSlab* freelist { nullptr };
+        size_t slab_count { 0 };
+    };
+
+    static constexpr size_t maximum_slabs_per_size_class = 32;
+
+    SizeClass size_classes[kmalloc_slab_size_class_count];
+};
+
+static void* try_allocate_from_cpu_cache(size_t size, size_t alignment, CallerWillInitializeMemory caller_will_initialize_memory)
+{
+    InterruptDisabler disabler;
+    auto* cache = Processor::current().get_specific<KmallocCpuCache>();
+    if (!cache)
+        return nullptr;
+    for (size_t i = 0; i < kmalloc_slab_size_class_count; ++i) {
+        size_t slab_size = kmalloc_slab_sizes[i];
+        if (size > slab_size || alignment > slab_size)
+            continue;
+        auto& size_class = cache->size_classes[i];
+        if (!size_class.freelist)
+            return nullptr;
+        void* ptr = exchange(size_class.freelist, size_class.freelist->next);
+        --size_class.slab_count;
+        if (caller_will_initialize_memory == CallerWillInitializeMemory::No)
+            memset(ptr, KMALLOC_SCRUB_BYTE, slab_size);
+        return ptr;
+    }
+    return nullptr;
+}
+
+static bool try_deallocate_to_cpu_cache(void* ptr, size_t size)
+{
+    InterruptDisabler disabler;
+    auto* cache = Processor::current().get_specific<KmallocCpuCache>();
+    if (!cache)
+        return false;
+    for (size_t i = 0; i < kmalloc_slab_size_class_count; ++i) {
+        size_t slab_size = kmalloc_slab_sizes[i];
+        if (size > slab_size)
+            continue;
+        auto& size_class = cache->size_classes[i];
+        if (size_class.slab_count >= KmallocCpuCache::maximum_slabs_per_size_class)
+            return false;
+        memset(ptr, KFREE_SCRUB_BYTE, slab_size);
+        auto* free_slab = static_cast<KmallocCpuCache::FreeSlab*>(ptr);
+        free_slab->next = size_class.freelist;
+        size_class.freelist = free_slab;
+        ++size_class.slab_count;
+        return true;
+    }
+    return false;
+}
+
 struct KmallocGlobalData {
     static constexpr size_t minimum_subheap_size = 1 * MiB;
 
@@ -394,7 +466,7 @@ struct KmallocGlobalData {
 
     KmallocSubheap::List subheaps;
 
-    KmallocSlabheap slabheaps[6] = { 16, 32, 64, 128, 256, 512 };
+    KmallocSlabheap slabheaps[kmalloc_slab_size_class_count] = { kmalloc_slab_sizes[0], kmalloc_slab_sizes[1], kmalloc_slab_sizes[2], kmalloc_slab_sizes[3], kmalloc_slab_sizes[4], kmalloc_slab_sizes[5] };
 
     bool expansion_in_progress { false };
 };
@@ -402,8 +474,8 @@ struct KmallocGlobalData {
 READONLY_AFTER_INIT static KmallocGlobalData* g_kmalloc_global;
 alignas(KmallocGlobalData) static u8 g_kmalloc_global_heap[sizeof(KmallocGlobalData)];
 
-static size_t g_kmalloc_call_count;
-static size_t g_kfree_call_count;
+static Atomic<size_t> g_kmalloc_call_count;
+static Atomic<size_t> g_kfree_call_count;
 static size_t g_nested_kfree_calls;
 bool g_dump_kmalloc_stacks;
 
@@ -412,6 +484,11 @@ void kmalloc_enable_expand()
     g_kmalloc_global->enable_expansion();
 }
 
+void kmalloc_initialize_per_cpu_cache()
+{
+    ProcessorSpecific<KmallocCpuCache>::initialize();
+}
+
 UNMAP_AFTER_INIT void kmalloc_init()
 {
     // Zero out heap since it's placed after end_of_kernel_bss.
@@ -431,15 +508,22 @@ static void* kmalloc_impl(size_t size, size_t alignment, CallerWillInitializeMem
     // Alignment must be a power of two.
     VERIFY(is_power_of_two(alignment));
 
-    SpinlockLocker lock(s_lock);
-    ++g_kmalloc_call_count;
+    g_kmalloc_call_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
 
-    if (g_dump_kmalloc_stacks && Kernel::g_kernel_symbols_available) {
-        dbgln("kmalloc({})", size);
-        Kernel::dump_backtrace();
-    }
+    void* ptr = nullptr;
+    if (!g_dump_kmalloc_stacks)
+        ptr = try_allocate_from_cpu_cache(size, alignment, caller_will_initialize_memory);
+
+    if (!ptr) {
+        SpinlockLocker lock(s_lock);
+
+        if (g_dump_kmalloc_stacks && Kernel::g_kernel_symbols_available) {
+            dbgln("kmalloc({})", size);
+            Kernel::dump_backtrace();
+        }
 
-    void* ptr = g_kmalloc_global->allocate(size, alignment, caller_will_initialize_memory);
+        ptr = g_kmalloc_global->allocate(size, alignment, caller_will_initialize_memory);
+    }
 
     Thread* current_thread = Thread::current();
     if (!current_thread)
@@ -482,8 +566,13 @@ void kfree_sized(void* ptr, size_t size)
         Processor::verify_no_spinlocks_held();
     }
 
+    g_kfree_call_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+
+    // Note: Frees that hit the CPU cache don't emit perf events.
+    if (try_deallocate_to_cpu_cache(ptr, size))
+        return;
+
     SpinlockLocker lock(s_lock);
-    ++g_kfree_call_count;
     ++g_nested_kfree_calls;
 
     if (g_nested_kfree_calls == 1) {
@@ -44,6 +44,7 @@ enum class align_val_t : size_t {};
 };
 
 void kmalloc_init();
+void kmalloc_initialize_per_cpu_cache();
 
 void kfree_sized(void*, size_t);
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/Locking/LockProfiling.h>
+
+namespace Kernel::LockProfiling {
+
+Atomic<bool> g_lock_profiling_enabled;
+
+static constexpr size_t site_table_size = 2048;
+// Probing is cut off well before a full table scan so a pathological hash
+// distribution bounds the per-acquisition overhead instead of growing it.
+static constexpr size_t maximum_probe_length = 16;
+
+struct SiteSlot {
+    Atomic<FlatPtr> call_site { 0 };
+    Atomic<u64> acquisitions { 0 };
+    Atomic<u64> contended_acquisitions { 0 };
+    Atomic<u64> total_wait_cycles { 0 };
+};
+
+static SiteSlot s_sites[site_table_size];
+static Atomic<u64> s_dropped_records;
+
+void set_enabled(bool enabled)
+{
+    if (enabled == g_lock_profiling_enabled.load(AK::memory_order_relaxed))
+        return;
+    if (enabled) {
+        // Note: Stragglers that observed the profiler as enabled may still
+        //       be writing into the table while it is being reset; for a
+        //       statistical profiler that slight skew is acceptable.
+        for (auto& slot : s_sites) {
+            slot.call_site.store(0, AK::memory_order_relaxed);
+            slot.acquisitions.store(0, AK::memory_order_relaxed);
+            slot.contended_acquisitions.store(0, AK::memory_order_relaxed);
+            slot.total_wait_cycles.store(0, AK::memory_order_relaxed);
+        }
+        s_dropped_records.store(0, AK::memory_order_relaxed);
+    }
+    g_lock_profiling_enabled.store(enabled, AK::memory_order_relaxed);
+}
+
+void record(FlatPtr call_site, u64 wait_cycles, bool contended)
+{
+    // Lock-free open addressing: a slot is claimed for a call site by
+    // compare-exchanging its address in, and all counters are relaxed
+    // since readers only want statistically coherent totals.
+    size_t index = (call_site >> 2) % site_table_size;
+    for (size_t probe = 0; probe < maximum_probe_length; ++probe) {
+        auto& slot = s_sites[index];
+        FlatPtr slot_site = slot.call_site.load(AK::memory_order_relaxed);
+        if (slot_site == 0) {
+            FlatPtr expected = 0;
+            if (slot.call_site.compare_exchange_strong(expected, call_site, AK::memory_order_relaxed))
+                slot_site = call_site;
+            else
+                slot_site = expected;
+        }
+        if (slot_site == call_site) {
+            slot.acquisitions.fetch_add(1, AK::memory_order_relaxed);
+            if (contended) {
+                slot.contended_acquisitions.fetch_add(1, AK::memory_order_relaxed);
+                slot.total_wait_cycles.fetch_add(wait_cycles, AK::memory_order_relaxed);
+            }
+            return;
+        }
+        index = (index + 1) % site_table_size;
+    }
+    s_dropped_records.fetch_add(1, AK::memory_order_relaxed);
+}
+
+void for_each_site(Function<void(SiteCounters const&)> const& callback)
+{
+    for (auto& slot : s_sites) {
+        auto call_site = slot.call_site.load(AK::memory_order_relaxed);
+        if (call_site == 0)
+            continue;
+        callback(SiteCounters {
+            .call_site = call_site,
+            .acquisitions = slot.acquisitions.load(AK::memory_order_relaxed),
+            .contended_acquisitions = slot.contended_acquisitions.load(AK::memory_order_relaxed),
+            .total_wait_cycles = slot.total_wait_cycles.load(AK::memory_order_relaxed),
+        });
+    }
+}
+
+u64 dropped_records()
+{
+    return s_dropped_records.load(AK::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Function.h>
+#include <AK/Types.h>
+
+namespace Kernel::LockProfiling {
+
+// An optional lock contention profiler. While enabled, every Mutex and
+// Spinlock acquisition is attributed to its call site (keyed by return
+// address) in a fixed-size lock-free table, along with how many of those
+// acquisitions were contended and how many cycles were spent waiting.
+// The table is exported as JSON through /sys/kernel/lock_stats and the
+// profiler is toggled via /sys/kernel/variables/lock_profiling_enabled;
+// when disabled the only cost at each lock site is one relaxed load.
+
+struct SiteCounters {
+    FlatPtr call_site { 0 };
+    u64 acquisitions { 0 };
+    u64 contended_acquisitions { 0 };
+    u64 total_wait_cycles { 0 };
+};
+
+extern Atomic<bool> g_lock_profiling_enabled;
+
+ALWAYS_INLINE bool is_enabled()
+{
+    return g_lock_profiling_enabled.load(AK::memory_order_relaxed);
+}
+
+void set_enabled(bool);
+
+void record(FlatPtr call_site, u64 wait_cycles, bool contended);
+
+void for_each_site(Function<void(SiteCounters const&)> const&);
+u64 dropped_records();
+
+}
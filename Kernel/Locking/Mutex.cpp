@@ -8,6 +8,7 @@
 #include <Kernel/Debug.h>
 #include <Kernel/KSyms.h>
 #include <Kernel/Locking/LockLocation.h>
+#include <Kernel/Locking/LockProfiling.h>
 #include <Kernel/Locking/Mutex.h>
 #include <Kernel/Locking/Spinlock.h>
 #include <Kernel/Thread.h>
@@ -29,6 +30,9 @@ void Mutex::lock(Mode mode, [[maybe_unused]] LockLocation const& location)
     VERIFY(mode != Mode::Unlocked);
     auto* current_thread = Thread::current();
 
+    FlatPtr const lock_site = FlatPtr(__builtin_return_address(0));
+    u64 const acquire_start = LockProfiling::is_enabled() ? Processor::read_cpu_counter() : 0;
+
     SpinlockLocker lock(m_lock);
     bool did_block = false;
     Mode current_mode = m_mode;
@@ -55,6 +59,8 @@ void Mutex::lock(Mode mode, [[maybe_unused]] LockLocation const& location)
             current_thread->holding_lock(*this, 1, location);
         }
 #endif
+        if (LockProfiling::is_enabled())
+            LockProfiling::record(lock_site, 0, false);
         return;
     }
     case Mode::Exclusive: {
@@ -92,6 +98,8 @@ void Mutex::lock(Mode mode, [[maybe_unused]] LockLocation const& location)
 #if LOCK_DEBUG
         current_thread->holding_lock(*this, 1, location);
 #endif
+        if (LockProfiling::is_enabled())
+            LockProfiling::record(lock_site, did_block && acquire_start != 0 ? Processor::read_cpu_counter() - acquire_start : 0, did_block);
         return;
     }
     case Mode::Shared: {
@@ -141,6 +149,8 @@ void Mutex::lock(Mode mode, [[maybe_unused]] LockLocation const& location)
 #if LOCK_DEBUG
         current_thread->holding_lock(*this, 1, location);
 #endif
+        if (LockProfiling::is_enabled())
+            LockProfiling::record(lock_site, did_block && acquire_start != 0 ? Processor::read_cpu_counter() - acquire_start : 0, did_block);
         return;
     }
     default:
@@ -9,6 +9,7 @@
 #include <AK/Atomic.h>
 #include <AK/Types.h>
 #include <Kernel/Arch/Processor.h>
+#include <Kernel/Locking/LockProfiling.h>
 #include <Kernel/Locking/LockRank.h>
 
 namespace Kernel {
@@ -26,8 +27,14 @@ public:
         InterruptsState previous_interrupts_state = processor_interrupts_state();
         Processor::enter_critical();
         Processor::disable_interrupts();
-        while (m_lock.exchange(1, AK::memory_order_acquire) != 0)
+        u64 wait_start = 0;
+        while (m_lock.exchange(1, AK::memory_order_acquire) != 0) {
+            if (wait_start == 0 && LockProfiling::is_enabled())
+                wait_start = Processor::read_cpu_counter();
             Processor::wait_check();
+        }
+        if (LockProfiling::is_enabled()) [[unlikely]]
+            LockProfiling::record(FlatPtr(__builtin_return_address(0)), wait_start != 0 ? Processor::read_cpu_counter() - wait_start : 0, wait_start != 0);
         track_lock_acquire(m_rank);
         return previous_interrupts_state;
     }
@@ -73,14 +80,20 @@ public:
         auto& proc = Processor::current();
         FlatPtr cpu = FlatPtr(&proc);
         FlatPtr expected = 0;
+        u64 wait_start = 0;
         while (!m_lock.compare_exchange_strong(expected, cpu, AK::memory_order_acq_rel)) {
             if (expected == cpu)
                 break;
+            if (wait_start == 0 && LockProfiling::is_enabled())
+                wait_start = Processor::read_cpu_counter();
             Processor::wait_check();
             expected = 0;
         }
-        if (m_recursions == 0)
+        if (m_recursions == 0) {
+            if (LockProfiling::is_enabled()) [[unlikely]]
+                LockProfiling::record(FlatPtr(__builtin_return_address(0)), wait_start != 0 ? Processor::read_cpu_counter() - wait_start : 0, wait_start != 0);
             track_lock_acquire(m_rank);
+        }
         m_recursions++;
         return previous_interrupts_state;
     }
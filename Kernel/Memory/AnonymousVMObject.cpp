@@ -205,7 +205,11 @@ size_t AnonymousVMObject::purge()
         ++total_pages_purged;
     }
 
-    m_was_purged = true;
+    // Slots whose contents live on in the compressed pool were skipped above
+    // (they already hold the shared zero page), so only report a purge when
+    // data was actually thrown away.
+    if (total_pages_purged != 0)
+        m_was_purged = true;
 
     for_each_region([](Region& region) {
         region.remap();
@@ -238,6 +242,22 @@ ErrorOr<void> AnonymousVMObject::set_volatile(bool is_volatile, bool& was_purged
         if (!m_cow_map.is_null())
             m_cow_map = {};
 
+        // Compress what we can into the in-RAM pool and give the raw pages
+        // back to the allocator right away. Anything that doesn't compress or
+        // doesn't fit under the pool cap stays resident and may get purged
+        // under memory pressure, as before.
+        for (size_t i = 0; i < page_count(); ++i) {
+            auto& page = m_physical_pages[i];
+            if (page->is_shared_zero_page())
+                continue;
+            auto compressed_page_or_error = CompressedPage::try_create(*page);
+            if (compressed_page_or_error.is_error())
+                continue;
+            if (m_compressed_pages.try_set(i, compressed_page_or_error.release_value()).is_error())
+                continue;
+            page = MM.shared_zero_page();
+        }
+
         m_volatile = true;
         m_was_purged = false;
 
@@ -260,10 +280,21 @@ ErrorOr<void> AnonymousVMObject::set_volatile(bool is_volatile, bool& was_purged
 
     m_unused_committed_pages = TRY(MM.commit_physical_pages(committed_pages_needed));
 
-    for (auto& page : m_physical_pages) {
-        if (page->is_shared_zero_page())
+    for (size_t i = 0; i < page_count(); ++i) {
+        auto& page = m_physical_pages[i];
+        if (!page->is_shared_zero_page())
+            continue;
+        // Restore compressed pages eagerly, so that clones (and their page
+        // faults) never have to know about them.
+        if (auto compressed_page = m_compressed_pages.take(i); compressed_page.has_value()) {
+            auto new_page = m_unused_committed_pages->take_one();
+            (*compressed_page)->decompress_into(*new_page);
+            page = move(new_page);
+        } else {
             page = MM.lazy_committed_page();
+        }
     }
+    VERIFY(m_compressed_pages.is_empty());
 
     m_volatile = false;
     m_was_purged = false;
@@ -276,6 +307,16 @@ NonnullRefPtr<PhysicalPage> AnonymousVMObject::allocate_committed_page(Badge<Reg
     return m_unused_committed_pages->take_one();
 }
 
+bool AnonymousVMObject::try_restore_compressed_page(Badge<Region>, size_t page_index, PhysicalPage& destination)
+{
+    VERIFY(m_lock.is_locked_by_current_processor());
+    auto compressed_page = m_compressed_pages.take(page_index);
+    if (!compressed_page.has_value())
+        return false;
+    (*compressed_page)->decompress_into(destination);
+    return true;
+}
+
 ErrorOr<void> AnonymousVMObject::ensure_cow_map()
 {
     if (m_cow_map.is_null())
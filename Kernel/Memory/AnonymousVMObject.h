@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <Kernel/Memory/AllocationStrategy.h>
+#include <Kernel/Memory/CompressedPage.h>
 #include <Kernel/Memory/MemoryManager.h>
 #include <Kernel/Memory/PageFaultResponse.h>
 #include <Kernel/Memory/VMObject.h>
@@ -38,6 +40,10 @@ public:
 
     size_t purge();
 
+    // NOTE: Callers must hold m_lock. Returns true if a compressed copy of
+    //       the page existed and was decompressed into the given page.
+    bool try_restore_compressed_page(Badge<Region>, size_t page_index, PhysicalPage& destination);
+
 private:
     class SharedCommittedCowPages;
 
@@ -62,6 +68,10 @@ private:
     Optional<CommittedPhysicalPageSet> m_unused_committed_pages;
     Bitmap m_cow_map;
 
+    // Compressed copies of pages stashed away while this object is volatile,
+    // keyed by page index. Slots with a stashed copy hold the shared zero page.
+    HashMap<size_t, NonnullOwnPtr<CompressedPage>> m_compressed_pages;
+
     // AnonymousVMObject shares committed COW pages with cloned children (happens on fork)
     class SharedCommittedCowPages final : public AtomicRefCounted<SharedCommittedCowPages> {
         AK_MAKE_NONCOPYABLE(SharedCommittedCowPages);
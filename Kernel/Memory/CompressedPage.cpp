@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <Kernel/InterruptDisabler.h>
+#include <Kernel/Memory/CompressedPage.h>
+#include <Kernel/Memory/MemoryManager.h>
+#include <Kernel/Memory/PhysicalPage.h>
+
+namespace Kernel::Memory {
+
+// Compressed pages use a simple byte-oriented LZ encoding: groups of eight
+// items preceded by a control byte, where each control bit selects either a
+// literal byte or a two-byte back-reference (12-bit distance, 4-bit length,
+// covering matches of 3 to 18 bytes). This is cheap enough to run in the
+// page fault path and does well on the mostly-zero and text-like pages that
+// purgeable memory tends to contain.
+static constexpr size_t minimum_match_length = 3;
+static constexpr size_t maximum_match_length = 18;
+static constexpr u16 no_hash_head = 0xffff;
+
+static Atomic<size_t> s_pool_bytes_used { 0 };
+
+static size_t pool_byte_limit()
+{
+    // Cap the compressed pool at 1/8 of physical memory.
+    static Atomic<size_t> s_cached_limit { 0 };
+    auto limit = s_cached_limit.load(AK::memory_order_relaxed);
+    if (limit == 0) {
+        limit = MM.get_system_memory_info().physical_pages * PAGE_SIZE / 8;
+        s_cached_limit.store(limit, AK::memory_order_relaxed);
+    }
+    return limit;
+}
+
+static size_t try_compress(u8 const* source, size_t source_size, u8* destination, size_t destination_capacity)
+{
+    Array<u16, 4096> hash_heads;
+    hash_heads.fill(no_hash_head);
+
+    auto hash_at = [&](size_t position) -> u32 {
+        u32 sequence = source[position] | (source[position + 1] << 8) | (source[position + 2] << 16);
+        return (sequence * 2654435761u) >> 20;
+    };
+
+    size_t in = 0;
+    size_t out = 0;
+    while (in < source_size) {
+        if (out >= destination_capacity)
+            return 0;
+        size_t control_index = out++;
+        u8 control = 0;
+        for (u8 bit = 0; bit < 8 && in < source_size; ++bit) {
+            size_t match_length = 0;
+            size_t match_distance = 0;
+            if (in + minimum_match_length <= source_size) {
+                auto hash = hash_at(in);
+                auto candidate = hash_heads[hash];
+                hash_heads[hash] = static_cast<u16>(in);
+                if (candidate != no_hash_head && candidate < in) {
+                    size_t longest_possible_match = min(maximum_match_length, source_size - in);
+                    size_t length = 0;
+                    while (length < longest_possible_match && source[candidate + length] == source[in + length])
+                        ++length;
+                    if (length >= minimum_match_length) {
+                        match_length = length;
+                        match_distance = in - candidate;
+                    }
+                }
+            }
+            if (match_length != 0) {
+                if (out + 2 > destination_capacity)
+                    return 0;
+                control |= 1 << bit;
+                destination[out++] = match_distance & 0xff;
+                destination[out++] = ((match_distance >> 8) & 0x0f) | ((match_length - minimum_match_length) << 4);
+                // Enter the covered positions into the hash table as well, so
+                // that later matches can refer back into this one.
+                for (size_t i = 1; i < match_length && in + i + minimum_match_length <= source_size; ++i)
+                    hash_heads[hash_at(in + i)] = static_cast<u16>(in + i);
+                in += match_length;
+            } else {
+                if (out >= destination_capacity)
+                    return 0;
+                destination[out++] = source[in++];
+            }
+        }
+        destination[control_index] = control;
+    }
+    return out;
+}
+
+static void decompress(u8 const* source, size_t source_size, u8* destination, size_t destination_size)
+{
+    size_t in = 0;
+    size_t out = 0;
+    while (in < source_size && out < destination_size) {
+        u8 control = source[in++];
+        for (u8 bit = 0; bit < 8 && in < source_size && out < destination_size; ++bit) {
+            if (control & (1 << bit)) {
+                VERIFY(in + 2 <= source_size);
+                size_t distance = source[in] | ((source[in + 1] & 0x0f) << 8);
+                size_t length = (source[in + 1] >> 4) + minimum_match_length;
+                in += 2;
+                VERIFY(distance != 0 && distance <= out);
+                VERIFY(out + length <= destination_size);
+                // NOTE: Byte-by-byte on purpose, matches may overlap themselves.
+                for (size_t i = 0; i < length; ++i, ++out)
+                    destination[out] = destination[out - distance];
+            } else {
+                destination[out++] = source[in++];
+            }
+        }
+    }
+    VERIFY(out == destination_size);
+}
+
+CompressedPage::CompressedPage(ByteBuffer data)
+    : m_data(move(data))
+{
+    s_pool_bytes_used.fetch_add(m_data.size(), AK::memory_order_relaxed);
+}
+
+CompressedPage::~CompressedPage()
+{
+    s_pool_bytes_used.fetch_sub(m_data.size(), AK::memory_order_relaxed);
+}
+
+ErrorOr<NonnullOwnPtr<CompressedPage>> CompressedPage::try_create(PhysicalPage& page)
+{
+    // Racing past the cap by a page or two is harmless, this is a soft limit
+    // on a best-effort cache, so a plain load is good enough here.
+    if (s_pool_bytes_used.load(AK::memory_order_relaxed) >= pool_byte_limit())
+        return ENOSPC;
+
+    auto scratch = TRY(ByteBuffer::create_uninitialized(PAGE_SIZE));
+
+    size_t compressed_size = 0;
+    {
+        InterruptDisabler disabler;
+        auto* source = MM.quickmap_page(page);
+        compressed_size = try_compress(source, PAGE_SIZE, scratch.data(), PAGE_SIZE - 1);
+        MM.unquickmap_page();
+    }
+
+    // Give up on pages that don't actually shrink; keeping them raw lets the
+    // purge path reclaim them the old way.
+    if (compressed_size == 0)
+        return ENOSPC;
+
+    auto data = TRY(ByteBuffer::copy(scratch.data(), compressed_size));
+    return adopt_nonnull_own_or_enomem(new (nothrow) CompressedPage(move(data)));
+}
+
+void CompressedPage::decompress_into(PhysicalPage& page) const
+{
+    InterruptDisabler disabler;
+    auto* destination = MM.quickmap_page(page);
+    decompress(m_data.data(), m_data.size(), destination, PAGE_SIZE);
+    MM.unquickmap_page();
+}
+
+}
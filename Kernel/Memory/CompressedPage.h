@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+
+namespace Kernel::Memory {
+
+class PhysicalPage;
+
+// A compressed in-RAM copy of a single page of anonymous memory.
+//
+// When a purgeable AnonymousVMObject is made volatile, its pages are
+// compressed into these and the raw pages are returned to the page allocator
+// right away; faulting on such a page (or making the object non-volatile
+// again) decompresses the stashed data instead of handing out zeroes.
+//
+// The pool of compressed pages is capped to a fraction of physical memory.
+// Pages that don't compress, or don't fit under the cap, simply stay
+// resident and may be purged (discarded) under memory pressure, exactly as
+// they were before compression existed.
+class CompressedPage {
+    AK_MAKE_NONCOPYABLE(CompressedPage);
+    AK_MAKE_NONMOVABLE(CompressedPage);
+
+public:
+    static ErrorOr<NonnullOwnPtr<CompressedPage>> try_create(PhysicalPage&);
+    ~CompressedPage();
+
+    void decompress_into(PhysicalPage&) const;
+
+    size_t compressed_size() const { return m_data.size(); }
+
+private:
+    explicit CompressedPage(ByteBuffer);
+
+    ByteBuffer m_data;
+};
+
+}
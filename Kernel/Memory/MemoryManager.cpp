@@ -141,11 +141,13 @@ UNMAP_AFTER_INIT void MemoryManager::protect_readonly_after_init_memory()
 {
     SpinlockLocker page_lock(kernel_page_directory().get_lock());
     // Disable writing to the .ro_after_init section
-    for (auto i = (FlatPtr)&start_of_ro_after_init; i < (FlatPtr)&end_of_ro_after_init; i += PAGE_SIZE) {
+    auto start = (FlatPtr)&start_of_ro_after_init;
+    auto end = (FlatPtr)&end_of_ro_after_init;
+    for (auto i = start; i < end; i += PAGE_SIZE) {
         auto& pte = *ensure_pte(kernel_page_directory(), VirtualAddress(i));
         pte.set_writable(false);
-        flush_tlb(&kernel_page_directory(), VirtualAddress(i));
     }
+    flush_tlb(&kernel_page_directory(), VirtualAddress(start), (end - start) / PAGE_SIZE);
 }
 
 void MemoryManager::unmap_text_after_init()
@@ -159,8 +161,8 @@ void MemoryManager::unmap_text_after_init()
     for (auto i = start; i < end; i += PAGE_SIZE) {
         auto& pte = *ensure_pte(kernel_page_directory(), VirtualAddress(i));
         pte.clear();
-        flush_tlb(&kernel_page_directory(), VirtualAddress(i));
     }
+    flush_tlb(&kernel_page_directory(), VirtualAddress(start), (end - start) / PAGE_SIZE);
 
     dmesgln("Unmapped {} KiB of kernel text after init! :^)", (end - start) / KiB);
 }
@@ -175,8 +177,8 @@ UNMAP_AFTER_INIT void MemoryManager::protect_ksyms_after_init()
     for (auto i = start; i < end; i += PAGE_SIZE) {
         auto& pte = *ensure_pte(kernel_page_directory(), VirtualAddress(i));
         pte.set_writable(false);
-        flush_tlb(&kernel_page_directory(), VirtualAddress(i));
     }
+    flush_tlb(&kernel_page_directory(), VirtualAddress(start), (end - start) / PAGE_SIZE);
 
     dmesgln("Write-protected kernel symbols after init.");
 }
@@ -652,6 +654,7 @@ UNMAP_AFTER_INIT void MemoryManager::initialize(u32 cpu)
 {
     dmesgln("Initialize MMU");
     ProcessorSpecific<MemoryManagerData>::initialize();
+    kmalloc_initialize_per_cpu_cache();
 
     if (cpu == 0) {
         new MemoryManager;
@@ -751,10 +754,41 @@ PageFaultResponse MemoryManager::handle_page_fault(PageFault const& fault)
         return PageFaultResponse::ShouldCrash;
     }
     dbgln_if(PAGE_FAULT_DEBUG, "MM: CPU[{}] handle_page_fault({:#04x}) at {}", Processor::current_id(), fault.code(), fault.vaddr());
-    auto* region = find_region_from_vaddr(fault.vaddr());
+
+    // Most faults hit the same region as the previous fault taken by this
+    // thread (think zero-fill or CoW sweeps across a mapping), so first try
+    // the thread's one-entry cache before walking the region tree.
+    auto* current_thread = Thread::current();
+    if (current_thread) {
+        auto& cache = current_thread->region_lookup_cache();
+        if (cache.region && cache.tree->generation() == cache.generation && cache.region->contains(fault.vaddr()))
+            return cache.region->handle_fault(fault);
+    }
+
+    // Snapshot the owning tree's generation before looking the region up, so
+    // that a concurrent mutation can only make a cached entry look stale,
+    // never valid.
+    Region* region = nullptr;
+    RegionTree const* region_tree = nullptr;
+    u64 generation = 0;
+    if (!is_user_address(fault.vaddr())) {
+        region = m_global_data.with([&](auto& global_data) {
+            region_tree = &global_data.region_tree;
+            generation = global_data.region_tree.generation();
+            return global_data.region_tree.find_region_containing(fault.vaddr());
+        });
+    } else if (auto page_directory = PageDirectory::find_current()) {
+        auto* address_space = page_directory->address_space();
+        VERIFY(address_space);
+        region_tree = &address_space->region_tree();
+        generation = region_tree->generation();
+        region = find_user_region_from_vaddr(*address_space, fault.vaddr());
+    }
     if (!region) {
         return PageFaultResponse::ShouldCrash;
     }
+    if (current_thread)
+        current_thread->region_lookup_cache() = { region_tree, generation, region };
     return region->handle_fault(fault);
 }
 
@@ -892,6 +926,18 @@ void MemoryManager::uncommit_physical_pages(Badge<CommittedPhysicalPageSet>, siz
 
 void MemoryManager::deallocate_physical_page(PhysicalAddress paddr)
 {
+    {
+        // Fast path: stash the page in the current CPU's magazine so it can be
+        // handed right back out without taking the global lock. Pages in a
+        // magazine stay accounted as used until they drain back to a zone.
+        InterruptDisabler disabler;
+        auto& magazine = get_data().m_page_magazine;
+        if (magazine.size() < MemoryManagerData::page_magazine_capacity) {
+            magazine.unchecked_append(PhysicalPage::create(paddr));
+            return;
+        }
+    }
+
     return m_global_data.with([&](auto& global_data) {
         // Are we returning a user page?
         for (auto& region : global_data.physical_regions) {
@@ -955,6 +1001,24 @@ NonnullRefPtr<PhysicalPage> MemoryManager::allocate_committed_physical_page(Badg
 
 ErrorOr<NonnullRefPtr<PhysicalPage>> MemoryManager::allocate_physical_page(ShouldZeroFill should_zero_fill, bool* did_purge)
 {
+    {
+        // Fast path: grab a page from the current CPU's magazine without
+        // touching the global lock.
+        InterruptDisabler disabler;
+        auto& magazine = get_data().m_page_magazine;
+        if (!magazine.is_empty()) {
+            auto page = magazine.take_last();
+            if (should_zero_fill == ShouldZeroFill::Yes) {
+                auto* ptr = quickmap_page(*page);
+                memset(ptr, 0, PAGE_SIZE);
+                unquickmap_page();
+            }
+            if (did_purge)
+                *did_purge = false;
+            return page;
+        }
+    }
+
     return m_global_data.with([&](auto&) -> ErrorOr<NonnullRefPtr<PhysicalPage>> {
         auto page = find_free_physical_page(false);
         bool purged_pages = false;
@@ -998,6 +1062,19 @@ ErrorOr<NonnullRefPtr<PhysicalPage>> MemoryManager::allocate_physical_page(Shoul
             return ENOMEM;
         }
 
+        // Since we're paying for the global lock anyway, refill the current
+        // CPU's magazine so the next few allocations don't have to take it.
+        {
+            InterruptDisabler disabler;
+            auto& magazine = get_data().m_page_magazine;
+            while (magazine.size() < MemoryManagerData::page_magazine_capacity / 2) {
+                auto extra_page = find_free_physical_page(false);
+                if (!extra_page)
+                    break;
+                magazine.unchecked_append(extra_page.release_nonnull());
+            }
+        }
+
         if (should_zero_fill == ShouldZeroFill::Yes) {
             auto* ptr = quickmap_page(*page);
             memset(ptr, 0, PAGE_SIZE);
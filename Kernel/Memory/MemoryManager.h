@@ -89,6 +89,13 @@ struct MemoryManagerData {
 
     Spinlock<LockRank::None> m_quickmap_in_use {};
     InterruptsState m_quickmap_previous_interrupts_state;
+
+    // A small per-CPU magazine of free physical pages, so the common single
+    // page allocation and deallocation paths don't have to take the global
+    // MM lock and walk the zone allocator. Only ever touched by the owning
+    // CPU with interrupts disabled.
+    static constexpr size_t page_magazine_capacity = 16;
+    Vector<NonnullRefPtr<PhysicalPage>, page_magazine_capacity> m_page_magazine;
 };
 
 // This class represents a set of committed physical pages.
@@ -126,8 +133,10 @@ private:
 class MemoryManager {
     friend class PageDirectory;
     friend class AnonymousVMObject;
+    friend class CompressedPage;
     friend class Region;
     friend class RegionTree;
+    friend class SharedInodeVMObject;
     friend class VMObject;
     friend struct ::KmallocGlobalData;
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/StringView.h>
 #include <Kernel/Arch/PageDirectory.h>
 #include <Kernel/Arch/PageFault.h>
@@ -288,7 +289,7 @@ void Region::set_page_directory(PageDirectory& page_directory)
     m_page_directory = page_directory;
 }
 
-ErrorOr<void> Region::map(PageDirectory& page_directory, ShouldFlushTLB should_flush_tlb)
+ErrorOr<void> Region::map(PageDirectory& page_directory, ShouldFlushTLB should_flush_tlb, ShouldPopulatePageTables should_populate_page_tables)
 {
     SpinlockLocker page_lock(page_directory.get_lock());
 
@@ -298,6 +299,12 @@ ErrorOr<void> Region::map(PageDirectory& page_directory, ShouldFlushTLB should_f
     }
 
     set_page_directory(page_directory);
+
+    // The caller may want to defer page table population until the pages are
+    // actually touched, in which case handle_fault() will materialize them
+    // one at a time.
+    if (should_populate_page_tables == ShouldPopulatePageTables::No)
+        return {};
     size_t page_index = 0;
     while (page_index < page_count()) {
         if (!map_individual_page_impl(page_index))
@@ -360,7 +367,13 @@ PageFaultResponse Region::handle_fault(PageFault const& fault)
         }
         if (vmobject().is_inode()) {
             dbgln_if(PAGE_FAULT_DEBUG, "NP(inode) fault in Region({})[{}]", this, page_index_in_region);
-            return handle_inode_fault(page_index_in_region);
+            auto response = handle_inode_fault(page_index_in_region);
+            // Sequential reads of a mapped file would otherwise take one fault
+            // per page; opportunistically map nearby pages that are already
+            // resident while we're here.
+            if (response == PageFaultResponse::Continue && fault.is_read())
+                fault_around(page_index_in_region);
+            return response;
         }
 
         SpinlockLocker vmobject_locker(vmobject().m_lock);
@@ -373,6 +386,17 @@ PageFaultResponse Region::handle_fault(PageFault const& fault)
                 return PageFaultResponse::OutOfMemory;
             return PageFaultResponse::Continue;
         }
+        if (page_slot) {
+            // The region was mapped without populating its page tables, and this
+            // page simply hasn't been materialized yet; do that now. If this is a
+            // write to a CoW page, it gets mapped read-only here and the retried
+            // instruction will take the protection violation path below.
+            dbgln_if(PAGE_FAULT_DEBUG, "NP(lazy) fault in Region({})[{}] at {}", this, page_index_in_region, fault.vaddr());
+            auto page_index_in_vmobject = translate_to_vmobject_page(page_index_in_region);
+            if (!remap_vmobject_page(page_index_in_vmobject, *page_slot))
+                return PageFaultResponse::OutOfMemory;
+            return PageFaultResponse::Continue;
+        }
         dbgln("BUG! Unexpected NP fault at {}", fault.vaddr());
         dbgln("     - Physical page slot pointer: {:p}", page_slot.ptr());
         if (page_slot) {
@@ -432,6 +456,9 @@ PageFaultResponse Region::handle_zero_fault(size_t page_index_in_region, Physica
             // Someone else already faulted in a new page in this slot. That's fine, we'll just remap with their page.
             new_physical_page = page_slot;
         } else {
+            // If a compressed copy of this page is stashed away, this is not
+            // really a zero fault; refill the new page from the stash instead.
+            static_cast<AnonymousVMObject&>(*m_vmobject).try_restore_compressed_page({}, page_index_in_vmobject, *new_physical_page);
             // Install the newly allocated page into the VMObject.
             page_slot = new_physical_page;
         }
@@ -545,6 +572,58 @@ PageFaultResponse Region::handle_inode_fault(size_t page_index_in_region)
     return PageFaultResponse::Continue;
 }
 
+void Region::fault_around(size_t page_index_in_region)
+{
+    // Map the already-resident pages in a small aligned window around the
+    // faulting page. This never starts any I/O: pages that aren't resident
+    // still take their own fault. The window is aligned so that two faults
+    // landing in the same window don't redo each other's work.
+    constexpr size_t fault_around_page_count = 16;
+    static_assert(is_power_of_two(fault_around_page_count));
+
+    size_t window_begin = page_index_in_region & ~(fault_around_page_count - 1);
+    size_t window_end = min(window_begin + fault_around_page_count, page_count());
+
+    Array<RefPtr<PhysicalPage>, fault_around_page_count> pages;
+    {
+        SpinlockLocker vmobject_locker(vmobject().m_lock);
+        for (size_t i = window_begin; i < window_end; ++i) {
+            if (i == page_index_in_region)
+                continue;
+            pages[i - window_begin] = vmobject().physical_pages()[translate_to_vmobject_page(i)];
+        }
+    }
+
+    SpinlockLocker page_lock(m_page_directory->get_lock());
+    for (size_t i = window_begin; i < window_end; ++i) {
+        auto const& page = pages[i - window_begin];
+        if (page.is_null())
+            continue;
+        // A failure here is harmless; the page will simply take its own fault.
+        (void)map_individual_page_impl(i, page);
+    }
+    MemoryManager::flush_tlb(m_page_directory, vaddr_from_page_index(window_begin), window_end - window_begin);
+}
+
+void Region::populate_pages_from_inode()
+{
+    VERIFY(vmobject().is_inode());
+
+    for (size_t i = 0; i < page_count(); ++i) {
+        bool page_is_resident = false;
+        {
+            SpinlockLocker vmobject_locker(vmobject().m_lock);
+            page_is_resident = !vmobject().physical_pages()[translate_to_vmobject_page(i)].is_null();
+        }
+        if (page_is_resident)
+            continue;
+        // A BusError just means we walked past the end of the file; anything
+        // the process actually touches past EOF will still fault normally.
+        if (handle_inode_fault(i) != PageFaultResponse::Continue)
+            break;
+    }
+}
+
 RefPtr<PhysicalPage> Region::physical_page(size_t index) const
 {
     SpinlockLocker vmobject_locker(vmobject().m_lock);
@@ -30,6 +30,11 @@ enum class ShouldFlushTLB {
     Yes,
 };
 
+enum class ShouldPopulatePageTables {
+    No,
+    Yes,
+};
+
 class Region final
     : public LockWeakable<Region> {
     friend class AddressSpace;
@@ -191,7 +196,7 @@ public:
     void unsafe_clear_access() { m_access = Region::None; }
 
     void set_page_directory(PageDirectory&);
-    ErrorOr<void> map(PageDirectory&, ShouldFlushTLB = ShouldFlushTLB::Yes);
+    ErrorOr<void> map(PageDirectory&, ShouldFlushTLB = ShouldFlushTLB::Yes, ShouldPopulatePageTables = ShouldPopulatePageTables::Yes);
     void unmap(ShouldFlushTLB = ShouldFlushTLB::Yes);
     void unmap_with_locks_held(ShouldFlushTLB, SpinlockLocker<RecursiveSpinlock<LockRank::None>>& pd_locker);
 
@@ -201,6 +206,11 @@ public:
 
     void clear_to_zero();
 
+    // Faults in every not-yet-resident page of an inode-backed region, as if
+    // the caller had touched each of them in turn. Best-effort: on failure the
+    // remaining pages are simply left to be demand-paged as usual.
+    void populate_pages_from_inode();
+
     [[nodiscard]] bool is_syscall_region() const { return m_syscall_region; }
     void set_syscall_region(bool b) { m_syscall_region = b; }
 
@@ -224,6 +234,7 @@ private:
 
     [[nodiscard]] PageFaultResponse handle_cow_fault(size_t page_index);
     [[nodiscard]] PageFaultResponse handle_inode_fault(size_t page_index);
+    void fault_around(size_t page_index);
     [[nodiscard]] PageFaultResponse handle_zero_fault(size_t page_index, PhysicalPage& page_in_slot_at_time_of_fault);
 
     [[nodiscard]] bool map_individual_page_impl(size_t page_index);
@@ -9,12 +9,19 @@
 #include <Kernel/Memory/MemoryManager.h>
 #include <Kernel/Memory/RegionTree.h>
 #include <Kernel/Random.h>
+#include <Kernel/Thread.h>
 
 namespace Kernel::Memory {
 
 RegionTree::~RegionTree()
 {
     delete_all_regions_assuming_they_are_unmapped();
+
+    // The current thread may still have this tree in its region lookup cache
+    // (e.g. an exec'ing thread tearing down its old address space); make sure
+    // the cache cannot dangle.
+    if (auto* current_thread = Thread::current(); current_thread && current_thread->region_lookup_cache().tree == this)
+        current_thread->region_lookup_cache() = {};
 }
 
 void RegionTree::delete_all_regions_assuming_they_are_unmapped()
@@ -25,6 +32,7 @@ void RegionTree::delete_all_regions_assuming_they_are_unmapped()
         m_regions.remove(region.vaddr().get());
         delete &region;
     }
+    bump_generation();
 }
 
 ErrorOr<VirtualRange> RegionTree::allocate_range_anywhere(size_t size, size_t alignment)
@@ -134,6 +142,7 @@ ErrorOr<void> RegionTree::place_anywhere(Region& region, RandomizeVirtualAddress
     auto range = TRY(randomize_virtual_address == RandomizeVirtualAddress::Yes ? allocate_range_randomized(size, alignment) : allocate_range_anywhere(size, alignment));
     region.m_range = range;
     m_regions.insert(region.vaddr().get(), region);
+    bump_generation();
     return {};
 }
 
@@ -142,12 +151,16 @@ ErrorOr<void> RegionTree::place_specifically(Region& region, VirtualRange const&
     auto allocated_range = TRY(allocate_range_specific(range.base(), range.size()));
     region.m_range = allocated_range;
     m_regions.insert(region.vaddr().get(), region);
+    bump_generation();
     return {};
 }
 
 bool RegionTree::remove(Region& region)
 {
-    return m_regions.remove(region.range().base().get());
+    bool removed = m_regions.remove(region.range().base().get());
+    if (removed)
+        bump_generation();
+    return removed;
 }
 
 Region* RegionTree::find_region_containing(VirtualAddress address)
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Error.h>
 #include <AK/IntrusiveRedBlackTree.h>
 #include <Kernel/Locking/Spinlock.h>
@@ -50,13 +51,21 @@ public:
     Region* find_region_containing(VirtualAddress);
     Region* find_region_containing(VirtualRange);
 
+    // Incremented whenever a region is inserted into or removed from the tree.
+    // Lets the page fault path validate Thread's one-entry region cache without
+    // walking the tree again.
+    u64 generation() const { return m_generation.load(AK::MemoryOrder::memory_order_relaxed); }
+
 private:
     ErrorOr<VirtualRange> allocate_range_anywhere(size_t size, size_t alignment = PAGE_SIZE);
     ErrorOr<VirtualRange> allocate_range_specific(VirtualAddress base, size_t size);
     ErrorOr<VirtualRange> allocate_range_randomized(size_t size, size_t alignment = PAGE_SIZE);
 
+    void bump_generation() { m_generation.fetch_add(1, AK::MemoryOrder::memory_order_relaxed); }
+
     IntrusiveRedBlackTree<&Region::m_tree_node> m_regions;
     VirtualRange const m_total_range;
+    Atomic<u64> m_generation { 0 };
 };
 
 }
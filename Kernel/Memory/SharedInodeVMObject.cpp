@@ -5,8 +5,10 @@
  */
 
 #include <Kernel/FileSystem/Inode.h>
+#include <Kernel/InterruptDisabler.h>
 #include <Kernel/Locking/Spinlock.h>
 #include <Kernel/Memory/SharedInodeVMObject.h>
+#include <Kernel/UserOrKernelBuffer.h>
 
 namespace Kernel::Memory {
 
@@ -49,6 +51,65 @@ SharedInodeVMObject::SharedInodeVMObject(SharedInodeVMObject const& other, Fixed
 {
 }
 
+ErrorOr<bool> SharedInodeVMObject::try_read_resident_range(off_t offset, size_t length, UserOrKernelBuffer& buffer) const
+{
+    size_t copied = 0;
+    while (copied < length) {
+        size_t current_offset = offset + copied;
+        size_t page_index = current_offset / PAGE_SIZE;
+        size_t offset_in_page = current_offset % PAGE_SIZE;
+        size_t chunk = min(length - copied, PAGE_SIZE - offset_in_page);
+
+        // Copy the page into a bounce buffer under the lock; writing to the
+        // (possibly paged-out) destination buffer must happen without it.
+        u8 page_buffer[PAGE_SIZE];
+        {
+            SpinlockLocker locker(m_lock);
+            if (page_index >= page_count())
+                return false;
+            auto& physical_page = m_physical_pages[page_index];
+            if (!physical_page)
+                return false;
+            MM.copy_physical_page(*physical_page, page_buffer);
+        }
+
+        TRY(buffer.write(page_buffer + offset_in_page, copied, chunk));
+        copied += chunk;
+    }
+    return true;
+}
+
+ErrorOr<void> SharedInodeVMObject::write_to_resident_range(off_t offset, size_t length, UserOrKernelBuffer const& source)
+{
+    size_t copied = 0;
+    while (copied < length) {
+        size_t current_offset = offset + copied;
+        size_t page_index = current_offset / PAGE_SIZE;
+        size_t offset_in_page = current_offset % PAGE_SIZE;
+        size_t chunk = min(length - copied, PAGE_SIZE - offset_in_page);
+
+        if (page_index >= page_count())
+            return {};
+
+        // Read from the (possibly paged-out) source buffer before taking the
+        // lock, then copy into the resident page if it is still there.
+        u8 chunk_buffer[PAGE_SIZE];
+        TRY(source.read(chunk_buffer, copied, chunk));
+        {
+            SpinlockLocker locker(m_lock);
+            auto& physical_page = m_physical_pages[page_index];
+            if (physical_page) {
+                InterruptDisabler disabler;
+                auto* destination = MM.quickmap_page(*physical_page);
+                memcpy(destination + offset_in_page, chunk_buffer, chunk);
+                MM.unquickmap_page();
+            }
+        }
+        copied += chunk;
+    }
+    return {};
+}
+
 ErrorOr<void> SharedInodeVMObject::sync(off_t offset_in_pages, size_t pages)
 {
     SpinlockLocker locker(m_lock);
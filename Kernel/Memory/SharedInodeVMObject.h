@@ -21,6 +21,16 @@ public:
 
     ErrorOr<void> sync(off_t offset_in_pages = 0, size_t pages = -1);
 
+    // Copies the given byte range out of resident pages into the buffer.
+    // Returns false (without having written the whole range) if any page in
+    // the range is not resident; the caller should then read through the
+    // file system instead.
+    ErrorOr<bool> try_read_resident_range(off_t offset, size_t length, UserOrKernelBuffer&) const;
+
+    // Updates any resident pages overlapping the given byte range with file
+    // contents that have already been written through to disk.
+    ErrorOr<void> write_to_resident_range(off_t offset, size_t length, UserOrKernelBuffer const&);
+
 private:
     virtual bool is_shared_inode() const override { return true; }
 
@@ -187,6 +187,29 @@ PortAllocationResult IPv4Socket::allocate_local_port_if_needed()
     return { m_local_port, true };
 }
 
+RoutingDecision IPv4Socket::cached_route_to(IPv4Address const& target, IPv4Address const& source, LockRefPtr<NetworkAdapter> const through, AllowUsingGateway allow_using_gateway)
+{
+    auto generation = routing_table_generation();
+    if (!m_cached_routing_decision.is_zero()
+        && m_cached_route_generation == generation
+        && m_cached_route_target == target
+        && m_cached_route_source == source
+        && m_cached_route_allow_using_gateway == allow_using_gateway
+        && (!through || through == m_cached_routing_decision.adapter)) {
+        return m_cached_routing_decision;
+    }
+
+    auto routing_decision = route_to(target, source, through, allow_using_gateway);
+    if (!routing_decision.is_zero()) {
+        m_cached_routing_decision = routing_decision;
+        m_cached_route_target = target;
+        m_cached_route_source = source;
+        m_cached_route_allow_using_gateway = allow_using_gateway;
+        m_cached_route_generation = generation;
+    }
+    return routing_decision;
+}
+
 ErrorOr<size_t> IPv4Socket::sendto(OpenFileDescription&, UserOrKernelBuffer const& data, size_t data_length, [[maybe_unused]] int flags, Userspace<sockaddr const*> addr, socklen_t addr_length)
 {
     MutexLocker locker(mutex());
@@ -211,7 +234,7 @@ ErrorOr<size_t> IPv4Socket::sendto(OpenFileDescription&, UserOrKernelBuffer cons
         return set_so_error(EPIPE);
 
     auto allow_using_gateway = ((flags & MSG_DONTROUTE) || m_routing_disabled) ? AllowUsingGateway::No : AllowUsingGateway::Yes;
-    auto routing_decision = route_to(m_peer_address, m_local_address, bound_interface(), allow_using_gateway);
+    auto routing_decision = cached_route_to(m_peer_address, m_local_address, bound_interface(), allow_using_gateway);
     if (routing_decision.is_zero())
         return set_so_error(EHOSTUNREACH);
 
@@ -504,10 +527,10 @@ ErrorOr<NonnullOwnPtr<KString>> IPv4Socket::pseudo_path(OpenFileDescription cons
     return KString::try_create(builder.string_view());
 }
 
-ErrorOr<void> IPv4Socket::setsockopt(int level, int option, Userspace<void const*> user_value, socklen_t user_value_size)
+ErrorOr<void> IPv4Socket::setsockopt(OpenFileDescription& description, int level, int option, Userspace<void const*> user_value, socklen_t user_value_size)
 {
     if (level != IPPROTO_IP)
-        return Socket::setsockopt(level, option, user_value, user_value_size);
+        return Socket::setsockopt(description, level, option, user_value, user_value_size);
 
     MutexLocker locker(mutex());
 
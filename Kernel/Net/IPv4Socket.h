@@ -13,6 +13,7 @@
 #include <Kernel/Locking/MutexProtected.h>
 #include <Kernel/Net/IPv4.h>
 #include <Kernel/Net/IPv4SocketTuple.h>
+#include <Kernel/Net/Routing.h>
 #include <Kernel/Net/Socket.h>
 
 namespace Kernel {
@@ -41,7 +42,7 @@ public:
     virtual bool can_write(OpenFileDescription const&, u64) const override;
     virtual ErrorOr<size_t> sendto(OpenFileDescription&, UserOrKernelBuffer const&, size_t, int, Userspace<sockaddr const*>, socklen_t) override;
     virtual ErrorOr<size_t> recvfrom(OpenFileDescription&, UserOrKernelBuffer&, size_t, int flags, Userspace<sockaddr*>, Userspace<socklen_t*>, Time&, bool blocking) override;
-    virtual ErrorOr<void> setsockopt(int level, int option, Userspace<void const*>, socklen_t) override;
+    virtual ErrorOr<void> setsockopt(OpenFileDescription&, int level, int option, Userspace<void const*>, socklen_t) override;
     virtual ErrorOr<void> getsockopt(OpenFileDescription&, int level, int option, Userspace<void*>, Userspace<socklen_t*>) override;
 
     virtual ErrorOr<void> ioctl(OpenFileDescription&, unsigned request, Userspace<void*> arg) override;
@@ -95,6 +96,14 @@ protected:
     static ErrorOr<NonnullOwnPtr<DoubleBuffer>> try_create_receive_buffer();
     void drop_receive_buffer();
 
+    size_t space_in_receive_buffer() const { return m_receive_buffer ? m_receive_buffer->space_for_writing() : 0; }
+
+    // Wraps route_to() with a per-socket cache. Most sockets talk to a single
+    // peer for their entire lifetime, so the previous decision is reused as
+    // long as the routing/ARP tables haven't changed since it was made.
+    // Callers must hold mutex().
+    RoutingDecision cached_route_to(IPv4Address const& target, IPv4Address const& source, LockRefPtr<NetworkAdapter> const through = nullptr, AllowUsingGateway = AllowUsingGateway::Yes);
+
 private:
     virtual bool is_ipv4() const override { return true; }
 
@@ -134,6 +143,12 @@ private:
 
     OwnPtr<KBuffer> m_scratch_buffer;
 
+    RoutingDecision m_cached_routing_decision;
+    IPv4Address m_cached_route_target;
+    IPv4Address m_cached_route_source;
+    AllowUsingGateway m_cached_route_allow_using_gateway { AllowUsingGateway::Yes };
+    u32 m_cached_route_generation { 0 };
+
     IntrusiveListNode<IPv4Socket> m_list_node;
 
 public:
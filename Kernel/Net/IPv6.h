@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Endian.h>
+#include <AK/IPv6Address.h>
+#include <AK/Types.h>
+
+namespace Kernel {
+
+// Next Header values we care about; the numbering space is shared with
+// the IPv4 protocol field (RFC 8200 section 3).
+enum class IPv6NextHeader : u8 {
+    HopByHopOptions = 0,
+    TCP = 6,
+    UDP = 17,
+    ICMPv6 = 58,
+    NoNextHeader = 59,
+};
+
+class [[gnu::packed]] IPv6PacketHeader {
+public:
+    u8 version() const { return (m_version_and_traffic >> 28) & 0xf; }
+    void set_version(u8 version) { m_version_and_traffic = (m_version_and_traffic & ~0xf0000000) | ((u32)version << 28); }
+
+    u8 traffic_class() const { return (m_version_and_traffic >> 20) & 0xff; }
+    void set_traffic_class(u8 traffic_class) { m_version_and_traffic = (m_version_and_traffic & ~0x0ff00000) | ((u32)traffic_class << 20); }
+
+    u32 flow_label() const { return m_version_and_traffic & 0xfffff; }
+    void set_flow_label(u32 flow_label) { m_version_and_traffic = (m_version_and_traffic & ~0xfffff) | (flow_label & 0xfffff); }
+
+    // Unlike IPv4, this does NOT include the fixed header.
+    u16 payload_length() const { return m_payload_length; }
+    void set_payload_length(u16 payload_length) { m_payload_length = payload_length; }
+
+    u8 next_header() const { return m_next_header; }
+    void set_next_header(u8 next_header) { m_next_header = next_header; }
+
+    u8 hop_limit() const { return m_hop_limit; }
+    void set_hop_limit(u8 hop_limit) { m_hop_limit = hop_limit; }
+
+    IPv6Address const& source() const { return m_source; }
+    void set_source(IPv6Address const& address) { m_source = address; }
+
+    IPv6Address const& destination() const { return m_destination; }
+    void set_destination(IPv6Address const& address) { m_destination = address; }
+
+    void* payload() { return this + 1; }
+    void const* payload() const { return this + 1; }
+
+private:
+    NetworkOrdered<u32> m_version_and_traffic;
+    NetworkOrdered<u16> m_payload_length;
+    u8 m_next_header { 0 };
+    u8 m_hop_limit { 0 };
+    IPv6Address m_source;
+    IPv6Address m_destination;
+};
+
+static_assert(AssertSize<IPv6PacketHeader, 40>());
+
+}
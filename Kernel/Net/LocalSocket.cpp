@@ -20,6 +20,11 @@
 
 namespace Kernel {
 
+// Limits for SO_SNDBUF/SO_RCVBUF; the defaults sit between these (64 KiB,
+// see DoubleBuffer::try_create).
+static constexpr size_t minimum_buffer_size = 4 * KiB;
+static constexpr size_t maximum_buffer_size = 4 * MiB;
+
 static Singleton<MutexProtected<LocalSocket::List>> s_list;
 
 static MutexProtected<LocalSocket::List>& all_sockets()
@@ -392,6 +397,34 @@ ErrorOr<NonnullOwnPtr<KString>> LocalSocket::pseudo_path(OpenFileDescription con
     return KString::try_create(builder.string_view());
 }
 
+ErrorOr<void> LocalSocket::setsockopt(OpenFileDescription& description, int level, int option, Userspace<void const*> user_value, socklen_t user_value_size)
+{
+    if (level != SOL_SOCKET)
+        return Socket::setsockopt(description, level, option, user_value, user_value_size);
+
+    switch (option) {
+    case SO_SNDBUF:
+    case SO_RCVBUF: {
+        if (user_value_size != sizeof(int))
+            return EINVAL;
+        int size = TRY(copy_typed_from_user(static_ptr_cast<int const*>(user_value)));
+        if (size < 0)
+            return EINVAL;
+        auto new_capacity = clamp(static_cast<size_t>(size), minimum_buffer_size, maximum_buffer_size);
+
+        MutexLocker locker(mutex());
+        auto* buffer = (option == SO_SNDBUF) ? send_buffer_for(description) : receive_buffer_for(description);
+        if (!buffer)
+            return set_so_error(ENOTCONN);
+        TRY(buffer->try_resize(new_capacity));
+        evaluate_block_conditions();
+        return {};
+    }
+    default:
+        return Socket::setsockopt(description, level, option, user_value, user_value_size);
+    }
+}
+
 ErrorOr<void> LocalSocket::getsockopt(OpenFileDescription& description, int level, int option, Userspace<void*> value, Userspace<socklen_t*> value_size)
 {
     if (level != SOL_SOCKET)
@@ -403,10 +436,28 @@ ErrorOr<void> LocalSocket::getsockopt(OpenFileDescription& description, int leve
     TRY(copy_from_user(&size, value_size.unsafe_userspace_ptr()));
 
     switch (option) {
-    case SO_SNDBUF:
-        return ENOTSUP;
-    case SO_RCVBUF:
-        return ENOTSUP;
+    case SO_SNDBUF: {
+        if (size < sizeof(int))
+            return EINVAL;
+        auto* buffer = send_buffer_for(description);
+        if (!buffer)
+            return set_so_error(ENOTCONN);
+        int capacity = buffer->capacity();
+        TRY(copy_to_user(static_ptr_cast<int*>(value), &capacity));
+        size = sizeof(int);
+        return copy_to_user(value_size, &size);
+    }
+    case SO_RCVBUF: {
+        if (size < sizeof(int))
+            return EINVAL;
+        auto* buffer = receive_buffer_for(description);
+        if (!buffer)
+            return set_so_error(ENOTCONN);
+        int capacity = buffer->capacity();
+        TRY(copy_to_user(static_ptr_cast<int*>(value), &capacity));
+        size = sizeof(int);
+        return copy_to_user(value_size, &size);
+    }
     case SO_PEERCRED: {
         if (size < sizeof(ucred))
             return EINVAL;
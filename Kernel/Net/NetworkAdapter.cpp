@@ -5,7 +5,6 @@
  */
 
 #include <Kernel/Heap/kmalloc.h>
-#include <Kernel/InterruptDisabler.h>
 #include <Kernel/Net/EtherType.h>
 #include <Kernel/Net/NetworkAdapter.h>
 #include <Kernel/Net/NetworkingManagement.h>
@@ -17,6 +16,8 @@ namespace Kernel {
 NetworkAdapter::NetworkAdapter(NonnullOwnPtr<KString> interface_name)
     : m_name(move(interface_name))
 {
+    for (size_t i = 0; i < max_packet_buffers; ++i)
+        m_packet_queue_slots[i].sequence.store(i, AK::MemoryOrder::memory_order_relaxed);
 }
 
 NetworkAdapter::~NetworkAdapter() = default;
@@ -69,16 +70,48 @@ void NetworkAdapter::fill_in_ipv4_header(PacketWithTimestamp& packet, IPv4Addres
     ipv4.set_checksum(ipv4.compute_checksum());
 }
 
-void NetworkAdapter::did_receive(ReadonlyBytes payload)
+bool NetworkAdapter::enqueue_packet_for_network_task(PacketWithTimestamp& packet)
 {
-    InterruptDisabler disabler;
-    m_packets_in++;
-    m_bytes_in += payload.size();
-
-    if (m_packet_queue_size == max_packet_buffers) {
-        // FIXME: Keep track of the number of dropped packets
-        return;
+    auto enqueue_pos = m_packet_queue_enqueue_pos.load(AK::MemoryOrder::memory_order_relaxed);
+    for (;;) {
+        auto& slot = m_packet_queue_slots[enqueue_pos & (max_packet_buffers - 1)];
+        auto sequence = slot.sequence.load(AK::MemoryOrder::memory_order_acquire);
+        auto difference = static_cast<ssize_t>(sequence) - static_cast<ssize_t>(enqueue_pos);
+        if (difference == 0) {
+            if (m_packet_queue_enqueue_pos.compare_exchange_strong(enqueue_pos, enqueue_pos + 1, AK::MemoryOrder::memory_order_relaxed)) {
+                slot.packet = &packet;
+                slot.sequence.store(enqueue_pos + 1, AK::MemoryOrder::memory_order_release);
+                return true;
+            }
+            // Another producer claimed this slot; compare_exchange_strong reloaded enqueue_pos for us.
+        } else if (difference < 0) {
+            // The consumer hasn't freed this slot yet, so the queue is full.
+            return false;
+        } else {
+            enqueue_pos = m_packet_queue_enqueue_pos.load(AK::MemoryOrder::memory_order_relaxed);
+        }
     }
+}
+
+LockRefPtr<PacketWithTimestamp> NetworkAdapter::dequeue_packet_for_network_task()
+{
+    // NOTE: NetworkTask is the only consumer, so the dequeue position needs no CAS.
+    auto dequeue_pos = m_packet_queue_dequeue_pos.load(AK::MemoryOrder::memory_order_relaxed);
+    auto& slot = m_packet_queue_slots[dequeue_pos & (max_packet_buffers - 1)];
+    auto sequence = slot.sequence.load(AK::MemoryOrder::memory_order_acquire);
+    if (static_cast<ssize_t>(sequence) - static_cast<ssize_t>(dequeue_pos + 1) < 0)
+        return nullptr;
+    auto packet = adopt_lock_ref_if_nonnull(slot.packet);
+    slot.packet = nullptr;
+    m_packet_queue_dequeue_pos.store(dequeue_pos + 1, AK::MemoryOrder::memory_order_relaxed);
+    slot.sequence.store(dequeue_pos + max_packet_buffers, AK::MemoryOrder::memory_order_release);
+    return packet;
+}
+
+void NetworkAdapter::did_receive(ReadonlyBytes payload)
+{
+    m_packets_in.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    m_bytes_in.fetch_add(payload.size(), AK::MemoryOrder::memory_order_relaxed);
 
     auto packet = acquire_packet_buffer(payload.size());
     if (!packet) {
@@ -88,8 +121,14 @@ void NetworkAdapter::did_receive(ReadonlyBytes payload)
 
     memcpy(packet->buffer->data(), payload.data(), payload.size());
 
-    m_packet_queue.append(*packet);
-    m_packet_queue_size++;
+    // The ring takes over our reference; it is re-adopted on dequeue.
+    auto* leaked_packet = packet.leak_ref();
+    if (!enqueue_packet_for_network_task(*leaked_packet)) {
+        // FIXME: Keep track of the number of dropped packets
+        auto dropped_packet = adopt_lock_ref_if_nonnull(leaked_packet);
+        release_packet_buffer(*dropped_packet);
+        return;
+    }
 
     if (on_receive)
         on_receive();
@@ -97,11 +136,9 @@ void NetworkAdapter::did_receive(ReadonlyBytes payload)
 
 size_t NetworkAdapter::dequeue_packet(u8* buffer, size_t buffer_size, Time& packet_timestamp)
 {
-    InterruptDisabler disabler;
-    if (m_packet_queue.is_empty())
+    auto packet_with_timestamp = dequeue_packet_for_network_task();
+    if (!packet_with_timestamp)
         return 0;
-    auto packet_with_timestamp = m_packet_queue.take_first();
-    m_packet_queue_size--;
     packet_timestamp = packet_with_timestamp->timestamp;
     auto& packet_buffer = packet_with_timestamp->buffer;
     size_t packet_size = packet_buffer->size();
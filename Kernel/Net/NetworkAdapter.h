@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Function.h>
@@ -81,15 +83,19 @@ public:
 
     size_t dequeue_packet(u8* buffer, size_t buffer_size, Time& packet_timestamp);
 
-    bool has_queued_packets() const { return !m_packet_queue.is_empty(); }
+    bool has_queued_packets() const
+    {
+        return m_packet_queue_dequeue_pos.load(AK::MemoryOrder::memory_order_relaxed)
+            != m_packet_queue_enqueue_pos.load(AK::MemoryOrder::memory_order_relaxed);
+    }
 
     u32 mtu() const { return m_mtu; }
     void set_mtu(u32 mtu) { m_mtu = mtu; }
 
-    u32 packets_in() const { return m_packets_in; }
-    u32 bytes_in() const { return m_bytes_in; }
-    u32 packets_out() const { return m_packets_out; }
-    u32 bytes_out() const { return m_bytes_out; }
+    u32 packets_in() const { return m_packets_in.load(AK::MemoryOrder::memory_order_relaxed); }
+    u32 bytes_in() const { return m_bytes_in.load(AK::MemoryOrder::memory_order_relaxed); }
+    u32 packets_out() const { return m_packets_out.load(AK::MemoryOrder::memory_order_relaxed); }
+    u32 bytes_out() const { return m_bytes_out.load(AK::MemoryOrder::memory_order_relaxed); }
 
     LockRefPtr<PacketWithTimestamp> acquire_packet_buffer(size_t);
     void release_packet_buffer(PacketWithTimestamp&);
@@ -114,17 +120,32 @@ private:
 
     // FIXME: Make this configurable
     static constexpr size_t max_packet_buffers = 1024;
+    static_assert((max_packet_buffers & (max_packet_buffers - 1)) == 0);
 
     using PacketList = IntrusiveList<&PacketWithTimestamp::packet_node>;
 
-    PacketList m_packet_queue;
-    size_t m_packet_queue_size { 0 };
+    // The receive queue is a bounded lock-free MPSC ring (Vyukov-style):
+    // RX interrupt handlers and loopback senders enqueue concurrently, and the
+    // single NetworkTask consumer dequeues. Each slot carries a sequence number
+    // that tells producers and the consumer whose turn the slot is.
+    struct PacketQueueSlot {
+        Atomic<size_t> sequence { 0 };
+        PacketWithTimestamp* packet { nullptr };
+    };
+
+    bool enqueue_packet_for_network_task(PacketWithTimestamp&);
+    LockRefPtr<PacketWithTimestamp> dequeue_packet_for_network_task();
+
+    Array<PacketQueueSlot, max_packet_buffers> m_packet_queue_slots;
+    Atomic<size_t> m_packet_queue_enqueue_pos { 0 };
+    Atomic<size_t> m_packet_queue_dequeue_pos { 0 };
+
     SpinlockProtected<PacketList, LockRank::None> m_unused_packets {};
     NonnullOwnPtr<KString> m_name;
-    u32 m_packets_in { 0 };
-    u32 m_bytes_in { 0 };
-    u32 m_packets_out { 0 };
-    u32 m_bytes_out { 0 };
+    Atomic<u32> m_packets_in { 0 };
+    Atomic<u32> m_bytes_in { 0 };
+    Atomic<u32> m_packets_out { 0 };
+    Atomic<u32> m_bytes_out { 0 };
     u32 m_mtu { 1500 };
 };
 
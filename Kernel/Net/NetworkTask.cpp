@@ -13,6 +13,7 @@
 #include <Kernel/Net/ICMP.h>
 #include <Kernel/Net/IPv4.h>
 #include <Kernel/Net/IPv4Socket.h>
+#include <Kernel/Net/IPv6.h>
 #include <Kernel/Net/LoopbackAdapter.h>
 #include <Kernel/Net/NetworkTask.h>
 #include <Kernel/Net/NetworkingManagement.h>
@@ -27,6 +28,7 @@ namespace Kernel {
 
 static void handle_arp(EthernetFrameHeader const&, size_t frame_size);
 static void handle_ipv4(EthernetFrameHeader const&, size_t frame_size, Time const& packet_timestamp);
+static void handle_ipv6(EthernetFrameHeader const&, size_t frame_size);
 static void handle_icmp(EthernetFrameHeader const&, IPv4Packet const&, Time const& packet_timestamp);
 static void handle_udp(IPv4Packet const&, Time const& packet_timestamp);
 static void handle_tcp(IPv4Packet const&, Time const& packet_timestamp);
@@ -122,7 +124,7 @@ void NetworkTask_main(void*)
             handle_ipv4(eth, packet_size, packet_timestamp);
             break;
         case EtherType::IPv6:
-            // ignore
+            handle_ipv6(eth, packet_size);
             break;
         default:
             dbgln_if(ETHERNET_DEBUG, "NetworkTask: Unknown ethernet type {:#04x}", eth.ether_type());
@@ -223,6 +225,34 @@ void handle_ipv4(EthernetFrameHeader const& eth, size_t frame_size, Time const&
     }
 }
 
+void handle_ipv6(EthernetFrameHeader const& eth, size_t frame_size)
+{
+    constexpr size_t minimum_ipv6_frame_size = sizeof(EthernetFrameHeader) + sizeof(IPv6PacketHeader);
+    if (frame_size < minimum_ipv6_frame_size) {
+        dbgln("handle_ipv6: Frame too small ({}, need {})", frame_size, minimum_ipv6_frame_size);
+        return;
+    }
+    auto& packet = *static_cast<IPv6PacketHeader const*>(eth.payload());
+
+    if (packet.version() != 6) {
+        dbgln("handle_ipv6: Not an IPv6 packet (version {})", packet.version());
+        return;
+    }
+
+    size_t actual_payload_length = frame_size - sizeof(EthernetFrameHeader) - sizeof(IPv6PacketHeader);
+    if (packet.payload_length() > actual_payload_length) {
+        dbgln("handle_ipv6: IPv6 packet claims to be longer than it is ({}, actually {})", packet.payload_length(), actual_payload_length);
+        return;
+    }
+
+    dbgln_if(IPV6_DEBUG, "handle_ipv6: source={}, destination={}, next_header={:#02x}, flow_label={:#05x}", packet.source(), packet.destination(), packet.next_header(), packet.flow_label());
+
+    // FIXME: We don't have an IPv6 protocol layer yet (no NDP, no ICMPv6,
+    //        no v6 sockets or routing), so all we can do here is validate
+    //        and drop. Handing the packet to the IPv4-only socket tables
+    //        would be wrong.
+}
+
 void handle_icmp(EthernetFrameHeader const& eth, IPv4Packet const& ipv4_packet, Time const& packet_timestamp)
 {
     auto& icmp_header = *static_cast<ICMPHeader const*>(ipv4_packet.payload());
@@ -18,6 +18,17 @@ namespace Kernel {
 
 static Singleton<SpinlockProtected<HashMap<IPv4Address, MACAddress>, LockRank::None>> s_arp_table;
 static Singleton<SpinlockProtected<Route::RouteList, LockRank::None>> s_routing_table;
+static Atomic<u32> s_routing_table_generation { 0 };
+
+u32 routing_table_generation()
+{
+    return s_routing_table_generation.load(AK::MemoryOrder::memory_order_acquire);
+}
+
+static void increment_routing_table_generation()
+{
+    s_routing_table_generation.fetch_add(1, AK::MemoryOrder::memory_order_release);
+}
 
 class ARPTableBlocker final : public Thread::Blocker {
 public:
@@ -119,6 +130,7 @@ void update_arp_table(IPv4Address const& ip_addr, MACAddress const& addr, Update
         if (update == UpdateTable::Delete)
             table.remove(ip_addr);
     });
+    increment_routing_table_generation();
     s_arp_table_blocker_set->unblock_blockers_waiting_for_ipv4_address(ip_addr, addr);
 
     if constexpr (ARP_DEBUG) {
@@ -165,6 +177,7 @@ ErrorOr<void> update_routing_table(IPv4Address const& destination, IPv4Address c
         return {};
     }));
 
+    increment_routing_table_generation();
     return {};
 }
 
@@ -66,6 +66,10 @@ enum class AllowUsingGateway {
 
 RoutingDecision route_to(IPv4Address const& target, IPv4Address const& source, LockRefPtr<NetworkAdapter> const through = nullptr, AllowUsingGateway = AllowUsingGateway::Yes);
 
+// Bumped whenever the routing table or the ARP table changes, so that cached
+// RoutingDecisions can be revalidated with a single atomic load.
+u32 routing_table_generation();
+
 SpinlockProtected<HashMap<IPv4Address, MACAddress>, LockRank::None>& arp_table();
 SpinlockProtected<Route::RouteList, LockRank::None>& routing_table();
 
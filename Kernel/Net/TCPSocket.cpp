@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Singleton.h>
 #include <AK/Time.h>
 #include <Kernel/Debug.h>
@@ -22,25 +23,47 @@
 
 namespace Kernel {
 
+// The tuple table is sharded so that NetworkTask's per-segment demux only
+// contends with connection setup and teardown for tuples that land in the
+// same shard, instead of serializing against every socket in the system.
+// A socket's table entry is removed in unref() under its shard's exclusive
+// lock, so a lookup that found the socket under the shared lock can always
+// safely take a strong reference to it.
+static constexpr size_t socket_tuple_shard_count = 16;
+struct SocketTupleShards {
+    Array<MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>, socket_tuple_shard_count> shards;
+};
+static Singleton<SocketTupleShards> s_socket_tuples;
+
+static MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>& socket_tuple_shard(IPv4SocketTuple const& tuple)
+{
+    return s_socket_tuples->shards[Traits<IPv4SocketTuple>::hash(tuple) % socket_tuple_shard_count];
+}
+
 void TCPSocket::for_each(Function<void(TCPSocket const&)> callback)
 {
-    sockets_by_tuple().for_each_shared([&](auto const& it) {
-        callback(*it.value);
-    });
+    for (auto& shard : s_socket_tuples->shards) {
+        shard.for_each_shared([&](auto const& it) {
+            callback(*it.value);
+        });
+    }
 }
 
 ErrorOr<void> TCPSocket::try_for_each(Function<ErrorOr<void>(TCPSocket const&)> callback)
 {
-    return sockets_by_tuple().with_shared([&](auto const& sockets) -> ErrorOr<void> {
-        for (auto& it : sockets)
-            TRY(callback(*it.value));
-        return {};
-    });
+    for (auto& shard : s_socket_tuples->shards) {
+        TRY(shard.with_shared([&](auto const& sockets) -> ErrorOr<void> {
+            for (auto& it : sockets)
+                TRY(callback(*it.value));
+            return {};
+        }));
+    }
+    return {};
 }
 
 bool TCPSocket::unref() const
 {
-    bool did_hit_zero = sockets_by_tuple().with_exclusive([&](auto& table) {
+    bool did_hit_zero = socket_tuple_shard(tuple()).with_exclusive([&](auto& table) {
         if (deref_base())
             return false;
         table.remove(tuple());
@@ -95,37 +118,29 @@ MutexProtected<HashMap<IPv4SocketTuple, LockRefPtr<TCPSocket>>>& TCPSocket::clos
     return *s_socket_closing;
 }
 
-static Singleton<MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>> s_socket_tuples;
-
-MutexProtected<HashMap<IPv4SocketTuple, TCPSocket*>>& TCPSocket::sockets_by_tuple()
-{
-    return *s_socket_tuples;
-}
-
 LockRefPtr<TCPSocket> TCPSocket::from_tuple(IPv4SocketTuple const& tuple)
 {
-    return sockets_by_tuple().with_shared([&](auto const& table) -> LockRefPtr<TCPSocket> {
-        auto exact_match = table.get(tuple);
-        if (exact_match.has_value())
-            return { *exact_match.value() };
+    auto lookup = [](IPv4SocketTuple const& key) -> LockRefPtr<TCPSocket> {
+        return socket_tuple_shard(key).with_shared([&](auto const& table) -> LockRefPtr<TCPSocket> {
+            auto match = table.get(key);
+            if (match.has_value())
+                return { *match.value() };
+            return {};
+        });
+    };
 
-        auto address_tuple = IPv4SocketTuple(tuple.local_address(), tuple.local_port(), IPv4Address(), 0);
-        auto address_match = table.get(address_tuple);
-        if (address_match.has_value())
-            return { *address_match.value() };
+    if (auto exact_match = lookup(tuple))
+        return exact_match;
 
-        auto wildcard_tuple = IPv4SocketTuple(IPv4Address(), tuple.local_port(), IPv4Address(), 0);
-        auto wildcard_match = table.get(wildcard_tuple);
-        if (wildcard_match.has_value())
-            return { *wildcard_match.value() };
+    if (auto address_match = lookup(IPv4SocketTuple(tuple.local_address(), tuple.local_port(), IPv4Address(), 0)))
+        return address_match;
 
-        return {};
-    });
+    return lookup(IPv4SocketTuple(IPv4Address(), tuple.local_port(), IPv4Address(), 0));
 }
 ErrorOr<NonnullLockRefPtr<TCPSocket>> TCPSocket::try_create_client(IPv4Address const& new_local_address, u16 new_local_port, IPv4Address const& new_peer_address, u16 new_peer_port)
 {
     auto tuple = IPv4SocketTuple(new_local_address, new_local_port, new_peer_address, new_peer_port);
-    return sockets_by_tuple().with_exclusive([&](auto& table) -> ErrorOr<NonnullLockRefPtr<TCPSocket>> {
+    return socket_tuple_shard(tuple).with_exclusive([&](auto& table) -> ErrorOr<NonnullLockRefPtr<TCPSocket>> {
         if (table.contains(tuple))
             return EEXIST;
 
@@ -202,13 +217,24 @@ ErrorOr<size_t> TCPSocket::protocol_receive(ReadonlyBytes raw_ipv4_packet, UserO
 
 ErrorOr<size_t> TCPSocket::protocol_send(UserOrKernelBuffer const& data, size_t data_length)
 {
-    RoutingDecision routing_decision = route_to(peer_address(), local_address(), bound_interface());
+    RoutingDecision routing_decision = cached_route_to(peer_address(), local_address(), bound_interface());
     if (routing_decision.is_zero())
         return set_so_error(EHOSTUNREACH);
     size_t mss = routing_decision.adapter->mtu() - sizeof(IPv4Packet) - sizeof(TCPPacket);
-    data_length = min(data_length, mss);
-    TRY(send_tcp_packet(TCPFlags::PSH | TCPFlags::ACK, &data, data_length, &routing_decision));
-    return data_length;
+    // Segment the whole buffer here instead of returning after one MSS worth of
+    // data, so that large writes don't pay a syscall and route lookup per segment.
+    size_t total_sent = 0;
+    while (total_sent < data_length) {
+        size_t segment_size = min(data_length - total_sent, mss);
+        auto segment_buffer = data.offset(total_sent);
+        if (auto result = send_tcp_packet(TCPFlags::PSH | TCPFlags::ACK, &segment_buffer, segment_size, &routing_decision); result.is_error()) {
+            if (total_sent == 0)
+                return result.release_error();
+            break;
+        }
+        total_sent += segment_size;
+    }
+    return total_sent;
 }
 
 ErrorOr<void> TCPSocket::send_ack(bool allow_duplicate)
@@ -220,7 +246,7 @@ ErrorOr<void> TCPSocket::send_ack(bool allow_duplicate)
 
 ErrorOr<void> TCPSocket::send_tcp_packet(u16 flags, UserOrKernelBuffer const* payload, size_t payload_size, RoutingDecision* user_routing_decision)
 {
-    RoutingDecision routing_decision = user_routing_decision ? *user_routing_decision : route_to(peer_address(), local_address(), bound_interface());
+    RoutingDecision routing_decision = user_routing_decision ? *user_routing_decision : cached_route_to(peer_address(), local_address(), bound_interface());
     if (routing_decision.is_zero())
         return set_so_error(EHOSTUNREACH);
 
@@ -241,7 +267,10 @@ ErrorOr<void> TCPSocket::send_tcp_packet(u16 flags, UserOrKernelBuffer const* pa
     VERIFY(local_port());
     tcp_packet.set_source_port(local_port());
     tcp_packet.set_destination_port(peer_port());
-    tcp_packet.set_window_size(NumericLimits<u16>::max());
+    // Advertise how much room the receive buffer actually has left instead of
+    // a blanket 64 KiB; otherwise a fast sender overruns the buffer and every
+    // overflowing segment has to be dropped and retransmitted.
+    tcp_packet.set_window_size(min(space_in_receive_buffer(), (size_t)NumericLimits<u16>::max()));
     tcp_packet.set_sequence_number(m_sequence_number);
     tcp_packet.set_data_offset(tcp_header_size / sizeof(u32));
     tcp_packet.set_flags(flags);
@@ -272,7 +301,12 @@ ErrorOr<void> TCPSocket::send_tcp_packet(u16 flags, UserOrKernelBuffer const* pa
         memcpy(packet->buffer->data() + ipv4_payload_offset + sizeof(TCPPacket), &mss_option, sizeof(mss_option));
     }
 
-    tcp_packet.set_checksum(compute_tcp_checksum(local_address(), peer_address(), tcp_packet, payload_size));
+    // The TCP checksum only guards against corruption on the wire. Loopback
+    // packets never leave kernel memory, and nothing on the receive side
+    // verifies the checksum, so don't spend a full pass over the payload
+    // computing one.
+    if (routing_decision.adapter->adapter_type() != NetworkAdapter::Type::Loopback)
+        tcp_packet.set_checksum(compute_tcp_checksum(local_address(), peer_address(), tcp_packet, payload_size));
 
     bool expect_ack { tcp_packet.has_syn() || payload_size > 0 };
     if (expect_ack) {
@@ -338,6 +372,13 @@ void TCPSocket::receive_tcp_packet(TCPPacket const& packet, u16 size)
         });
     }
 
+    // Every segment carries the peer's current receive window; honor it
+    // instead of assuming a fixed 64 KiB forever.
+    if (m_send_window_size != packet.window_size()) {
+        m_send_window_size = packet.window_size();
+        evaluate_block_conditions();
+    }
+
     m_packets_in++;
     m_bytes_in += packet.header_size() + size;
 }
@@ -421,7 +462,7 @@ ErrorOr<void> TCPSocket::protocol_bind()
 ErrorOr<void> TCPSocket::protocol_listen(bool did_allocate_port)
 {
     if (!did_allocate_port) {
-        bool ok = sockets_by_tuple().with_exclusive([&](auto& table) -> bool {
+        bool ok = socket_tuple_shard(tuple()).with_exclusive([&](auto& table) -> bool {
             if (table.contains(tuple()))
                 return false;
             table.set(tuple(), this);
@@ -441,7 +482,7 @@ ErrorOr<void> TCPSocket::protocol_connect(OpenFileDescription& description)
 {
     MutexLocker locker(mutex());
 
-    auto routing_decision = route_to(peer_address(), local_address());
+    auto routing_decision = cached_route_to(peer_address(), local_address());
     if (routing_decision.is_zero())
         return set_so_error(EHOSTUNREACH);
     if (!has_specific_local_address())
@@ -488,24 +529,30 @@ ErrorOr<u16> TCPSocket::protocol_allocate_local_port()
     constexpr u16 ephemeral_port_range_size = last_ephemeral_port - first_ephemeral_port;
     u16 first_scan_port = first_ephemeral_port + get_good_random<u16>() % ephemeral_port_range_size;
 
-    return sockets_by_tuple().with_exclusive([&](auto& table) -> ErrorOr<u16> {
-        for (u16 port = first_scan_port;;) {
-            IPv4SocketTuple proposed_tuple(local_address(), port, peer_address(), peer_port());
+    for (u16 port = first_scan_port;;) {
+        IPv4SocketTuple proposed_tuple(local_address(), port, peer_address(), peer_port());
 
+        // Note: Checking and claiming a proposed tuple is atomic within its
+        // shard, which is all that's needed; a concurrent allocation of the
+        // same tuple serializes on the same shard lock.
+        bool claimed = socket_tuple_shard(proposed_tuple).with_exclusive([&](auto& table) {
             auto it = table.find(proposed_tuple);
-            if (it == table.end()) {
-                set_local_port(port);
-                table.set(proposed_tuple, this);
-                return port;
-            }
-            ++port;
-            if (port > last_ephemeral_port)
-                port = first_ephemeral_port;
-            if (port == first_scan_port)
-                break;
+            if (it != table.end())
+                return false;
+            table.set(proposed_tuple, this);
+            return true;
+        });
+        if (claimed) {
+            set_local_port(port);
+            return port;
         }
-        return set_so_error(EADDRINUSE);
-    });
+        ++port;
+        if (port > last_ephemeral_port)
+            port = first_ephemeral_port;
+        if (port == first_scan_port)
+            break;
+    }
+    return set_so_error(EADDRINUSE);
 }
 
 bool TCPSocket::protocol_is_disconnected() const
@@ -598,7 +645,7 @@ void TCPSocket::retransmit_packets()
         return;
     }
 
-    auto routing_decision = route_to(peer_address(), local_address(), bound_interface());
+    auto routing_decision = cached_route_to(peer_address(), local_address(), bound_interface());
     if (routing_decision.is_zero())
         return;
 
@@ -652,6 +699,11 @@ bool TCPSocket::can_write(OpenFileDescription const& file_description, u64 size)
         return true;
 
     return m_unacked_packets.with_shared([&](auto& unacked_packets) {
+        // When the peer has closed its window entirely, still let one segment
+        // through once everything in flight is acknowledged; it doubles as the
+        // window probe that elicits the ACK reopening the window.
+        if (m_send_window_size == 0)
+            return unacked_packets.packets.is_empty();
         return unacked_packets.size + size <= m_send_window_size;
     });
 }
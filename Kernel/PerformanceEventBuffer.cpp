@@ -28,11 +28,13 @@ NEVER_INLINE ErrorOr<void> PerformanceEventBuffer::append(int type, FlatPtr arg1
     return append_with_ip_and_bp(current_thread->pid(), current_thread->tid(), 0, base_pointer, type, 0, arg1, arg2, arg3, arg4, arg5, arg6);
 }
 
-static Vector<FlatPtr, PerformanceEvent::max_stack_frame_count> raw_backtrace(FlatPtr bp, FlatPtr ip)
+// Walks the stack directly into the (already claimed) event's frame array,
+// so that sampling doesn't have to copy up to half a kilobyte of frames twice.
+static size_t raw_backtrace(FlatPtr bp, FlatPtr ip, FlatPtr* frames, size_t max_frame_count)
 {
-    Vector<FlatPtr, PerformanceEvent::max_stack_frame_count> backtrace;
+    size_t frame_count = 0;
     if (ip != 0)
-        backtrace.unchecked_append(ip);
+        frames[frame_count++] = ip;
     FlatPtr stack_ptr_copy;
     FlatPtr stack_ptr = bp;
     // FIXME: Figure out how to remove this SmapDisabler without breaking profile stacks.
@@ -57,12 +59,12 @@ static Vector<FlatPtr, PerformanceEvent::max_stack_frame_count> raw_backtrace(Fl
             break;
         if (retaddr == 0)
             break;
-        backtrace.unchecked_append(retaddr);
-        if (backtrace.size() == PerformanceEvent::max_stack_frame_count)
+        frames[frame_count++] = retaddr;
+        if (frame_count == max_frame_count)
             break;
         stack_ptr = stack_ptr_copy;
     }
-    return backtrace;
+    return frame_count;
 }
 
 ErrorOr<void> PerformanceEventBuffer::append_with_ip_and_bp(ProcessID pid, ThreadID tid, RegisterState const& regs,
@@ -91,92 +93,100 @@ ErrorOr<void> PerformanceEventBuffer::append_with_ip_and_bp(ProcessID pid, Threa
     if (enter_count > 0)
         return EINVAL;
 
-    PerformanceEvent event;
-    event.type = type;
-    event.lost_samples = lost_samples;
+    // Only the small payload union is staged on the stack; the event itself
+    // is built in place once a slot has been claimed, so the frame array is
+    // written exactly once.
+    decltype(PerformanceEvent::data) data;
 
     switch (type) {
     case PERF_EVENT_SAMPLE:
         break;
     case PERF_EVENT_MALLOC:
-        event.data.malloc.size = arg1;
-        event.data.malloc.ptr = arg2;
+        data.malloc.size = arg1;
+        data.malloc.ptr = arg2;
         break;
     case PERF_EVENT_FREE:
-        event.data.free.ptr = arg1;
+        data.free.ptr = arg1;
         break;
     case PERF_EVENT_MMAP:
-        event.data.mmap.ptr = arg1;
-        event.data.mmap.size = arg2;
-        memset(event.data.mmap.name, 0, sizeof(event.data.mmap.name));
+        data.mmap.ptr = arg1;
+        data.mmap.size = arg2;
+        memset(data.mmap.name, 0, sizeof(data.mmap.name));
         if (!arg3.is_empty())
-            memcpy(event.data.mmap.name, arg3.characters_without_null_termination(), min(arg3.length(), sizeof(event.data.mmap.name) - 1));
+            memcpy(data.mmap.name, arg3.characters_without_null_termination(), min(arg3.length(), sizeof(data.mmap.name) - 1));
         break;
     case PERF_EVENT_MUNMAP:
-        event.data.munmap.ptr = arg1;
-        event.data.munmap.size = arg2;
+        data.munmap.ptr = arg1;
+        data.munmap.size = arg2;
         break;
     case PERF_EVENT_PROCESS_CREATE:
-        event.data.process_create.parent_pid = arg1;
-        memset(event.data.process_create.executable, 0, sizeof(event.data.process_create.executable));
+        data.process_create.parent_pid = arg1;
+        memset(data.process_create.executable, 0, sizeof(data.process_create.executable));
         if (!arg3.is_empty()) {
-            memcpy(event.data.process_create.executable, arg3.characters_without_null_termination(),
-                min(arg3.length(), sizeof(event.data.process_create.executable) - 1));
+            memcpy(data.process_create.executable, arg3.characters_without_null_termination(),
+                min(arg3.length(), sizeof(data.process_create.executable) - 1));
         }
         break;
     case PERF_EVENT_PROCESS_EXEC:
-        memset(event.data.process_exec.executable, 0, sizeof(event.data.process_exec.executable));
+        memset(data.process_exec.executable, 0, sizeof(data.process_exec.executable));
         if (!arg3.is_empty()) {
-            memcpy(event.data.process_exec.executable, arg3.characters_without_null_termination(),
-                min(arg3.length(), sizeof(event.data.process_exec.executable) - 1));
+            memcpy(data.process_exec.executable, arg3.characters_without_null_termination(),
+                min(arg3.length(), sizeof(data.process_exec.executable) - 1));
         }
         break;
     case PERF_EVENT_PROCESS_EXIT:
         break;
     case PERF_EVENT_THREAD_CREATE:
-        event.data.thread_create.parent_tid = arg1;
+        data.thread_create.parent_tid = arg1;
         break;
     case PERF_EVENT_THREAD_EXIT:
         break;
     case PERF_EVENT_CONTEXT_SWITCH:
-        event.data.context_switch.next_pid = arg1;
-        event.data.context_switch.next_tid = arg2;
+        data.context_switch.next_pid = arg1;
+        data.context_switch.next_tid = arg2;
         break;
     case PERF_EVENT_KMALLOC:
-        event.data.kmalloc.size = arg1;
-        event.data.kmalloc.ptr = arg2;
+        data.kmalloc.size = arg1;
+        data.kmalloc.ptr = arg2;
         break;
     case PERF_EVENT_KFREE:
-        event.data.kfree.size = arg1;
-        event.data.kfree.ptr = arg2;
+        data.kfree.size = arg1;
+        data.kfree.ptr = arg2;
         break;
     case PERF_EVENT_PAGE_FAULT:
         break;
     case PERF_EVENT_SYSCALL:
         break;
     case PERF_EVENT_SIGNPOST:
-        event.data.signpost.arg1 = arg1;
-        event.data.signpost.arg2 = arg2;
+        data.signpost.arg1 = arg1;
+        data.signpost.arg2 = arg2;
         break;
     case PERF_EVENT_READ:
-        event.data.read.fd = arg1;
-        event.data.read.size = arg2;
-        event.data.read.filename_index = arg4;
-        event.data.read.start_timestamp = arg5;
-        event.data.read.success = !arg6.is_error();
+        data.read.fd = arg1;
+        data.read.size = arg2;
+        data.read.filename_index = arg4;
+        data.read.start_timestamp = arg5;
+        data.read.success = !arg6.is_error();
         break;
     default:
         return EINVAL;
     }
 
-    auto backtrace = raw_backtrace(bp, ip);
-    event.stack_size = min(sizeof(event.stack) / sizeof(FlatPtr), static_cast<size_t>(backtrace.size()));
-    memcpy(event.stack, backtrace.data(), event.stack_size * sizeof(FlatPtr));
+    // Claim a slot with an atomic increment so that sampling timer ticks on
+    // different CPUs can append concurrently without taking a lock. A slot
+    // claimed beyond the capacity is simply never used; count() saturates.
+    auto index = m_count.fetch_add(1, AK::memory_order_acq_rel);
+    if (index >= capacity())
+        return ENOBUFS;
 
+    auto& event = at(index);
+    event.type = type;
+    event.lost_samples = lost_samples;
+    event.data = data;
+    event.stack_size = raw_backtrace(bp, ip, event.stack, PerformanceEvent::max_stack_frame_count);
     event.pid = pid.value();
     event.tid = tid.value();
     event.timestamp = TimeManagement::the().uptime_ms();
-    at(m_count++) = event;
     return {};
 }
 
@@ -210,7 +220,7 @@ ErrorOr<void> PerformanceEventBuffer::to_json_impl(Serializer& object) const
     bool show_kernel_addresses = current_process_credentials->is_superuser();
     auto array = TRY(object.add_array("events"sv));
     bool seen_first_sample = false;
-    for (size_t i = 0; i < m_count; ++i) {
+    for (size_t i = 0; i < count(); ++i) {
         auto const& event = at(i);
 
         if (!show_kernel_addresses) {
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Error.h>
 #include <Kernel/KBuffer.h>
 
@@ -118,11 +119,13 @@ public:
 
     void clear()
     {
-        m_count = 0;
+        m_count.store(0, AK::memory_order_release);
     }
 
     size_t capacity() const { return m_buffer->size() / sizeof(PerformanceEvent); }
-    size_t count() const { return m_count; }
+    // The claim counter may transiently run past the capacity when appends
+    // race against a full buffer, so saturate it here.
+    size_t count() const { return min(m_count.load(AK::memory_order_acquire), capacity()); }
     PerformanceEvent const& at(size_t index) const
     {
         return const_cast<PerformanceEventBuffer&>(*this).at(index);
@@ -142,7 +145,7 @@ private:
 
     PerformanceEvent& at(size_t index);
 
-    size_t m_count { 0 };
+    Atomic<size_t> m_count { 0 };
     NonnullOwnPtr<KBuffer> m_buffer;
 
     HashMap<NonnullOwnPtr<KString>, size_t> m_strings;
@@ -38,6 +38,7 @@
 #include <Kernel/TTY/TTY.h>
 #include <Kernel/Thread.h>
 #include <Kernel/ThreadTracer.h>
+#include <Kernel/Time/TimeManagement.h>
 #include <Kernel/TimerQueue.h>
 
 namespace Kernel {
@@ -1027,6 +1028,47 @@ void Process::set_dumpable(bool dumpable)
     });
 }
 
+void Process::set_block_io_bandwidth_limit(u64 bytes_per_second)
+{
+    SpinlockLocker locker(m_block_io_throttle_lock);
+    m_block_io_bandwidth_limit.store(bytes_per_second, AK::MemoryOrder::memory_order_relaxed);
+    // Start with a full bucket so the process doesn't stall right away.
+    m_block_io_tokens = bytes_per_second;
+    m_block_io_last_refill_ms = TimeManagement::the().uptime_ms();
+}
+
+ErrorOr<void> Process::charge_block_io(u64 bytes)
+{
+    for (;;) {
+        auto limit = block_io_bandwidth_limit();
+        if (limit == 0)
+            return {};
+
+        u64 wait_ms = 0;
+        {
+            SpinlockLocker locker(m_block_io_throttle_lock);
+            u64 now = TimeManagement::the().uptime_ms();
+            u64 elapsed_ms = now - m_block_io_last_refill_ms;
+            if (elapsed_ms > 0) {
+                m_block_io_tokens = min(limit, m_block_io_tokens + (limit * elapsed_ms) / 1000);
+                m_block_io_last_refill_ms = now;
+            }
+            // A request larger than one second's worth of bandwidth is
+            // admitted once the bucket is full; it could never be paid for
+            // in full otherwise.
+            if (m_block_io_tokens >= min(bytes, limit)) {
+                m_block_io_tokens -= min(bytes, m_block_io_tokens);
+                return {};
+            }
+            wait_ms = ((min(bytes, limit) - m_block_io_tokens) * 1000) / limit + 1;
+        }
+
+        auto wait_time = Time::from_milliseconds(static_cast<i64>(wait_ms));
+        if (Thread::current()->sleep(wait_time).was_interrupted())
+            return EINTR;
+    }
+}
+
 ErrorOr<void> Process::set_coredump_property(NonnullOwnPtr<KString> key, NonnullOwnPtr<KString> value)
 {
     return m_coredump_properties.with([&](auto& coredump_properties) -> ErrorOr<void> {
@@ -254,6 +254,14 @@ public:
     }
     void set_dumpable(bool);
 
+    u64 block_io_bandwidth_limit() const { return m_block_io_bandwidth_limit.load(AK::MemoryOrder::memory_order_relaxed); }
+    void set_block_io_bandwidth_limit(u64 bytes_per_second);
+    // Charges a block I/O request against this process' bandwidth limit,
+    // sleeping until the token bucket refills if the limit is exhausted.
+    // Callers must not hold any filesystem or block cache locks, or the
+    // sleep would stall other processes' I/O along with ours.
+    ErrorOr<void> charge_block_io(u64 bytes);
+
     mode_t umask() const
     {
         return with_protected_data([](auto& protected_data) { return protected_data.umask; });
@@ -325,8 +333,10 @@ public:
     ErrorOr<FlatPtr> sys$readv(int fd, Userspace<const struct iovec*> iov, int iov_count);
     ErrorOr<FlatPtr> sys$write(int fd, Userspace<u8 const*>, size_t);
     ErrorOr<FlatPtr> sys$pwritev(int fd, Userspace<const struct iovec*> iov, int iov_count, Userspace<off_t const*>);
+    ErrorOr<FlatPtr> sys$batch_io(Userspace<Syscall::SC_batch_io_params const*>);
     ErrorOr<FlatPtr> sys$fstat(int fd, Userspace<stat*>);
     ErrorOr<FlatPtr> sys$stat(Userspace<Syscall::SC_stat_params const*>);
+    ErrorOr<FlatPtr> sys$batch_stat(Userspace<Syscall::SC_batch_stat_params const*>);
     ErrorOr<FlatPtr> sys$annotate_mapping(Userspace<void*>, int flags);
     ErrorOr<FlatPtr> sys$lseek(int fd, Userspace<off_t*>, int whence);
     ErrorOr<FlatPtr> sys$ftruncate(int fd, Userspace<off_t const*>);
@@ -345,6 +355,7 @@ public:
     ErrorOr<FlatPtr> sys$purge(int mode);
     ErrorOr<FlatPtr> sys$poll(Userspace<Syscall::SC_poll_params const*>);
     ErrorOr<FlatPtr> sys$get_dir_entries(int fd, Userspace<void*>, size_t);
+    ErrorOr<FlatPtr> sys$get_dir_entries_stat(int fd, Userspace<void*>, size_t);
     ErrorOr<FlatPtr> sys$getcwd(Userspace<char*>, size_t);
     ErrorOr<FlatPtr> sys$chdir(Userspace<char const*>, size_t);
     ErrorOr<FlatPtr> sys$fchdir(int fd);
@@ -437,6 +448,7 @@ public:
     ErrorOr<FlatPtr> sys$get_stack_bounds(Userspace<FlatPtr*> stack_base, Userspace<size_t*> stack_size);
     ErrorOr<FlatPtr> sys$ptrace(Userspace<Syscall::SC_ptrace_params const*>);
     ErrorOr<FlatPtr> sys$sendfd(int sockfd, int fd);
+    ErrorOr<FlatPtr> sys$sendfile(int out_fd, int in_fd, Userspace<off_t*>, size_t count);
     ErrorOr<FlatPtr> sys$recvfd(int sockfd, int options);
     ErrorOr<FlatPtr> sys$sysconf(int name);
     ErrorOr<FlatPtr> sys$disown(ProcessID);
@@ -891,6 +903,12 @@ private:
     Mutex m_big_lock { "Process"sv, Mutex::MutexBehavior::BigLock };
     Mutex m_ptrace_lock { "ptrace"sv };
 
+    // Token bucket for block I/O throttling; a limit of 0 means unthrottled.
+    Atomic<u64> m_block_io_bandwidth_limit { 0 };
+    Spinlock<LockRank::None> m_block_io_throttle_lock {};
+    u64 m_block_io_tokens { 0 };
+    u64 m_block_io_last_refill_ms { 0 };
+
     LockRefPtr<Timer> m_alarm_timer;
 
     SpinlockProtected<UnveilData, LockRank::None> m_unveil_data;
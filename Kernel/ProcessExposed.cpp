@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BinarySearch.h>
+#include <AK/QuickSort.h>
 #include <Kernel/FileSystem/ProcFS/Inode.h>
 #include <Kernel/KBufferBuilder.h>
 #include <Kernel/PerformanceEventBuffer.h>
@@ -141,12 +143,30 @@ void ProcFSExposedDirectory::add_component(ProcFSExposedComponent const&)
 
 ErrorOr<NonnullLockRefPtr<ProcFSExposedComponent>> ProcFSExposedDirectory::lookup(StringView name)
 {
-    for (auto& component : m_components) {
-        if (component.name() == name) {
-            return component;
-        }
+    // The exposed directories are registry-wide singletons shared by all
+    // procfs mounts, so the caller's per-mount lock is not enough to guard
+    // the lazy index rebuild; take the registry lock like
+    // traverse_as_directory() does.
+    MutexLocker locker(ProcFSComponentRegistry::the().get_lock());
+    if (m_lookup_index.size() != m_components.size()) {
+        m_lookup_index.clear_with_capacity();
+        TRY(m_lookup_index.try_ensure_capacity(m_components.size()));
+        for (auto& component : m_components)
+            m_lookup_index.unchecked_append(&component);
+        quick_sort(m_lookup_index, [](auto* a, auto* b) { return a->name() < b->name(); });
     }
-    return ENOENT;
+
+    auto* const* result = binary_search(m_lookup_index, name, nullptr, [](StringView const& name, ProcFSExposedComponent* const& component) {
+        auto component_name = component->name();
+        if (name < component_name)
+            return -1;
+        if (component_name < name)
+            return 1;
+        return 0;
+    });
+    if (!result)
+        return ENOENT;
+    return **result;
 }
 
 ErrorOr<void> ProcFSExposedDirectory::traverse_as_directory(FileSystemID fsid, Function<ErrorOr<void>(FileSystem::DirectoryEntryView const&)> callback) const
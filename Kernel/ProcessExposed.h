@@ -126,6 +126,13 @@ protected:
     ProcFSExposedDirectory(StringView name, ProcFSExposedDirectory const& parent_directory);
     NonnullLockRefPtrVector<ProcFSExposedComponent> m_components;
     LockWeakPtr<ProcFSExposedDirectory> m_parent_directory;
+
+private:
+    // Sorted by name and rebuilt lazily (under the registry lock), so lookups
+    // in directories with many components are O(log n). The component list is
+    // append-only (components are only ever registered), so its size doubles
+    // as a generation stamp.
+    Vector<ProcFSExposedComponent*> m_lookup_index;
 };
 
 class ProcFSExposedLink : public ProcFSExposedComponent {
@@ -46,10 +46,56 @@ struct ThreadReadyQueues {
     Array<ThreadReadyQueue, count> queues;
 };
 
-static Singleton<SpinlockProtected<ThreadReadyQueues, LockRank::None>> g_ready_queues;
+// One set of ready queues per processor, each with its own lock, so enqueues and
+// dequeues on different processors don't contend on a single global lock. A
+// processor with nothing runnable locally steals from its siblings.
+// NOTE: Thread affinity masks are u32, so that's also the processor limit.
+static constexpr size_t max_processor_count = sizeof(u32) * 8;
+static Singleton<Array<SpinlockProtected<ThreadReadyQueues, LockRank::None>, max_processor_count>> g_ready_queues_per_processor;
+
+static SpinlockProtected<ThreadReadyQueues, LockRank::None>& ready_queues_for_processor(u32 processor_id)
+{
+    VERIFY(processor_id < max_processor_count);
+    return (*g_ready_queues_per_processor)[processor_id];
+}
 
 static SpinlockProtected<TotalTimeScheduled, LockRank::None> g_total_time_scheduled {};
 
+// Per-processor scheduling statistics, updated with relaxed atomics on the
+// scheduler's hot paths so sampling them never takes a lock.
+struct PerProcessorSchedulerStats {
+    Atomic<u32> run_queue_depth { 0 };
+    Atomic<u64> run_queue_depth_histogram[SchedulerPerProcessorStats::run_queue_depth_bucket_count];
+    Atomic<u64> wakeup_latency_histogram[SchedulerPerProcessorStats::wakeup_latency_bucket_count];
+    Atomic<u64> involuntary_context_switches { 0 };
+};
+static Array<PerProcessorSchedulerStats, max_processor_count> s_per_processor_stats;
+
+static size_t power_of_two_bucket_index(u64 value, size_t bucket_count)
+{
+    if (value == 0)
+        return 0;
+    return min(static_cast<size_t>(64 - count_leading_zeroes(value)), bucket_count - 1);
+}
+
+static void record_enqueued_thread(u32 processor_id)
+{
+    auto& stats = s_per_processor_stats[processor_id];
+    auto depth = stats.run_queue_depth.fetch_add(1, AK::memory_order_relaxed) + 1;
+    stats.run_queue_depth_histogram[power_of_two_bucket_index(depth, SchedulerPerProcessorStats::run_queue_depth_bucket_count)].fetch_add(1, AK::memory_order_relaxed);
+}
+
+static void record_dequeued_thread(u32 processor_id)
+{
+    s_per_processor_stats[processor_id].run_queue_depth.fetch_sub(1, AK::memory_order_relaxed);
+}
+
+static void record_wakeup_latency(u64 latency_in_nanoseconds)
+{
+    auto& stats = s_per_processor_stats[Processor::current_id()];
+    stats.wakeup_latency_histogram[power_of_two_bucket_index(latency_in_nanoseconds / 1000, SchedulerPerProcessorStats::wakeup_latency_bucket_count)].fetch_add(1, AK::memory_order_relaxed);
+}
+
 static void dump_thread_list(bool = false);
 
 static inline u32 thread_priority_to_priority_index(u32 thread_priority)
@@ -64,11 +110,9 @@ static inline u32 thread_priority_to_priority_index(u32 thread_priority)
     return priority_bucket;
 }
 
-Thread& Scheduler::pull_next_runnable_thread()
+Thread* Scheduler::try_pull_runnable_thread_from(u32 processor_id, u32 affinity_mask)
 {
-    auto affinity_mask = 1u << Processor::current_id();
-
-    return g_ready_queues->with([&](auto& ready_queues) -> Thread& {
+    return ready_queues_for_processor(processor_id).with([&](auto& ready_queues) -> Thread* {
         auto priority_mask = ready_queues.mask;
         while (priority_mask != 0) {
             auto priority = bit_scan_forward(priority_mask);
@@ -95,19 +139,36 @@ Thread& Scheduler::pull_next_runnable_thread()
                 // switching to it.
                 // FIXME: Figure out a better way maybe?
                 thread.set_active(true);
-                return thread;
+                record_dequeued_thread(processor_id);
+                return &thread;
             }
             priority_mask &= ~(1u << priority);
         }
-        return *Processor::idle_thread();
+        return nullptr;
     });
 }
 
-Thread* Scheduler::peek_next_runnable_thread()
+Thread& Scheduler::pull_next_runnable_thread()
 {
-    auto affinity_mask = 1u << Processor::current_id();
+    auto processor_id = Processor::current_id();
+    auto affinity_mask = 1u << processor_id;
+
+    if (auto* thread = try_pull_runnable_thread_from(processor_id, affinity_mask))
+        return *thread;
+
+    // Nothing runnable on our own queues, see if we can steal from another processor.
+    auto processor_count = Processor::count();
+    for (u32 i = 1; i < processor_count; ++i) {
+        auto victim_id = (processor_id + i) % processor_count;
+        if (auto* thread = try_pull_runnable_thread_from(victim_id, affinity_mask))
+            return *thread;
+    }
+    return *Processor::idle_thread();
+}
 
-    return g_ready_queues->with([&](auto& ready_queues) -> Thread* {
+Thread* Scheduler::peek_runnable_thread_from(u32 processor_id, u32 affinity_mask)
+{
+    return ready_queues_for_processor(processor_id).with([&](auto& ready_queues) -> Thread* {
         auto priority_mask = ready_queues.mask;
         while (priority_mask != 0) {
             auto priority = bit_scan_forward(priority_mask);
@@ -123,20 +184,37 @@ Thread* Scheduler::peek_next_runnable_thread()
             }
             priority_mask &= ~(1u << priority);
         }
-
-        // Unlike in pull_next_runnable_thread() we don't want to fall back to
-        // the idle thread. We just want to see if we have any other thread ready
-        // to be scheduled.
         return nullptr;
     });
 }
 
+Thread* Scheduler::peek_next_runnable_thread()
+{
+    auto processor_id = Processor::current_id();
+    auto affinity_mask = 1u << processor_id;
+
+    if (auto* thread = peek_runnable_thread_from(processor_id, affinity_mask))
+        return thread;
+
+    auto processor_count = Processor::count();
+    for (u32 i = 1; i < processor_count; ++i) {
+        auto victim_id = (processor_id + i) % processor_count;
+        if (auto* thread = peek_runnable_thread_from(victim_id, affinity_mask))
+            return thread;
+    }
+
+    // Unlike in pull_next_runnable_thread() we don't want to fall back to
+    // the idle thread. We just want to see if we have any other thread ready
+    // to be scheduled.
+    return nullptr;
+}
+
 bool Scheduler::dequeue_runnable_thread(Thread& thread, bool check_affinity)
 {
     if (thread.is_idle_thread())
         return true;
 
-    return g_ready_queues->with([&](auto& ready_queues) {
+    return ready_queues_for_processor(thread.m_ready_queue_processor).with([&](auto& ready_queues) {
         auto priority = thread.m_runnable_priority;
         if (priority < 0) {
             VERIFY(!thread.m_ready_queue_node.is_in_list());
@@ -152,6 +230,7 @@ bool Scheduler::dequeue_runnable_thread(Thread& thread, bool check_affinity)
         ready_queue.thread_list.remove(thread);
         if (ready_queue.thread_list.is_empty())
             ready_queues.mask &= ~(1u << priority);
+        record_dequeued_thread(thread.m_ready_queue_processor);
         return true;
     });
 }
@@ -163,9 +242,19 @@ void Scheduler::enqueue_runnable_thread(Thread& thread)
         return;
     auto priority = thread_priority_to_priority_index(thread.priority());
 
-    g_ready_queues->with([&](auto& ready_queues) {
+    // Queue the thread on the current processor if its affinity allows, otherwise
+    // on the first processor it may run on; work stealing evens out imbalances.
+    auto target_processor = Processor::current_id();
+    if (!(thread.affinity() & (1u << target_processor))) {
+        VERIFY(thread.affinity() != 0);
+        target_processor = bit_scan_forward(thread.affinity()) - 1;
+    }
+
+    thread.m_became_runnable_time = TimeManagement::scheduler_current_time();
+    ready_queues_for_processor(target_processor).with([&](auto& ready_queues) {
         VERIFY(thread.m_runnable_priority < 0);
         thread.m_runnable_priority = (int)priority;
+        thread.m_ready_queue_processor = target_processor;
         VERIFY(!thread.m_ready_queue_node.is_in_list());
         auto& ready_queue = ready_queues.queues[priority];
         bool was_empty = ready_queue.thread_list.is_empty();
@@ -173,6 +262,7 @@ void Scheduler::enqueue_runnable_thread(Thread& thread)
         if (was_empty)
             ready_queues.mask |= (1u << priority);
     });
+    record_enqueued_thread(target_processor);
 }
 
 UNMAP_AFTER_INIT void Scheduler::start()
@@ -257,6 +347,10 @@ void Scheduler::yield()
 void Scheduler::context_switch(Thread* thread)
 {
     thread->did_schedule();
+    if (thread->m_became_runnable_time != 0) {
+        record_wakeup_latency(TimeManagement::scheduler_current_time() - thread->m_became_runnable_time);
+        thread->m_became_runnable_time = 0;
+    }
 
     auto* from_thread = Thread::current();
     VERIFY(from_thread);
@@ -264,10 +358,14 @@ void Scheduler::context_switch(Thread* thread)
     if (from_thread == thread)
         return;
 
-    // If the last process hasn't blocked (still marked as running),
-    // mark it as runnable for the next round.
-    if (from_thread->state() == Thread::State::Running)
+    // If the last process hasn't blocked (still marked as running), mark it
+    // as runnable for the next round; it didn't give up the CPU on its own,
+    // so this counts as an involuntary context switch.
+    if (from_thread->state() == Thread::State::Running) {
         from_thread->set_state(Thread::State::Runnable);
+        from_thread->did_involuntary_context_switch();
+        s_per_processor_stats[Processor::current_id()].involuntary_context_switches.fetch_add(1, AK::memory_order_relaxed);
+    }
 
 #ifdef LOG_EVERY_CONTEXT_SWITCH
     auto const msg = "Scheduler[{}]: {} -> {} [prio={}] {:p}";
@@ -497,6 +595,20 @@ bool Scheduler::is_initialized()
     return Processor::idle_thread() != nullptr;
 }
 
+void Scheduler::for_each_processor_stats(Function<void(u32 processor_id, SchedulerPerProcessorStats const&)> const& callback)
+{
+    for (u32 processor_id = 0; processor_id < Processor::count(); ++processor_id) {
+        auto& stats = s_per_processor_stats[processor_id];
+        SchedulerPerProcessorStats snapshot;
+        for (size_t i = 0; i < SchedulerPerProcessorStats::run_queue_depth_bucket_count; ++i)
+            snapshot.run_queue_depth_histogram[i] = stats.run_queue_depth_histogram[i].load(AK::memory_order_relaxed);
+        for (size_t i = 0; i < SchedulerPerProcessorStats::wakeup_latency_bucket_count; ++i)
+            snapshot.wakeup_latency_histogram[i] = stats.wakeup_latency_histogram[i].load(AK::memory_order_relaxed);
+        snapshot.involuntary_context_switches = stats.involuntary_context_switches.load(AK::memory_order_relaxed);
+        callback(processor_id, snapshot);
+    }
+}
+
 TotalTimeScheduled Scheduler::get_total_time_scheduled()
 {
     return g_total_time_scheduled.with([&](auto& total_time_scheduled) { return total_time_scheduled; });
@@ -29,6 +29,18 @@ struct TotalTimeScheduled {
     u64 total_kernel { 0 };
 };
 
+// A snapshot of one processor's scheduling statistics. Histogram buckets are
+// powers of two (bucket i of the depth histogram covers depths [2^(i-1), 2^i),
+// bucket i of the latency histogram covers [2^(i-1), 2^i) microseconds), so
+// userspace can derive percentiles without the kernel tracking them.
+struct SchedulerPerProcessorStats {
+    static constexpr size_t run_queue_depth_bucket_count = 8;
+    static constexpr size_t wakeup_latency_bucket_count = 16;
+    u64 run_queue_depth_histogram[run_queue_depth_bucket_count] {};
+    u64 wakeup_latency_histogram[wakeup_latency_bucket_count] {};
+    u64 involuntary_context_switches { 0 };
+};
+
 class Scheduler {
 public:
     static void initialize();
@@ -55,6 +67,11 @@ public:
     static bool is_initialized();
     static TotalTimeScheduled get_total_time_scheduled();
     static void add_time_scheduled(u64, bool);
+    static void for_each_processor_stats(Function<void(u32 processor_id, SchedulerPerProcessorStats const&)> const&);
+
+private:
+    static Thread* try_pull_runnable_thread_from(u32 processor_id, u32 affinity_mask);
+    static Thread* peek_runnable_thread_from(u32 processor_id, u32 affinity_mask);
 };
 
 }
@@ -20,6 +20,14 @@ UNMAP_AFTER_INIT NVMeInterruptQueue::NVMeInterruptQueue(NonnullOwnPtr<Memory::Re
 
 bool NVMeInterruptQueue::handle_irq(RegisterState const&)
 {
+    // All IO queues share the controller's pin-based interrupt, so every
+    // queue's handler runs on every disk interrupt. Peek at the phase tag of
+    // the current completion entry before taking the request lock, so queues
+    // with nothing pending get out of the way cheaply. This is safe without
+    // the lock: this handler is the only consumer of this completion queue,
+    // and the device writes the entry before asserting the interrupt.
+    if (!cqe_available())
+        return false;
     SpinlockLocker lock(m_request_lock);
     return process_cq() ? true : false;
 }
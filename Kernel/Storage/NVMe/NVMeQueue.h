@@ -40,6 +40,7 @@ public:
 
 protected:
     u32 process_cq();
+    bool cqe_available();
     void update_sq_doorbell()
     {
         m_db_regs->sq_tail = m_sq_tail;
@@ -47,7 +48,6 @@ protected:
     NVMeQueue(NonnullOwnPtr<Memory::Region> rw_dma_region, Memory::PhysicalPage const& rw_dma_page, u16 qid, u32 q_depth, OwnPtr<Memory::Region> cq_dma_region, NonnullRefPtrVector<Memory::PhysicalPage> cq_dma_page, OwnPtr<Memory::Region> sq_dma_region, NonnullRefPtrVector<Memory::PhysicalPage> sq_dma_page, Memory::TypedMapping<DoorbellRegister volatile> db_regs);
 
 private:
-    bool cqe_available();
     void update_cqe_head();
     virtual void complete_current_request(u16 status) = 0;
     void update_cq_doorbell()
@@ -0,0 +1,426 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <Kernel/API/Ioctl.h>
+#include <Kernel/Devices/DeviceManagement.h>
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Process.h>
+#include <Kernel/Storage/SnapshotLayerDevice.h>
+#include <Kernel/Storage/StorageManagement.h>
+#include <Kernel/WorkQueue.h>
+
+namespace Kernel {
+
+static u32 crc32(ReadonlyBytes bytes)
+{
+    static constexpr auto table = [] {
+        Array<u32, 256> table {};
+        for (u32 index = 0; index < 256; ++index) {
+            u32 value = index;
+            for (int bit = 0; bit < 8; ++bit)
+                value = (value >> 1) ^ ((value & 1) ? 0xEDB88320u : 0u);
+            table[index] = value;
+        }
+        return table;
+    }();
+
+    u32 crc = 0xFFFFFFFFu;
+    for (auto byte : bytes)
+        crc = (crc >> 8) ^ table[(crc ^ byte) & 0xFF];
+    return ~crc;
+}
+
+// Stored in the very last block of the underlying device, right after the
+// per-block checksums. If the header doesn't match the current geometry, the
+// side area contents are considered garbage and every region starts out
+// stale, to be (re)computed by the scrub task.
+struct [[gnu::packed]] ChecksumAreaHeader {
+    static constexpr u32 expected_magic = 0x53435242; // "SCRB"
+    static constexpr u32 current_version = 1;
+
+    u32 magic;
+    u32 version;
+    u32 block_size;
+    u64 mapped_block_count;
+};
+
+ErrorOr<NonnullLockRefPtr<SnapshotLayerDevice>> SnapshotLayerDevice::create(StorageDevice& device)
+{
+    auto total_block_count = device.max_addressable_block();
+    auto checksums_per_block = device.block_size() / sizeof(u32);
+
+    // Reserve the side area at the end of the device: one checksum block per
+    // checksums_per_block data blocks (slightly over-reserved for simplicity),
+    // plus the header block.
+    u64 checksum_block_count = ceil_div(total_block_count, static_cast<u64>(checksums_per_block));
+    if (total_block_count <= checksum_block_count + 1)
+        return ENOSPC;
+    u64 mapped_block_count = total_block_count - checksum_block_count - 1;
+    u64 checksum_area_start = mapped_block_count;
+    u64 header_block = total_block_count - 1;
+
+    auto header_buffer = TRY(KBuffer::try_create_with_size("SnapshotLayerDevice: Header"sv, device.block_size()));
+    auto header_io_buffer = UserOrKernelBuffer::for_kernel_buffer(header_buffer->data());
+    if (!device.read_block(header_block, header_io_buffer))
+        return EIO;
+    auto& header = *reinterpret_cast<ChecksumAreaHeader*>(header_buffer->data());
+    bool checksums_valid = header.magic == ChecksumAreaHeader::expected_magic
+        && header.version == ChecksumAreaHeader::current_version
+        && header.block_size == device.block_size()
+        && header.mapped_block_count == mapped_block_count;
+
+    u64 region_count = ceil_div(mapped_block_count, static_cast<u64>(checksums_per_block));
+    auto stale_checksum_regions = TRY(Bitmap::create(region_count, !checksums_valid));
+
+    if (!checksums_valid) {
+        header = { ChecksumAreaHeader::expected_magic, ChecksumAreaHeader::current_version, static_cast<u32>(device.block_size()), mapped_block_count };
+        if (!device.write_block(header_block, header_io_buffer))
+            return EIO;
+    }
+
+    auto layer = TRY(DeviceManagement::try_create_device<SnapshotLayerDevice>(device, StorageManagement::generate_storage_minor_number(), mapped_block_count, checksum_area_start, move(stale_checksum_regions)));
+    layer->m_snapshot_view = TRY(DeviceManagement::try_create_device<SnapshotViewDevice>(*layer, StorageManagement::generate_storage_minor_number()));
+    layer->spawn_scrub_task();
+    return layer;
+}
+
+SnapshotLayerDevice::SnapshotLayerDevice(StorageDevice& device, MinorNumber minor_number, u64 mapped_block_count, u64 checksum_area_start, Bitmap stale_checksum_regions)
+    : BlockDevice(StorageManagement::storage_type_major_number(), minor_number, device.block_size())
+    , m_device(device)
+    , m_mapped_block_count(mapped_block_count)
+    , m_checksum_area_start(checksum_area_start)
+    , m_stale_checksum_regions(move(stale_checksum_regions))
+{
+}
+
+SnapshotLayerDevice::~SnapshotLayerDevice() = default;
+
+StringView SnapshotLayerDevice::class_name() const
+{
+    return "SnapshotLayerDevice"sv;
+}
+
+void SnapshotLayerDevice::forward_request(AsyncBlockDeviceRequest& request)
+{
+    auto sub_request_or_error = m_device->try_make_request<AsyncBlockDeviceRequest>(request.request_type(),
+        request.block_index(), request.block_count(), request.buffer(), request.buffer_size());
+    if (sub_request_or_error.is_error()) {
+        request.complete(AsyncDeviceRequest::Failure);
+        return;
+    }
+    request.add_sub_request(sub_request_or_error.release_value());
+}
+
+void SnapshotLayerDevice::start_request(AsyncBlockDeviceRequest& request)
+{
+    if (request.block_index() + request.block_count() > m_mapped_block_count) {
+        request.complete(AsyncDeviceRequest::Failure);
+        return;
+    }
+
+    if (request.request_type() == AsyncBlockDeviceRequest::Write) {
+        bool needs_copy_out = false;
+        {
+            SpinlockLocker locker(m_lock);
+            if (m_snapshot_active) {
+                for (u64 i = 0; i < request.block_count() && !needs_copy_out; ++i)
+                    needs_copy_out = !m_exceptions.contains(request.block_index() + i);
+            }
+        }
+        if (needs_copy_out) {
+            // We may have been called with interrupts disabled, and the
+            // copy-out performs blocking I/O on the underlying device, so
+            // defer it (and the forwarding of the write) to the work queue.
+            auto work_result = g_io_work->try_queue([this, &request]() {
+                if (copy_out_blocks_before_write(request.block_index(), request.block_count()).is_error()) {
+                    request.complete(AsyncDeviceRequest::Failure);
+                    return;
+                }
+                // Mark the regions stale only now, right before the write is
+                // queued: marking them before the copy-out would let a scrub
+                // pass clear the bit and persist pre-write checksums in the
+                // meantime, producing a false mismatch on the next pass.
+                mark_checksum_regions_stale(request.block_index(), request.block_count());
+                forward_request(request);
+            });
+            if (work_result.is_error())
+                request.complete(AsyncDeviceRequest::Failure);
+            return;
+        }
+        mark_checksum_regions_stale(request.block_index(), request.block_count());
+    }
+
+    forward_request(request);
+}
+
+ErrorOr<void> SnapshotLayerDevice::copy_out_blocks_before_write(u64 first_block, size_t block_count)
+{
+    for (u64 block = first_block; block < first_block + block_count; ++block) {
+        {
+            SpinlockLocker locker(m_lock);
+            if (!m_snapshot_active || m_exceptions.contains(block))
+                continue;
+        }
+        auto copy = TRY(KBuffer::try_create_with_size("SnapshotLayerDevice: Exception"sv, block_size()));
+        auto copy_buffer = UserOrKernelBuffer::for_kernel_buffer(copy->data());
+        if (!m_device->read_block(block, copy_buffer))
+            return EIO;
+        SpinlockLocker locker(m_lock);
+        if (m_snapshot_active)
+            TRY(m_exceptions.try_set(block, move(copy)));
+    }
+    return {};
+}
+
+void SnapshotLayerDevice::mark_checksum_regions_stale(u64 first_block, size_t block_count)
+{
+    auto first_region = first_block / checksums_per_block();
+    auto last_region = (first_block + block_count - 1) / checksums_per_block();
+    SpinlockLocker locker(m_lock);
+    for (auto region = first_region; region <= last_region; ++region)
+        m_stale_checksum_regions.set(region, true);
+}
+
+ErrorOr<void> SnapshotLayerDevice::take_snapshot()
+{
+    SpinlockLocker locker(m_lock);
+    if (m_snapshot_active)
+        return EEXIST;
+    m_snapshot_active = true;
+    return {};
+}
+
+void SnapshotLayerDevice::release_snapshot()
+{
+    SpinlockLocker locker(m_lock);
+    m_snapshot_active = false;
+    m_exceptions.clear();
+}
+
+ErrorOr<void> SnapshotLayerDevice::read_block_for_snapshot(Badge<SnapshotViewDevice>, u64 index, UserOrKernelBuffer& kernel_buffer)
+{
+    if (index >= m_mapped_block_count)
+        return EINVAL;
+
+    {
+        SpinlockLocker locker(m_lock);
+        if (auto it = m_exceptions.find(index); it != m_exceptions.end()) {
+            // The view's buffer is a kernel one, so this cannot fault.
+            TRY(kernel_buffer.write(it->value->data(), block_size()));
+            return {};
+        }
+    }
+
+    if (!m_device->read_block(index, kernel_buffer))
+        return EIO;
+    return {};
+}
+
+ErrorOr<size_t> SnapshotLayerDevice::read(OpenFileDescription& fd, u64 offset, UserOrKernelBuffer& outbuf, size_t len)
+{
+    return m_device->read(fd, offset, outbuf, len);
+}
+
+bool SnapshotLayerDevice::can_read(OpenFileDescription const&, u64 offset) const
+{
+    return offset < (m_mapped_block_count * block_size());
+}
+
+ErrorOr<size_t> SnapshotLayerDevice::write(OpenFileDescription& fd, u64 offset, UserOrKernelBuffer const& inbuf, size_t len)
+{
+    u64 first_block = offset >> block_size_log();
+    size_t block_count = ((offset + len + block_size() - 1) >> block_size_log()) - first_block;
+    if (first_block + block_count > m_mapped_block_count)
+        return ENOSPC;
+
+    mark_checksum_regions_stale(first_block, block_count);
+    TRY(copy_out_blocks_before_write(first_block, block_count));
+    return m_device->write(fd, offset, inbuf, len);
+}
+
+bool SnapshotLayerDevice::can_write(OpenFileDescription const&, u64 offset) const
+{
+    return offset < (m_mapped_block_count * block_size());
+}
+
+ErrorOr<void> SnapshotLayerDevice::ioctl(OpenFileDescription&, unsigned request, Userspace<void*> arg)
+{
+    switch (request) {
+    case STORAGE_DEVICE_GET_SIZE: {
+        u64 size = m_mapped_block_count * block_size();
+        return copy_to_user(static_ptr_cast<u64*>(arg), &size);
+    }
+    case STORAGE_DEVICE_GET_BLOCK_SIZE: {
+        size_t size = block_size();
+        return copy_to_user(static_ptr_cast<size_t*>(arg), &size);
+    }
+    case SNAPSHOT_LAYER_TAKE_SNAPSHOT:
+        return take_snapshot();
+    case SNAPSHOT_LAYER_RELEASE_SNAPSHOT:
+        release_snapshot();
+        return {};
+    default:
+        return EINVAL;
+    }
+}
+
+void SnapshotLayerDevice::spawn_scrub_task()
+{
+    LockRefPtr<Thread> scrub_thread;
+    (void)Process::create_kernel_process(scrub_thread, KString::must_create("Storage Scrub Task"sv), [self = LockRefPtr<SnapshotLayerDevice>(this)]() mutable {
+        // One checksum region (block_size() / 4 data blocks) per second keeps
+        // the scrub well below the throughput of even the slowest devices, so
+        // it stays off the hot path.
+        for (;;) {
+            (void)Thread::current()->sleep(Time::from_seconds(1));
+            self->scrub_next_region();
+        }
+    });
+}
+
+void SnapshotLayerDevice::scrub_next_region()
+{
+    auto region_count = checksum_region_count();
+    if (region_count == 0)
+        return;
+    auto region = m_scrub_cursor;
+    m_scrub_cursor = (m_scrub_cursor + 1) % region_count;
+
+    u64 first_block = region * checksums_per_block();
+    size_t block_count = min(static_cast<u64>(checksums_per_block()), m_mapped_block_count - first_block);
+
+    bool recompute;
+    {
+        SpinlockLocker locker(m_lock);
+        recompute = m_stale_checksum_regions.get(region);
+        if (recompute)
+            m_stale_checksum_regions.set(region, false);
+    }
+
+    auto stored_buffer_or_error = KBuffer::try_create_with_size("SnapshotLayerDevice: Stored checksums"sv, block_size());
+    auto computed_buffer_or_error = KBuffer::try_create_with_size("SnapshotLayerDevice: Computed checksums"sv, block_size());
+    auto data_block_or_error = KBuffer::try_create_with_size("SnapshotLayerDevice: Scrub data"sv, block_size());
+    if (stored_buffer_or_error.is_error() || computed_buffer_or_error.is_error() || data_block_or_error.is_error())
+        return;
+    auto stored_buffer = stored_buffer_or_error.release_value();
+    auto computed_buffer = computed_buffer_or_error.release_value();
+    auto data_block = data_block_or_error.release_value();
+    auto* stored_checksums = reinterpret_cast<u32*>(stored_buffer->data());
+    auto* computed_checksums = reinterpret_cast<u32*>(computed_buffer->data());
+    auto stored_io_buffer = UserOrKernelBuffer::for_kernel_buffer(stored_buffer->data());
+    auto data_io_buffer = UserOrKernelBuffer::for_kernel_buffer(data_block->data());
+
+    if (!recompute && !m_device->read_block(m_checksum_area_start + region, stored_io_buffer))
+        return;
+
+    for (size_t i = 0; i < block_count; ++i) {
+        if (!m_device->read_block(first_block + i, data_io_buffer))
+            return;
+        computed_checksums[i] = crc32(data_block->bytes());
+    }
+
+    {
+        // If the region was written to while we were reading it, neither
+        // verifying nor persisting our checksums would be sound; a later pass
+        // will recompute the region.
+        SpinlockLocker locker(m_lock);
+        if (m_stale_checksum_regions.get(region))
+            return;
+    }
+
+    if (recompute) {
+        auto computed_io_buffer = UserOrKernelBuffer::for_kernel_buffer(computed_buffer->data());
+        (void)m_device->write_block(m_checksum_area_start + region, computed_io_buffer);
+        return;
+    }
+
+    bool any_mismatch = false;
+    for (size_t i = 0; i < block_count; ++i) {
+        if (stored_checksums[i] == computed_checksums[i])
+            continue;
+        dmesgln("SnapshotLayerDevice: Checksum mismatch on block {}: expected {:#08x}, got {:#08x}", first_block + i, stored_checksums[i], computed_checksums[i]);
+        // Remember the current contents, so persistent corruption is only reported once.
+        stored_checksums[i] = computed_checksums[i];
+        any_mismatch = true;
+    }
+    if (any_mismatch)
+        (void)m_device->write_block(m_checksum_area_start + region, stored_io_buffer);
+}
+
+SnapshotViewDevice::SnapshotViewDevice(SnapshotLayerDevice& layer, MinorNumber minor_number)
+    : BlockDevice(StorageManagement::storage_type_major_number(), minor_number, layer.block_size())
+    , m_layer(layer)
+{
+}
+
+SnapshotViewDevice::~SnapshotViewDevice() = default;
+
+StringView SnapshotViewDevice::class_name() const
+{
+    return "SnapshotViewDevice"sv;
+}
+
+void SnapshotViewDevice::start_request(AsyncBlockDeviceRequest& request)
+{
+    if (request.request_type() == AsyncBlockDeviceRequest::Write) {
+        request.complete(AsyncDeviceRequest::Failure);
+        return;
+    }
+
+    // Reading from the exception store may allocate and the pass-through path
+    // performs blocking I/O, so service the request from the work queue.
+    auto work_result = g_io_work->try_queue([this, &request]() {
+        auto result = [&]() -> ErrorOr<void> {
+            auto temp = TRY(KBuffer::try_create_with_size("SnapshotViewDevice: Read"sv, block_size()));
+            auto temp_buffer = UserOrKernelBuffer::for_kernel_buffer(temp->data());
+            for (u32 i = 0; i < request.block_count(); ++i) {
+                TRY(m_layer->read_block_for_snapshot({}, request.block_index() + i, temp_buffer));
+                TRY(request.write_to_buffer(request.buffer(), temp->data(), i * block_size(), block_size()));
+            }
+            return {};
+        }();
+        request.complete(result.is_error() ? AsyncDeviceRequest::Failure : AsyncDeviceRequest::Success);
+    });
+    if (work_result.is_error())
+        request.complete(AsyncDeviceRequest::Failure);
+}
+
+ErrorOr<size_t> SnapshotViewDevice::read(OpenFileDescription&, u64 offset, UserOrKernelBuffer& outbuf, size_t len)
+{
+    auto temp = TRY(KBuffer::try_create_with_size("SnapshotViewDevice: Read"sv, block_size()));
+    auto temp_buffer = UserOrKernelBuffer::for_kernel_buffer(temp->data());
+
+    size_t nread = 0;
+    while (nread < len) {
+        u64 block = (offset + nread) >> block_size_log();
+        if (block >= m_layer->mapped_block_count())
+            break;
+        size_t offset_in_block = (offset + nread) - (block << block_size_log());
+        size_t to_copy = min(len - nread, block_size() - offset_in_block);
+        TRY(m_layer->read_block_for_snapshot({}, block, temp_buffer));
+        TRY(outbuf.write(temp->data() + offset_in_block, nread, to_copy));
+        nread += to_copy;
+    }
+    return nread;
+}
+
+bool SnapshotViewDevice::can_read(OpenFileDescription const&, u64 offset) const
+{
+    return offset < (m_layer->mapped_block_count() * block_size());
+}
+
+ErrorOr<size_t> SnapshotViewDevice::write(OpenFileDescription&, u64, UserOrKernelBuffer const&, size_t)
+{
+    return EROFS;
+}
+
+bool SnapshotViewDevice::can_write(OpenFileDescription const&, u64) const
+{
+    return false;
+}
+
+}
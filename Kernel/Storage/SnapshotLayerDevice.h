@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Bitmap.h>
+#include <AK/HashMap.h>
+#include <Kernel/Devices/BlockDevice.h>
+#include <Kernel/KBuffer.h>
+#include <Kernel/Library/LockRefPtr.h>
+#include <Kernel/Locking/Spinlock.h>
+#include <Kernel/Storage/StorageDevice.h>
+
+namespace Kernel {
+
+class SnapshotViewDevice;
+
+// A device-mapper-style layer stacked on top of a StorageDevice. It exposes
+// the underlying device minus a reserved side area at its end, and adds two
+// facilities on top of the plain block interface:
+//
+// - Copy-on-write snapshots: while a snapshot is active, the original
+//   contents of every block is copied into an in-memory exception store
+//   before it is overwritten. A companion read-only SnapshotViewDevice
+//   exposes the frozen contents, so a mounted Ext2 volume can be backed up
+//   online without unmounting it.
+//
+// - Checksum scrubbing: the side area holds a CRC32 per exposed block. The
+//   hot path only marks checksum regions stale in an in-memory bitmap; a
+//   background kernel task walks the device at a fixed, low rate, recomputing
+//   stale regions and verifying clean ones, reporting any mismatch.
+class SnapshotLayerDevice final : public BlockDevice {
+    friend class DeviceManagement;
+
+public:
+    static ErrorOr<NonnullLockRefPtr<SnapshotLayerDevice>> create(StorageDevice&);
+    virtual ~SnapshotLayerDevice() override;
+
+    // ^BlockDevice
+    virtual void start_request(AsyncBlockDeviceRequest&) override;
+    virtual ErrorOr<size_t> read(OpenFileDescription&, u64, UserOrKernelBuffer&, size_t) override;
+    virtual bool can_read(OpenFileDescription const&, u64) const override;
+    virtual ErrorOr<size_t> write(OpenFileDescription&, u64, UserOrKernelBuffer const&, size_t) override;
+    virtual bool can_write(OpenFileDescription const&, u64) const override;
+
+    // ^File
+    virtual ErrorOr<void> ioctl(OpenFileDescription&, unsigned request, Userspace<void*> arg) override;
+
+    u64 mapped_block_count() const { return m_mapped_block_count; }
+
+    ErrorOr<void> take_snapshot();
+    void release_snapshot();
+
+    // Fills the given kernel buffer with the snapshotted contents of a block:
+    // its copied-out original if the block was overwritten since the snapshot
+    // was taken, its live contents otherwise.
+    ErrorOr<void> read_block_for_snapshot(Badge<SnapshotViewDevice>, u64 index, UserOrKernelBuffer& kernel_buffer);
+
+private:
+    SnapshotLayerDevice(StorageDevice&, MinorNumber, u64 mapped_block_count, u64 checksum_area_start, Bitmap stale_checksum_regions);
+    virtual StringView class_name() const override;
+
+    void spawn_scrub_task();
+    void scrub_next_region();
+
+    void forward_request(AsyncBlockDeviceRequest&);
+    ErrorOr<void> copy_out_blocks_before_write(u64 first_block, size_t block_count);
+    void mark_checksum_regions_stale(u64 first_block, size_t block_count);
+
+    size_t checksums_per_block() const { return block_size() / sizeof(u32); }
+    u64 checksum_region_count() const { return ceil_div(m_mapped_block_count, static_cast<u64>(checksums_per_block())); }
+
+    NonnullLockRefPtr<StorageDevice> m_device;
+    LockRefPtr<SnapshotViewDevice> m_snapshot_view;
+
+    u64 const m_mapped_block_count { 0 };
+    u64 const m_checksum_area_start { 0 };
+
+    // Guards the snapshot state, the exception store and the stale bitmap;
+    // start_request() may run with interrupts disabled, so this cannot be a Mutex.
+    mutable Spinlock<LockRank::None> m_lock {};
+    bool m_snapshot_active { false };
+    HashMap<u64, NonnullOwnPtr<KBuffer>> m_exceptions;
+    Bitmap m_stale_checksum_regions;
+
+    // Only ever touched by the scrub task.
+    u64 m_scrub_cursor { 0 };
+};
+
+// The read-only view of the layer's active snapshot. While no snapshot is
+// active, it simply reads through to the live device.
+class SnapshotViewDevice final : public BlockDevice {
+    friend class DeviceManagement;
+
+public:
+    virtual ~SnapshotViewDevice() override;
+
+    // ^BlockDevice
+    virtual void start_request(AsyncBlockDeviceRequest&) override;
+    virtual ErrorOr<size_t> read(OpenFileDescription&, u64, UserOrKernelBuffer&, size_t) override;
+    virtual bool can_read(OpenFileDescription const&, u64) const override;
+    virtual ErrorOr<size_t> write(OpenFileDescription&, u64, UserOrKernelBuffer const&, size_t) override;
+    virtual bool can_write(OpenFileDescription const&, u64) const override;
+
+private:
+    SnapshotViewDevice(SnapshotLayerDevice&, MinorNumber);
+    virtual StringView class_name() const override;
+
+    NonnullLockRefPtr<SnapshotLayerDevice> m_layer;
+};
+
+}
@@ -13,6 +13,7 @@
 #include <Kernel/FileSystem/SysFS/Subsystems/DeviceIdentifiers/SymbolicLinkDeviceComponent.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Devices/Storage/DeviceDirectory.h>
 #include <Kernel/FileSystem/SysFS/Subsystems/Devices/Storage/Directory.h>
+#include <Kernel/Storage/SnapshotLayerDevice.h>
 #include <Kernel/Storage/StorageDevice.h>
 #include <Kernel/Storage/StorageManagement.h>
 
@@ -66,6 +67,42 @@ StringView StorageDevice::class_name() const
     return "StorageDevice"sv;
 }
 
+// C-LOOK elevator dispatch: pick the queued request with the lowest starting
+// block at or after where the previous dispatch left off, wrapping to the
+// lowest block once the sweep runs out of requests ahead of it. This keeps
+// mixed random/sequential workloads from constantly seeking back and forth
+// between distant regions of the disk. The oldest request (the front of the
+// queue) is only passed over a bounded number of times, so a stream of
+// sequential I/O cannot starve a request at the far end of the disk.
+static constexpr size_t max_elevator_skips = 8;
+
+AsyncDeviceRequest* StorageDevice::next_request_to_start(DoublyLinkedList<LockRefPtr<AsyncDeviceRequest>>& requests)
+{
+    auto* oldest_request = static_cast<AsyncBlockDeviceRequest*>(requests.first().ptr());
+    if (m_elevator_skip_count >= max_elevator_skips) {
+        m_elevator_skip_count = 0;
+        m_next_elevator_block = oldest_request->block_index() + oldest_request->block_count();
+        return oldest_request;
+    }
+
+    AsyncBlockDeviceRequest* best_ahead = nullptr;
+    AsyncBlockDeviceRequest* best_overall = nullptr;
+    for (auto& queued_request : requests) {
+        auto* request = static_cast<AsyncBlockDeviceRequest*>(queued_request.ptr());
+        if (request->block_index() >= m_next_elevator_block && (!best_ahead || request->block_index() < best_ahead->block_index()))
+            best_ahead = request;
+        if (!best_overall || request->block_index() < best_overall->block_index())
+            best_overall = request;
+    }
+    auto* chosen_request = best_ahead ? best_ahead : best_overall;
+    if (chosen_request == oldest_request)
+        m_elevator_skip_count = 0;
+    else
+        m_elevator_skip_count++;
+    m_next_elevator_block = chosen_request->block_index() + chosen_request->block_count();
+    return chosen_request;
+}
+
 StringView StorageDevice::command_set_to_string_view() const
 {
     switch (command_set()) {
@@ -104,6 +141,8 @@ ErrorOr<size_t> StorageDevice::read(OpenFileDescription&, u64 offset, UserOrKern
 
     if (whole_blocks > 0) {
         auto read_request = TRY(try_make_request<AsyncBlockDeviceRequest>(AsyncBlockDeviceRequest::Read, index, whole_blocks, outbuf, whole_blocks * block_size()));
+        m_read_requests.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        m_blocks_read.fetch_add(whole_blocks, AK::MemoryOrder::memory_order_relaxed);
         auto result = read_request->wait();
         if (result.wait_result().was_interrupted())
             return EINTR;
@@ -124,6 +163,8 @@ ErrorOr<size_t> StorageDevice::read(OpenFileDescription&, u64 offset, UserOrKern
         auto data = TRY(ByteBuffer::create_uninitialized(block_size()));
         auto data_buffer = UserOrKernelBuffer::for_kernel_buffer(data.data());
         auto read_request = TRY(try_make_request<AsyncBlockDeviceRequest>(AsyncBlockDeviceRequest::Read, index + whole_blocks, 1, data_buffer, block_size()));
+        m_read_requests.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        m_blocks_read.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
         auto result = read_request->wait();
         if (result.wait_result().was_interrupted())
             return EINTR;
@@ -176,6 +217,8 @@ ErrorOr<size_t> StorageDevice::write(OpenFileDescription&, u64 offset, UserOrKer
 
     if (whole_blocks > 0) {
         auto write_request = TRY(try_make_request<AsyncBlockDeviceRequest>(AsyncBlockDeviceRequest::Write, index, whole_blocks, inbuf, whole_blocks * block_size()));
+        m_write_requests.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        m_blocks_written.fetch_add(whole_blocks, AK::MemoryOrder::memory_order_relaxed);
         auto result = write_request->wait();
         if (result.wait_result().was_interrupted())
             return EINTR;
@@ -199,6 +242,8 @@ ErrorOr<size_t> StorageDevice::write(OpenFileDescription&, u64 offset, UserOrKer
         auto data_buffer = UserOrKernelBuffer::for_kernel_buffer(partial_write_block->data());
         {
             auto read_request = TRY(try_make_request<AsyncBlockDeviceRequest>(AsyncBlockDeviceRequest::Read, index + whole_blocks, 1, data_buffer, block_size()));
+            m_read_requests.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            m_blocks_read.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
             auto result = read_request->wait();
             if (result.wait_result().was_interrupted())
                 return EINTR;
@@ -219,6 +264,8 @@ ErrorOr<size_t> StorageDevice::write(OpenFileDescription&, u64 offset, UserOrKer
 
         {
             auto write_request = TRY(try_make_request<AsyncBlockDeviceRequest>(AsyncBlockDeviceRequest::Write, index + whole_blocks, 1, data_buffer, block_size()));
+            m_write_requests.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            m_blocks_written.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
             auto result = write_request->wait();
             if (result.wait_result().was_interrupted())
                 return EINTR;
@@ -257,6 +304,14 @@ ErrorOr<void> StorageDevice::ioctl(OpenFileDescription&, unsigned request, Users
         return copy_to_user(static_ptr_cast<size_t*>(arg), &size);
         break;
     }
+    case STORAGE_DEVICE_CREATE_SNAPSHOT_LAYER: {
+        if (m_snapshot_layer)
+            return EEXIST;
+        auto layer = TRY(SnapshotLayerDevice::create(*this));
+        m_snapshot_layer = layer;
+        u64 device_numbers = (static_cast<u64>(layer->major().value()) << 32) | layer->minor().value();
+        return copy_to_user(static_ptr_cast<u64*>(arg), &device_numbers);
+    }
     default:
         return EINVAL;
     }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/IntrusiveList.h>
 #include <Kernel/Devices/BlockDevice.h>
 #include <Kernel/Interrupts/IRQHandler.h>
@@ -16,6 +17,7 @@
 namespace Kernel {
 
 class RamdiskDevice;
+class SnapshotLayerDevice;
 class StorageDevice : public BlockDevice {
     friend class StorageManagement;
     friend class DeviceManagement;
@@ -56,6 +58,11 @@ public:
 public:
     virtual u64 max_addressable_block() const { return m_max_addressable_block; }
 
+    u64 read_requests() const { return m_read_requests.load(AK::MemoryOrder::memory_order_relaxed); }
+    u64 write_requests() const { return m_write_requests.load(AK::MemoryOrder::memory_order_relaxed); }
+    u64 blocks_read() const { return m_blocks_read.load(AK::MemoryOrder::memory_order_relaxed); }
+    u64 blocks_written() const { return m_blocks_written.load(AK::MemoryOrder::memory_order_relaxed); }
+
     // ^BlockDevice
     virtual ErrorOr<size_t> read(OpenFileDescription&, u64, UserOrKernelBuffer&, size_t) override;
     virtual bool can_read(OpenFileDescription const&, u64) const override;
@@ -92,8 +99,12 @@ private:
     virtual ErrorOr<void> after_inserting() override;
     virtual void will_be_destroyed() override;
 
+    // ^Device
+    virtual AsyncDeviceRequest* next_request_to_start(DoublyLinkedList<LockRefPtr<AsyncDeviceRequest>>&) override;
+
     mutable IntrusiveListNode<StorageDevice, LockRefPtr<StorageDevice>> m_list_node;
     NonnullLockRefPtrVector<DiskPartition> m_partitions;
+    LockRefPtr<SnapshotLayerDevice> m_snapshot_layer;
 
     LUNAddress const m_logical_unit_number_address;
 
@@ -106,6 +117,16 @@ private:
 
     u64 m_max_addressable_block { 0 };
     size_t m_blocks_per_page { 0 };
+
+    // Elevator dispatch state, guarded by the Device request queue lock.
+    u64 m_next_elevator_block { 0 };
+    size_t m_elevator_skip_count { 0 };
+
+    // I/O statistics, exposed through SysFS. Counted at request submission.
+    Atomic<u64> m_read_requests { 0 };
+    Atomic<u64> m_write_requests { 0 };
+    Atomic<u64> m_blocks_read { 0 };
+    Atomic<u64> m_blocks_written { 0 };
 };
 
 }
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Process.h>
+
+namespace Kernel {
+
+static constexpr size_t maximum_batched_io_ops = 256;
+
+static ErrorOr<size_t> perform_batched_io_op(Process& process, batch_io_op const& op)
+{
+    if (op.flags != 0)
+        return EINVAL;
+    if (op.buffer_size > NumericLimits<i32>::max())
+        return EINVAL;
+
+    auto description = TRY(process.fds().with_shared([&](auto& fds) { return fds.open_file_description(op.fd); }));
+
+    switch (op.opcode) {
+    case BATCH_IO_READ: {
+        if (!description->is_readable())
+            return EBADF;
+        if (description->is_directory())
+            return EISDIR;
+        // NOTE: Batched operations never block; a not-ready description simply
+        //       completes with EAGAIN, like a non-blocking read would.
+        if (!description->can_read())
+            return EAGAIN;
+        auto buffer = TRY(UserOrKernelBuffer::for_user_buffer(static_cast<u8*>(op.buffer), op.buffer_size));
+        return description->read(buffer, op.buffer_size);
+    }
+    case BATCH_IO_WRITE: {
+        if (!description->is_writable())
+            return EBADF;
+        if (!description->can_write())
+            return EAGAIN;
+        auto buffer = TRY(UserOrKernelBuffer::for_user_buffer(static_cast<u8*>(op.buffer), op.buffer_size));
+        return description->write(buffer, op.buffer_size);
+    }
+    default:
+        return EINVAL;
+    }
+}
+
+ErrorOr<FlatPtr> Process::sys$batch_io(Userspace<Syscall::SC_batch_io_params const*> user_params)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+    auto params = TRY(copy_typed_from_user(user_params));
+
+    if (params.op_count == 0)
+        return 0;
+    if (params.op_count > maximum_batched_io_ops)
+        return EINVAL;
+
+    Vector<batch_io_op, 32> ops;
+    TRY(ops.try_resize(params.op_count));
+    TRY(copy_n_from_user(ops.data(), params.ops, params.op_count));
+
+    size_t completed_ops = 0;
+    for (auto& op : ops) {
+        auto result = perform_batched_io_op(*this, op);
+        if (result.is_error()) {
+            op.result = -static_cast<ssize_t>(result.error().code());
+        } else {
+            op.result = static_cast<ssize_t>(result.value());
+            ++completed_ops;
+        }
+    }
+
+    TRY(copy_n_to_user(params.ops, ops.data(), params.op_count));
+    return completed_ops;
+}
+
+}
@@ -77,6 +77,7 @@ ErrorOr<FlatPtr> Process::sys$fork(RegisterState& regs)
     }));
 
     child->m_pg = m_pg;
+    child->set_block_io_bandwidth_limit(block_io_bandwidth_limit());
 
     with_protected_data([&](auto& my_protected_data) {
         child->with_mutable_protected_data([&](auto& child_protected_data) {
@@ -138,7 +139,11 @@ ErrorOr<FlatPtr> Process::sys$fork(RegisterState& regs)
             for (auto& region : parent_space->region_tree().regions()) {
                 dbgln_if(FORK_DEBUG, "fork: cloning Region '{}' @ {}", region.name(), region.vaddr());
                 auto region_clone = TRY(region.try_clone());
-                TRY(region_clone->map(child_space->page_directory(), Memory::ShouldFlushTLB::No));
+                // Defer page table population for anonymous regions; the child
+                // materializes pages on first touch, so fork cost scales with
+                // what the child actually uses instead of address space size.
+                // Inode-backed regions already page in lazily via handle_inode_fault().
+                TRY(region_clone->map(child_space->page_directory(), Memory::ShouldFlushTLB::No, Memory::ShouldPopulatePageTables::No));
                 TRY(child_space->region_tree().place_specifically(*region_clone, region.range()));
                 auto* child_region = region_clone.leak_ptr();
 
@@ -15,6 +15,11 @@ namespace Kernel {
 
 static Singleton<SpinlockProtected<HashMap<GlobalFutexKey, NonnullLockRefPtr<FutexQueue>>, LockRank::None>> s_global_futex_queues;
 
+// Number of queues in s_global_futex_queues, maintained while holding its
+// lock but readable without it. Lets uncontended wakes (nobody has ever
+// waited, or all waiters are gone) skip the global queue lock entirely.
+static Atomic<size_t> s_global_futex_queues_count;
+
 void Process::clear_futex_queues_on_exec()
 {
     s_global_futex_queues->with([this](auto& queues) {
@@ -27,6 +32,7 @@ void Process::clear_futex_queues_on_exec()
             bool did_wake_all;
             futex_queue->wake_all(did_wake_all);
             VERIFY(did_wake_all); // No one should be left behind...
+            s_global_futex_queues_count.fetch_sub(1, AK::memory_order_seq_cst);
             return true;
         });
     });
@@ -136,6 +142,7 @@ ErrorOr<FlatPtr> Process::sys$futex(Userspace<Syscall::SC_futex_params const*> u
             auto futex_queue = TRY(adopt_nonnull_lock_ref_or_enomem(new (nothrow) FutexQueue));
             auto result = TRY(queues.try_set(futex_key, futex_queue));
             VERIFY(result == AK::HashSetResult::InsertedNewEntry);
+            s_global_futex_queues_count.fetch_add(1, AK::memory_order_seq_cst);
             return futex_queue;
         });
     };
@@ -145,8 +152,10 @@ ErrorOr<FlatPtr> Process::sys$futex(Userspace<Syscall::SC_futex_params const*> u
             auto it = queues.find(futex_key);
             if (it == queues.end())
                 return;
-            if (it->value->try_remove())
+            if (it->value->try_remove()) {
                 queues.remove(it);
+                s_global_futex_queues_count.fetch_sub(1, AK::memory_order_seq_cst);
+            }
         });
     };
 
@@ -154,6 +163,12 @@ ErrorOr<FlatPtr> Process::sys$futex(Userspace<Syscall::SC_futex_params const*> u
         if (count == 0)
             return 0;
         auto futex_key = TRY(get_futex_key(user_address, shared));
+        // Fast path: there is nobody to wake, so don't bother with the global
+        // queue lock. The count only changes while that lock is held, so
+        // observing zero here is equivalent to taking the lock and finding no
+        // queue for this key.
+        if (s_global_futex_queues_count.load(AK::memory_order_seq_cst) == 0)
+            return 0;
         auto futex_queue = TRY(find_futex_queue(futex_key, false));
         if (!futex_queue)
             return 0;
@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <Kernel/FileSystem/Custody.h>
 #include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/FileSystem/VirtualFileSystem.h>
+#include <Kernel/KString.h>
 #include <Kernel/Process.h>
 
 namespace Kernel {
@@ -21,4 +24,70 @@ ErrorOr<FlatPtr> Process::sys$get_dir_entries(int fd, Userspace<void*> user_buff
     return count;
 }
 
+// A "readdir-plus": returns every remaining directory entry together with its
+// metadata in one buffer, saving a stat() syscall per entry. Each record is a
+// u64 inode index, a u8 entry type, a u32 name length, the name bytes, and a
+// struct stat for the entry.
+ErrorOr<FlatPtr> Process::sys$get_dir_entries_stat(int fd, Userspace<void*> user_buffer, size_t user_size)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::rpath));
+    if (user_size > NumericLimits<ssize_t>::max())
+        return EINVAL;
+    auto description = TRY(open_file_description(fd));
+    if (!description->is_directory())
+        return ENOTDIR;
+    auto custody = description->custody();
+    if (!custody)
+        return EINVAL;
+
+    struct Entry {
+        NonnullOwnPtr<KString> name;
+        u64 inode_index { 0 };
+        u8 type { 0 };
+    };
+
+    // Collect the entries first so no directory locks are held while we do the
+    // per-entry metadata lookups below.
+    Vector<Entry> entries;
+    TRY(description->inode()->traverse_as_directory([&](auto& entry) -> ErrorOr<void> {
+        auto name = TRY(KString::try_create(entry.name));
+        auto type = description->inode()->fs().internal_file_type_to_directory_entry_type(entry);
+        TRY(entries.try_append(Entry { move(name), entry.inode.index().value(), type }));
+        return {};
+    }));
+
+    auto buffer = TRY(UserOrKernelBuffer::for_user_buffer(user_buffer, user_size));
+    size_t remaining = user_size;
+
+    // We should only return EINVAL when the userspace buffer is too small, so
+    // that userspace can reliably use it as a signal to increase its buffer size.
+    auto write_bytes = [&](void const* data, size_t size) -> ErrorOr<void> {
+        if (remaining < size)
+            return EINVAL;
+        TRY(buffer.write(data, size));
+        buffer = buffer.offset(size);
+        remaining -= size;
+        return {};
+    };
+
+    for (auto& entry : entries) {
+        auto metadata_or_error = VirtualFileSystem::the().lookup_metadata(credentials(), entry.name->view(), *custody, O_NOFOLLOW_NOERROR);
+        // An entry vanishing between the directory walk and the metadata lookup
+        // is the same race as between readdir() and lstat(); skip it.
+        if (metadata_or_error.is_error())
+            continue;
+        auto statbuf = TRY(metadata_or_error.value().stat());
+
+        u32 name_length = entry.name->length();
+        TRY(write_bytes(&entry.inode_index, sizeof(entry.inode_index)));
+        TRY(write_bytes(&entry.type, sizeof(entry.type)));
+        TRY(write_bytes(&name_length, sizeof(name_length)));
+        TRY(write_bytes(entry.name->characters(), name_length));
+        TRY(write_bytes(&statbuf, sizeof(statbuf)));
+    }
+
+    return user_size - remaining;
+}
+
 }
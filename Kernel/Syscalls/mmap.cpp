@@ -173,6 +173,7 @@ ErrorOr<FlatPtr> Process::sys$mmap(Userspace<Syscall::SC_mmap_params const*> use
     bool map_noreserve = flags & MAP_NORESERVE;
     bool map_randomized = flags & MAP_RANDOMIZED;
     bool map_fixed_noreplace = flags & MAP_FIXED_NOREPLACE;
+    bool map_populate = flags & MAP_POPULATE;
 
     if (map_shared && map_private)
         return EINVAL;
@@ -261,6 +262,12 @@ ErrorOr<FlatPtr> Process::sys$mmap(Userspace<Syscall::SC_mmap_params const*> use
         if (name)
             region->set_name(move(name));
 
+        // MAP_POPULATE faults the file contents in up front instead of on
+        // first access. Best-effort: if we can't populate everything, the
+        // remaining pages are demand-paged as usual.
+        if (map_populate && region->vmobject().is_inode())
+            region->populate_pages_from_inode();
+
         PerformanceManager::add_mmap_perf_event(*this, *region);
 
         return region->vaddr().get();
@@ -18,6 +18,19 @@ ErrorOr<FlatPtr> Process::sys$prctl(int option, FlatPtr arg1, [[maybe_unused]] F
     case PR_SET_DUMPABLE:
         set_dumpable(arg1);
         return 0;
+    case PR_SET_BLOCK_IO_BANDWIDTH: {
+        u64 new_limit = arg1;
+        u64 current_limit = block_io_bandwidth_limit();
+        // Tightening the limit is always allowed, but raising or removing one
+        // requires superuser, or a throttled process could just unthrottle itself.
+        bool is_tightening = new_limit != 0 && (current_limit == 0 || new_limit <= current_limit);
+        if (!is_tightening && !credentials()->is_superuser())
+            return EPERM;
+        set_block_io_bandwidth_limit(new_limit);
+        return 0;
+    }
+    case PR_GET_BLOCK_IO_BANDWIDTH:
+        return block_io_bandwidth_limit();
     }
     return EINVAL;
 }
@@ -59,6 +59,8 @@ ErrorOr<FlatPtr> Process::sys$readv(int fd, Userspace<const struct iovec*> iov,
     }
 
     auto description = TRY(open_readable_file_description(fds(), fd));
+    if (description->should_charge_block_io())
+        TRY(charge_block_io(total_length));
 
     int nread = 0;
     for (auto& vec : vecs) {
@@ -95,6 +97,8 @@ ErrorOr<FlatPtr> Process::read_impl(int fd, Userspace<u8*> buffer, size_t size)
         return EINVAL;
     dbgln_if(IO_DEBUG, "sys$read({}, {}, {})", fd, buffer.ptr(), size);
     auto description = TRY(open_readable_file_description(fds(), fd));
+    if (description->should_charge_block_io())
+        TRY(charge_block_io(size));
 
     TRY(check_blocked_read(description));
     auto user_buffer = TRY(UserOrKernelBuffer::for_user_buffer(buffer, size));
@@ -118,6 +122,8 @@ ErrorOr<FlatPtr> Process::sys$pread(int fd, Userspace<u8*> buffer, size_t size,
     auto description = TRY(open_readable_file_description(fds(), fd));
     if (!description->file().is_seekable())
         return EINVAL;
+    if (description->should_charge_block_io())
+        TRY(charge_block_io(size));
     TRY(check_blocked_read(description));
     auto user_buffer = TRY(UserOrKernelBuffer::for_user_buffer(buffer, size));
     return TRY(description->read(user_buffer, offset, size));
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <Kernel/FileSystem/OpenFileDescription.h>
+#include <Kernel/Process.h>
+
+namespace Kernel {
+
+static constexpr size_t sendfile_chunk_size = 64 * KiB;
+
+ErrorOr<FlatPtr> Process::sys$sendfile(int out_fd, int in_fd, Userspace<off_t*> userspace_offset, size_t count)
+{
+    VERIFY_PROCESS_BIG_LOCK_ACQUIRED(this);
+    TRY(require_promise(Pledge::stdio));
+
+    if (count == 0)
+        return 0;
+    if (count > NumericLimits<i32>::max())
+        return EINVAL;
+
+    auto in_description = TRY(fds().with_shared([&](auto& fds) { return fds.open_file_description(in_fd); }));
+    if (!in_description->is_readable())
+        return EBADF;
+    if (in_description->is_directory())
+        return EISDIR;
+    if (!in_description->file().is_seekable())
+        return EINVAL;
+
+    auto out_description = TRY(fds().with_shared([&](auto& fds) { return fds.open_file_description(out_fd); }));
+    if (!out_description->is_writable())
+        return EBADF;
+
+    Optional<off_t> in_offset;
+    if (userspace_offset) {
+        in_offset = TRY(copy_typed_from_user(userspace_offset));
+        if (*in_offset < 0)
+            return EINVAL;
+    }
+
+    auto chunk_buffer = TRY(KBuffer::try_create_with_size("sys$sendfile chunk"sv, min(count, sendfile_chunk_size)));
+    auto kernel_buffer = UserOrKernelBuffer::for_kernel_buffer(chunk_buffer->data());
+
+    size_t total_sent = 0;
+    while (total_sent < count) {
+        size_t chunk_size = min(count - total_sent, chunk_buffer->size());
+        auto nread_or_error = in_offset.has_value()
+            ? in_description->read(kernel_buffer, *in_offset, chunk_size)
+            : in_description->read(kernel_buffer, chunk_size);
+        if (nread_or_error.is_error()) {
+            if (total_sent > 0)
+                break;
+            return nread_or_error.release_error();
+        }
+        auto nread = nread_or_error.value();
+        if (nread == 0)
+            break;
+
+        auto nwritten_or_error = do_write(*out_description, kernel_buffer, nread, {});
+        if (nwritten_or_error.is_error()) {
+            // Roll the input file position back over whatever we couldn't write out,
+            // so the caller can retry from where this call actually stopped.
+            if (!in_offset.has_value())
+                TRY(in_description->seek(-static_cast<off_t>(nread), SEEK_CUR));
+            if (total_sent > 0)
+                break;
+            return nwritten_or_error.release_error();
+        }
+        auto nwritten = nwritten_or_error.value();
+        total_sent += nwritten;
+        if (in_offset.has_value())
+            *in_offset += nwritten;
+        else if (nwritten < nread)
+            TRY(in_description->seek(-static_cast<off_t>(nread - nwritten), SEEK_CUR));
+        if (nwritten < nread)
+            break;
+    }
+
+    if (in_offset.has_value()) {
+        off_t updated_offset = *in_offset;
+        TRY(copy_to_user(userspace_offset, &updated_offset));
+    }
+    return total_sent;
+}
+
+}
@@ -47,4 +47,56 @@ ErrorOr<FlatPtr> Process::sys$stat(Userspace<Syscall::SC_stat_params const*> use
     return 0;
 }
 
+static constexpr size_t maximum_batched_stat_ops = 1024;
+
+ErrorOr<FlatPtr> Process::sys$batch_stat(Userspace<Syscall::SC_batch_stat_params const*> user_params)
+{
+    VERIFY_NO_PROCESS_BIG_LOCK(this);
+    TRY(require_promise(Pledge::rpath));
+    auto params = TRY(copy_typed_from_user(user_params));
+
+    if (params.op_count == 0)
+        return 0;
+    if (params.op_count > maximum_batched_stat_ops)
+        return EINVAL;
+
+    Vector<stat_batch_op, 32> ops;
+    TRY(ops.try_resize(params.op_count));
+    TRY(copy_n_from_user(ops.data(), params.ops, params.op_count));
+
+    auto perform_op = [&](stat_batch_op const& op) -> ErrorOr<void> {
+        auto path = TRY(get_syscall_path_argument(Syscall::StringArgument { op.path, op.path_length }));
+
+        RefPtr<Custody> base;
+        if (op.dirfd == AT_FDCWD) {
+            base = current_directory();
+        } else {
+            auto base_description = TRY(open_file_description(op.dirfd));
+            if (!base_description->is_directory())
+                return ENOTDIR;
+            if (!base_description->custody())
+                return EINVAL;
+            base = base_description->custody();
+        }
+        auto metadata = TRY(VirtualFileSystem::the().lookup_metadata(credentials(), path->view(), *base, op.follow_symlinks ? 0 : O_NOFOLLOW_NOERROR));
+        auto statbuf = TRY(metadata.stat());
+        TRY(copy_to_user(op.statbuf, &statbuf));
+        return {};
+    };
+
+    size_t completed_ops = 0;
+    for (auto& op : ops) {
+        auto result = perform_op(op);
+        if (result.is_error()) {
+            op.result = -static_cast<ssize_t>(result.error().code());
+        } else {
+            op.result = 0;
+            ++completed_ops;
+        }
+    }
+
+    TRY(copy_n_to_user(params.ops, ops.data(), params.op_count));
+    return completed_ops;
+}
+
 }
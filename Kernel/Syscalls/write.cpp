@@ -62,6 +62,11 @@ ErrorOr<FlatPtr> Process::do_write(OpenFileDescription& description, UserOrKerne
 {
     size_t total_nwritten = 0;
 
+    // Throttle before any locks are taken: a limited process sleeping with
+    // e.g. the block cache held would stall everyone else's I/O as well.
+    if (description.should_charge_block_io())
+        TRY(charge_block_io(data_size));
+
     if (description.should_append() && description.file().is_seekable()) {
         TRY(description.seek(0, SEEK_END));
     }
@@ -760,6 +760,9 @@ public:
     void did_schedule() { ++m_times_scheduled; }
     u32 times_scheduled() const { return m_times_scheduled; }
 
+    void did_involuntary_context_switch() { ++m_involuntary_context_switches; }
+    u32 involuntary_context_switches() const { return m_involuntary_context_switches; }
+
     void resume_from_stopped();
 
     [[nodiscard]] bool should_be_stopped() const;
@@ -1039,6 +1042,18 @@ public:
         return m_handling_page_fault;
     }
     void set_handling_page_fault(bool b) { m_handling_page_fault = b; }
+
+    // One-entry cache of the last region this thread faulted in, since most
+    // faults hit the same region repeatedly. An entry is only valid while the
+    // owning tree's generation counter still matches. Only the thread itself
+    // reads and writes its own cache, so no locking is needed.
+    struct RegionLookupCache {
+        Memory::RegionTree const* tree { nullptr };
+        u64 generation { 0 };
+        Memory::Region* region { nullptr };
+    };
+    RegionLookupCache& region_lookup_cache() { return m_region_lookup_cache; }
+
     void set_idle_thread() { m_is_idle_thread = true; }
     bool is_idle_thread() const { return m_is_idle_thread; }
 
@@ -1089,6 +1104,8 @@ private:
 
     IntrusiveListNode<Thread> m_process_thread_list_node;
     int m_runnable_priority { -1 };
+    u32 m_ready_queue_processor { 0 };
+    u64 m_became_runnable_time { 0 };
 
     friend class WaitQueue;
 
@@ -1168,6 +1185,7 @@ private:
     Atomic<u64> m_total_time_scheduled_kernel { 0 };
     u32 m_ticks_left { 0 };
     u32 m_times_scheduled { 0 };
+    u32 m_involuntary_context_switches { 0 };
     u32 m_ticks_in_user { 0 };
     u32 m_ticks_in_kernel { 0 };
     u32 m_pending_signals { 0 };
@@ -1203,6 +1221,7 @@ private:
     Atomic<bool, AK::MemoryOrder::memory_order_relaxed> m_is_active { false };
     bool m_is_joinable { true };
     bool m_handling_page_fault { false };
+    RegionLookupCache m_region_lookup_cache;
     ExecutionMode m_previous_mode { ExecutionMode::Kernel }; // We always start out in kernel mode
 
     unsigned m_syscall_count { 0 };
@@ -84,35 +84,26 @@ TimerId TimerQueue::add_timer(NonnullLockRefPtr<Timer>&& timer)
     return id;
 }
 
-void TimerQueue::add_timer_locked(NonnullLockRefPtr<Timer> timer)
+Timer::List& TimerQueue::bucket_for_expiry(Queue& queue, Time expiry)
 {
-    Time timer_expiration = timer->m_expires;
+    // Clamping to the last fired time makes sure a timer that is already past
+    // due lands in the bucket that will be swept on the very next tick,
+    // instead of one that may be up to a full rotation away.
+    if (expiry < queue.last_fired)
+        expiry = queue.last_fired;
+    auto slot = (static_cast<u64>(expiry.to_nanoseconds()) / Queue::bucket_granularity_ns) & (Queue::bucket_count - 1);
+    return queue.buckets[slot];
+}
 
+void TimerQueue::add_timer_locked(NonnullLockRefPtr<Timer> timer)
+{
     timer->clear_cancelled();
     timer->clear_callback_finished();
     timer->set_in_use();
 
     auto& queue = queue_for_timer(*timer);
-    if (queue.list.is_empty()) {
-        queue.list.append(timer.leak_ref());
-        queue.next_timer_due = timer_expiration;
-    } else {
-        Timer* following_timer = nullptr;
-        for (auto& t : queue.list) {
-            if (t.m_expires > timer_expiration) {
-                following_timer = &t;
-                break;
-            }
-        }
-        if (following_timer) {
-            bool next_timer_needs_update = queue.list.first() == following_timer;
-            queue.list.insert_before(*following_timer, timer.leak_ref());
-            if (next_timer_needs_update)
-                queue.next_timer_due = timer_expiration;
-        } else {
-            queue.list.append(timer.leak_ref());
-        }
-    }
+    bucket_for_expiry(queue, timer->m_expires).append(timer.leak_ref());
+    queue.timer_count++;
 }
 
 bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
@@ -133,7 +124,7 @@ bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
         timer.clear_in_use();
 
         SpinlockLocker lock(g_timerqueue_lock);
-        if (timer_queue.list.contains(timer)) {
+        if (bucket_for_expiry(timer_queue, timer.m_expires).contains(timer)) {
             // The timer has not fired, remove it
             VERIFY(timer.ref_count() > 1);
             remove_timer_locked(timer_queue, timer);
@@ -160,73 +151,81 @@ bool TimerQueue::cancel_timer(Timer& timer, bool* was_in_use)
 
 void TimerQueue::remove_timer_locked(Queue& queue, Timer& timer)
 {
-    bool was_next_timer = (queue.list.first() == &timer);
-    queue.list.remove(timer);
+    bucket_for_expiry(queue, timer.m_expires).remove(timer);
+    queue.timer_count--;
     auto now = timer.now(false);
     if (timer.m_expires > now)
         timer.m_remaining = timer.m_expires - now;
 
-    if (was_next_timer)
-        update_next_timer_due(queue);
     // Whenever we remove a timer that was still queued (but hasn't been
     // fired) we added a reference to it. So, when removing it from the
     // queue we need to drop that reference.
     timer.unref();
 }
 
-void TimerQueue::fire()
+void TimerQueue::collect_expired_timers_locked(Queue& queue, clockid_t clock_id, Timer::List& expired_timers)
 {
-    SpinlockLocker lock(g_timerqueue_lock);
+    auto now = TimeManagement::the().current_time(clock_id);
+    if (queue.timer_count == 0) {
+        queue.last_fired = now;
+        return;
+    }
 
-    auto fire_timers = [&](Queue& queue) {
-        auto* timer = queue.list.first();
-        VERIFY(timer);
-        VERIFY(queue.next_timer_due == timer->m_expires);
-
-        while (timer && timer->now(true) > timer->m_expires) {
-            queue.list.remove(*timer);
-
-            m_timers_executing.append(*timer);
-
-            update_next_timer_due(queue);
-
-            lock.unlock();
-
-            // Defer executing the timer outside of the irq handler
-            Processor::deferred_call_queue([this, timer]() {
-                // Check if we were cancelled in between being triggered
-                // by the timer irq handler and now. If so, just drop
-                // our reference and don't execute the callback.
-                if (!timer->set_cancelled()) {
-                    timer->m_callback();
-                    SpinlockLocker lock(g_timerqueue_lock);
-                    m_timers_executing.remove(*timer);
-                }
-                timer->clear_in_use();
-                timer->set_callback_finished();
-                // Drop the reference we added when queueing the timer
-                timer->unref();
-            });
-
-            lock.lock();
-            timer = queue.list.first();
+    // Sweep every bucket between the last fired position and now, at most one
+    // full rotation. Timers in a swept bucket that belong to a later rotation
+    // simply stay where they are.
+    auto start_slot = static_cast<u64>(queue.last_fired.to_nanoseconds()) / Queue::bucket_granularity_ns;
+    auto end_slot = static_cast<u64>(now.to_nanoseconds()) / Queue::bucket_granularity_ns;
+    if (end_slot - start_slot >= Queue::bucket_count)
+        start_slot = end_slot - (Queue::bucket_count - 1);
+
+    for (auto slot = start_slot; slot <= end_slot; ++slot) {
+        auto& bucket = queue.buckets[slot & (Queue::bucket_count - 1)];
+        for (auto it = bucket.begin(); it != bucket.end();) {
+            auto& timer = *it;
+            ++it;
+            if (timer.now(true) > timer.m_expires) {
+                bucket.remove(timer);
+                queue.timer_count--;
+                expired_timers.append(timer);
+            }
         }
-    };
-
-    if (!m_timer_queue_monotonic.list.is_empty())
-        fire_timers(m_timer_queue_monotonic);
-    if (!m_timer_queue_realtime.list.is_empty())
-        fire_timers(m_timer_queue_realtime);
+    }
+    queue.last_fired = now;
 }
 
-void TimerQueue::update_next_timer_due(Queue& queue)
+void TimerQueue::fire()
 {
-    VERIFY(g_timerqueue_lock.is_locked());
+    SpinlockLocker lock(g_timerqueue_lock);
+
+    Timer::List expired_timers;
+    collect_expired_timers_locked(m_timer_queue_monotonic, CLOCK_MONOTONIC_COARSE, expired_timers);
+    collect_expired_timers_locked(m_timer_queue_realtime, CLOCK_REALTIME_COARSE, expired_timers);
+
+    while (auto* timer = expired_timers.first()) {
+        expired_timers.remove(*timer);
+        m_timers_executing.append(*timer);
+
+        lock.unlock();
+
+        // Defer executing the timer outside of the irq handler
+        Processor::deferred_call_queue([this, timer]() {
+            // Check if we were cancelled in between being triggered
+            // by the timer irq handler and now. If so, just drop
+            // our reference and don't execute the callback.
+            if (!timer->set_cancelled()) {
+                timer->m_callback();
+                SpinlockLocker lock(g_timerqueue_lock);
+                m_timers_executing.remove(*timer);
+            }
+            timer->clear_in_use();
+            timer->set_callback_finished();
+            // Drop the reference we added when queueing the timer
+            timer->unref();
+        });
 
-    if (auto* next_timer = queue.list.first())
-        queue.next_timer_due = next_timer->m_expires;
-    else
-        queue.next_timer_due = {};
+        lock.lock();
+    }
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/AtomicRefCounted.h>
 #include <AK/Function.h>
 #include <AK/IntrusiveList.h>
@@ -93,13 +94,23 @@ public:
     void fire();
 
 private:
+    // Timers are kept on a timing wheel: a bucket holds every queued timer
+    // whose expiry time falls into the same granularity-sized slot, modulo the
+    // wheel size, making insertion and cancellation O(1). A bucket may thus
+    // contain timers that are one or more full rotations away; fire() simply
+    // leaves those alone until their time actually comes.
     struct Queue {
-        Timer::List list;
-        Time next_timer_due {};
+        static constexpr u64 bucket_count = 256; // Must be a power of two.
+        static constexpr u64 bucket_granularity_ns = 4'000'000;
+
+        Array<Timer::List, bucket_count> buckets;
+        Time last_fired {};
+        size_t timer_count { 0 };
     };
+    static Timer::List& bucket_for_expiry(Queue&, Time);
     void remove_timer_locked(Queue&, Timer&);
-    void update_next_timer_due(Queue&);
     void add_timer_locked(NonnullLockRefPtr<Timer>);
+    void collect_expired_timers_locked(Queue&, clockid_t, Timer::List& expired_timers);
 
     Queue& queue_for_timer(Timer& timer)
     {
@@ -91,6 +91,7 @@ set(IOAPIC_DEBUG ON)
 set(IO_DEBUG ON)
 set(IPV4_DEBUG ON)
 set(IPV4_SOCKET_DEBUG ON)
+set(IPV6_DEBUG ON)
 set(IRQ_DEBUG ON)
 set(ISO9660_DEBUG ON)
 set(ISO9660_VERY_DEBUG ON)
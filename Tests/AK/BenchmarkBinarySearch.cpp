@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/BinarySearch.h>
+#include <AK/Vector.h>
+
+// Large enough that the haystack falls out of the L2 cache, which is where
+// the prefetching in binary_search() starts paying off.
+static size_t const haystack_size = 4 * 1024 * 1024;
+static size_t const lookup_count = 1'000'000;
+
+BENCHMARK_CASE(binary_search_large_haystack)
+{
+    Vector<u32> haystack;
+    haystack.ensure_capacity(haystack_size);
+    for (size_t i = 0; i < haystack_size; ++i)
+        haystack.unchecked_append(i * 2);
+
+    u32 state = 0x12345678;
+    size_t found_count = 0;
+    for (size_t i = 0; i < lookup_count; ++i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        if (binary_search(haystack, state % (2 * haystack_size)) != nullptr)
+            ++found_count;
+    }
+    EXPECT(found_count > 0);
+}
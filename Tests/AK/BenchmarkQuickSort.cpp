@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/QuickSort.h>
+#include <AK/Vector.h>
+
+static u32 s_rng_state;
+
+static u32 next_random()
+{
+    // Keep the inputs deterministic across runs with a simple xorshift.
+    s_rng_state ^= s_rng_state << 13;
+    s_rng_state ^= s_rng_state >> 17;
+    s_rng_state ^= s_rng_state << 5;
+    return s_rng_state;
+}
+
+static Vector<u32> make_input(size_t size, auto value_for_index)
+{
+    s_rng_state = 0x12345678;
+    Vector<u32> values;
+    values.ensure_capacity(size);
+    for (size_t i = 0; i < size; ++i)
+        values.unchecked_append(value_for_index(i));
+    return values;
+}
+
+static size_t const benchmark_size = 100'000;
+
+BENCHMARK_CASE(sort_random)
+{
+    auto values = make_input(benchmark_size, [](auto) { return next_random(); });
+    quick_sort(values);
+}
+
+BENCHMARK_CASE(sort_already_sorted)
+{
+    auto values = make_input(benchmark_size, [](auto i) { return i; });
+    quick_sort(values);
+}
+
+BENCHMARK_CASE(sort_reverse_sorted)
+{
+    auto values = make_input(benchmark_size, [](auto i) { return benchmark_size - i; });
+    quick_sort(values);
+}
+
+BENCHMARK_CASE(sort_organ_pipe)
+{
+    auto values = make_input(benchmark_size, [](auto i) { return i < benchmark_size / 2 ? i : benchmark_size - i; });
+    quick_sort(values);
+}
+
+BENCHMARK_CASE(sort_few_distinct_values)
+{
+    auto values = make_input(benchmark_size, [](auto i) { return i % 17; });
+    quick_sort(values);
+}
+
+BENCHMARK_CASE(sort_random_single_pivot)
+{
+    auto values = make_input(benchmark_size, [](auto) { return next_random(); });
+    AK::single_pivot_quick_sort(values.begin(), values.end(), [](auto& a, auto& b) { return a < b; });
+}
@@ -119,3 +119,31 @@ TEST_CASE(big_endian_bit_stream_input_output_match)
         EXPECT_EQ(0b1101001000100001u, result);
     }
 }
+
+TEST_CASE(big_endian_bit_stream_unary)
+{
+    auto memory_stream = make<AllocatingMemoryStream>();
+
+    BigEndianOutputBitStream bit_write_stream { MaybeOwned<AK::Stream>(*memory_stream) };
+    BigEndianInputBitStream bit_read_stream { MaybeOwned<AK::Stream>(*memory_stream) };
+
+    // A run of every length from 0 to 15, interleaved with 3-bit values to throw off the alignment.
+    for (size_t run_length = 0; run_length < 16; ++run_length) {
+        MUST(bit_write_stream.write_bits(1u, run_length + 1));
+        MUST(bit_write_stream.write_bits(0b101u, 3));
+    }
+    MUST(bit_write_stream.align_to_byte_boundary());
+
+    for (size_t run_length = 0; run_length < 16; ++run_length) {
+        EXPECT_EQ(run_length, MUST(bit_read_stream.read_unary()));
+        EXPECT_EQ(0b101u, MUST(bit_read_stream.read_bits(3)));
+    }
+
+    // A run that spans more than one refill of the internal bit buffer.
+    MUST(bit_write_stream.write_bits(1u, 32));
+    MUST(bit_write_stream.write_bits(1ull, 50));
+    MUST(bit_write_stream.align_to_byte_boundary());
+
+    EXPECT_EQ(31u, MUST(bit_read_stream.read_unary()));
+    EXPECT_EQ(49u, MUST(bit_read_stream.read_unary()));
+}
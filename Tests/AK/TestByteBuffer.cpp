@@ -33,6 +33,29 @@ TEST_CASE(equality_operator)
     EXPECT_EQ(d == d, true);
 }
 
+TEST_CASE(move_between_inline_capacities)
+{
+    // Inline contents get copied over...
+    AK::Detail::ByteBuffer<256> small;
+    small.append("hello", 5);
+    ByteBuffer moved_small { move(small) };
+    EXPECT_EQ(moved_small.size(), 5u);
+    EXPECT_EQ(small.size(), 0u);
+    EXPECT_EQ(memcmp(moved_small.data(), "hello", 5), 0);
+
+    // ...while heap contents move without copying.
+    AK::Detail::ByteBuffer<256> large;
+    for (size_t i = 0; i < 4096; ++i)
+        large.append(static_cast<u8>(i));
+    auto const* large_data = large.data();
+    ByteBuffer moved_large { move(large) };
+    EXPECT_EQ(moved_large.size(), 4096u);
+    EXPECT_EQ(large.size(), 0u);
+    EXPECT_EQ(moved_large.data(), large_data);
+    for (size_t i = 0; i < 4096; ++i)
+        EXPECT_EQ(moved_large[i], static_cast<u8>(i));
+}
+
 BENCHMARK_CASE(append)
 {
     ByteBuffer bb;
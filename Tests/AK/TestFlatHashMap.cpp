@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/DeprecatedString.h>
+#include <AK/FlatHashMap.h>
+
+TEST_CASE(construct)
+{
+    using IntIntMap = FlatHashMap<int, int>;
+    EXPECT(IntIntMap().is_empty());
+    EXPECT_EQ(IntIntMap().size(), 0u);
+}
+
+TEST_CASE(populate_and_lookup)
+{
+    FlatHashMap<int, DeprecatedString> number_to_string;
+    EXPECT_EQ(number_to_string.set(1, "One"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(number_to_string.set(2, "Two"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(number_to_string.set(3, "Three"), AK::HashSetResult::InsertedNewEntry);
+
+    EXPECT_EQ(number_to_string.size(), 3u);
+    EXPECT_EQ(number_to_string.get(2).value(), "Two");
+    EXPECT(!number_to_string.get(4).has_value());
+    EXPECT(number_to_string.contains(3));
+    EXPECT(!number_to_string.contains(0));
+
+    EXPECT_EQ(number_to_string.set(2, "Zwei"), AK::HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(number_to_string.size(), 3u);
+    EXPECT_EQ(number_to_string.get(2).value(), "Zwei");
+}
+
+TEST_CASE(range_loop)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, i * 2);
+
+    int loop_counter = 0;
+    int sum = 0;
+    for (auto& it : map) {
+        ++loop_counter;
+        EXPECT_EQ(it.value, it.key * 2);
+        sum += it.key;
+    }
+    EXPECT_EQ(loop_counter, 100);
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST_CASE(remove_and_reinsert)
+{
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+        map.set(i, i);
+    for (int i = 0; i < 1000; i += 2)
+        EXPECT(map.remove(i));
+    EXPECT_EQ(map.size(), 500u);
+    EXPECT(!map.remove(0));
+
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.contains(i), i % 2 == 1);
+
+    // Tombstone-heavy churn has to keep the table functional.
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 1000; i += 2)
+            map.set(i, i + round);
+        for (int i = 0; i < 1000; i += 2)
+            EXPECT(map.remove(i));
+    }
+    EXPECT_EQ(map.size(), 500u);
+    for (int i = 1; i < 1000; i += 2)
+        EXPECT_EQ(map.get(i).value(), i);
+}
+
+TEST_CASE(find_iterator)
+{
+    FlatHashMap<int, int> map;
+    map.set(42, 0);
+    auto it = map.find(42);
+    EXPECT(it != map.end());
+    it->value = 7;
+    EXPECT_EQ(map.get(42).value(), 7);
+    EXPECT(map.find(43) == map.end());
+
+    map.remove(it);
+    EXPECT(map.is_empty());
+}
+
+TEST_CASE(copy_and_move)
+{
+    FlatHashMap<int, DeprecatedString> map;
+    map.set(1, "One");
+    map.set(2, "Two");
+
+    auto copy = map;
+    EXPECT_EQ(copy.size(), 2u);
+    EXPECT_EQ(copy.get(1).value(), "One");
+    copy.set(3, "Three");
+    EXPECT_EQ(map.size(), 2u);
+
+    auto moved = move(copy);
+    EXPECT_EQ(moved.size(), 3u);
+    EXPECT_EQ(copy.size(), 0u);
+
+    map = moved;
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.get(3).value(), "Three");
+}
+
+TEST_CASE(string_keys)
+{
+    FlatHashMap<DeprecatedString, int> map;
+    for (int i = 0; i < 500; ++i)
+        map.set(DeprecatedString::formatted("key-{}", i), i);
+    EXPECT_EQ(map.size(), 500u);
+    for (int i = 0; i < 500; ++i)
+        EXPECT_EQ(map.get(DeprecatedString::formatted("key-{}", i)).value(), i);
+    EXPECT(!map.contains("key-500"));
+}
+
+TEST_CASE(clear)
+{
+    FlatHashMap<int, DeprecatedString> map;
+    for (int i = 0; i < 50; ++i)
+        map.set(i, "meow");
+    map.clear();
+    EXPECT(map.is_empty());
+    EXPECT_EQ(map.capacity(), 0u);
+    map.set(1, "One");
+    EXPECT_EQ(map.get(1).value(), "One");
+}
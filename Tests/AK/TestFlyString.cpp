@@ -118,3 +118,27 @@ TEST_CASE(moved_fly_string_becomes_empty)
     EXPECT_EQ(fly1, "thisisdefinitelymorethan7bytes"sv);
     EXPECT_EQ(FlyString::number_of_fly_strings(), 1u);
 }
+
+TEST_CASE(atom_id)
+{
+    auto atoms_before = FlyString::number_of_atoms();
+
+    u32 id1 = 0;
+    {
+        FlyString fly { MUST(String::from_utf8("thisisdefinitelymorethan7bytes"sv)) };
+        id1 = fly.atom_id();
+        EXPECT_EQ(fly.atom_id(), id1);
+        EXPECT_EQ(FlyString::text_of_atom_id(id1), "thisisdefinitelymorethan7bytes"sv);
+        EXPECT_EQ(FlyString::number_of_atoms(), atoms_before + 1);
+    }
+
+    // Atom IDs and their text outlive the fly strings they were created from.
+    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+    EXPECT_EQ(FlyString::text_of_atom_id(id1), "thisisdefinitelymorethan7bytes"sv);
+
+    FlyString fly_again { MUST(String::from_utf8("thisisdefinitelymorethan7bytes"sv)) };
+    EXPECT_EQ(fly_again.atom_id(), id1);
+
+    FlyString other { MUST(String::from_utf8("thisisalsomorethan7byteslong"sv)) };
+    EXPECT_NE(other.atom_id(), id1);
+}
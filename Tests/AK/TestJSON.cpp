@@ -73,6 +73,29 @@ TEST_CASE(json_string)
     EXPECT_EQ(json.as_string() == "A", true);
 }
 
+TEST_CASE(json_string_long_and_escaped)
+{
+    // Exercise the word-at-a-time string scanning with strings whose
+    // escapes and terminators land on either side of a word boundary.
+    for (size_t prefix_length = 0; prefix_length < 20; ++prefix_length) {
+        auto prefix = DeprecatedString::repeated('x', prefix_length);
+
+        auto plain = DeprecatedString::formatted("\"{}\"", prefix);
+        auto plain_json = JsonValue::from_string(plain).value();
+        EXPECT_EQ(plain_json.as_string(), prefix);
+
+        auto escaped = DeprecatedString::formatted("\"{}\\n{}\"", prefix, prefix);
+        auto escaped_json = JsonValue::from_string(escaped).value();
+        EXPECT_EQ(escaped_json.as_string(), DeprecatedString::formatted("{}\n{}", prefix, prefix));
+
+        auto control = DeprecatedString::formatted("\"{}\x01\"", prefix);
+        EXPECT(JsonValue::from_string(control).is_error());
+
+        auto unterminated = DeprecatedString::formatted("\"{}", prefix);
+        EXPECT(JsonValue::from_string(unterminated).is_error());
+    }
+}
+
 TEST_CASE(json_utf8_character)
 {
     auto json = JsonValue::from_string("\"\\u0041\""sv).value();
@@ -9,6 +9,7 @@
 #include <AK/Noncopyable.h>
 #include <AK/QuickSort.h>
 #include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
 
 TEST_CASE(sorts_without_copy)
 {
@@ -97,3 +98,42 @@ TEST_CASE(maximum_stack_depth)
 
     delete[] data;
 }
+
+TEST_CASE(adversarial_patterns)
+{
+    // Patterns that keep producing lopsided partitions should hit the heap
+    // sort fallback instead of going quadratic, and still sort correctly.
+    int const size = 4096;
+    Vector<int> data;
+    data.ensure_capacity(size);
+
+    auto check_sorted = [&] {
+        for (int i = 0; i < size - 1; i++)
+            EXPECT(data[i] <= data[i + 1]);
+    };
+
+    // Organ pipe.
+    data.clear_with_capacity();
+    for (int i = 0; i < size; i++)
+        data.unchecked_append(i < size / 2 ? i : size - i);
+    quick_sort(data);
+    check_sorted();
+
+    // Already sorted and reverse sorted.
+    data.clear_with_capacity();
+    for (int i = 0; i < size; i++)
+        data.unchecked_append(i);
+    quick_sort(data);
+    check_sorted();
+    for (int i = 0; i < size; i++)
+        data[i] = size - i;
+    quick_sort(data);
+    check_sorted();
+
+    // Lots of duplicates.
+    data.clear_with_capacity();
+    for (int i = 0; i < size; i++)
+        data.unchecked_append(i % 7);
+    AK::single_pivot_quick_sort(data.begin(), data.end(), [](auto& a, auto& b) { return a < b; });
+    check_sorted();
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteBuffer.h>
+#include <AK/SharedByteBuffer.h>
+
+TEST_CASE(empty)
+{
+    SharedByteBuffer buffer;
+    EXPECT(buffer.is_empty());
+    EXPECT_EQ(buffer.size(), 0u);
+    EXPECT_EQ(buffer.bytes().size(), 0u);
+    EXPECT(!buffer.ensure_unique().is_error());
+}
+
+TEST_CASE(adopt_shares_storage)
+{
+    // Large enough that the ByteBuffer is heap-allocated rather than inline,
+    // so its storage pointer survives being moved into the SharedByteBuffer.
+    auto byte_buffer = MUST(ByteBuffer::create_zeroed(1024));
+    auto const* storage = byte_buffer.data();
+
+    auto buffer = SharedByteBuffer::adopt(move(byte_buffer));
+    EXPECT_EQ(buffer.size(), 1024u);
+    EXPECT_EQ(buffer.data(), storage);
+
+    auto copy = buffer;
+    EXPECT_EQ(copy.data(), storage);
+    EXPECT_EQ(copy.bytes(), buffer.bytes());
+}
+
+TEST_CASE(slice_is_zero_copy)
+{
+    auto buffer = MUST(SharedByteBuffer::copy("Hello friends!"sv.bytes()));
+    auto slice = buffer.slice(6, 7);
+    EXPECT_EQ(slice.size(), 7u);
+    EXPECT_EQ(slice.data(), buffer.data() + 6);
+    EXPECT_EQ(slice.bytes(), "friends"sv.bytes());
+
+    auto slice_of_slice = slice.slice(0, 6);
+    EXPECT_EQ(slice_of_slice.data(), buffer.data() + 6);
+    EXPECT_EQ(slice_of_slice.bytes(), "friend"sv.bytes());
+
+    EXPECT(buffer.slice(buffer.size(), 0).is_empty());
+}
+
+TEST_CASE(slice_keeps_storage_alive)
+{
+    SharedByteBuffer slice;
+    {
+        auto buffer = MUST(SharedByteBuffer::copy("Hello friends!"sv.bytes()));
+        slice = buffer.slice(0, 5);
+    }
+    EXPECT_EQ(slice.bytes(), "Hello"sv.bytes());
+}
+
+TEST_CASE(ensure_unique)
+{
+    auto buffer = MUST(SharedByteBuffer::copy("Hello friends!"sv.bytes()));
+
+    // Sole full-range owner: no copy needed.
+    auto const* storage = buffer.data();
+    EXPECT(!buffer.ensure_unique().is_error());
+    EXPECT_EQ(buffer.data(), storage);
+
+    // Shared storage: mutation must not be visible through the other handle.
+    auto copy = buffer;
+    EXPECT(!copy.ensure_unique().is_error());
+    EXPECT_NE(copy.data(), buffer.data());
+    copy.mutable_bytes()[0] = 'J';
+    EXPECT_EQ(copy.bytes(), "Jello friends!"sv.bytes());
+    EXPECT_EQ(buffer.bytes(), "Hello friends!"sv.bytes());
+
+    // A proper slice counts as shared even after the parent goes away.
+    auto slice = buffer.slice(6, 7);
+    buffer = {};
+    EXPECT(!slice.ensure_unique().is_error());
+    EXPECT_EQ(slice.bytes(), "friends"sv.bytes());
+    slice.mutable_bytes().fill('x');
+    EXPECT_EQ(slice.bytes(), "xxxxxxx"sv.bytes());
+}
+
+TEST_CASE(to_byte_buffer)
+{
+    auto buffer = MUST(SharedByteBuffer::copy("Hello friends!"sv.bytes()));
+    auto slice = buffer.slice(0, 5);
+    auto byte_buffer = MUST(slice.to_byte_buffer());
+    EXPECT_EQ(byte_buffer.bytes(), "Hello"sv.bytes());
+    EXPECT_NE(static_cast<u8 const*>(byte_buffer.data()), buffer.data());
+}
@@ -364,6 +364,10 @@ TEST_CASE(contains)
     DeprecatedString command_palette_bug_string = "Go Go Back";
     EXPECT(AK::StringUtils::contains(command_palette_bug_string, "Go Back"sv, AK::CaseSensitivity::CaseSensitive));
     EXPECT(AK::StringUtils::contains(command_palette_bug_string, "gO bAcK"sv, AK::CaseSensitivity::CaseInsensitive));
+
+    // Overlapping candidate matches must not be skipped over.
+    EXPECT(AK::StringUtils::contains("aaab"sv, "aab"sv, AK::CaseSensitivity::CaseInsensitive));
+    EXPECT(AK::StringUtils::contains("aAaB"sv, "AAb"sv, AK::CaseSensitivity::CaseInsensitive));
 }
 
 TEST_CASE(is_whitespace)
@@ -82,6 +82,26 @@ TEST_CASE(validate_invalid_ut8)
     EXPECT(valid_bytes == 0);
 }
 
+TEST_CASE(validate_long_ascii_runs)
+{
+    // Runs of ASCII longer than one 16-byte chunk take a separate fast path
+    // in validation and length calculation; make sure it agrees with the
+    // code point iterator around chunk boundaries.
+    auto ascii_run = DeprecatedString::repeated('x', 37);
+    auto mixed = DeprecatedString::formatted("{}é{}", ascii_run, ascii_run);
+    Utf8View utf8 { mixed };
+    size_t valid_bytes;
+    EXPECT(utf8.validate(valid_bytes));
+    EXPECT_EQ(valid_bytes, mixed.length());
+    EXPECT_EQ(utf8.length(), (size_t)(2 * 37 + 1));
+
+    // A bad byte right after a long ASCII run must still be caught.
+    auto invalid = DeprecatedString::formatted("{}\xc3", ascii_run);
+    Utf8View invalid_utf8 { invalid };
+    EXPECT(!invalid_utf8.validate(valid_bytes));
+    EXPECT_EQ(valid_bytes, ascii_run.length());
+}
+
 TEST_CASE(iterate_utf8)
 {
     Utf8View view("Some weird characters \u00A9\u266A\uA755"sv);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibAudio/Resampler.h>
+#include <LibTest/TestCase.h>
+
+// The filter has a startup transient while its window still overlaps the zeroed
+// initial history, so the checks below skip the first few output frames.
+static constexpr size_t startup_transient_frames = 16;
+
+static Vector<Audio::Sample> dc_signal(size_t frame_count, float value)
+{
+    Vector<Audio::Sample> signal;
+    signal.resize(frame_count);
+    for (auto& frame : signal)
+        frame = Audio::Sample { value };
+    return signal;
+}
+
+TEST_CASE(same_rate_passes_dc_through)
+{
+    auto resampler = MUST(Audio::PolyphaseResampler::create(44100, 44100));
+    auto output = MUST(resampler.resample(dc_signal(512, 0.5f).span()));
+
+    EXPECT(output.size() >= 512 - startup_transient_frames);
+    for (size_t i = startup_transient_frames; i < output.size(); ++i) {
+        EXPECT(AK::fabs(output[i].left - 0.5f) < 0.0001f);
+        EXPECT(AK::fabs(output[i].right - 0.5f) < 0.0001f);
+    }
+}
+
+TEST_CASE(dc_gain_is_unity_when_resampling)
+{
+    constexpr Array<Array<u32, 2>, 3> rate_pairs { { { 44100, 48000 }, { 48000, 44100 }, { 22050, 48000 } } };
+    for (auto rate_pair : rate_pairs) {
+        auto resampler = MUST(Audio::PolyphaseResampler::create(rate_pair[0], rate_pair[1]));
+        auto output = MUST(resampler.resample(dc_signal(4410, 0.25f).span()));
+
+        for (size_t i = startup_transient_frames; i < output.size(); ++i)
+            EXPECT(AK::fabs(output[i].left - 0.25f) < 0.001f);
+    }
+}
+
+TEST_CASE(output_length_tracks_rate_ratio)
+{
+    auto resampler = MUST(Audio::PolyphaseResampler::create(44100, 48000));
+    size_t total_output = 0;
+    for (size_t i = 0; i < 10; ++i)
+        total_output += MUST(resampler.resample(dc_signal(4410, 0.0f).span())).size();
+
+    // 44100 input frames should produce 48000 output frames, give or take
+    // fixed-point rounding of the step size.
+    EXPECT(total_output >= 48000 - 1 && total_output <= 48000 + 1);
+}
+
+TEST_CASE(chunked_input_is_seamless)
+{
+    Vector<Audio::Sample> signal;
+    signal.resize(4000);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        auto value = AK::sin(2 * AK::Pi<float> * 440.0f * static_cast<float>(i) / 44100.0f);
+        signal[i] = Audio::Sample { value };
+    }
+
+    auto whole_resampler = MUST(Audio::PolyphaseResampler::create(44100, 48000));
+    auto whole_output = MUST(whole_resampler.resample(signal.span()));
+
+    auto chunked_resampler = MUST(Audio::PolyphaseResampler::create(44100, 48000));
+    Vector<Audio::Sample> chunked_output;
+    for (size_t offset = 0; offset < signal.size(); offset += 337) {
+        auto chunk = signal.span().slice(offset, min(static_cast<size_t>(337), signal.size() - offset));
+        MUST(chunked_resampler.resample_into_end(chunked_output, chunk));
+    }
+
+    EXPECT_EQ(whole_output.size(), chunked_output.size());
+    for (size_t i = 0; i < whole_output.size(); ++i) {
+        EXPECT_EQ(whole_output[i].left, chunked_output[i].left);
+        EXPECT_EQ(whole_output[i].right, chunked_output[i].right);
+    }
+}
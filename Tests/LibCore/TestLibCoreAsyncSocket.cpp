@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteBuffer.h>
+#include <LibCore/AsyncSocket.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Timer.h>
+#include <LibTest/TestCase.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static Array<NonnullOwnPtr<Core::Stream::LocalSocket>, 2> local_socket_pair()
+{
+    int fds[2];
+    VERIFY(socketpair(AF_LOCAL, SOCK_STREAM, 0, fds) == 0);
+    return {
+        MUST(Core::Stream::LocalSocket::adopt_fd(fds[0])),
+        MUST(Core::Stream::LocalSocket::adopt_fd(fds[1])),
+    };
+}
+
+TEST_CASE(async_read_entire_buffer_waits_for_data)
+{
+    Core::EventLoop event_loop;
+    auto sockets = local_socket_pair();
+
+    Array<u8, 8> buffer {};
+    bool completed = false;
+    Core::run_async(
+        Core::Stream::async_read_entire_buffer(*sockets[0], buffer.span()),
+        Function<void(ErrorOr<void>)> { [&](ErrorOr<void> result) {
+            EXPECT(!result.is_error());
+            completed = true;
+            event_loop.quit(0);
+        } });
+
+    // Feed the reader in two halves so it has to suspend in between.
+    auto first_half = Core::Timer::create_single_shot(10, [&] {
+        MUST(sockets[1]->write_entire_buffer("Well"sv.bytes()));
+    }).release_value();
+    first_half->start();
+    auto second_half = Core::Timer::create_single_shot(20, [&] {
+        MUST(sockets[1]->write_entire_buffer("Hello"sv.bytes()));
+    }).release_value();
+    second_half->start();
+
+    event_loop.exec();
+
+    EXPECT(completed);
+    EXPECT_EQ(StringView { buffer.span() }, "WellHell"sv);
+}
+
+TEST_CASE(async_write_entire_buffer_handles_a_full_send_buffer)
+{
+    Core::EventLoop event_loop;
+    auto sockets = local_socket_pair();
+    MUST(sockets[0]->set_blocking(false));
+
+    auto to_send = MUST(ByteBuffer::create_uninitialized(1 * MiB));
+    for (size_t i = 0; i < to_send.size(); ++i)
+        to_send[i] = static_cast<u8>(i * 31);
+
+    size_t remaining_coroutines = 2;
+    auto finish_one = [&] {
+        if (--remaining_coroutines == 0)
+            event_loop.quit(0);
+    };
+
+    Core::run_async(
+        Core::Stream::async_write_entire_buffer(*sockets[0], to_send.bytes()),
+        Function<void(ErrorOr<void>)> { [&](ErrorOr<void> result) {
+            EXPECT(!result.is_error());
+            finish_one();
+        } });
+
+    auto received = MUST(ByteBuffer::create_zeroed(to_send.size()));
+    Core::run_async(
+        Core::Stream::async_read_entire_buffer(*sockets[1], received.bytes()),
+        Function<void(ErrorOr<void>)> { [&](ErrorOr<void> result) {
+            EXPECT(!result.is_error());
+            finish_one();
+        } });
+
+    event_loop.exec();
+
+    EXPECT_EQ(remaining_coroutines, 0u);
+    EXPECT_EQ(received.bytes(), to_send.bytes());
+}
+
+TEST_CASE(co_awaited_coroutines_chain)
+{
+    Core::EventLoop event_loop;
+    auto sockets = local_socket_pair();
+
+    // An inner coroutine per field, co_awaited by an outer one; this is the
+    // shape protocol parsers take.
+    auto read_one_byte = [](Core::Stream::Socket& socket) -> Core::Coroutine<ErrorOr<u8>> {
+        u8 byte = 0;
+        CO_TRY(co_await Core::Stream::async_read_entire_buffer(socket, { &byte, 1 }));
+        co_return byte;
+    };
+    auto sum_three_bytes = [&read_one_byte](Core::Stream::Socket& socket) -> Core::Coroutine<ErrorOr<u32>> {
+        u32 sum = 0;
+        for (int i = 0; i < 3; ++i)
+            sum += CO_TRY(co_await read_one_byte(socket));
+        co_return sum;
+    };
+
+    u32 result = 0;
+    Core::run_async(
+        sum_three_bytes(*sockets[0]),
+        Function<void(ErrorOr<u32>)> { [&](ErrorOr<u32> sum) {
+            result = MUST(move(sum));
+            event_loop.quit(0);
+        } });
+
+    auto writer = Core::Timer::create_single_shot(10, [&] {
+        MUST(sockets[1]->write_entire_buffer(Array<u8, 3> { 1, 2, 3 }.span()));
+    }).release_value();
+    writer->start();
+
+    event_loop.exec();
+    EXPECT_EQ(result, 6u);
+}
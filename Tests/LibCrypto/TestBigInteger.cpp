@@ -331,6 +331,20 @@ TEST_CASE(test_bigint_modular_power_extra_tests)
     }
 }
 
+BENCHMARK_CASE(benchmark_bigint_modular_power)
+{
+    // A 1024-bit odd modulus, so this exercises the montgomery code path that
+    // RSA handshakes spend most of their time in.
+    auto base = bigint_fibonacci(1000);
+    auto exponent = bigint_fibonacci(1000).minus(1);
+    auto modulo = Crypto::UnsignedBigInteger { 1 }.shift_left(1024).minus(1);
+
+    for (int i = 0; i < 10; ++i) {
+        auto result = Crypto::NumberTheory::ModularPower(base, exponent, modulo);
+        EXPECT(result < modulo);
+    }
+}
+
 TEST_CASE(test_bigint_primality_test)
 {
     struct {
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/DisjointRectSet.h>
+#include <LibGfx/Forward.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(add_disjoint_rects)
+{
+    Gfx::DisjointIntRectSet rects;
+    rects.add({ 0, 0, 10, 10 });
+    rects.add({ 20, 20, 10, 10 });
+    EXPECT_EQ(rects.size(), 2u);
+    EXPECT(rects.contains({ 0, 0, 10, 10 }));
+    EXPECT(rects.contains({ 20, 20, 10, 10 }));
+}
+
+TEST_CASE(add_contained_rect)
+{
+    Gfx::DisjointIntRectSet rects;
+    rects.add({ 0, 0, 10, 10 });
+    rects.add({ 2, 2, 4, 4 });
+    EXPECT_EQ(rects.size(), 1u);
+}
+
+TEST_CASE(adjacent_rects_coalesce)
+{
+    Gfx::DisjointIntRectSet rects;
+    rects.add({ 0, 0, 10, 10 });
+    rects.add({ 10, 0, 10, 10 });
+    EXPECT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects.rects()[0], Gfx::IntRect(0, 0, 20, 10));
+}
+
+TEST_CASE(overlapping_rects_shatter_and_coalesce)
+{
+    Gfx::DisjointIntRectSet rects;
+    rects.add({ 0, 0, 10, 10 });
+    rects.add({ 0, 5, 10, 10 });
+    EXPECT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects.rects()[0], Gfx::IntRect(0, 0, 10, 15));
+}
+
+TEST_CASE(coalescing_preserves_coverage)
+{
+    Gfx::DisjointIntRectSet rects;
+    rects.add({ 0, 0, 10, 10 });
+    rects.add({ 5, 5, 10, 10 });
+    EXPECT(rects.contains({ 0, 0, 5, 5 }));
+    EXPECT(rects.contains({ 10, 10, 5, 5 }));
+    EXPECT(rects.contains({ 5, 5, 5, 5 }));
+    EXPECT(!rects.contains({ 10, 0, 5, 5 }));
+    for (size_t i = 0; i < rects.size(); ++i) {
+        for (size_t j = i + 1; j < rects.size(); ++j)
+            EXPECT(!rects.rects()[i].intersects(rects.rects()[j]));
+    }
+}
+
+TEST_CASE(fragmentation_threshold_collapses_to_bounding_box)
+{
+    Gfx::DisjointIntRectSet rects;
+    rects.set_fragmentation_threshold(4);
+    for (int i = 0; i < 4; ++i)
+        rects.add({ i * 20, 0, 10, 10 });
+    EXPECT_EQ(rects.size(), 4u);
+
+    rects.add({ 0, 100, 10, 10 });
+    EXPECT_EQ(rects.size(), 1u);
+    EXPECT_EQ(rects.rects()[0], Gfx::IntRect(0, 0, 70, 110));
+
+    // The threshold over-approximates but never loses coverage.
+    EXPECT(rects.contains({ 20, 0, 10, 10 }));
+    EXPECT(rects.contains({ 0, 100, 10, 10 }));
+
+    // A clone keeps the configured threshold: the 4th add pushes the clone
+    // past it and collapses everything to one bounding box, and the 5th rect
+    // is disjoint from that box, so it stays separate. Without the threshold
+    // all five rects would have survived.
+    auto cloned = rects.clone();
+    for (int i = 0; i < 5; ++i)
+        cloned.add({ i * 20, 200, 10, 10 });
+    EXPECT_EQ(cloned.size(), 2u);
+    EXPECT_EQ(cloned.rects()[0], Gfx::IntRect(0, 0, 70, 210));
+}
+
+TEST_CASE(unlimited_fragmentation_by_default)
+{
+    Gfx::DisjointIntRectSet rects;
+    for (int i = 0; i < 100; ++i)
+        rects.add({ i * 20, 0, 10, 10 });
+    EXPECT_EQ(rects.size(), 100u);
+}
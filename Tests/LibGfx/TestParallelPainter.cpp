@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/ParallelPainter.h>
+
+static void paint_test_scene(auto&& draw)
+{
+    draw([](Gfx::Painter& painter) {
+        painter.fill_rect({ 0, 0, 400, 300 }, Color::White);
+    });
+    draw([](Gfx::Painter& painter) {
+        // Tall enough to straddle every band boundary.
+        painter.fill_rect({ 50, 10, 60, 280 }, Color::Red);
+    });
+    draw([](Gfx::Painter& painter) {
+        painter.draw_line({ 0, 0 }, { 399, 299 }, Color::Blue);
+    });
+    draw([](Gfx::Painter& painter) {
+        painter.translate(200, 0);
+        painter.fill_rect_with_gradient({ 0, 100, 150, 150 }, Color::Green, Color::Black);
+    });
+}
+
+TEST_CASE(matches_serial_painter)
+{
+    auto serial_bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { 400, 300 }));
+    Gfx::Painter serial_painter(serial_bitmap);
+    paint_test_scene([&](auto command) { command(serial_painter); });
+
+    auto parallel_bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { 400, 300 }));
+    Gfx::ParallelPainter parallel_painter(parallel_bitmap);
+    paint_test_scene([&](auto command) { parallel_painter.queue_command(move(command)); });
+    parallel_painter.paint();
+
+    EXPECT_EQ(memcmp(serial_bitmap->scanline(0), parallel_bitmap->scanline(0), serial_bitmap->size_in_bytes()), 0);
+}
+
+TEST_CASE(painting_twice)
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { 64, 64 }));
+    Gfx::ParallelPainter painter(bitmap);
+
+    painter.queue_command([](Gfx::Painter& painter) {
+        painter.fill_rect({ 0, 0, 64, 64 }, Color::Magenta);
+    });
+    painter.paint();
+    EXPECT_EQ(bitmap->get_pixel(32, 63), Color(Color::Magenta));
+
+    // The command list is consumed by paint(), so a second paint() is a no-op.
+    painter.paint();
+    EXPECT_EQ(bitmap->get_pixel(0, 0), Color(Color::Magenta));
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibMarkdown/Document.h>
+#include <LibMarkdown/IncrementalDocument.h>
+#include <LibTest/TestCase.h>
+
+static DeprecatedString full_render(StringView source)
+{
+    return Markdown::Document::parse(source)->render_to_inline_html();
+}
+
+static void expect_matches_full_render(Markdown::IncrementalDocument& incremental, StringView source)
+{
+    EXPECT_EQ(incremental.render_to_inline_html(source), full_render(source));
+}
+
+TEST_CASE(incremental_render_matches_full_render)
+{
+    StringView const revisions[] = {
+        "# Title\n\nSome paragraph.\n\n- one\n- two\n\nAnother paragraph.\n"sv,
+        // Edit the middle paragraph.
+        "# Title\n\nSome paragraph, edited.\n\n- one\n- two\n\nAnother paragraph.\n"sv,
+        // Grow the list.
+        "# Title\n\nSome paragraph, edited.\n\n- one\n- two\n- three\n\nAnother paragraph.\n"sv,
+        // Insert a new heading between blocks.
+        "# Title\n\nSome paragraph, edited.\n\n## Section\n\n- one\n- two\n- three\n\nAnother paragraph.\n"sv,
+        // Delete the list entirely.
+        "# Title\n\nSome paragraph, edited.\n\n## Section\n\nAnother paragraph.\n"sv,
+        // Append at the end.
+        "# Title\n\nSome paragraph, edited.\n\n## Section\n\nAnother paragraph.\n\n> quoted\n"sv,
+        // Edit the very first line.
+        "# New Title\n\nSome paragraph, edited.\n\n## Section\n\nAnother paragraph.\n\n> quoted\n"sv,
+    };
+
+    Markdown::IncrementalDocument incremental;
+    for (auto revision : revisions)
+        expect_matches_full_render(incremental, revision);
+}
+
+TEST_CASE(incremental_render_survives_unbalanced_fences)
+{
+    Markdown::IncrementalDocument incremental;
+    expect_matches_full_render(incremental, "Intro.\n\n```\ncode here\n```\n\nOutro.\n"sv);
+    // Deleting the closing fence makes the code block swallow the rest of the
+    // document; this must fall back to a full reparse.
+    expect_matches_full_render(incremental, "Intro.\n\n```\ncode here\n\nOutro.\n"sv);
+    expect_matches_full_render(incremental, "Intro.\n\n```\ncode here\n```\n\nOutro.\n"sv);
+}
+
+TEST_CASE(incremental_render_character_by_character)
+{
+    // Simulate typing a document one character at a time, as a live preview
+    // would observe it.
+    auto source = "# Notes\n\nFirst paragraph with some text.\n\n- list item one\n- list item two\n\n> A block quote.\n\nLast paragraph.\n"sv;
+
+    Markdown::IncrementalDocument incremental;
+    StringBuilder typed;
+    for (auto ch : source) {
+        typed.append(ch);
+        expect_matches_full_render(incremental, typed.string_view());
+    }
+}
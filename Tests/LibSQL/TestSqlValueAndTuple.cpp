@@ -137,6 +137,27 @@ TEST_CASE(serialize_text_value)
     EXPECT_EQ(v2, v);
 }
 
+TEST_CASE(serialize_repeated_text_values)
+{
+    SQL::Serializer serializer;
+    serializer.serialize<SQL::Value>(SQL::Value("Test"));
+    serializer.serialize<SQL::Value>(SQL::Value("Other"));
+    serializer.serialize<SQL::Value>(SQL::Value("Test"));
+    auto length_with_back_reference = serializer.offset();
+
+    // The third value must have been stored as a back reference to the
+    // first, i.e. without repeating the character data.
+    SQL::Serializer reference_serializer;
+    reference_serializer.serialize<SQL::Value>(SQL::Value("Test"));
+    reference_serializer.serialize<SQL::Value>(SQL::Value("Other"));
+    EXPECT(length_with_back_reference < reference_serializer.offset() + "Test"sv.length());
+
+    serializer.rewind();
+    EXPECT_EQ(serializer.deserialize<SQL::Value>(), "Test"sv);
+    EXPECT_EQ(serializer.deserialize<SQL::Value>(), "Other"sv);
+    EXPECT_EQ(serializer.deserialize<SQL::Value>(), "Test"sv);
+}
+
 TEST_CASE(integer_value)
 {
     {
@@ -24,6 +24,18 @@ TEST_CASE(test_utf8_decode)
     EXPECT(decoder.to_utf8(test_string) == test_string);
 }
 
+TEST_CASE(test_latin1_to_utf8)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+    // Long enough to exercise the word-at-a-time ASCII fast path, with
+    // Latin-1 bytes (ä = 0xE4, ö = 0xF6) interleaved between ASCII runs.
+    auto test_string = "the quick brown fox j\xe4mps \xf6ver the lazy dog"sv;
+
+    EXPECT_EQ(decoder.to_utf8(test_string), "the quick brown fox jämps över the lazy dog"sv);
+    EXPECT_EQ(decoder.to_utf8("\xe4"sv), "ä"sv);
+    EXPECT_EQ(decoder.to_utf8(""sv), ""sv);
+}
+
 TEST_CASE(test_utf16be_decode)
 {
     auto decoder = TextCodec::UTF16BEDecoder();
@@ -39,6 +51,8 @@ TEST_CASE(test_utf16be_decode)
     EXPECT(processed_code_points[1] == 0xE4);
     EXPECT(processed_code_points[2] == 0x6B);
     EXPECT(processed_code_points[3] == 0x1F600);
+
+    EXPECT_EQ(decoder.to_utf8(test_string), "säk😀"sv);
 }
 
 TEST_CASE(test_utf16le_decode)
@@ -56,4 +70,6 @@ TEST_CASE(test_utf16le_decode)
     EXPECT(processed_code_points[1] == 0xE4);
     EXPECT(processed_code_points[2] == 0x6B);
     EXPECT(processed_code_points[3] == 0x1F600);
+
+    EXPECT_EQ(decoder.to_utf8(test_string), "säk😀"sv);
 }
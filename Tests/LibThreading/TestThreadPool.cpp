@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+TEST_CASE(enqueued_tasks_all_run)
+{
+    Threading::ThreadPool pool { 4 };
+
+    Atomic<size_t> counter { 0 };
+    Threading::Mutex mutex;
+    Threading::ConditionVariable done { mutex };
+    size_t remaining = 1000;
+
+    for (size_t i = 0; i < 1000; ++i) {
+        pool.enqueue([&] {
+            counter.fetch_add(1);
+            Threading::MutexLocker locker { mutex };
+            if (--remaining == 0)
+                done.signal();
+        });
+    }
+
+    Threading::MutexLocker locker { mutex };
+    done.wait_while([&] { return remaining != 0; });
+    EXPECT_EQ(counter.load(), 1000u);
+}
+
+TEST_CASE(parallel_for_each_slice_covers_the_whole_span)
+{
+    Threading::ThreadPool pool { 4 };
+
+    Vector<int> values;
+    values.resize(100'000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = 1;
+
+    pool.parallel_for_each_slice(values.span(), 1024, [](Span<int> slice) {
+        for (auto& value : slice)
+            value *= 2;
+    });
+
+    for (auto value : values)
+        EXPECT_EQ(value, 2);
+}
+
+TEST_CASE(parallel_for_each_small_spans_run_inline)
+{
+    Threading::ThreadPool pool { 2 };
+
+    Array<int, 3> values { 1, 2, 3 };
+    int sum = 0;
+    // The span is below the minimum slice size, so this must run entirely on
+    // the calling thread and needs no synchronization in the callback.
+    pool.parallel_for_each(values.span(), 16, [&sum](int value) {
+        sum += value;
+    });
+    EXPECT_EQ(sum, 6);
+}
+
+TEST_CASE(submit_resolves_promise_on_the_calling_event_loop)
+{
+    Core::EventLoop event_loop;
+    auto promise = Threading::ThreadPool::the().submit<int>([] {
+        return 42;
+    });
+    EXPECT_EQ(promise->await(), 42);
+}
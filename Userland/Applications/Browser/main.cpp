@@ -14,6 +14,7 @@
 #include <Applications/Browser/WindowActions.h>
 #include <LibConfig/Client.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/FileWatcher.h>
 #include <LibCore/StandardPaths.h>
@@ -27,6 +28,7 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWebView/OutOfProcessWebView.h>
 #include <LibWebView/RequestServerAdapter.h>
+#include <LibWebView/WebContentClient.h>
 #include <unistd.h>
 
 namespace Browser {
@@ -182,5 +184,12 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     window->broadcast_window_position(window->position());
     window->broadcast_window_size(window->size());
 
+    // Park a pre-initialized WebContent process so opening a new tab doesn't
+    // pay the full process spawn and initialization cost up front.
+    Core::deferred_invoke([] {
+        if (auto result = WebView::WebContentClient::prewarm_spare_process(); result.is_error())
+            dbgln("Failed to prewarm spare WebContent process: {}", result.error());
+    });
+
     return app->exec();
 }
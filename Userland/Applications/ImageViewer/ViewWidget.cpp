@@ -169,7 +169,7 @@ void ViewWidget::load_from_file(DeprecatedString const& path)
     // Spawn a new ImageDecoder service process and connect to it.
     auto client = ImageDecoderClient::Client::try_create().release_value_but_fixme_should_propagate_errors();
     auto mime_type = Core::guess_mime_type_based_on_filename(path);
-    auto decoded_image_or_error = client->decode_image(mapped_file.bytes(), mime_type);
+    auto decoded_image_or_error = client->decode_image(mapped_file.bytes(), {}, mime_type);
     if (!decoded_image_or_error.has_value()) {
         show_error();
         return;
@@ -56,6 +56,7 @@ PDF::PDFErrorOr<void> PDFViewer::set_document(RefPtr<PDF::Document> document)
     m_current_page_index = document->get_first_page_index();
     m_zoom_level = initial_zoom_level;
     m_rendered_page_list.clear();
+    m_rendering_cache = make_ref_counted<PDF::RenderingCache>();
 
     m_rendered_page_list.ensure_capacity(document->get_page_count());
     for (u32 i = 0; i < document->get_page_count(); i++)
@@ -80,6 +81,27 @@ PDF::PDFErrorOr<NonnullRefPtr<Gfx::Bitmap>> PDFViewer::get_rendered_page(u32 ind
     return rendered_page;
 }
 
+void PDFViewer::schedule_prerender_of_adjacent_pages()
+{
+    // Pre-render the neighbors of the visible page once the event loop goes
+    // idle, so flipping or scrolling to them only has to blit a cached
+    // bitmap. Note: This stays on the main thread since Document and the
+    // rendering caches are not thread-safe.
+    if (m_prerender_scheduled)
+        return;
+    m_prerender_scheduled = true;
+    deferred_invoke([this] {
+        m_prerender_scheduled = false;
+        if (!m_document)
+            return;
+        auto page_count = m_document->get_page_count();
+        if (m_current_page_index + 1 < page_count)
+            (void)get_rendered_page(m_current_page_index + 1);
+        if (m_current_page_index > 0)
+            (void)get_rendered_page(m_current_page_index - 1);
+    });
+}
+
 void PDFViewer::paint_event(GUI::PaintEvent& event)
 {
     GUI::Frame::paint_event(event);
@@ -107,6 +129,7 @@ void PDFViewer::paint_event(GUI::PaintEvent& event)
 
         auto page = maybe_page.release_value();
         set_content_size(page->size());
+        schedule_prerender_of_adjacent_pages();
 
         painter.translate(frame_thickness(), frame_thickness());
         painter.translate(-horizontal_scrollbar().value(), -vertical_scrollbar().value());
@@ -158,6 +181,8 @@ void PDFViewer::paint_event(GUI::PaintEvent& event)
 
         y_offset += diff_y;
     }
+
+    schedule_prerender_of_adjacent_pages();
 }
 
 void PDFViewer::set_current_page(u32 current_page)
@@ -319,7 +344,7 @@ PDF::PDFErrorOr<NonnullRefPtr<Gfx::Bitmap>> PDFViewer::render_page(u32 page_inde
     auto& page_size = m_page_dimension_cache.render_info[page_index].size;
     auto bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, page_size.to_type<int>()));
 
-    auto maybe_errors = PDF::Renderer::render(*m_document, page, bitmap, m_rendering_preferences);
+    auto maybe_errors = PDF::Renderer::render(*m_document, page, bitmap, m_rendering_preferences, m_rendering_cache);
     if (maybe_errors.is_error()) {
         auto errors = maybe_errors.release_error();
         on_render_errors(page_index, errors);
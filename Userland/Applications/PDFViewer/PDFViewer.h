@@ -12,6 +12,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibPDF/Document.h>
 #include <LibPDF/Renderer.h>
+#include <LibPDF/RenderingCache.h>
 
 static constexpr size_t initial_zoom_level = 8;
 
@@ -88,10 +89,13 @@ private:
     PDF::PDFErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_page(u32 page_index);
     PDF::PDFErrorOr<void> cache_page_dimensions(bool recalculate_fixed_info = false);
     void change_page(u32 new_page);
+    void schedule_prerender_of_adjacent_pages();
 
     RefPtr<PDF::Document> m_document;
     u32 m_current_page_index { 0 };
     Vector<HashMap<u32, RenderedPage>> m_rendered_page_list;
+    RefPtr<PDF::RenderingCache> m_rendering_cache;
+    bool m_prerender_scheduled { false };
 
     u8 m_zoom_level { initial_zoom_level };
     PageDimensionCache m_page_dimension_cache;
@@ -13,6 +13,8 @@
 #include <AK/HashTable.h>
 #include <AK/Variant.h>
 #include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
+#include <LibCore/System.h>
 #include <LibFileSystemAccessClient/Client.h>
 #include <LibGUI/Application.h>
 #include <LibGUI/BoxLayout.h>
@@ -364,8 +366,10 @@ PDF::PDFErrorOr<void> PDFViewerWidget::try_open_file(StringView path, NonnullOwn
 {
     window()->set_title(DeprecatedString::formatted("{} - PDF Viewer", path));
 
-    m_buffer = TRY(file->read_until_eof());
-    auto document = TRY(PDF::Document::create(m_buffer));
+    // Map the file instead of reading it, so opening a large document only
+    // faults in the parts of the file that actually get visited.
+    auto mapped_file = TRY(Core::MappedFile::map_from_fd_and_close(TRY(Core::System::dup(file->fd())), path));
+    auto document = TRY(PDF::Document::create(move(mapped_file)));
 
     if (auto sh = document->security_handler(); sh && !sh->has_user_password()) {
         DeprecatedString password;
@@ -55,5 +55,4 @@ private:
     RefPtr<GUI::CheckBox> m_show_images;
 
     bool m_sidebar_open { false };
-    ByteBuffer m_buffer;
 };
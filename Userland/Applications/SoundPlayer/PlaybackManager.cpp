@@ -27,7 +27,7 @@ void PlaybackManager::set_loader(NonnullRefPtr<Audio::Loader>&& loader)
         m_total_length = m_loader->total_samples() / static_cast<float>(m_loader->sample_rate());
         m_device_samples_per_buffer = PlaybackManager::buffer_size_ms / 1000.0f * m_device_sample_rate;
         m_samples_to_load_per_buffer = PlaybackManager::buffer_size_ms / 1000.0f * m_loader->sample_rate();
-        m_resampler = Audio::ResampleHelper<Audio::Sample>(m_loader->sample_rate(), m_device_sample_rate);
+        m_resampler = MUST(Audio::PolyphaseResampler::create(m_loader->sample_rate(), m_device_sample_rate));
         m_timer->start();
     } else {
         m_timer->stop();
@@ -62,6 +62,8 @@ void PlaybackManager::seek(int const position)
     set_paused(true);
 
     [[maybe_unused]] auto result = m_loader->seek(position);
+    if (m_resampler.has_value())
+        m_resampler->reset();
 
     m_connection->clear_client_buffer();
     m_connection->async_clear_buffer();
@@ -122,9 +124,8 @@ void PlaybackManager::next_buffer()
         m_current_buffer.swap(buffer);
         VERIFY(m_resampler.has_value());
 
-        m_resampler->reset();
         // FIXME: Handle OOM better.
-        auto resampled = MUST(FixedArray<Audio::Sample>::create(m_resampler->resample(move(m_current_buffer)).span()));
+        auto resampled = MUST(FixedArray<Audio::Sample>::create(MUST(m_resampler->resample(m_current_buffer.span())).span()));
         m_current_buffer.swap(resampled);
         MUST(m_connection->async_enqueue(m_current_buffer));
     }
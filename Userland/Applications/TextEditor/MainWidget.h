@@ -16,6 +16,7 @@
 #include <LibGUI/TextEditor.h>
 #include <LibGUI/Widget.h>
 #include <LibGUI/Window.h>
+#include <LibMarkdown/Forward.h>
 #include <LibWebView/Forward.h>
 
 namespace TextEditor {
@@ -138,6 +139,7 @@ private:
     RefPtr<GUI::Action> m_sql_highlight;
 
     RefPtr<WebView::OutOfProcessWebView> m_page_view;
+    OwnPtr<Markdown::IncrementalDocument> m_markdown_preview_document;
 
     bool m_auto_detect_preview_mode { false };
     bool m_use_regex { false };
@@ -55,7 +55,7 @@ ErrorOr<NonnullRefPtr<CatDog>> CatDog::create()
 }
 
 CatDog::CatDog()
-    : m_proc_all(MUST(Core::Stream::File::open("/sys/kernel/processes"sv, Core::Stream::OpenMode::Read)))
+    : m_proc_all(MUST(Core::Stream::File::open("/sys/kernel/processes_stats"sv, Core::Stream::OpenMode::Read)))
 {
     m_idle_sleep_timer.start();
 }
@@ -700,6 +700,8 @@ ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_verbatim(FlacSubframe
     return decoded;
 }
 
+static void predict_custom_lpc(Span<i32> decoded, ReadonlySpan<i32> coefficients, i8 lpc_shift);
+
 // 11.28. SUBFRAME_LPC
 // Decode a subframe encoded with a custom linear predictor coding, i.e. the subframe provides the polynomial order and coefficients
 ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_custom_lpc(FlacSubframeHeader& subframe, BigEndianInputBitStream& bit_input)
@@ -738,10 +740,21 @@ ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_custom_lpc(FlacSubfra
     TRY(decode_residual(decoded, subframe, bit_input));
 
     // approximate the waveform with the predictor
-    for (size_t i = subframe.order; i < m_current_frame->sample_count; ++i) {
-        // (see below)
+    predict_custom_lpc(decoded.span(), coefficients.span(), lpc_shift);
+
+    return decoded;
+}
+
+// Runs the custom linear predictor over the residuals, in place.
+// The prediction itself is inherently serial (every sample depends on the previous outputs),
+// but fixing the order at compile time for the common small orders lets the compiler
+// fully unroll and vectorize the inner product.
+template<size_t order>
+ALWAYS_INLINE static void predict_custom_lpc_with_order(Span<i32> decoded, ReadonlySpan<i32> coefficients, i8 lpc_shift)
+{
+    for (size_t i = order; i < decoded.size(); ++i) {
         i64 sample = 0;
-        for (size_t t = 0; t < subframe.order; ++t) {
+        for (size_t t = 0; t < order; ++t) {
             // It's really important that we compute in 64-bit land here.
             // Even though FLAC operates at a maximum bit depth of 32 bits, modern encoders use super-large coefficients for maximum compression.
             // These will easily overflow 32 bits and cause strange white noise that abruptly stops intermittently (at the end of a frame).
@@ -751,8 +764,47 @@ ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_custom_lpc(FlacSubfra
         }
         decoded[i] += sample >> lpc_shift;
     }
+}
 
-    return decoded;
+static void predict_custom_lpc(Span<i32> decoded, ReadonlySpan<i32> coefficients, i8 lpc_shift)
+{
+    // Even the highest encoder presets don't use orders beyond 12, so those cover practically all files.
+    switch (coefficients.size()) {
+    case 1:
+        return predict_custom_lpc_with_order<1>(decoded, coefficients, lpc_shift);
+    case 2:
+        return predict_custom_lpc_with_order<2>(decoded, coefficients, lpc_shift);
+    case 3:
+        return predict_custom_lpc_with_order<3>(decoded, coefficients, lpc_shift);
+    case 4:
+        return predict_custom_lpc_with_order<4>(decoded, coefficients, lpc_shift);
+    case 5:
+        return predict_custom_lpc_with_order<5>(decoded, coefficients, lpc_shift);
+    case 6:
+        return predict_custom_lpc_with_order<6>(decoded, coefficients, lpc_shift);
+    case 7:
+        return predict_custom_lpc_with_order<7>(decoded, coefficients, lpc_shift);
+    case 8:
+        return predict_custom_lpc_with_order<8>(decoded, coefficients, lpc_shift);
+    case 9:
+        return predict_custom_lpc_with_order<9>(decoded, coefficients, lpc_shift);
+    case 10:
+        return predict_custom_lpc_with_order<10>(decoded, coefficients, lpc_shift);
+    case 11:
+        return predict_custom_lpc_with_order<11>(decoded, coefficients, lpc_shift);
+    case 12:
+        return predict_custom_lpc_with_order<12>(decoded, coefficients, lpc_shift);
+    default:
+        break;
+    }
+
+    size_t const order = coefficients.size();
+    for (size_t i = order; i < decoded.size(); ++i) {
+        i64 sample = 0;
+        for (size_t t = 0; t < order; ++t)
+            sample += static_cast<i64>(coefficients[t]) * static_cast<i64>(decoded[i - t - 1]);
+        decoded[i] += sample >> lpc_shift;
+    }
 }
 
 // 11.27. SUBFRAME_FIXED
@@ -888,13 +940,11 @@ ALWAYS_INLINE ErrorOr<Vector<i32>, LoaderError> FlacLoaderPlugin::decode_rice_pa
 // Decode a single number encoded with Rice/Exponential-Golomb encoding (the unsigned variant)
 ALWAYS_INLINE ErrorOr<i32> decode_unsigned_exp_golomb(u8 k, BigEndianInputBitStream& bit_input)
 {
-    u8 q = 0;
-    while (TRY(bit_input.read_bit()) == 0)
-        ++q;
+    u32 const quotient = static_cast<u32>(TRY(bit_input.read_unary()));
 
     // least significant bits (remainder)
     u32 rem = TRY(bit_input.read_bits<u32>(k));
-    u32 value = q << k | rem;
+    u32 value = quotient << k | rem;
 
     return rice_to_signed(value);
 }
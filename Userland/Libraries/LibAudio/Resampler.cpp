@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <LibAudio/Resampler.h>
+
+namespace Audio {
+
+ErrorOr<PolyphaseResampler> PolyphaseResampler::create(u32 source, u32 target)
+{
+    VERIFY(source > 0);
+    VERIFY(target > 0);
+
+    auto coefficients = TRY(FixedArray<float>::create(phase_count * taps_per_phase * 2));
+
+    // Windowed-sinc low-pass; when downsampling, the cutoff has to drop to the target band
+    // so that everything above the new Nyquist frequency is attenuated instead of aliasing.
+    double const cutoff = min(1.0, static_cast<double>(target) / static_cast<double>(source));
+    constexpr double center = (taps_per_phase - 1) / 2.0;
+
+    for (size_t phase = 0; phase < phase_count; ++phase) {
+        double const fractional_position = static_cast<double>(phase) / phase_count;
+
+        Array<double, taps_per_phase> phase_taps;
+        double tap_sum = 0;
+        for (size_t tap = 0; tap < taps_per_phase; ++tap) {
+            // Distance (in input frames) between this tap and the ideal output position.
+            double const offset = static_cast<double>(tap) - fractional_position - center;
+            double const t = offset * cutoff;
+            double const sinc = t == 0 ? 1.0 : AK::sin(AK::Pi<double> * t) / (AK::Pi<double> * t);
+            double const window = 0.5 + 0.5 * AK::cos(AK::Pi<double> * offset / (center + 1.0));
+            phase_taps[tap] = sinc * window;
+            tap_sum += phase_taps[tap];
+        }
+
+        // Normalize each phase to unity DC gain, so pure tones keep their amplitude
+        // no matter which phases their output frames happen to hit.
+        for (size_t tap = 0; tap < taps_per_phase; ++tap) {
+            float const coefficient = static_cast<float>(phase_taps[tap] / tap_sum);
+            size_t const base = (phase * taps_per_phase + tap) * 2;
+            coefficients[base] = coefficient;
+            coefficients[base + 1] = coefficient;
+        }
+    }
+
+    PolyphaseResampler resampler { source, target, move(coefficients) };
+    TRY(resampler.m_history.try_resize(taps_per_phase - 1));
+    return resampler;
+}
+
+PolyphaseResampler::PolyphaseResampler(u32 source, u32 target, FixedArray<float> coefficients)
+    : m_source(source)
+    , m_target(target)
+    , m_step((static_cast<u64>(source) << 32) / target)
+    , m_coefficients(move(coefficients))
+{
+}
+
+ErrorOr<void> PolyphaseResampler::resample_into_end(Vector<Sample>& destination, ReadonlySpan<Sample> input)
+{
+    using AK::SIMD::f32x4;
+
+    if (input.is_empty())
+        return {};
+
+    // Work on history + input, so that windows crossing the chunk boundary see both.
+    Vector<Sample> work;
+    TRY(work.try_ensure_capacity(m_history.size() + input.size()));
+    work.unchecked_append(m_history.data(), m_history.size());
+    work.unchecked_append(input.data(), input.size());
+
+    size_t const frame_count = work.size();
+    u64 const end_position = static_cast<u64>(frame_count - (taps_per_phase - 1)) << 32;
+    if (m_position < end_position)
+        TRY(destination.try_ensure_capacity(destination.size() + static_cast<size_t>((end_position - m_position) / m_step) + 1));
+
+    while (true) {
+        size_t const frame_index = static_cast<size_t>(m_position >> 32);
+        if (frame_index + taps_per_phase > frame_count)
+            break;
+        size_t const phase = static_cast<size_t>(((m_position & 0xFFFF'FFFFu) * phase_count) >> 32);
+
+        auto const* window = reinterpret_cast<float const*>(work.data() + frame_index);
+        auto const* phase_coefficients = m_coefficients.data() + phase * taps_per_phase * 2;
+
+        f32x4 accumulator {};
+        for (size_t i = 0; i < taps_per_phase * 2; i += 4) {
+            f32x4 window_vector;
+            f32x4 coefficient_vector;
+            __builtin_memcpy(&window_vector, window + i, sizeof(window_vector));
+            __builtin_memcpy(&coefficient_vector, phase_coefficients + i, sizeof(coefficient_vector));
+            accumulator += window_vector * coefficient_vector;
+        }
+        destination.unchecked_append(Sample { accumulator[0] + accumulator[2], accumulator[1] + accumulator[3] });
+
+        m_position += m_step;
+    }
+
+    // Keep the tail that future output windows may still need.
+    size_t const consumed = frame_count - (taps_per_phase - 1);
+    m_history.clear_with_capacity();
+    m_history.unchecked_append(work.data() + consumed, taps_per_phase - 1);
+    m_position -= static_cast<u64>(consumed) << 32;
+
+    return {};
+}
+
+ErrorOr<Vector<Sample>> PolyphaseResampler::resample(ReadonlySpan<Sample> input)
+{
+    Vector<Sample> output;
+    TRY(resample_into_end(output, input));
+    return output;
+}
+
+void PolyphaseResampler::reset()
+{
+    m_position = 0;
+    m_history.clear_with_capacity();
+    MUST(m_history.try_resize(taps_per_phase - 1));
+}
+
+}
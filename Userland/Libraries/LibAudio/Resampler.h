@@ -7,8 +7,11 @@
 #pragma once
 
 #include <AK/Concepts.h>
+#include <AK/FixedArray.h>
+#include <AK/Span.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
+#include <LibAudio/Sample.h>
 
 namespace Audio {
 
@@ -97,4 +100,44 @@ private:
     SampleType m_last_sample_r {};
 };
 
+// A streaming polyphase FIR resampler for stereo Sample frames.
+// The filter bank is a windowed-sinc low-pass with a fixed number of phases;
+// each output frame uses the phase closest to its ideal fractional input position.
+// Unlike ResampleHelper, this band-limits the signal properly, and it keeps its
+// filter state between calls, so feeding chunked input produces seamless output.
+class PolyphaseResampler {
+public:
+    static ErrorOr<PolyphaseResampler> create(u32 source, u32 target);
+
+    // Appends the resampled frames to the end of the destination vector.
+    ErrorOr<void> resample_into_end(Vector<Sample>& destination, ReadonlySpan<Sample> input);
+    ErrorOr<Vector<Sample>> resample(ReadonlySpan<Sample> input);
+
+    // Forgets all previously seen input, for example after seeking.
+    void reset();
+
+    u32 source() const { return m_source; }
+    u32 target() const { return m_target; }
+
+private:
+    // How finely the fractional input position is quantized when picking a filter.
+    static constexpr size_t phase_count = 128;
+    // How many input frames contribute to one output frame.
+    // Must be a multiple of two so the SIMD inner product sees whole vectors.
+    static constexpr size_t taps_per_phase = 8;
+
+    PolyphaseResampler(u32 source, u32 target, FixedArray<float> coefficients);
+
+    u32 m_source;
+    u32 m_target;
+    // 32.32 fixed-point position of the next output frame, relative to the start of the work buffer.
+    u64 m_position { 0 };
+    u64 m_step;
+    // Per phase, taps_per_phase coefficients duplicated into interleaved stereo pairs,
+    // so the inner product runs directly over Sample memory.
+    FixedArray<float> m_coefficients;
+    // The last taps_per_phase - 1 input frames, so that windows may cross chunk boundaries.
+    Vector<Sample> m_history;
+};
+
 }
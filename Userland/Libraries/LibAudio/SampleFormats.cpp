@@ -5,6 +5,8 @@
  */
 
 #include "SampleFormats.h"
+#include <AK/NumericLimits.h>
+#include <AK/SIMD.h>
 
 namespace Audio {
 
@@ -33,4 +35,51 @@ DeprecatedString sample_format_name(PcmSampleFormat format)
     return DeprecatedString::formatted("PCM {}bit {}", pcm_bits_per_sample(format), is_float ? "Float" : "LE");
 }
 
+ErrorOr<FixedArray<Sample>> samples_from_int16_pcm(ReadonlyBytes data, size_t channel_count)
+{
+    using AK::SIMD::f32x4;
+    using AK::SIMD::i16x4;
+
+    VERIFY(channel_count == 1 || channel_count == 2);
+
+    // All of our targets are little-endian, so the raw values can be used as-is.
+    size_t const frame_count = data.size() / (channel_count * sizeof(i16));
+    auto samples = TRY(FixedArray<Sample>::create(frame_count));
+
+    constexpr float scale = 1.0f / NumericLimits<i16>::max();
+
+    auto convert_four_values = [&](size_t value_index) {
+        i16x4 raw;
+        __builtin_memcpy(&raw, data.data() + value_index * sizeof(i16), sizeof(raw));
+        return __builtin_convertvector(raw, f32x4) * scale;
+    };
+    auto convert_one_value = [&](size_t value_index) {
+        i16 raw;
+        __builtin_memcpy(&raw, data.data() + value_index * sizeof(i16), sizeof(raw));
+        return static_cast<float>(raw) * scale;
+    };
+
+    size_t frame = 0;
+    if (channel_count == 2) {
+        // Two stereo frames, i.e. four values, per iteration.
+        for (; frame + 2 <= frame_count; frame += 2) {
+            auto const converted = convert_four_values(frame * 2);
+            samples[frame] = Sample { converted[0], converted[1] };
+            samples[frame + 1] = Sample { converted[2], converted[3] };
+        }
+        for (; frame < frame_count; ++frame)
+            samples[frame] = Sample { convert_one_value(frame * 2), convert_one_value(frame * 2 + 1) };
+    } else {
+        for (; frame + 4 <= frame_count; frame += 4) {
+            auto const converted = convert_four_values(frame);
+            for (size_t i = 0; i < 4; ++i)
+                samples[frame + i] = Sample { converted[i] };
+        }
+        for (; frame < frame_count; ++frame)
+            samples[frame] = Sample { convert_one_value(frame) };
+    }
+
+    return samples;
+}
+
 }
@@ -7,7 +7,10 @@
 #pragma once
 
 #include <AK/DeprecatedString.h>
+#include <AK/FixedArray.h>
+#include <AK/Span.h>
 #include <AK/Types.h>
+#include <LibAudio/Sample.h>
 
 namespace Audio {
 
@@ -24,4 +27,9 @@ enum class PcmSampleFormat : u8 {
 // Most of the read code only cares about how many bits to read or write
 u16 pcm_bits_per_sample(PcmSampleFormat format);
 DeprecatedString sample_format_name(PcmSampleFormat format);
+
+// Bulk-converts interleaved little-endian signed 16-bit PCM into samples,
+// several values at a time. This is much faster than reading one sample at a
+// time, and int16 is by far the most common format in the wild.
+ErrorOr<FixedArray<Sample>> samples_from_int16_pcm(ReadonlyBytes data, size_t channel_count);
 }
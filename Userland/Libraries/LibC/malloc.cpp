@@ -56,6 +56,67 @@ static bool s_scrub_free = true;
 static bool s_profiling = false;
 static bool s_in_userspace_emulator = false;
 
+// The sampling allocation profiler: instead of recording every allocation the
+// way LIBC_PROFILE_MALLOC does, roughly one allocation per sample interval's
+// worth of allocated bytes is emitted as a perf event (which the kernel tags
+// with a stack trace, and Profiler already knows how to attribute). This makes
+// the overhead low enough to leave enabled outside of dedicated profiling
+// runs. Sampled pointers are remembered in a small open-addressed table so
+// their matching frees can be emitted too; everything else stays syscall-free.
+static size_t s_profiling_sample_interval = 0;
+static size_t s_profiling_bytes_until_sample = 0;
+static pthread_mutex_t s_sampled_pointers_mutex = PTHREAD_MUTEX_INITIALIZER;
+static constexpr FlatPtr sampled_pointer_tombstone = 1;
+static FlatPtr s_sampled_pointers[1024];
+
+ALWAYS_INLINE static bool should_sample_allocation(size_t size)
+{
+    // Deliberately racy: losing or double-counting a few bytes between
+    // threads only perturbs which allocation gets sampled, not the
+    // statistics themselves.
+    if (s_profiling_bytes_until_sample > size) {
+        s_profiling_bytes_until_sample -= size;
+        return false;
+    }
+    s_profiling_bytes_until_sample = s_profiling_sample_interval;
+    return true;
+}
+
+static void remember_sampled_pointer(FlatPtr ptr)
+{
+    pthread_mutex_lock(&s_sampled_pointers_mutex);
+    size_t index = (ptr / 16) % array_size(s_sampled_pointers);
+    for (size_t probe = 0; probe < array_size(s_sampled_pointers); ++probe) {
+        if (s_sampled_pointers[index] == 0 || s_sampled_pointers[index] == sampled_pointer_tombstone) {
+            s_sampled_pointers[index] = ptr;
+            break;
+        }
+        index = (index + 1) % array_size(s_sampled_pointers);
+    }
+    // If the table is full we simply drop the sample; its eventual free
+    // won't be recorded either, so the profile stays consistent.
+    pthread_mutex_unlock(&s_sampled_pointers_mutex);
+}
+
+static bool forget_sampled_pointer(FlatPtr ptr)
+{
+    pthread_mutex_lock(&s_sampled_pointers_mutex);
+    bool found = false;
+    size_t index = (ptr / 16) % array_size(s_sampled_pointers);
+    for (size_t probe = 0; probe < array_size(s_sampled_pointers); ++probe) {
+        if (s_sampled_pointers[index] == ptr) {
+            s_sampled_pointers[index] = sampled_pointer_tombstone;
+            found = true;
+            break;
+        }
+        if (s_sampled_pointers[index] == 0)
+            break;
+        index = (index + 1) % array_size(s_sampled_pointers);
+    }
+    pthread_mutex_unlock(&s_sampled_pointers_mutex);
+    return found;
+}
+
 ALWAYS_INLINE static void ue_notify_malloc(void const* ptr, size_t size)
 {
     if (s_in_userspace_emulator)
@@ -115,6 +176,9 @@ struct MallocStats {
     size_t number_of_hot_keeps;
     size_t number_of_cold_keeps;
     size_t number_of_frees;
+
+    size_t number_of_thread_cache_hits;
+    size_t number_of_thread_cache_trims;
 };
 static MallocStats g_malloc_stats = {};
 
@@ -241,7 +305,9 @@ extern "C" {
 
 static ErrorOr<void*> os_alloc(size_t size, char const* name)
 {
-    int flags = MAP_ANONYMOUS | MAP_PRIVATE | MAP_PURGEABLE;
+    // MAP_NORESERVE, since chunked blocks only fill up as chunks get handed
+    // out and shouldn't charge commit for pages that are never touched.
+    int flags = MAP_ANONYMOUS | MAP_PRIVATE | MAP_PURGEABLE | MAP_NORESERVE;
 #if ARCH(X86_64)
     flags |= MAP_RANDOMIZED;
 #endif
@@ -291,8 +357,99 @@ enum class CallerWillInitializeMemory {
 
 #ifndef NO_TLS
 __thread bool s_allocation_enabled = true;
+
+// Each thread keeps a small cache of free chunks per size class, so that
+// standard-aligned malloc() and free() can usually be serviced without
+// taking the global malloc lock. The cache is refilled from the shared
+// allocators in batches while the lock is held anyway, and trimmed back
+// to them (which in turn releases empty blocks to the kernel) once a
+// size class accumulates too many chunks.
+static constexpr size_t thread_cache_max_bytes_per_size_class = 32 * KiB;
+static constexpr size_t thread_cache_refill_batch_size = 16;
+
+struct ThreadCache {
+    FreelistEntry* freelists[num_size_classes] { nullptr };
+    size_t chunk_counts[num_size_classes] { 0 };
+};
+static __thread ThreadCache s_thread_cache;
+
+static size_t thread_cache_capacity(size_t chunk_size)
+{
+    return max(static_cast<size_t>(2), thread_cache_max_bytes_per_size_class / chunk_size);
+}
+
+static size_t size_class_index(size_t chunk_size)
+{
+    for (size_t i = 0; i < num_size_classes; ++i) {
+        if (size_classes[i] == chunk_size)
+            return i;
+    }
+    VERIFY_NOT_REACHED();
+}
 #endif
 
+static void free_chunk_to_block_locked(ChunkedBlock* block, void* ptr);
+
+#ifndef NO_TLS
+static void thread_cache_trim(size_t index, size_t keep_count)
+{
+    auto& cache = s_thread_cache;
+    g_malloc_stats.number_of_thread_cache_trims++;
+
+    PthreadMutexLocker locker(s_malloc_mutex);
+    while (cache.chunk_counts[index] > keep_count) {
+        auto* entry = cache.freelists[index];
+        cache.freelists[index] = entry->next;
+        cache.chunk_counts[index]--;
+        auto* block = (ChunkedBlock*)((FlatPtr)entry & ChunkedBlock::block_mask);
+        free_chunk_to_block_locked(block, entry);
+    }
+}
+
+static void refill_thread_cache_locked(Allocator& allocator, size_t good_size)
+{
+    size_t index = &allocator - &allocators()[0];
+    auto& cache = s_thread_cache;
+    size_t batch_size = min(thread_cache_refill_batch_size, thread_cache_capacity(good_size) / 2);
+    while (cache.chunk_counts[index] < batch_size) {
+        ChunkedBlock* block = nullptr;
+        void* ptr = nullptr;
+        for (auto& current : allocator.usable_blocks) {
+            if (current.free_chunks()) {
+                ptr = try_allocate_chunk_aligned(1, current);
+                if (ptr) {
+                    block = &current;
+                    break;
+                }
+            }
+        }
+        if (!ptr) {
+            // Don't map new blocks just to fill the cache.
+            break;
+        }
+        if (block->is_full()) {
+            g_malloc_stats.number_of_blocks_full++;
+            allocator.usable_blocks.remove(*block);
+            allocator.full_blocks.append(*block);
+        }
+        auto* entry = (FreelistEntry*)ptr;
+        entry->next = cache.freelists[index];
+        cache.freelists[index] = entry;
+        cache.chunk_counts[index]++;
+    }
+}
+#endif
+
+void __malloc_thread_cleanup(void)
+{
+#ifndef NO_TLS
+    for (size_t i = 0; i < num_size_classes; ++i) {
+        if (s_thread_cache.chunk_counts[i])
+            thread_cache_trim(i, 0);
+    }
+#endif
+}
+
 static ErrorOr<void*> malloc_impl(size_t size, size_t align, CallerWillInitializeMemory caller_will_initialize_memory)
 {
 #ifndef NO_TLS
@@ -321,6 +478,25 @@ static ErrorOr<void*> malloc_impl(size_t size, size_t align, CallerWillInitializ
     size_t good_size;
     auto* allocator = allocator_for_size(size, good_size, align);
 
+#ifndef NO_TLS
+    // Fast path: grab a chunk from this thread's cache, no lock needed.
+    // Chunks are always 16-byte aligned (see check_size_classes_alignment),
+    // so only stricter alignments have to go through the slow path.
+    if (allocator && align <= 16) {
+        size_t index = allocator - &allocators()[0];
+        auto& cache = s_thread_cache;
+        if (auto* entry = cache.freelists[index]) {
+            g_malloc_stats.number_of_thread_cache_hits++;
+            cache.freelists[index] = entry->next;
+            cache.chunk_counts[index]--;
+            if (s_scrub_malloc && caller_will_initialize_memory == CallerWillInitializeMemory::No)
+                memset(entry, MALLOC_SCRUB_BYTE, good_size);
+            ue_notify_malloc(entry, size);
+            return entry;
+        }
+    }
+#endif
+
     PthreadMutexLocker locker(s_malloc_mutex);
 
     if (!allocator) {
@@ -436,6 +612,14 @@ static ErrorOr<void*> malloc_impl(size_t size, size_t align, CallerWillInitializ
     }
     dbgln_if(MALLOC_DEBUG, "LibC: allocated {:p} (chunk in block {:p}, size {})", ptr, block, block->bytes_per_chunk());
 
+#ifndef NO_TLS
+    // While we hold the lock anyway, grab a batch of chunks for this
+    // thread's cache so the next few allocations in this size class don't
+    // need to take it at all.
+    if (align <= 16)
+        refill_thread_cache_locked(*allocator, good_size);
+#endif
+
     if (s_scrub_malloc && caller_will_initialize_memory == CallerWillInitializeMemory::No)
         memset(ptr, MALLOC_SCRUB_BYTE, block->m_size);
 
@@ -459,6 +643,28 @@ static void free_impl(void* ptr)
     void* block_base = (void*)((FlatPtr)ptr & ChunkedBlock::ChunkedBlock::block_mask);
     size_t magic = *(size_t*)block_base;
 
+#ifndef NO_TLS
+    // Fast path: drop the chunk into this thread's cache, no lock needed.
+    // Note that the block cannot go away under us: it has at least this one
+    // chunk in use until we trim the cache back to the shared allocators.
+    if (magic == MAGIC_PAGE_HEADER) {
+        auto* block = (ChunkedBlock*)block_base;
+        if (s_scrub_free)
+            memset(ptr, FREE_SCRUB_BYTE, block->bytes_per_chunk());
+
+        size_t index = size_class_index(block->m_size);
+        auto& cache = s_thread_cache;
+        auto* entry = (FreelistEntry*)ptr;
+        entry->next = cache.freelists[index];
+        cache.freelists[index] = entry;
+
+        size_t capacity = thread_cache_capacity(block->m_size);
+        if (++cache.chunk_counts[index] > capacity)
+            thread_cache_trim(index, capacity / 2);
+        return;
+    }
+#endif
+
     PthreadMutexLocker locker(s_malloc_mutex);
 
     if (magic == MAGIC_BIGALLOC_HEADER) {
@@ -494,6 +700,11 @@ static void free_impl(void* ptr)
     if (s_scrub_free)
         memset(ptr, FREE_SCRUB_BYTE, block->bytes_per_chunk());
 
+    free_chunk_to_block_locked(block, ptr);
+}
+
+static void free_chunk_to_block_locked(ChunkedBlock* block, void* ptr)
+{
     auto* entry = (FreelistEntry*)ptr;
     entry->next = block->m_freelist;
     block->m_freelist = entry;
@@ -547,8 +758,12 @@ void* malloc(size_t size)
         return nullptr;
     }
 
-    if (s_profiling)
+    if (s_profiling) {
         perf_event(PERF_EVENT_MALLOC, size, reinterpret_cast<FlatPtr>(ptr_or_error.value()));
+    } else if (s_profiling_sample_interval != 0 && should_sample_allocation(size)) {
+        remember_sampled_pointer(reinterpret_cast<FlatPtr>(ptr_or_error.value()));
+        perf_event(PERF_EVENT_MALLOC, size, reinterpret_cast<FlatPtr>(ptr_or_error.value()));
+    }
 
     return ptr_or_error.value();
 }
@@ -559,6 +774,8 @@ void free(void* ptr)
     MemoryAuditingSuppressor suppressor;
     if (s_profiling)
         perf_event(PERF_EVENT_FREE, reinterpret_cast<FlatPtr>(ptr), 0);
+    else if (s_profiling_sample_interval != 0 && ptr && forget_sampled_pointer(reinterpret_cast<FlatPtr>(ptr)))
+        perf_event(PERF_EVENT_FREE, reinterpret_cast<FlatPtr>(ptr), 0);
     ue_notify_free(ptr);
     free_impl(ptr);
 }
@@ -673,6 +890,8 @@ void __malloc_init()
         s_log_malloc = true;
     if (secure_getenv("LIBC_PROFILE_MALLOC"))
         s_profiling = true;
+    if (auto* sample_interval = secure_getenv("LIBC_PROFILE_MALLOC_SAMPLE_INTERVAL"))
+        s_profiling_bytes_until_sample = s_profiling_sample_interval = strtoul(sample_interval, nullptr, 0);
 
     for (size_t i = 0; i < num_size_classes; ++i) {
         new (&allocators()[i]) Allocator();
@@ -705,5 +924,8 @@ void serenity_dump_malloc_stats()
     dbgln("number of hot keeps: {}", g_malloc_stats.number_of_hot_keeps);
     dbgln("number of cold keeps: {}", g_malloc_stats.number_of_cold_keeps);
     dbgln("number of frees: {}", g_malloc_stats.number_of_frees);
+    dbgln();
+    dbgln("thread cache hits: {}", g_malloc_stats.number_of_thread_cache_hits);
+    dbgln("thread cache trims: {}", g_malloc_stats.number_of_thread_cache_trims);
 }
 }
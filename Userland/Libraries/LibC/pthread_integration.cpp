@@ -97,6 +97,36 @@ static constexpr u32 MUTEX_UNLOCKED = 0;
 static constexpr u32 MUTEX_LOCKED_NO_NEED_TO_WAKE = 1;
 static constexpr u32 MUTEX_LOCKED_NEED_TO_WAKE = 2;
 
+// Maximum pause count for a single backoff round when spinning on a
+// contended mutex; successive rounds double the count up to this limit.
+static constexpr u32 MUTEX_MAX_BACKOFF_PAUSES = 64;
+
+static void mutex_backoff_pause(u32 pause_count)
+{
+    for (u32 i = 0; i < pause_count; ++i) {
+#if ARCH(X86_64)
+        asm volatile("pause");
+#elif ARCH(AARCH64)
+        asm volatile("yield");
+#endif
+    }
+}
+
+static bool mutex_spinning_is_worthwhile()
+{
+    // Spinning can only ever win if the holder can make progress while we
+    // burn cycles, i.e. if there is more than one processor.
+    static Atomic<int> s_processor_count { 0 };
+    int count = s_processor_count.load(AK::memory_order_relaxed);
+    if (count == 0) {
+        count = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+        if (count < 1)
+            count = 1;
+        s_processor_count.store(count, AK::memory_order_relaxed);
+    }
+    return count > 1;
+}
+
 // https://pubs.opengroup.org/onlinepubs/009695399/functions/pthread_mutex_init.html
 int pthread_mutex_init(pthread_mutex_t* mutex, pthread_mutexattr_t const* attributes)
 {
@@ -149,6 +179,26 @@ int pthread_mutex_lock(pthread_mutex_t* mutex)
         }
     }
 
+    // Adaptive path: the holder is likely to release the mutex shortly, so
+    // spin a few rounds with exponential backoff before asking the kernel to
+    // put us to sleep. Don't spin once a waiter has gone to sleep in the
+    // kernel (MUTEX_LOCKED_NEED_TO_WAKE): barging past it on every release
+    // would starve it.
+    if (value != MUTEX_LOCKED_NEED_TO_WAKE && mutex_spinning_is_worthwhile()) {
+        for (u32 pause_count = 1; pause_count <= MUTEX_MAX_BACKOFF_PAUSES; pause_count *= 2) {
+            mutex_backoff_pause(pause_count);
+            if (AK::atomic_load(&mutex->lock, AK::memory_order_relaxed) == MUTEX_LOCKED_NEED_TO_WAKE)
+                break;
+            value = MUTEX_UNLOCKED;
+            if (AK::atomic_compare_exchange_strong(&mutex->lock, value, MUTEX_LOCKED_NO_NEED_TO_WAKE, AK::memory_order_acquire)) [[likely]] {
+                if (mutex->type == __PTHREAD_MUTEX_RECURSIVE)
+                    AK::atomic_store(&mutex->owner, pthread_self(), AK::memory_order_relaxed);
+                mutex->level = 0;
+                return 0;
+            }
+        }
+    }
+
     // Slow path: wait, record the fact that we're going to wait, and always
     // remember to wake the next thread up once we release the mutex.
     if (value != MUTEX_LOCKED_NEED_TO_WAKE)
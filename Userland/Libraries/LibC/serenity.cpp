@@ -20,6 +20,26 @@ int disown(pid_t pid)
     __RETURN_WITH_ERRNO(rc, rc, -1);
 }
 
+int batch_io(struct batch_io_op* ops, unsigned op_count)
+{
+    Syscall::SC_batch_io_params params { ops, op_count };
+    int rc = syscall(SC_batch_io, &params);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
+int batch_stat(struct stat_batch_op* ops, unsigned op_count)
+{
+    Syscall::SC_batch_stat_params params { ops, op_count };
+    int rc = syscall(SC_batch_stat, &params);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
+ssize_t get_dir_entries_stat(int fd, void* buffer, size_t buffer_size)
+{
+    ssize_t rc = syscall(SC_get_dir_entries_stat, fd, buffer, buffer_size);
+    __RETURN_WITH_ERRNO(rc, rc, -1);
+}
+
 int profiling_enable(pid_t pid, uint64_t event_mask)
 {
     int rc = syscall(SC_profiling_enable, pid, &event_mask);
@@ -54,6 +54,29 @@ static ALWAYS_INLINE int futex_wake(uint32_t* userspace_address, uint32_t count,
 
 int purge(int mode);
 
+/*
+ * Submits a batch of non-blocking I/O operations in a single syscall.
+ * Each op's result field receives the number of bytes transferred, or a
+ * negated errno code. Returns the number of ops that completed without error.
+ */
+int batch_io(struct batch_io_op* ops, unsigned op_count);
+
+/*
+ * Performs a batch of stat lookups in a single syscall. dirfd and
+ * follow_symlinks have fstatat() semantics. Each op's result field receives 0
+ * on success or a negated errno code. Returns the number of ops that succeeded.
+ */
+int batch_stat(struct stat_batch_op* ops, unsigned op_count);
+
+/*
+ * Reads all remaining directory entries from fd in one syscall, each together
+ * with its metadata. Every record is a u64 inode index, a u8 entry type, a u32
+ * name length, the name bytes, and a struct stat. Returns the number of bytes
+ * written to the buffer; fails with EINVAL if the buffer is too small to hold
+ * all entries.
+ */
+ssize_t get_dir_entries_stat(int fd, void* buffer, size_t buffer_size);
+
 int perf_event(int type, uintptr_t arg1, uintptr_t arg2);
 int perf_register_string(char const* string, size_t string_length);
 
@@ -8,3 +8,5 @@
 
 #define PR_SET_DUMPABLE 1
 #define PR_GET_DUMPABLE 2
+#define PR_SET_BLOCK_IO_BANDWIDTH 3
+#define PR_GET_BLOCK_IO_BANDWIDTH 4
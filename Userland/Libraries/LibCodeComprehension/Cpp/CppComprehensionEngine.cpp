@@ -28,9 +28,28 @@ CppComprehensionEngine::CppComprehensionEngine(FileDB const& filedb)
 CppComprehensionEngine::DocumentData const* CppComprehensionEngine::get_or_create_document_data(DeprecatedString const& file)
 {
     auto absolute_path = filedb().to_absolute_path(file);
-    if (!m_documents.contains(absolute_path)) {
-        set_document_data(absolute_path, create_document_data_for(absolute_path));
+    bool is_dirty = m_dirty_documents.remove(absolute_path);
+    auto existing_document = m_documents.get(absolute_path);
+    if (existing_document.has_value() && !is_dirty) {
+        // Symbol lookups walk included documents live, so a dirty header has
+        // to be refreshed before we hand out a document that includes it.
+        if (existing_document.value() && !m_dirty_documents.is_empty()) {
+            for (auto& header : existing_document.value()->m_available_headers) {
+                if (m_dirty_documents.contains(header))
+                    get_or_create_document_data(header);
+            }
+        }
+        return existing_document.value();
+    }
+    if (existing_document.has_value() && existing_document.value()) {
+        // An edit was reported, but if the content ends up identical to what
+        // we already parsed (e.g. an undone change), the old parse is still
+        // valid and we can skip the reparse entirely.
+        auto current_text = filedb().get_or_read_from_filesystem(absolute_path);
+        if (current_text.has_value() && current_text.value() == existing_document.value()->text())
+            return existing_document.value();
     }
+    set_document_data(absolute_path, create_document_data_for(absolute_path));
     return get_document_data(absolute_path);
 }
 
@@ -393,7 +412,11 @@ DeprecatedString CppComprehensionEngine::document_path_from_include_path(StringV
 
 void CppComprehensionEngine::on_edit(DeprecatedString const& file)
 {
-    set_document_data(file, create_document_data_for(file));
+    // Reparsing on every keystroke blocks the language server for the whole
+    // preprocess+parse of the file, so just mark the document dirty here and
+    // let the next query reparse it. A burst of edits then costs one reparse
+    // instead of one per keystroke.
+    m_dirty_documents.set(filedb().to_absolute_path(file));
 }
 
 void CppComprehensionEngine::file_opened([[maybe_unused]] DeprecatedString const& file)
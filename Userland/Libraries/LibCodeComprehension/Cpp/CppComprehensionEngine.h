@@ -151,6 +151,10 @@ private:
     // A document is added to this set when we start processing it (e.g because it was #included) and removed when we're done.
     // We use this to prevent circular #includes from looping indefinitely.
     HashTable<DeprecatedString> m_unfinished_documents;
+
+    // Documents that have been edited since we last parsed them.
+    // They get reparsed lazily, on the next query that needs them.
+    HashTable<DeprecatedString> m_dirty_documents;
 };
 
 template<typename Func>
@@ -10,6 +10,8 @@
 #include <AK/BinaryHeap.h>
 #include <AK/BinarySearch.h>
 #include <AK/BitStream.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/ByteReader.h>
 #include <AK/MemoryStream.h>
 #include <string.h>
 
@@ -522,6 +524,23 @@ size_t DeflateCompressor::compare_match_candidate(size_t start, size_t candidate
 
     // Find the actual length
     auto match_length = previous_match_length + 1;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // Compare a word at a time and let count_trailing_zeroes() point out the
+    // first mismatching byte, instead of crawling along byte by byte.
+    while (match_length + sizeof(u64) <= maximum_match_length) {
+        u64 window_data;
+        u64 candidate_data;
+        ByteReader::load(m_rolling_window + start + match_length, window_data);
+        ByteReader::load(m_rolling_window + candidate + match_length, candidate_data);
+        if (auto difference = window_data ^ candidate_data; difference != 0) {
+            match_length += count_trailing_zeroes(difference) / 8;
+            VERIFY(match_length > previous_match_length);
+            VERIFY(match_length <= maximum_match_length);
+            return match_length;
+        }
+        match_length += sizeof(u64);
+    }
+#endif
     while (match_length < maximum_match_length && m_rolling_window[start + match_length] == m_rolling_window[candidate + match_length]) {
         match_length++;
     }
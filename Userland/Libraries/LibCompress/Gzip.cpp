@@ -7,9 +7,12 @@
 
 #include <LibCompress/Gzip.h>
 
+#include <AK/Atomic.h>
 #include <AK/DeprecatedString.h>
 #include <AK/MemoryStream.h>
 #include <LibCore/DateTime.h>
+#include <LibThreading/Thread.h>
+#include <unistd.h>
 
 namespace Compress {
 
@@ -245,4 +248,58 @@ ErrorOr<ByteBuffer> GzipCompressor::compress_all(ReadonlyBytes bytes)
     return buffer;
 }
 
+ErrorOr<ByteBuffer> GzipCompressor::compress_all_parallel(ReadonlyBytes bytes)
+{
+    // Each block becomes an independent gzip member, so the concatenated
+    // output is a standard multi-member stream that any decompressor
+    // (including GzipDecompressor) accepts.
+    constexpr size_t block_size = 1 * MiB;
+    if (bytes.size() <= block_size)
+        return compress_all(bytes);
+
+    size_t block_count = ceil_div(bytes.size(), block_size);
+    auto processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+    auto thread_count = min(block_count, static_cast<size_t>(max(static_cast<long>(1), processor_count)));
+
+    Vector<ErrorOr<ByteBuffer>> compressed_blocks;
+    TRY(compressed_blocks.try_ensure_capacity(block_count));
+    for (size_t i = 0; i < block_count; ++i)
+        compressed_blocks.unchecked_append(ByteBuffer {});
+
+    Atomic<size_t> next_block_index { 0 };
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    TRY(threads.try_ensure_capacity(thread_count));
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct([&]() -> intptr_t {
+            for (;;) {
+                auto block_index = next_block_index.fetch_add(1);
+                if (block_index >= block_count)
+                    return 0;
+                auto block = bytes.slice(block_index * block_size, min(block_size, bytes.size() - block_index * block_size));
+                compressed_blocks[block_index] = compress_all(block);
+            }
+        },
+            "GzipCompressor"sv);
+        thread->start();
+        threads.unchecked_append(move(thread));
+    }
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    size_t total_size = 0;
+    for (auto& compressed_block : compressed_blocks) {
+        if (compressed_block.is_error())
+            return compressed_block.release_error();
+        total_size += compressed_block.value().size();
+    }
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(total_size));
+    size_t offset = 0;
+    for (auto& compressed_block : compressed_blocks) {
+        buffer.overwrite(offset, compressed_block.value().data(), compressed_block.value().size());
+        offset += compressed_block.value().size();
+    }
+    return buffer;
+}
+
 }
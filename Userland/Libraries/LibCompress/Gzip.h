@@ -89,6 +89,9 @@ public:
     virtual void close() override;
 
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes);
+    // Compresses blocks of the input on multiple threads and emits one gzip
+    // member per block, which concatenate into a standard multi-member stream.
+    static ErrorOr<ByteBuffer> compress_all_parallel(ReadonlyBytes bytes);
 
 private:
     MaybeOwned<AK::Stream> m_output_stream;
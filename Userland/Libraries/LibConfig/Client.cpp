@@ -27,76 +27,167 @@ void Client::pledge_domains(Vector<DeprecatedString> const& domains)
 
 void Client::monitor_domain(DeprecatedString const& domain)
 {
+    m_explicitly_monitored_domains.set(domain);
+    if (m_monitored_domains.contains(domain))
+        return;
+    m_monitored_domains.set(domain);
     async_monitor_domain(domain);
 }
 
+Client::CachedDomain& Client::ensure_cached_domain(DeprecatedString const& domain)
+{
+    auto it = m_cached_domains.find(domain);
+    if (it != m_cached_domains.end())
+        return it->value;
+
+    // Start monitoring before taking the snapshot, so that no change can slip
+    // in between the snapshot and the first notification. The server handles
+    // messages in order, so the monitor request is processed first.
+    if (!m_monitored_domains.contains(domain)) {
+        m_monitored_domains.set(domain);
+        async_monitor_domain(domain);
+    }
+
+    auto dump = dump_domain_values(domain);
+    auto const& groups = dump.groups();
+    auto const& keys = dump.keys();
+    auto const& values = dump.values();
+    VERIFY(groups.size() == keys.size() && keys.size() == values.size());
+
+    CachedDomain cache;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        auto& group = cache.groups.ensure(groups[i]);
+        if (!keys[i].is_empty())
+            group.set(keys[i], values[i]);
+    }
+    m_cached_domains.set(domain, move(cache));
+    return m_cached_domains.find(domain)->value;
+}
+
 Vector<DeprecatedString> Client::list_keys(StringView domain, StringView group)
 {
-    return list_config_keys(domain, group);
+    auto& cache = ensure_cached_domain(domain);
+    auto group_it = cache.groups.find(group);
+    if (group_it == cache.groups.end())
+        return {};
+    Vector<DeprecatedString> keys;
+    keys.ensure_capacity(group_it->value.size());
+    for (auto& it : group_it->value)
+        keys.unchecked_append(it.key);
+    return keys;
 }
 
 Vector<DeprecatedString> Client::list_groups(StringView domain)
 {
-    return list_config_groups(domain);
+    auto& cache = ensure_cached_domain(domain);
+    Vector<DeprecatedString> groups;
+    groups.ensure_capacity(cache.groups.size());
+    for (auto& it : cache.groups)
+        groups.unchecked_append(it.key);
+    return groups;
+}
+
+DeprecatedString const* Client::cached_value(CachedDomain const& cache, StringView group, StringView key)
+{
+    auto group_it = cache.groups.find(group);
+    if (group_it == cache.groups.end())
+        return nullptr;
+    auto key_it = group_it->value.find(key);
+    if (key_it == group_it->value.end())
+        return nullptr;
+    return &key_it->value;
 }
 
 DeprecatedString Client::read_string(StringView domain, StringView group, StringView key, StringView fallback)
 {
-    return read_string_value(domain, group, key).value_or(fallback);
+    auto* value = cached_value(ensure_cached_domain(domain), group, key);
+    if (!value)
+        return fallback;
+    return *value;
 }
 
 i32 Client::read_i32(StringView domain, StringView group, StringView key, i32 fallback)
 {
-    return read_i32_value(domain, group, key).value_or(fallback);
+    auto* value = cached_value(ensure_cached_domain(domain), group, key);
+    if (!value)
+        return fallback;
+    // Match Core::ConfigFile::read_num_entry(), which falls back to 0 for unparsable values.
+    return value->to_int().value_or(0);
 }
 
 u32 Client::read_u32(StringView domain, StringView group, StringView key, u32 fallback)
 {
-    return read_u32_value(domain, group, key).value_or(fallback);
+    auto* value = cached_value(ensure_cached_domain(domain), group, key);
+    if (!value)
+        return fallback;
+    return value->to_uint().value_or(0);
 }
 
 bool Client::read_bool(StringView domain, StringView group, StringView key, bool fallback)
 {
-    return read_bool_value(domain, group, key).value_or(fallback);
+    auto* value = cached_value(ensure_cached_domain(domain), group, key);
+    if (!value)
+        return fallback;
+    return *value == "1" || value->equals_ignoring_case("true"sv);
 }
 
 void Client::write_string(StringView domain, StringView group, StringView key, StringView value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, value);
     write_string_value(domain, group, key, value);
 }
 
 void Client::write_i32(StringView domain, StringView group, StringView key, i32 value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, DeprecatedString::number(value));
     write_i32_value(domain, group, key, value);
 }
 
 void Client::write_u32(StringView domain, StringView group, StringView key, u32 value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, DeprecatedString::number(value));
     write_u32_value(domain, group, key, value);
 }
 
 void Client::write_bool(StringView domain, StringView group, StringView key, bool value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, value ? "true" : "false");
     write_bool_value(domain, group, key, value);
 }
 
 void Client::remove_key(StringView domain, StringView group, StringView key)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end()) {
+        if (auto group_it = it->value.groups.find(group); group_it != it->value.groups.end())
+            group_it->value.remove(key);
+    }
     remove_key_entry(domain, group, key);
 }
 
 void Client::remove_group(StringView domain, StringView group)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.remove(group);
     remove_group_entry(domain, group);
 }
 
 void Client::add_group(StringView domain, StringView group)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group);
     add_group_entry(domain, group);
 }
 
 void Client::notify_changed_string_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, DeprecatedString const& value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, value);
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_string_did_change(domain, group, key, value);
     });
@@ -104,6 +195,10 @@ void Client::notify_changed_string_value(DeprecatedString const& domain, Depreca
 
 void Client::notify_changed_i32_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, i32 value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, DeprecatedString::number(value));
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_i32_did_change(domain, group, key, value);
     });
@@ -111,6 +206,10 @@ void Client::notify_changed_i32_value(DeprecatedString const& domain, Deprecated
 
 void Client::notify_changed_u32_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, u32 value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, DeprecatedString::number(value));
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_u32_did_change(domain, group, key, value);
     });
@@ -118,6 +217,10 @@ void Client::notify_changed_u32_value(DeprecatedString const& domain, Deprecated
 
 void Client::notify_changed_bool_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key, bool value)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group).set(key, value ? "true" : "false");
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_bool_did_change(domain, group, key, value);
     });
@@ -125,6 +228,12 @@ void Client::notify_changed_bool_value(DeprecatedString const& domain, Deprecate
 
 void Client::notify_removed_key(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end()) {
+        if (auto group_it = it->value.groups.find(group); group_it != it->value.groups.end())
+            group_it->value.remove(key);
+    }
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_key_was_removed(domain, group, key);
     });
@@ -132,6 +241,10 @@ void Client::notify_removed_key(DeprecatedString const& domain, DeprecatedString
 
 void Client::notify_removed_group(DeprecatedString const& domain, DeprecatedString const& group)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.remove(group);
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_group_was_removed(domain, group);
     });
@@ -139,6 +252,10 @@ void Client::notify_removed_group(DeprecatedString const& domain, DeprecatedStri
 
 void Client::notify_added_group(DeprecatedString const& domain, DeprecatedString const& group)
 {
+    if (auto it = m_cached_domains.find(domain); it != m_cached_domains.end())
+        it->value.groups.ensure(group);
+    if (!m_explicitly_monitored_domains.contains(domain))
+        return;
     Listener::for_each([&](auto& listener) {
         listener.config_group_was_added(domain, group);
     });
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <ConfigServer/ConfigClientEndpoint.h>
 #include <ConfigServer/ConfigServerEndpoint.h>
 #include <LibCore/File.h>
@@ -55,6 +57,22 @@ private:
     void notify_removed_key(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key) override;
     void notify_removed_group(DeprecatedString const& domain, DeprecatedString const& group) override;
     void notify_added_group(DeprecatedString const& domain, DeprecatedString const& group) override;
+
+    // Values for a whole domain, fetched from the server in one round-trip
+    // and kept coherent through change notifications.
+    struct CachedDomain {
+        HashMap<DeprecatedString, HashMap<DeprecatedString, DeprecatedString>> groups;
+    };
+
+    CachedDomain& ensure_cached_domain(DeprecatedString const& domain);
+    static DeprecatedString const* cached_value(CachedDomain const&, StringView group, StringView key);
+
+    HashMap<DeprecatedString, CachedDomain> m_cached_domains;
+    // Domains the server notifies us about. This is a superset of the domains
+    // the application asked to monitor, since cached domains need
+    // notifications to stay coherent.
+    HashTable<DeprecatedString> m_monitored_domains;
+    HashTable<DeprecatedString> m_explicitly_monitored_domains;
 };
 
 inline Vector<DeprecatedString> list_groups(StringView domain)
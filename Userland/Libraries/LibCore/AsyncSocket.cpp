@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/AsyncSocket.h>
+
+namespace Core::Stream {
+
+Coroutine<ErrorOr<Bytes>> async_read(Socket& socket, Bytes buffer)
+{
+    // Re-check readiness after every wakeup; see ReadableAwaiter.
+    // NOTE: The checks are deliberately not folded into CO_TRY(): GCC 12
+    //       miscompiles coroutines when a virtual call is evaluated inside a
+    //       co_await operand's braced initializer.
+    for (;;) {
+        auto can_read = socket.can_read_without_blocking();
+        if (can_read.is_error())
+            co_return can_read.release_error();
+        if (can_read.value())
+            break;
+        co_await ReadableAwaiter { socket };
+    }
+    co_return socket.read(buffer);
+}
+
+Coroutine<ErrorOr<void>> async_read_entire_buffer(Socket& socket, Bytes buffer)
+{
+    size_t nread = 0;
+    while (nread < buffer.size()) {
+        if (socket.is_eof())
+            co_return Error::from_errno(ECONNRESET);
+        auto read_result = co_await async_read(socket, buffer.slice(nread));
+        auto received = CO_TRY(move(read_result));
+        if (received.is_empty() && socket.is_eof())
+            co_return Error::from_errno(ECONNRESET);
+        nread += received.size();
+    }
+    co_return ErrorOr<void> {};
+}
+
+Coroutine<ErrorOr<NonnullOwnPtr<TCPSocket>>> async_accept(TCPServer& server)
+{
+    struct AcceptAwaiter {
+        TCPServer& server;
+        bool await_ready() const { return false; }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            server.on_ready_to_accept = [&server = server, handle, resumed = false]() mutable {
+                // See ReadableAwaiter for why the resume has to be deferred
+                // and guarded against duplicate notifications.
+                if (resumed)
+                    return;
+                resumed = true;
+                deferred_invoke([&server, handle] {
+                    server.on_ready_to_accept = nullptr;
+                    handle.resume();
+                });
+            };
+        }
+        void await_resume() const { }
+    };
+
+    co_await AcceptAwaiter { server };
+    co_return server.accept();
+}
+
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibCore/Coroutine.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/Stream.h>
+#include <LibCore/TCPServer.h>
+#include <errno.h>
+
+namespace Core::Stream {
+
+// Awaitable socket operations, driven by the Core::EventLoop of the thread
+// that co_awaits them. These take over the socket's on_ready_to_read hook
+// while suspended, so a socket used with coroutines must not also have a
+// callback-style read handler installed.
+
+// Suspends until the socket signals readiness to read. Wakeups may be
+// spurious (a stale notification can arrive after a previous awaiter already
+// consumed the data), so resumers must re-check can_read_without_blocking()
+// and wait again if need be; async_read() below does this.
+class ReadableAwaiter {
+public:
+    explicit ReadableAwaiter(Socket& socket)
+        : m_socket(socket)
+    {
+    }
+
+    bool await_ready() const
+    {
+        // If polling the socket fails, resume immediately and let the
+        // subsequent read surface the error.
+        auto result = m_socket.can_read_without_blocking();
+        return result.is_error() || result.value();
+    }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_socket.on_ready_to_read = [&socket = m_socket, handle, resumed = false]() mutable {
+            // The event loop can have several readiness events for this socket
+            // in flight; only the first one may resume the coroutine.
+            if (resumed)
+                return;
+            resumed = true;
+            // Resume from a deferred invocation: an AK::Function must not be
+            // cleared or replaced (by the next awaiter) while it is running.
+            deferred_invoke([&socket, handle] {
+                socket.on_ready_to_read = nullptr;
+                handle.resume();
+            });
+        };
+    }
+    void await_resume() const { }
+
+private:
+    Socket& m_socket;
+};
+
+// Suspends until the given file descriptor can be written without blocking.
+class WritableFdAwaiter {
+public:
+    explicit WritableFdAwaiter(int fd)
+        : m_fd(fd)
+    {
+    }
+
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_notifier = Notifier::construct(m_fd, Notifier::Event::Write);
+        m_notifier->on_ready_to_write = [this, handle] {
+            m_notifier->set_enabled(false);
+            // See ReadableAwaiter: resuming in place would destroy the
+            // notifier (and this callback) mid-call.
+            deferred_invoke([handle] { handle.resume(); });
+        };
+    }
+    void await_resume() { m_notifier = nullptr; }
+
+private:
+    int m_fd { -1 };
+    RefPtr<Notifier> m_notifier;
+};
+
+namespace Detail {
+ALWAYS_INLINE int fd_of(int fd) { return fd; }
+ALWAYS_INLINE int fd_of(Optional<int> fd) { return fd.value_or(-1); }
+}
+
+// Reads at least one byte into the buffer (unless the socket hits EOF),
+// suspending until data is available. Returns the filled part of the buffer.
+Coroutine<ErrorOr<Bytes>> async_read(Socket&, Bytes buffer);
+
+// Keeps reading until the buffer is completely filled, suspending as needed.
+// Returns ECONNRESET if the socket hits EOF first.
+Coroutine<ErrorOr<void>> async_read_entire_buffer(Socket&, Bytes buffer);
+
+// Writes out the whole buffer, suspending whenever the socket's send buffer is
+// full. The caller retains ownership of the buffer and must keep it alive
+// until the coroutine completes. The socket must be in non-blocking mode for
+// the suspension to ever kick in; on a blocking socket this degenerates to
+// AK::Stream::write_entire_buffer.
+template<SocketLike SocketType>
+Coroutine<ErrorOr<void>> async_write_entire_buffer(SocketType& socket, ReadonlyBytes buffer)
+{
+    while (!buffer.is_empty()) {
+        auto result = socket.write(buffer);
+        if (result.is_error()) {
+            if (!result.error().is_errno() || result.error().code() != EAGAIN)
+                co_return result.release_error();
+            co_await WritableFdAwaiter { Detail::fd_of(socket.fd()) };
+            continue;
+        }
+        buffer = buffer.slice(result.value());
+    }
+    co_return ErrorOr<void> {};
+}
+
+// Suspends until a client connects to the server, then accepts it. This takes
+// over the server's on_ready_to_accept hook, with the same exclusivity caveat
+// as the socket read hook above.
+Coroutine<ErrorOr<NonnullOwnPtr<TCPSocket>>> async_accept(TCPServer&);
+
+}
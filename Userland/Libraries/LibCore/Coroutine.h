@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <coroutine>
+
+namespace Core {
+
+// A lazily-started coroutine returning a value of type T.
+//
+// Coroutines only make progress while something drives them: either a parent
+// coroutine that co_awaits them, or the event loop resuming them through an
+// awaitable (see AsyncSocket.h). A Coroutine must be driven to completion
+// before it is destroyed; dropping one that is suspended inside an awaitable
+// would leave the awaitable with a dangling resume callback.
+template<typename T>
+class [[nodiscard]] Coroutine {
+    AK_MAKE_NONCOPYABLE(Coroutine);
+
+public:
+    struct PromiseType;
+    using promise_type = PromiseType;
+
+    Coroutine(Coroutine&& other)
+        : m_handle(exchange(other.m_handle, {}))
+    {
+    }
+    Coroutine& operator=(Coroutine&& other)
+    {
+        if (this != &other) {
+            if (m_handle)
+                m_handle.destroy();
+            m_handle = exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    ~Coroutine()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    bool is_done() const { return m_handle.done(); }
+
+    // co_awaiting a Coroutine starts it and resumes the awaiter with its
+    // result once it co_returns.
+    bool await_ready() const { return false; }
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter)
+    {
+        m_handle.promise().continuation = awaiter;
+        // Symmetric transfer: run the child coroutine in place of the awaiter.
+        return m_handle;
+    }
+    [[nodiscard]] T await_resume() { return m_handle.promise().value.release_value(); }
+
+    struct PromiseType {
+        Optional<T> value;
+        std::coroutine_handle<> continuation;
+
+        Coroutine get_return_object() { return Coroutine { std::coroutine_handle<PromiseType>::from_promise(*this) }; }
+        std::suspend_always initial_suspend() { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> handle) noexcept
+            {
+                // Hand control back to whoever was co_awaiting us, if anyone.
+                if (handle.promise().continuation)
+                    return handle.promise().continuation;
+                return std::noop_coroutine();
+            }
+            void await_resume() const noexcept { }
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        using ReturnType = T;
+
+        void return_value(T&& returned_value) { value = move(returned_value); }
+        void return_value(T const& returned_value) { value = returned_value; }
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+    };
+
+private:
+    explicit Coroutine(std::coroutine_handle<PromiseType> handle)
+        : m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<PromiseType> m_handle;
+};
+
+namespace Detail {
+
+// An eagerly-started coroutine whose frame owns itself; used as the root of a
+// coroutine chain kicked off from regular code.
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() { return {}; }
+        std::suspend_never initial_suspend() { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { }
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+    };
+};
+
+template<typename T>
+inline DetachedCoroutine run_async_impl(Coroutine<T> coroutine, Function<void(T)> on_completion)
+{
+    on_completion(co_await coroutine);
+}
+
+// Awaiting this either yields the success value of an ErrorOr, or finishes
+// the enclosing Coroutine early with the error as its result. Only valid
+// inside a Coroutine whose return type is constructible from Error.
+template<typename ErrorOrType>
+struct TryAwaiter {
+    ErrorOrType result;
+
+    bool await_ready() const { return !result.is_error(); }
+    template<typename PromiseType>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> handle)
+    {
+        // Store the error as the coroutine's result and hand control straight
+        // to its awaiter; the frame stays suspended here until it's destroyed.
+        auto& promise = handle.promise();
+        promise.value = typename PromiseType::ReturnType { result.release_error() };
+        if (promise.continuation)
+            return promise.continuation;
+        return std::noop_coroutine();
+    }
+    auto await_resume() { return result.release_value(); }
+};
+
+template<typename ErrorOrType>
+TryAwaiter(ErrorOrType) -> TryAwaiter<ErrorOrType>;
+
+}
+
+// Starts a coroutine from non-coroutine code and invokes the callback with its
+// result once it has run to completion. The coroutine must only suspend on
+// event-loop-integrated awaitables, as it is the event loop that will keep
+// resuming it.
+template<typename T>
+void run_async(Coroutine<T> coroutine, Function<void(T)> on_completion)
+{
+    Detail::run_async_impl(move(coroutine), move(on_completion));
+}
+
+}
+
+// TRY() for use inside a Coroutine<ErrorOr<...>>. This is implemented as an
+// awaiter rather than a statement expression because GCC miscompiles
+// co_return inside the latter.
+#define CO_TRY(expression) (co_await ::Core::Detail::TryAwaiter { (expression) })
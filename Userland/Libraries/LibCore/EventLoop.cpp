@@ -71,6 +71,9 @@ static Threading::MutexProtected<RefPtr<InspectorServerConnection>> s_inspector_
 static thread_local Vector<EventLoop&>* s_event_loop_stack;
 static thread_local HashMap<int, NonnullOwnPtr<EventLoopTimer>>* s_timers;
 static thread_local HashTable<Notifier*>* s_notifiers;
+// Bumped whenever the set of notifiers (or one of their event masks) changes,
+// so wait_for_event() knows its cached select() sets are stale.
+static thread_local unsigned s_notifiers_generation { 0 };
 // The wake pipe is both responsible for notifying us when someone calls wake(), as well as POSIX signals.
 // While wake() pushes zero into the pipe, signal numbers (by defintion nonzero, see signal_numbers.h) are pushed into the pipe verbatim.
 thread_local int EventLoop::s_wake_pipe_fds[2];
@@ -665,6 +668,7 @@ void EventLoop::notify_forked(ForkEvent event)
         s_event_loop_stack->clear();
         s_timers->clear();
         s_notifiers->clear();
+        ++s_notifiers_generation;
         s_wake_pipe_initialized = false;
         initialize_wake_pipes();
         if (auto* info = signals_info<false>()) {
@@ -680,36 +684,52 @@ void EventLoop::notify_forked(ForkEvent event)
 
 void EventLoop::wait_for_event(WaitMode mode)
 {
+    // The notifier set rarely changes between wakeups, so the select() sets
+    // are cached and only rebuilt when a notifier is registered, unregistered
+    // or re-masked, instead of on every iteration.
+    static thread_local fd_set s_cached_rfds;
+    static thread_local fd_set s_cached_wfds;
+    static thread_local int s_cached_max_fd { 0 };
+    static thread_local unsigned s_cached_generation { 0 };
+    static thread_local bool s_cache_valid { false };
+
     fd_set rfds;
     fd_set wfds;
 retry:
 
-    // Set up the file descriptors for select().
-    // Basically, we translate high-level event information into low-level selectable file descriptors.
-    FD_ZERO(&rfds);
-    FD_ZERO(&wfds);
+    if (!s_cache_valid || s_cached_generation != s_notifiers_generation) {
+        // Set up the file descriptors for select().
+        // Basically, we translate high-level event information into low-level selectable file descriptors.
+        FD_ZERO(&s_cached_rfds);
+        FD_ZERO(&s_cached_wfds);
+
+        s_cached_max_fd = 0;
+        auto add_fd_to_set = [](int fd, fd_set& set) {
+            FD_SET(fd, &set);
+            if (fd > s_cached_max_fd)
+                s_cached_max_fd = fd;
+        };
 
-    int max_fd = 0;
-    auto add_fd_to_set = [&max_fd](int fd, fd_set& set) {
-        FD_SET(fd, &set);
-        if (fd > max_fd)
-            max_fd = fd;
-    };
+        // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+        add_fd_to_set(s_wake_pipe_fds[0], s_cached_rfds);
 
-    int max_fd_added = -1;
-    // The wake pipe informs us of POSIX signals as well as manual calls to wake()
-    add_fd_to_set(s_wake_pipe_fds[0], rfds);
-    max_fd = max(max_fd, max_fd_added);
+        for (auto& notifier : *s_notifiers) {
+            if (notifier->event_mask() & Notifier::Read)
+                add_fd_to_set(notifier->fd(), s_cached_rfds);
+            if (notifier->event_mask() & Notifier::Write)
+                add_fd_to_set(notifier->fd(), s_cached_wfds);
+            if (notifier->event_mask() & Notifier::Exceptional)
+                VERIFY_NOT_REACHED();
+        }
 
-    for (auto& notifier : *s_notifiers) {
-        if (notifier->event_mask() & Notifier::Read)
-            add_fd_to_set(notifier->fd(), rfds);
-        if (notifier->event_mask() & Notifier::Write)
-            add_fd_to_set(notifier->fd(), wfds);
-        if (notifier->event_mask() & Notifier::Exceptional)
-            VERIFY_NOT_REACHED();
+        s_cached_generation = s_notifiers_generation;
+        s_cache_valid = true;
     }
 
+    rfds = s_cached_rfds;
+    wfds = s_cached_wfds;
+    int max_fd = s_cached_max_fd;
+
     bool queued_events_is_empty;
     {
         Threading::MutexLocker locker(m_private->lock);
@@ -885,12 +905,19 @@ void EventLoop::register_notifier(Badge<Notifier>, Notifier& notifier)
 {
     VERIFY_EVENT_LOOP_INITIALIZED();
     s_notifiers->set(&notifier);
+    ++s_notifiers_generation;
 }
 
 void EventLoop::unregister_notifier(Badge<Notifier>, Notifier& notifier)
 {
     VERIFY_EVENT_LOOP_INITIALIZED();
     s_notifiers->remove(&notifier);
+    ++s_notifiers_generation;
+}
+
+void EventLoop::notifier_event_mask_did_change(Badge<Notifier>)
+{
+    ++s_notifiers_generation;
 }
 
 void EventLoop::wake_current()
@@ -102,6 +102,7 @@ public:
 
     static void register_notifier(Badge<Notifier>, Notifier&);
     static void unregister_notifier(Badge<Notifier>, Notifier&);
+    static void notifier_event_mask_did_change(Badge<Notifier>);
 
     static int register_signal(int signo, Function<void(int)> handler);
     static void unregister_signal(int handler_id);
@@ -5,16 +5,21 @@
  */
 
 #include <AK/ByteBuffer.h>
-#include <AK/JsonArray.h>
-#include <AK/JsonObject.h>
-#include <AK/JsonValue.h>
+#include <Kernel/API/ProcessStatistics.h>
 #include <LibCore/ProcessStatisticsReader.h>
 #include <pwd.h>
+#include <string.h>
 
 namespace Core {
 
 HashMap<uid_t, DeprecatedString> ProcessStatisticsReader::s_usernames;
 
+template<size_t N>
+static DeprecatedString string_from_fixed_field(char const (&field)[N])
+{
+    return StringView { field, strnlen(field, N) };
+}
+
 ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(SeekableStream& proc_all_file, bool include_usernames)
 {
     TRY(proc_all_file.seek(0, SeekMode::SetPosition));
@@ -22,75 +27,104 @@ ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(SeekableStream&
     AllProcessesStatistics all_processes_statistics;
 
     auto file_contents = TRY(proc_all_file.read_until_eof());
-    auto json_obj = TRY(JsonValue::from_string(file_contents)).as_object();
-    json_obj.get_array("processes"sv)->for_each([&](auto& value) {
-        const JsonObject& process_object = value.as_object();
+    ReadonlyBytes remaining_bytes = file_contents;
+
+    // The records are packed and not guaranteed to be aligned in the buffer,
+    // so copy each one out before reading from it.
+    auto consume = [&]<typename T>(T& record) -> ErrorOr<void> {
+        if (remaining_bytes.size() < sizeof(T))
+            return Error::from_string_literal("Truncated process statistics");
+        memcpy(&record, remaining_bytes.data(), sizeof(T));
+        remaining_bytes = remaining_bytes.slice(sizeof(T));
+        return {};
+    };
+
+    ProcessStatisticsHeader header;
+    TRY(consume(header));
+    if (header.version != PROCESS_STATISTICS_VERSION)
+        return Error::from_string_literal("Unsupported process statistics version");
+
+    for (u32 process_index = 0; process_index < header.process_count; ++process_index) {
+        ProcessStatisticsProcess process_record;
+        TRY(consume(process_record));
+
         Core::ProcessStatistics process;
+        process.pid = process_record.pid;
+        process.pgid = process_record.pgid;
+        process.pgp = process_record.pgp;
+        process.sid = process_record.sid;
+        process.uid = process_record.uid;
+        process.gid = process_record.gid;
+        process.ppid = process_record.ppid;
+        process.nfds = process_record.nfds;
+        process.kernel = process_record.kernel;
+        process.name = string_from_fixed_field(process_record.name);
+        process.executable = string_from_fixed_field(process_record.executable);
+        process.tty = string_from_fixed_field(process_record.tty);
+        process.pledge = string_from_fixed_field(process_record.pledge);
+        if (!process.kernel) {
+            switch (process_record.veil) {
+            case ProcessStatisticsVeilState::None:
+                process.veil = "None";
+                break;
+            case ProcessStatisticsVeilState::Dropped:
+                process.veil = "Dropped";
+                break;
+            case ProcessStatisticsVeilState::Locked:
+                process.veil = "Locked";
+                break;
+            }
+        }
+        process.amount_virtual = process_record.amount_virtual;
+        process.amount_resident = process_record.amount_resident;
+        process.amount_shared = process_record.amount_shared;
+        process.amount_dirty_private = process_record.amount_dirty_private;
+        process.amount_clean_inode = process_record.amount_clean_inode;
+        process.amount_purgeable_volatile = process_record.amount_purgeable_volatile;
+        process.amount_purgeable_nonvolatile = process_record.amount_purgeable_nonvolatile;
+
+        process.threads.ensure_capacity(process_record.thread_count);
+        for (u32 thread_index = 0; thread_index < process_record.thread_count; ++thread_index) {
+            ProcessStatisticsThread thread_record;
+            TRY(consume(thread_record));
 
-        // kernel data first
-        process.pid = process_object.get_u32("pid"sv).value_or(0);
-        process.pgid = process_object.get_u32("pgid"sv).value_or(0);
-        process.pgp = process_object.get_u32("pgp"sv).value_or(0);
-        process.sid = process_object.get_u32("sid"sv).value_or(0);
-        process.uid = process_object.get_u32("uid"sv).value_or(0);
-        process.gid = process_object.get_u32("gid"sv).value_or(0);
-        process.ppid = process_object.get_u32("ppid"sv).value_or(0);
-        process.nfds = process_object.get_u32("nfds"sv).value_or(0);
-        process.kernel = process_object.get_bool("kernel"sv).value_or(false);
-        process.name = process_object.get_deprecated_string("name"sv).value_or("");
-        process.executable = process_object.get_deprecated_string("executable"sv).value_or("");
-        process.tty = process_object.get_deprecated_string("tty"sv).value_or("");
-        process.pledge = process_object.get_deprecated_string("pledge"sv).value_or("");
-        process.veil = process_object.get_deprecated_string("veil"sv).value_or("");
-        process.amount_virtual = process_object.get_u32("amount_virtual"sv).value_or(0);
-        process.amount_resident = process_object.get_u32("amount_resident"sv).value_or(0);
-        process.amount_shared = process_object.get_u32("amount_shared"sv).value_or(0);
-        process.amount_dirty_private = process_object.get_u32("amount_dirty_private"sv).value_or(0);
-        process.amount_clean_inode = process_object.get_u32("amount_clean_inode"sv).value_or(0);
-        process.amount_purgeable_volatile = process_object.get_u32("amount_purgeable_volatile"sv).value_or(0);
-        process.amount_purgeable_nonvolatile = process_object.get_u32("amount_purgeable_nonvolatile"sv).value_or(0);
-
-        auto& thread_array = process_object.get_array("threads"sv).value();
-        process.threads.ensure_capacity(thread_array.size());
-        thread_array.for_each([&](auto& value) {
-            auto& thread_object = value.as_object();
             Core::ThreadStatistics thread;
-            thread.tid = thread_object.get_u32("tid"sv).value_or(0);
-            thread.times_scheduled = thread_object.get_u32("times_scheduled"sv).value_or(0);
-            thread.name = thread_object.get_deprecated_string("name"sv).value_or("");
-            thread.state = thread_object.get_deprecated_string("state"sv).value_or("");
-            thread.time_user = thread_object.get_u64("time_user"sv).value_or(0);
-            thread.time_kernel = thread_object.get_u64("time_kernel"sv).value_or(0);
-            thread.cpu = thread_object.get_u32("cpu"sv).value_or(0);
-            thread.priority = thread_object.get_u32("priority"sv).value_or(0);
-            thread.syscall_count = thread_object.get_u32("syscall_count"sv).value_or(0);
-            thread.inode_faults = thread_object.get_u32("inode_faults"sv).value_or(0);
-            thread.zero_faults = thread_object.get_u32("zero_faults"sv).value_or(0);
-            thread.cow_faults = thread_object.get_u32("cow_faults"sv).value_or(0);
-            thread.unix_socket_read_bytes = thread_object.get_u32("unix_socket_read_bytes"sv).value_or(0);
-            thread.unix_socket_write_bytes = thread_object.get_u32("unix_socket_write_bytes"sv).value_or(0);
-            thread.ipv4_socket_read_bytes = thread_object.get_u32("ipv4_socket_read_bytes"sv).value_or(0);
-            thread.ipv4_socket_write_bytes = thread_object.get_u32("ipv4_socket_write_bytes"sv).value_or(0);
-            thread.file_read_bytes = thread_object.get_u32("file_read_bytes"sv).value_or(0);
-            thread.file_write_bytes = thread_object.get_u32("file_write_bytes"sv).value_or(0);
+            thread.tid = thread_record.tid;
+            thread.times_scheduled = thread_record.times_scheduled;
+            thread.name = string_from_fixed_field(thread_record.name);
+            thread.state = string_from_fixed_field(thread_record.state);
+            thread.time_user = thread_record.time_user;
+            thread.time_kernel = thread_record.time_kernel;
+            thread.cpu = thread_record.cpu;
+            thread.priority = thread_record.priority;
+            thread.syscall_count = thread_record.syscall_count;
+            thread.inode_faults = thread_record.inode_faults;
+            thread.zero_faults = thread_record.zero_faults;
+            thread.cow_faults = thread_record.cow_faults;
+            thread.unix_socket_read_bytes = thread_record.unix_socket_read_bytes;
+            thread.unix_socket_write_bytes = thread_record.unix_socket_write_bytes;
+            thread.ipv4_socket_read_bytes = thread_record.ipv4_socket_read_bytes;
+            thread.ipv4_socket_write_bytes = thread_record.ipv4_socket_write_bytes;
+            thread.file_read_bytes = thread_record.file_read_bytes;
+            thread.file_write_bytes = thread_record.file_write_bytes;
             process.threads.append(move(thread));
-        });
+        }
 
         // and synthetic data last
         if (include_usernames) {
             process.username = username_from_uid(process.uid);
         }
         all_processes_statistics.processes.append(move(process));
-    });
+    }
 
-    all_processes_statistics.total_time_scheduled = json_obj.get_u64("total_time"sv).value_or(0);
-    all_processes_statistics.total_time_scheduled_kernel = json_obj.get_u64("total_time_kernel"sv).value_or(0);
+    all_processes_statistics.total_time_scheduled = header.total_time_scheduled;
+    all_processes_statistics.total_time_scheduled_kernel = header.total_time_scheduled_kernel;
     return all_processes_statistics;
 }
 
 ErrorOr<AllProcessesStatistics> ProcessStatisticsReader::get_all(bool include_usernames)
 {
-    auto proc_all_file = TRY(Core::Stream::File::open("/sys/kernel/processes"sv, Core::Stream::OpenMode::Read));
+    auto proc_all_file = TRY(Core::Stream::File::open("/sys/kernel/processes_stats"sv, Core::Stream::OpenMode::Read));
     return get_all(*proc_all_file, include_usernames);
 }
 
@@ -20,6 +20,7 @@ public:
     static DeprecatedString downloads_directory();
     static DeprecatedString tempfile_directory();
     static DeprecatedString config_directory();
+    static DeprecatedString cache_directory();
     static DeprecatedString data_directory();
     static ErrorOr<DeprecatedString> runtime_directory();
     static ErrorOr<Vector<String>> font_directories();
@@ -292,6 +292,8 @@ public:
     ErrorOr<void> set_blocking(bool enabled) override { return m_helper.set_blocking(enabled); }
     ErrorOr<void> set_close_on_exec(bool enabled) override { return m_helper.set_close_on_exec(enabled); }
 
+    int fd() const { return m_helper.fd(); }
+
     virtual ~TCPSocket() override { close(); }
 
 private:
@@ -521,6 +523,8 @@ public:
 
     virtual size_t buffer_size() const override { return m_helper.buffer_size(); }
 
+    T& underlying_stream() { return m_helper.stream(); }
+
     virtual ~BufferedSocket() override = default;
 
 private:
@@ -90,26 +90,6 @@ ALWAYS_INLINE static void addition_with_carry(u32 a, u32 b, u32& z_carry, u32& z
     z = static_cast<u32>(result);
 }
 
-/**
- * Computes a montgomery "fragment" for y_i. This computes "z[i] += x[i] * y_i" for all words while rippling the carry, and returns the carry.
- * Algorithm from: Gueron, "Efficient Software Implementations of Modular Exponentiation". (https://eprint.iacr.org/2011/239.pdf)
- */
-UnsignedBigInteger::Word UnsignedBigIntegerAlgorithms::montgomery_fragment(UnsignedBigInteger& z, size_t offset_in_z, UnsignedBigInteger const& x, UnsignedBigInteger::Word y_digit, size_t num_words)
-{
-    UnsignedBigInteger::Word carry { 0 };
-    for (size_t i = 0; i < num_words; ++i) {
-        UnsignedBigInteger::Word a_carry;
-        UnsignedBigInteger::Word a;
-        linear_multiplication_with_carry(x.m_words[i], y_digit, z.m_words[offset_in_z + i], a_carry, a);
-        UnsignedBigInteger::Word b_carry;
-        UnsignedBigInteger::Word b;
-        addition_with_carry(a, carry, b_carry, b);
-        z.m_words[offset_in_z + i] = b;
-        carry = a_carry + b_carry;
-    }
-    return carry;
-}
-
 /**
  * Computes the "almost montgomery" product : x * y * 2 ^ (-num_words * BITS_IN_WORD) % modulo
  * [Note : that means that the result z satisfies z * 2^(num_words * BITS_IN_WORD) % modulo = x * y % modulo]
@@ -136,11 +116,34 @@ void UnsignedBigIntegerAlgorithms::almost_montgomery_multiplication_without_allo
 
     UnsignedBigInteger::Word previous_double_carry { 0 };
     for (size_t i = 0; i < num_words; ++i) {
-        // z[i->num_words+i] += x * y_i
-        UnsignedBigInteger::Word carry_1 = montgomery_fragment(z, i, x, y.m_words[i], num_words);
-        // z[i->num_words+i] += modulo * (z_i * k)
-        UnsignedBigInteger::Word t = z.m_words[i] * k;
-        UnsignedBigInteger::Word carry_2 = montgomery_fragment(z, i, modulo, t, num_words);
+        UnsignedBigInteger::Word y_digit = y.m_words[i];
+        // t is picked so that the lowest word of z ends up zero after this round:
+        // t = (z_i + x_0 * y_i) * k, with k the inverse of -modulo over 2^32.
+        UnsignedBigInteger::Word t = (z.m_words[i] + x.m_words[0] * y_digit) * k;
+
+        // z[i->num_words+i] += x * y_i + modulo * t, accumulated in a single pass
+        // over z (the "CIOS" variant), with separate carry chains for each product.
+        UnsignedBigInteger::Word carry_1 { 0 };
+        UnsignedBigInteger::Word carry_2 { 0 };
+        for (size_t j = 0; j < num_words; ++j) {
+            UnsignedBigInteger::Word a_carry;
+            UnsignedBigInteger::Word a;
+            linear_multiplication_with_carry(x.m_words[j], y_digit, z.m_words[i + j], a_carry, a);
+            UnsignedBigInteger::Word b_carry;
+            UnsignedBigInteger::Word b;
+            addition_with_carry(a, carry_1, b_carry, b);
+            carry_1 = a_carry + b_carry;
+
+            UnsignedBigInteger::Word c_carry;
+            UnsignedBigInteger::Word c;
+            linear_multiplication_with_carry(modulo.m_words[j], t, b, c_carry, c);
+            UnsignedBigInteger::Word d_carry;
+            UnsignedBigInteger::Word d;
+            addition_with_carry(c, carry_2, d_carry, d);
+            carry_2 = c_carry + d_carry;
+
+            z.m_words[i + j] = d;
+        }
 
         // Compute the carry by combining all of the carries of the previous computations
         // Put it "right after" the range that we computed above
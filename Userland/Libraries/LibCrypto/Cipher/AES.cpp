@@ -4,10 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Platform.h>
 #include <AK/StringBuilder.h>
 #include <LibCrypto/Cipher/AES.h>
 #include <LibCrypto/Cipher/AESTables.h>
 
+#if ARCH(X86_64) && !defined(KERNEL)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto {
 namespace Cipher {
 
@@ -197,8 +202,58 @@ void AESCipherKey::expand_decrypt_key(ReadonlyBytes user_key, size_t bits)
     }
 }
 
+#if ARCH(X86_64) && !defined(KERNEL)
+static bool cpu_supports_aes_ni()
+{
+    static bool supported = __builtin_cpu_supports("aes") && __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+
+// The key schedule is stored as big-endian u32 words, while the AES
+// instructions want the raw schedule bytes, so each word gets byte-swapped
+// into its lane.
+__attribute__((target("aes,sse4.1"))) static __m128i aes_ni_round_key(u32 const* round_keys, size_t index)
+{
+    return _mm_set_epi32(
+        __builtin_bswap32(round_keys[index * 4 + 3]),
+        __builtin_bswap32(round_keys[index * 4 + 2]),
+        __builtin_bswap32(round_keys[index * 4 + 1]),
+        __builtin_bswap32(round_keys[index * 4]));
+}
+
+__attribute__((target("aes,sse4.1"))) static void encrypt_block_aes_ni(AESCipherKey const& key, AESCipherBlock const& in, AESCipherBlock& out)
+{
+    auto const* round_keys = key.round_keys();
+    auto state = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in.bytes().data()));
+    state = _mm_xor_si128(state, aes_ni_round_key(round_keys, 0));
+    for (size_t i = 1; i < key.rounds(); ++i)
+        state = _mm_aesenc_si128(state, aes_ni_round_key(round_keys, i));
+    state = _mm_aesenclast_si128(state, aes_ni_round_key(round_keys, key.rounds()));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out.bytes().data()), state);
+}
+
+// Note: The decryption key schedule is already reordered and run through
+//       InvMixColumns (the "equivalent inverse cipher" form), which is
+//       exactly what aesdec expects.
+__attribute__((target("aes,sse4.1"))) static void decrypt_block_aes_ni(AESCipherKey const& key, AESCipherBlock const& in, AESCipherBlock& out)
+{
+    auto const* round_keys = key.round_keys();
+    auto state = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in.bytes().data()));
+    state = _mm_xor_si128(state, aes_ni_round_key(round_keys, 0));
+    for (size_t i = 1; i < key.rounds(); ++i)
+        state = _mm_aesdec_si128(state, aes_ni_round_key(round_keys, i));
+    state = _mm_aesdeclast_si128(state, aes_ni_round_key(round_keys, key.rounds()));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out.bytes().data()), state);
+}
+#endif
+
 void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (cpu_supports_aes_ni())
+        return encrypt_block_aes_ni(key(), in, out);
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -288,6 +343,11 @@ void AESCipher::encrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 
 void AESCipher::decrypt_block(AESCipherBlock const& in, AESCipherBlock& out)
 {
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (cpu_supports_aes_ni())
+        return decrypt_block_aes_ni(key(), in, out);
+#endif
+
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
     size_t r { 0 };
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Memory.h>
+#include <LibCrypto/Authentication/Poly1305.h>
+#include <LibCrypto/Cipher/ChaCha20.h>
+#include <LibCrypto/Cipher/ChaCha20Poly1305.h>
+
+namespace Crypto::Cipher {
+
+ChaCha20Poly1305::ChaCha20Poly1305(ReadonlyBytes key)
+{
+    VERIFY(key.size() == key_size);
+    memcpy(m_key, key.data(), key_size);
+}
+
+// https://datatracker.ietf.org/doc/html/rfc8439#section-2.8
+ErrorOr<void> ChaCha20Poly1305::compute_tag(ReadonlyBytes nonce, ReadonlyBytes aad, ReadonlyBytes ciphertext, Bytes tag)
+{
+    // The one-time Poly1305 key is the first half of the keystream block with counter zero.
+    u8 poly_key[32] {};
+    {
+        ChaCha20 chacha({ m_key, key_size }, nonce, 0);
+        Bytes poly_key_bytes { poly_key, sizeof(poly_key) };
+        chacha.encrypt(poly_key_bytes, poly_key_bytes);
+    }
+    Authentication::Poly1305 poly({ poly_key, sizeof(poly_key) });
+
+    static constexpr u8 zero_padding[16] {};
+    auto update_padded = [&](ReadonlyBytes data) {
+        poly.update(data);
+        if (auto remainder = data.size() % 16; remainder != 0)
+            poly.update({ zero_padding, 16 - remainder });
+    };
+    update_padded(aad);
+    update_padded(ciphertext);
+
+    u8 lengths[16];
+    auto store_le64 = [](u8* out, u64 value) {
+        for (size_t i = 0; i < 8; ++i)
+            out[i] = (value >> (8 * i)) & 0xff;
+    };
+    store_le64(lengths, aad.size());
+    store_le64(lengths + 8, ciphertext.size());
+    poly.update({ lengths, sizeof(lengths) });
+
+    auto digest = TRY(poly.digest());
+    VERIFY(digest.size() == tag_size && tag.size() == tag_size);
+    digest.bytes().copy_to(tag);
+    return {};
+}
+
+void ChaCha20Poly1305::encrypt(ReadonlyBytes plaintext, Bytes ciphertext, ReadonlyBytes nonce, ReadonlyBytes aad, Bytes tag)
+{
+    VERIFY(nonce.size() == nonce_size);
+    VERIFY(ciphertext.size() >= plaintext.size());
+
+    ChaCha20 chacha({ m_key, key_size }, nonce, 1);
+    chacha.encrypt(plaintext, ciphertext);
+    MUST(compute_tag(nonce, aad, ciphertext.slice(0, plaintext.size()), tag));
+}
+
+VerificationConsistency ChaCha20Poly1305::decrypt(ReadonlyBytes ciphertext, Bytes plaintext, ReadonlyBytes nonce, ReadonlyBytes aad, ReadonlyBytes tag)
+{
+    VERIFY(nonce.size() == nonce_size);
+    VERIFY(plaintext.size() >= ciphertext.size());
+
+    u8 expected_tag[tag_size];
+    if (compute_tag(nonce, aad, ciphertext, { expected_tag, tag_size }).is_error())
+        return VerificationConsistency::Inconsistent;
+    if (tag.size() != tag_size || !timing_safe_compare(expected_tag, tag.data(), tag_size))
+        return VerificationConsistency::Inconsistent;
+
+    ChaCha20 chacha({ m_key, key_size }, nonce, 1);
+    chacha.decrypt(ciphertext, plaintext);
+    return VerificationConsistency::Consistent;
+}
+
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <LibCrypto/Verification.h>
+
+namespace Crypto::Cipher {
+
+// The AEAD construction from RFC 8439 section 2.8: ChaCha20 for the bulk data,
+// authenticated by Poly1305 under a one-time key taken from the first
+// keystream block of the same (key, nonce) pair.
+class ChaCha20Poly1305 {
+public:
+    static constexpr size_t key_size = 32;
+    static constexpr size_t nonce_size = 12;
+    static constexpr size_t tag_size = 16;
+
+    explicit ChaCha20Poly1305(ReadonlyBytes key);
+
+    void encrypt(ReadonlyBytes plaintext, Bytes ciphertext, ReadonlyBytes nonce, ReadonlyBytes aad, Bytes tag);
+    VerificationConsistency decrypt(ReadonlyBytes ciphertext, Bytes plaintext, ReadonlyBytes nonce, ReadonlyBytes aad, ReadonlyBytes tag);
+
+private:
+    ErrorOr<void> compute_tag(ReadonlyBytes nonce, ReadonlyBytes aad, ReadonlyBytes ciphertext, Bytes tag);
+
+    u8 m_key[key_size] {};
+};
+
+}
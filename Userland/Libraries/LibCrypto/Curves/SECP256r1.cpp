@@ -4,12 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/ByteReader.h>
 #include <AK/DeprecatedString.h>
 #include <AK/Endian.h>
 #include <AK/Random.h>
 #include <AK/StringBuilder.h>
 #include <AK/UFixedBigInt.h>
+#include <AK/Vector.h>
 #include <LibCrypto/Curves/SECP256r1.h>
 
 namespace Crypto::Curves {
@@ -21,6 +23,15 @@ static constexpr u256 PRIME { u128 { 0xffffffffffffffffull, 0x00000000fffffffful
 static constexpr u256 R2_MOD_PRIME { u128 { 0x0000000000000003ull, 0xfffffffbffffffffull }, u128 { 0xfffffffffffffffeull, 0x00000004fffffffdull } };
 static constexpr u256 ONE { 1u };
 static constexpr u256 B_MONTGOMERY { u128 { 0xd89cdf6229c4bddfull, 0xacf005cd78843090ull }, u128 { 0xe5a220abf7212ed6ull, 0xdc30061d04874834ull } };
+static constexpr u256 GENERATOR_X { u128 { 0xf4a13945d898c296ull, 0x77037d812deb33a0ull }, u128 { 0xf8bce6e563a440f2ull, 0x6b17d1f2e12c4247ull } };
+static constexpr u256 GENERATOR_Y { u128 { 0xcbb6406837bf51f5ull, 0x2bce33576b315eceull }, u128 { 0x8ee7eb4a7c0f9e16ull, 0x4fe342e2fe1a7f9bull } };
+
+// An affine point in Montgomery form, used for precomputed tables where the
+// shared Z coordinate has been divided out.
+struct AffinePoint {
+    u256 x { 0u };
+    u256 y { 0u };
+};
 
 static u256 import_big_endian(ReadonlyBytes data)
 {
@@ -205,11 +216,9 @@ static void point_double(JacobianPoint& output_point, JacobianPoint const& point
 {
     // Based on "Point Doubling" from http://point-at-infinity.org/ecc/Prime_Curve_Jacobian_Coordinates.html
 
-    // if (Y == 0)
-    //   return POINT_AT_INFINITY
-    if (point.y.is_zero_constant_time()) {
-        VERIFY_NOT_REACHED();
-    }
+    // The identity is represented as (0 : 0 : 0). It is the only input with
+    // Y = 0, since the curve has no points of order two, and the formulas
+    // below already map it to itself, so it needs no special-casing.
 
     u256 temp;
 
@@ -322,18 +331,142 @@ static void point_add(JacobianPoint& output_point, JacobianPoint const& point_a,
     output_point.z = z3;
 }
 
-static void convert_jacobian_to_affine(JacobianPoint& point)
+static void point_add_mixed(JacobianPoint& output_point, JacobianPoint const& point_a, AffinePoint const& point_b)
 {
+    // Like point_add, but point_b is affine (an implicit Z2 = 1), which makes
+    // all the Z2 arithmetic disappear.
+    if (point_a.x.is_zero_constant_time() && point_a.y.is_zero_constant_time() && point_a.z.is_zero_constant_time()) {
+        output_point.x = point_b.x;
+        output_point.y = point_b.y;
+        output_point.z = to_montgomery(ONE);
+        return;
+    }
+
     u256 temp;
+
+    // U1 = X1*Z2^2 = X1
+    u256 u1 = point_a.x;
+    // S1 = Y1*Z2^3 = Y1
+    u256 s1 = point_a.y;
+
+    temp = modular_square(point_a.z);
+    // U2 = X2*Z1^2
+    u256 u2 = modular_multiply(point_b.x, temp);
+    // S2 = Y2*Z1^3
+    u256 s2 = modular_multiply(point_b.y, temp);
+    s2 = modular_multiply(s2, point_a.z);
+
+    // if (U1 == U2)
+    //   if (S1 != S2)
+    //     return POINT_AT_INFINITY
+    //   else
+    //     return POINT_DOUBLE(X1, Y1, Z1)
+    if (u1.is_equal_to_constant_time(u2)) {
+        if (s1.is_equal_to_constant_time(s2)) {
+            point_double(output_point, point_a);
+            return;
+        } else {
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    // H = U2 - U1
+    u256 h = modular_sub(u2, u1);
+    u256 h2 = modular_square(h);
+    u256 h3 = modular_multiply(h2, h);
+    // R = S2 - S1
+    u256 r = modular_sub(s2, s1);
+    // X3 = R^2 - H^3 - 2*U1*H^2
+    u256 x3 = modular_square(r);
+    x3 = modular_sub(x3, h3);
+    temp = modular_multiply(u1, h2);
+    temp = modular_add(temp, temp);
+    x3 = modular_sub(x3, temp);
+    // Y3 = R*(U1*H^2 - X3) - S1*H^3
+    u256 y3 = modular_multiply(u1, h2);
+    y3 = modular_sub(y3, x3);
+    y3 = modular_multiply(y3, r);
+    temp = modular_multiply(s1, h3);
+    y3 = modular_sub(y3, temp);
+    // Z3 = H*Z1*Z2 = H*Z1
+    u256 z3 = modular_multiply(h, point_a.z);
+    // return (X3, Y3, Z3)
+    output_point.x = x3;
+    output_point.y = y3;
+    output_point.z = z3;
+}
+
+static void convert_jacobian_to_affine(JacobianPoint& point)
+{
+    // A single inversion of Z covers both coordinates.
+    u256 z_inverse = modular_inverse(point.z);
+    u256 z_inverse_squared = modular_square(z_inverse);
     // X' = X/Z^2
-    temp = modular_square(point.z);
-    temp = modular_inverse(temp);
-    point.x = modular_multiply(point.x, temp);
+    point.x = modular_multiply(point.x, z_inverse_squared);
     // Y' = Y/Z^3
-    temp = modular_square(point.z);
-    temp = modular_multiply(temp, point.z);
-    temp = modular_inverse(temp);
-    point.y = modular_multiply(point.y, temp);
+    point.y = modular_multiply(point.y, modular_multiply(z_inverse_squared, z_inverse));
+}
+
+static void batch_normalize(Span<JacobianPoint const> points, Span<AffinePoint> output)
+{
+    VERIFY(points.size() == output.size());
+
+    // Montgomery's trick: one modular inversion covers every Z coordinate, by
+    // inverting the running product of all of them and unwinding it with one
+    // multiplication per point on the way back.
+    Vector<u256> products;
+    products.ensure_capacity(points.size());
+    u256 running = to_montgomery(ONE);
+    for (auto const& point : points) {
+        running = modular_multiply(running, point.z);
+        products.unchecked_append(running);
+    }
+
+    u256 inverse = modular_inverse(running);
+    for (size_t i = points.size(); i-- > 0;) {
+        u256 z_inverse = i == 0 ? inverse : modular_multiply(inverse, products[i - 1]);
+        inverse = modular_multiply(inverse, points[i].z);
+
+        u256 z_inverse_squared = modular_square(z_inverse);
+        output[i].x = modular_multiply(points[i].x, z_inverse_squared);
+        output[i].y = modular_multiply(points[i].y, modular_multiply(z_inverse_squared, z_inverse));
+    }
+}
+
+static AffinePoint select_point(Span<AffinePoint const> table, u8 index)
+{
+    // Constant-time table lookup: scan every entry and keep the matching one.
+    AffinePoint result;
+    for (size_t i = 0; i < table.size(); ++i) {
+        bool matches = i == index;
+        result.x = select(result.x, table[i].x, matches);
+        result.y = select(result.y, table[i].y, matches);
+    }
+    return result;
+}
+
+// Affine table of 2^i * G, so that multiplications of the fixed generator only
+// pay for the conditional additions of the ladder. Built once on first use,
+// with all 256 entries sharing a single batch-normalizing inversion.
+static Span<AffinePoint const> generator_table()
+{
+    static auto const table = [] {
+        Array<JacobianPoint, 256> doublings;
+        JacobianPoint generator {
+            to_montgomery(GENERATOR_X),
+            to_montgomery(GENERATOR_Y),
+            to_montgomery(ONE),
+        };
+        for (auto& entry : doublings) {
+            entry = generator;
+            point_double(generator, generator);
+        }
+
+        Array<AffinePoint, 256> result;
+        batch_normalize(doublings.span(), result.span());
+        return result;
+    }();
+    return table.span();
 }
 
 static bool is_point_on_curve(JacobianPoint const& point)
@@ -362,18 +495,59 @@ ErrorOr<ByteBuffer> SECP256r1::generate_private_key()
     return buffer;
 }
 
+static ErrorOr<ByteBuffer> export_point(JacobianPoint& point)
+{
+    // Convert from Jacobian coordinates back to Affine coordinates
+    convert_jacobian_to_affine(point);
+
+    // Make sure the resulting point is on the curve
+    VERIFY(is_point_on_curve(point));
+
+    // Convert the result back from Montgomery form
+    point.x = from_montgomery(point.x);
+    point.y = from_montgomery(point.y);
+    // Final modular reduction on the coordinates
+    point.x = modular_reduce(point.x);
+    point.y = modular_reduce(point.y);
+
+    // Export the values into an output buffer
+    auto buf = TRY(ByteBuffer::create_uninitialized(65));
+    buf[0] = 0x04;
+    export_big_endian(point.x, buf.bytes().slice(1, 32));
+    export_big_endian(point.y, buf.bytes().slice(33, 32));
+    return buf;
+}
+
 ErrorOr<ByteBuffer> SECP256r1::generate_public_key(ReadonlyBytes a)
 {
-    // clang-format off
-    u8 generator_bytes[65] {
-        0x04,
-        0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2,
-        0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96,
-        0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16,
-        0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5,
-    };
-    // clang-format on
-    return compute_coordinate(a, { generator_bytes, 65 });
+    VERIFY(a.size() == 32);
+
+    u256 scalar = import_big_endian(a);
+    // FIXME: This will slightly bias the distribution of client secrets
+    scalar = modular_reduce_order(scalar);
+    if (scalar.is_zero_constant_time())
+        return Error::from_string_literal("SECP256r1: scalar is zero");
+
+    auto table = generator_table();
+
+    JacobianPoint result;
+    JacobianPoint temp_result;
+
+    // Calculate the scalar times generator multiplication in constant time.
+    // The precomputed doublings of the generator replace the point doubling
+    // half of the generic ladder.
+    for (auto i = 0; i < 256; i++) {
+        point_add_mixed(temp_result, result, table[i]);
+
+        auto condition = (scalar & 1u) == 1u;
+        result.x = select(result.x, temp_result.x, condition);
+        result.y = select(result.y, temp_result.y, condition);
+        result.z = select(result.z, temp_result.z, condition);
+
+        scalar >>= 1u;
+    }
+
+    return export_point(result);
 }
 
 ErrorOr<ByteBuffer> SECP256r1::compute_coordinate(ReadonlyBytes scalar_bytes, ReadonlyBytes point_bytes)
@@ -405,41 +579,39 @@ ErrorOr<ByteBuffer> SECP256r1::compute_coordinate(ReadonlyBytes scalar_bytes, Re
     if (!is_point_on_curve(point))
         return Error::from_string_literal("SECP256r1: point is not on the curve");
 
+    // Precompute 1*P .. 15*P for a 4-bit window, normalized to affine form
+    // with a single shared inversion so the ladder can use mixed additions.
+    Array<JacobianPoint, 15> multiples;
+    multiples[0] = point;
+    for (size_t i = 1; i < multiples.size(); ++i)
+        point_add(multiples[i], multiples[i - 1], point);
+    Array<AffinePoint, 15> table;
+    batch_normalize(multiples.span(), table.span());
+
     JacobianPoint result;
     JacobianPoint temp_result;
 
-    // Calculate the scalar times point multiplication in constant time
-    for (auto i = 0; i < 256; i++) {
-        point_add(temp_result, result, point);
-
-        auto condition = (scalar & 1u) == 1u;
+    // Calculate the scalar times point multiplication in constant time, four
+    // scalar bits per iteration. A zero digit selects no table entry and the
+    // resulting addition is thrown away, so every iteration does the same
+    // amount of work.
+    for (size_t i = 64; i-- > 0;) {
+        point_double(result, result);
+        point_double(result, result);
+        point_double(result, result);
+        point_double(result, result);
+
+        u8 digit = (scalar >> (i * 4)).low().low() & 15;
+        AffinePoint addend = select_point(table.span(), digit - 1);
+
+        point_add_mixed(temp_result, result, addend);
+        auto condition = digit != 0;
         result.x = select(result.x, temp_result.x, condition);
         result.y = select(result.y, temp_result.y, condition);
         result.z = select(result.z, temp_result.z, condition);
-
-        point_double(point, point);
-        scalar >>= 1u;
     }
 
-    // Convert from Jacobian coordinates back to Affine coordinates
-    convert_jacobian_to_affine(result);
-
-    // Make sure the resulting point is on the curve
-    VERIFY(is_point_on_curve(result));
-
-    // Convert the result back from Montgomery form
-    result.x = from_montgomery(result.x);
-    result.y = from_montgomery(result.y);
-    // Final modular reduction on the coordinates
-    result.x = modular_reduce(result.x);
-    result.y = modular_reduce(result.y);
-
-    // Export the values into an output buffer
-    auto buf = TRY(ByteBuffer::create_uninitialized(65));
-    buf[0] = 0x04;
-    export_big_endian(result.x, buf.bytes().slice(1, 32));
-    export_big_endian(result.y, buf.bytes().slice(33, 32));
-    return buf;
+    return export_point(result);
 }
 
 ErrorOr<ByteBuffer> SECP256r1::derive_premaster_key(ReadonlyBytes shared_point)
@@ -4,9 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Platform.h>
 #include <AK/Types.h>
 #include <LibCrypto/Hash/SHA2.h>
 
+#if ARCH(X86_64) && !defined(KERNEL)
+#    include <immintrin.h>
+#endif
+
 namespace Crypto::Hash {
 constexpr static auto ROTRIGHT(u32 a, size_t b) { return (a >> b) | (a << (32 - b)); }
 constexpr static auto CH(u32 x, u32 y, u32 z) { return (x & y) ^ (z & ~x); }
@@ -24,8 +29,67 @@ constexpr static auto EP1(u64 x) { return ROTRIGHT(x, 14) ^ ROTRIGHT(x, 18) ^ RO
 constexpr static auto SIGN0(u64 x) { return ROTRIGHT(x, 1) ^ ROTRIGHT(x, 8) ^ (x >> 7); }
 constexpr static auto SIGN1(u64 x) { return ROTRIGHT(x, 19) ^ ROTRIGHT(x, 61) ^ (x >> 6); }
 
+#if ARCH(X86_64) && !defined(KERNEL)
+static bool cpu_supports_sha_extensions()
+{
+    static bool supported = __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+    return supported;
+}
+
+__attribute__((target("sha,sse4.1"))) static void transform_sha_ni(u32 state[8], u8 const* data)
+{
+    __m128i const byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0b, 0x0405060700010203);
+
+    // The SHA instructions operate on the state packed as { A, B, E, F } and { C, D, G, H }.
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xb1);
+    state1 = _mm_shuffle_epi32(state1, 0x1b);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+    __m128i const saved_state0 = state0;
+    __m128i const saved_state1 = state1;
+
+    __m128i message_schedule[4];
+    for (size_t i = 0; i < 4; ++i) {
+        auto block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data) + i);
+        message_schedule[i] = _mm_shuffle_epi8(block, byte_swap_mask);
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+        auto round_constants = _mm_loadu_si128(reinterpret_cast<__m128i const*>(SHA256Constants::RoundConstants) + i);
+        auto message = _mm_add_epi32(message_schedule[i % 4], round_constants);
+        state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(message, 0x0e));
+
+        // Extend the message schedule: W[i..i+3] become W[i+16..i+19].
+        if (i < 12) {
+            auto extended = _mm_sha256msg1_epu32(message_schedule[i % 4], message_schedule[(i + 1) % 4]);
+            extended = _mm_add_epi32(extended, _mm_alignr_epi8(message_schedule[(i + 3) % 4], message_schedule[(i + 2) % 4], 4));
+            message_schedule[i % 4] = _mm_sha256msg2_epu32(extended, message_schedule[(i + 3) % 4]);
+        }
+    }
+
+    state0 = _mm_add_epi32(state0, saved_state0);
+    state1 = _mm_add_epi32(state1, saved_state1);
+
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+#endif
+
 inline void SHA256::transform(u8 const* data)
 {
+#if ARCH(X86_64) && !defined(KERNEL)
+    if (cpu_supports_sha_extensions())
+        return transform_sha_ni(m_state, data);
+#endif
+
     u32 m[64];
 
     size_t i = 0;
@@ -67,13 +131,26 @@ inline void SHA256::transform(u8 const* data)
 
 void SHA256::update(u8 const* message, size_t length)
 {
-    for (size_t i = 0; i < length; ++i) {
+    while (length > 0) {
         if (m_data_length == BlockSize) {
             transform(m_data_buffer);
             m_bit_length += 512;
             m_data_length = 0;
         }
-        m_data_buffer[m_data_length++] = message[i];
+        // Hash whole blocks straight from the input; only the trailing block
+        // (partial or not) gets staged in m_data_buffer.
+        if (m_data_length == 0 && length > BlockSize) {
+            transform(message);
+            m_bit_length += 512;
+            message += BlockSize;
+            length -= BlockSize;
+            continue;
+        }
+        auto bytes_to_copy = min(length, BlockSize - m_data_length);
+        __builtin_memcpy(m_data_buffer + m_data_length, message, bytes_to_copy);
+        m_data_length += bytes_to_copy;
+        message += bytes_to_copy;
+        length -= bytes_to_copy;
     }
 }
 
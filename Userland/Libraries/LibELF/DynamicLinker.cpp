@@ -66,8 +66,25 @@ static Result<void*, DlErrorMessage> __dlopen(char const* filename, int flags);
 static Result<void*, DlErrorMessage> __dlsym(void* handle, char const* symbol_name);
 static Result<void, DlErrorMessage> __dladdr(void* addr, Dl_info* info);
 
+// While the loader links the main program at process startup, global symbol
+// resolutions are memoized here. Every object that links against, say, LibC
+// resolves largely the same set of symbols, and without this cache each of
+// those lookups probes the hash tables of every global object all over again.
+// The cache is dropped before any initializers run: after that point, lazy
+// PLT fixups may race from multiple threads, which a plain HashMap does not
+// support. Keys are backed by the mapped objects' string tables, which are
+// never unmapped.
+static HashMap<StringView, DynamicObject::SymbolLookupResult> s_startup_symbol_cache;
+static bool s_startup_symbol_caching_allowed { false };
+static bool s_startup_symbol_caching_active { false };
+
 Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(StringView name)
 {
+    if (s_startup_symbol_caching_active) {
+        if (auto cached = s_startup_symbol_cache.get(name); cached.has_value())
+            return cached.value();
+    }
+
     Optional<DynamicObject::SymbolLookupResult> weak_result;
 
     auto symbol = DynamicObject::HashSymbol { name };
@@ -76,12 +93,17 @@ Optional<DynamicObject::SymbolLookupResult> DynamicLinker::lookup_global_symbol(
         auto res = lib.value->lookup_symbol(symbol);
         if (!res.has_value())
             continue;
-        if (res.value().bind == STB_GLOBAL)
+        if (res.value().bind == STB_GLOBAL) {
+            if (s_startup_symbol_caching_active)
+                s_startup_symbol_cache.set(name, res.value());
             return res;
+        }
         if (res.value().bind == STB_WEAK && !weak_result.has_value())
             weak_result = res;
         // We don't want to allow local symbols to be pulled in to other modules
     }
+    if (s_startup_symbol_caching_active && weak_result.has_value())
+        s_startup_symbol_cache.set(name, weak_result.value());
     return weak_result;
 }
 
@@ -384,6 +406,13 @@ static Result<void, DlErrorMessage> link_main_library(DeprecatedString const& pa
 
     auto loaders = collect_loaders_for_library(path);
 
+    // Only the initial link at process startup may use the symbol cache;
+    // exchange() makes sure a dlopen() from somebody's initializer can't
+    // re-enable it once other threads may exist.
+    bool use_startup_symbol_cache = exchange(s_startup_symbol_caching_allowed, false);
+    if (use_startup_symbol_cache)
+        s_startup_symbol_caching_active = true;
+
     for (auto& loader : loaders) {
         auto dynamic_object = loader.map();
         if (dynamic_object)
@@ -424,6 +453,13 @@ static Result<void, DlErrorMessage> link_main_library(DeprecatedString const& pa
         }
     }
 
+    // All relocations are done; drop the cache before stage 4 gets a chance
+    // to run initializers (which may spawn threads or dlopen()).
+    if (use_startup_symbol_cache) {
+        s_startup_symbol_caching_active = false;
+        s_startup_symbol_cache.clear();
+    }
+
     drop_loader_promise("prot_exec"sv);
 
     for (auto& loader : loaders) {
@@ -660,6 +696,7 @@ void ELF::DynamicLinker::linker_main(DeprecatedString&& main_program_path, int m
     allocate_tls();
 
     auto entry_point_function = [&main_program_path] {
+        s_startup_symbol_caching_allowed = true;
         auto result = link_main_library(main_program_path, RTLD_GLOBAL | RTLD_LAZY);
         if (result.is_error()) {
             warnln("{}", result.error().text);
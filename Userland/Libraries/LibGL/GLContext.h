@@ -278,6 +278,9 @@ private:
     void get_material_param(Face face, GLenum pname, T* params);
 
     void invoke_list(size_t list_index);
+    void invoke_compiled_vertex_run(GLuint run_index);
+    void append_vertex_from_client_pointers(int index);
+    static GPU::PrimitiveType primitive_type_for_draw_mode(GLenum draw_mode);
     [[nodiscard]] bool should_append_to_listing() const { return m_current_listing_index.has_value(); }
     [[nodiscard]] bool should_execute_after_appending_to_listing() const { return m_current_listing_index.has_value() && m_current_listing_index->mode == GL_COMPILE_AND_EXECUTE; }
 
@@ -513,11 +516,36 @@ private:
 
         Vector<NonnullOwnPtr<ExtraSavedArguments>> saved_arguments;
         Vector<FunctionsAndArgs> entries;
+
+        // A recorded gl_begin .. gl_end run consisting purely of vertex
+        // attribute calls, compiled into a prebuilt vertex buffer so that
+        // invoking the list submits the entire run to the device in one call
+        // instead of replaying every recorded call.
+        struct CompiledVertexRun {
+            GLenum draw_mode { GL_TRIANGLES };
+            Vector<GPU::Vertex> vertices;
+            // Numbers of leading vertices recorded before the run set the
+            // corresponding attribute; they take the current attribute values
+            // at invocation time.
+            size_t vertices_missing_color { 0 };
+            size_t vertices_missing_normal { 0 };
+            Array<size_t, GPU::NUM_TEXTURE_UNITS> vertices_missing_tex_coord {};
+            // Attribute values the run leaves behind as current values.
+            Optional<FloatVector4> final_color;
+            Optional<FloatVector3> final_normal;
+            Array<Optional<FloatVector4>, GPU::NUM_TEXTURE_UNITS> final_tex_coords;
+        };
+        Vector<CompiledVertexRun> compiled_runs;
     };
 
+    void compile_vertex_runs(Listing&);
+
     static constexpr size_t max_allowed_gl_call_depth { 128 };
     size_t m_gl_call_depth { 0 };
     Vector<Listing> m_listings;
+    // The listing currently being replayed by invoke_list(); compiled vertex
+    // runs are resolved against it.
+    Listing const* m_invoked_listing { nullptr };
     size_t m_list_base { 0 };
     struct CurrentListing {
         Listing listing;
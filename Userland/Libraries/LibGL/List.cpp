@@ -94,8 +94,10 @@ void GLContext::gl_delete_lists(GLuint list, GLsizei range)
     if (m_listings.size() < list || m_listings.size() <= list + range)
         return;
 
-    for (auto& entry : m_listings.span().slice(list - 1, range))
+    for (auto& entry : m_listings.span().slice(list - 1, range)) {
         entry.entries.clear_with_capacity();
+        entry.compiled_runs.clear_with_capacity();
+    }
 }
 
 void GLContext::gl_end_list()
@@ -103,8 +105,11 @@ void GLContext::gl_end_list()
     RETURN_WITH_ERROR_IF(m_in_draw_state, GL_INVALID_OPERATION);
     RETURN_WITH_ERROR_IF(!m_current_listing_index.has_value(), GL_INVALID_OPERATION);
 
-    m_listings[m_current_listing_index->index] = move(m_current_listing_index->listing);
+    auto listing_index = m_current_listing_index->index;
+    m_listings[listing_index] = move(m_current_listing_index->listing);
     m_current_listing_index.clear();
+
+    compile_vertex_runs(m_listings[listing_index]);
 }
 
 GLuint GLContext::gl_gen_lists(GLsizei range)
@@ -149,6 +154,7 @@ void GLContext::gl_new_list(GLuint list, GLenum mode)
 void GLContext::invoke_list(size_t list_index)
 {
     auto& listing = m_listings[list_index - 1];
+    TemporaryChange invoked_listing_change { m_invoked_listing, static_cast<Listing const*>(&listing) };
     for (auto& entry : listing.entries) {
         entry.function.visit([&](auto& function) {
             entry.arguments.visit([&](auto& arguments) {
@@ -163,4 +169,163 @@ void GLContext::invoke_list(size_t list_index)
     }
 }
 
+// Scans a freshly compiled listing for gl_begin .. gl_end runs that consist
+// purely of vertex attribute calls and collapses each into a prebuilt vertex
+// buffer, replaced in the entry stream by a single invoke_compiled_vertex_run()
+// entry. Attributes that a run does not set before its first vertex still
+// depend on the current values at invocation time; such vertices are counted
+// here and patched when the run is invoked.
+void GLContext::compile_vertex_runs(Listing& listing)
+{
+    auto entry_is = [](Listing::FunctionsAndArgs const& entry, auto function) {
+        auto const* stored_function = entry.function.template get_pointer<decltype(function)>();
+        return stored_function != nullptr && *stored_function == function;
+    };
+
+    Vector<Listing::FunctionsAndArgs> compiled_entries;
+    Vector<Listing::CompiledVertexRun> compiled_runs;
+
+    size_t entry_index = 0;
+    while (entry_index < listing.entries.size()) {
+        auto const& begin_entry = listing.entries[entry_index];
+        if (!entry_is(begin_entry, &GLContext::gl_begin)) {
+            compiled_entries.append(begin_entry);
+            ++entry_index;
+            continue;
+        }
+
+        auto draw_mode = begin_entry.arguments.get<Tuple<GLenum>>().get<0>();
+
+        Listing::CompiledVertexRun run;
+        run.draw_mode = draw_mode;
+
+        // Attribute state as far as the run itself has determined it.
+        Optional<FloatVector4> color;
+        Optional<FloatVector3> normal;
+        Array<Optional<FloatVector4>, GPU::NUM_TEXTURE_UNITS> tex_coords;
+
+        bool committed = false;
+        size_t scan_index = entry_index + 1;
+        if (draw_mode <= GL_POLYGON) {
+            for (; scan_index < listing.entries.size(); ++scan_index) {
+                auto const& run_entry = listing.entries[scan_index];
+                if (entry_is(run_entry, &GLContext::gl_end)) {
+                    committed = true;
+                    ++scan_index;
+                    break;
+                }
+                if (entry_is(run_entry, &GLContext::gl_vertex)) {
+                    auto const& arguments = run_entry.arguments.get<Tuple<GLfloat, GLfloat, GLfloat, GLfloat>>();
+                    GPU::Vertex vertex;
+                    vertex.position = { arguments.get<0>(), arguments.get<1>(), arguments.get<2>(), arguments.get<3>() };
+                    if (color.has_value())
+                        vertex.color = color.value();
+                    else
+                        run.vertices_missing_color = run.vertices.size() + 1;
+                    if (normal.has_value())
+                        vertex.normal = normal.value();
+                    else
+                        run.vertices_missing_normal = run.vertices.size() + 1;
+                    for (size_t i = 0; i < tex_coords.size(); ++i) {
+                        if (tex_coords[i].has_value())
+                            vertex.tex_coords[i] = tex_coords[i].value();
+                        else
+                            run.vertices_missing_tex_coord[i] = run.vertices.size() + 1;
+                    }
+                    run.vertices.append(vertex);
+                    continue;
+                }
+                if (entry_is(run_entry, &GLContext::gl_color)) {
+                    auto const& arguments = run_entry.arguments.get<Tuple<GLfloat, GLfloat, GLfloat, GLfloat>>();
+                    color = FloatVector4 { arguments.get<0>(), arguments.get<1>(), arguments.get<2>(), arguments.get<3>() };
+                    continue;
+                }
+                if (entry_is(run_entry, &GLContext::gl_normal)) {
+                    auto const& arguments = run_entry.arguments.get<Tuple<GLfloat, GLfloat, GLfloat>>();
+                    normal = FloatVector3 { arguments.get<0>(), arguments.get<1>(), arguments.get<2>() };
+                    continue;
+                }
+                if (entry_is(run_entry, &GLContext::gl_tex_coord)) {
+                    auto const& arguments = run_entry.arguments.get<Tuple<GLfloat, GLfloat, GLfloat, GLfloat>>();
+                    tex_coords[0] = FloatVector4 { arguments.get<0>(), arguments.get<1>(), arguments.get<2>(), arguments.get<3>() };
+                    continue;
+                }
+                if (entry_is(run_entry, &GLContext::gl_multi_tex_coord)) {
+                    auto const& arguments = run_entry.arguments.get<Tuple<GLenum, GLfloat, GLfloat, GLfloat, GLfloat>>();
+                    auto target = arguments.get<0>();
+                    // Leave invalid targets to the regular replay path, which
+                    // will generate the GL error.
+                    if (target < GL_TEXTURE0 || target >= GL_TEXTURE0 + m_device_info.num_texture_units)
+                        break;
+                    tex_coords[target - GL_TEXTURE0] = FloatVector4 { arguments.get<1>(), arguments.get<2>(), arguments.get<3>(), arguments.get<4>() };
+                    continue;
+                }
+                // Any other call ends the attempt; replay this run normally.
+                break;
+            }
+        }
+
+        if (!committed || run.vertices.is_empty()) {
+            // Keep the gl_begin entry and rescan from the entry after it; only
+            // gl_begin starts a new compilation attempt, so the entries in
+            // between are copied verbatim.
+            compiled_entries.append(begin_entry);
+            ++entry_index;
+            continue;
+        }
+
+        run.final_color = color;
+        run.final_normal = normal;
+        run.final_tex_coords = tex_coords;
+        compiled_runs.append(move(run));
+
+        compiled_entries.empend(
+            &GLContext::invoke_compiled_vertex_run,
+            Listing::ArgumentsFor<&GLContext::invoke_compiled_vertex_run> { static_cast<GLuint>(compiled_runs.size() - 1) });
+        entry_index = scan_index;
+    }
+
+    listing.entries = move(compiled_entries);
+    listing.compiled_runs = move(compiled_runs);
+}
+
+void GLContext::invoke_compiled_vertex_run(GLuint run_index)
+{
+    // The same error gl_begin would have generated when replaying the run.
+    RETURN_WITH_ERROR_IF(m_in_draw_state, GL_INVALID_OPERATION);
+
+    VERIFY(m_invoked_listing != nullptr);
+    auto const& run = m_invoked_listing->compiled_runs[run_index];
+
+    // Outside of a gl_begin/gl_end pair the vertex list is always empty, so
+    // the run's vertices land at the start of it.
+    VERIFY(m_vertex_list.is_empty());
+    m_vertex_list.extend(run.vertices);
+
+    // Patch the leading vertices whose attributes were not determined by the
+    // run itself with the current attribute values.
+    for (size_t i = 0; i < run.vertices_missing_color; ++i)
+        m_vertex_list[i].color = m_current_vertex_color;
+    for (size_t i = 0; i < run.vertices_missing_normal; ++i)
+        m_vertex_list[i].normal = m_current_vertex_normal;
+    for (size_t unit = 0; unit < m_device_info.num_texture_units; ++unit) {
+        for (size_t i = 0; i < run.vertices_missing_tex_coord[unit]; ++i)
+            m_vertex_list[i].tex_coords[unit] = m_current_vertex_tex_coord[unit];
+    }
+
+    sync_device_config();
+    m_rasterizer->draw_primitives(primitive_type_for_draw_mode(run.draw_mode), model_view_matrix(), projection_matrix(), m_vertex_list);
+    m_vertex_list.clear_with_capacity();
+
+    // The run leaves the last attribute values it set as the current values.
+    if (run.final_color.has_value())
+        m_current_vertex_color = run.final_color.value();
+    if (run.final_normal.has_value())
+        m_current_vertex_normal = run.final_normal.value();
+    for (size_t unit = 0; unit < m_device_info.num_texture_units; ++unit) {
+        if (run.final_tex_coords[unit].has_value())
+            m_current_vertex_tex_coord[unit] = run.final_tex_coords[unit].value();
+    }
+}
+
 }
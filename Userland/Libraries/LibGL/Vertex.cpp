@@ -56,6 +56,47 @@ static void read_from_vertex_attribute_pointer(VertexAttribPointer const& attrib
     }
 }
 
+// Fast path for drawing from the client vertex arrays: builds the vertex
+// directly from the enabled arrays and the current attribute state, bypassing
+// the per-call display list checks and current-state bookkeeping of the
+// individual attribute calls.
+void GLContext::append_vertex_from_client_pointers(int index)
+{
+    GPU::Vertex vertex;
+
+    float position[4] { 0.f, 0.f, 0.f, 1.f };
+    read_from_vertex_attribute_pointer(m_client_vertex_pointer, index, position);
+    vertex.position = { position[0], position[1], position[2], position[3] };
+
+    if (m_client_side_color_array_enabled) {
+        float color[4] { 0.f, 0.f, 0.f, 1.f };
+        read_from_vertex_attribute_pointer(m_client_color_pointer, index, color);
+        vertex.color = { color[0], color[1], color[2], color[3] };
+    } else {
+        vertex.color = m_current_vertex_color;
+    }
+
+    for (size_t t = 0; t < m_client_tex_coord_pointer.size(); ++t) {
+        if (m_client_side_texture_coord_array_enabled[t]) {
+            float tex_coords[4] { 0.f, 0.f, 0.f, 1.f };
+            read_from_vertex_attribute_pointer(m_client_tex_coord_pointer[t], index, tex_coords);
+            vertex.tex_coords[t] = { tex_coords[0], tex_coords[1], tex_coords[2], tex_coords[3] };
+        } else {
+            vertex.tex_coords[t] = m_current_vertex_tex_coord[t];
+        }
+    }
+
+    if (m_client_side_normal_array_enabled) {
+        float normal[3];
+        read_from_vertex_attribute_pointer(m_client_normal_pointer, index, normal);
+        vertex.normal = { normal[0], normal[1], normal[2] };
+    } else {
+        vertex.normal = m_current_vertex_normal;
+    }
+
+    m_vertex_list.append(vertex);
+}
+
 void GLContext::gl_array_element(GLint i)
 {
     // NOTE: This always dereferences data; display list support is deferred to the
@@ -137,6 +178,20 @@ void GLContext::gl_draw_arrays(GLenum mode, GLint first, GLsizei count)
     RETURN_WITH_ERROR_IF(count < 0, GL_INVALID_VALUE);
 
     auto last = first + count;
+
+    // When not compiling a display list, batch the entire array directly into
+    // the vertex list and submit it to the device in one go.
+    if (!should_append_to_listing()) {
+        gl_begin(mode);
+        if (m_client_side_vertex_array_enabled) {
+            m_vertex_list.ensure_capacity(count);
+            for (int i = first; i < last; i++)
+                append_vertex_from_client_pointers(i);
+        }
+        gl_end();
+        return;
+    }
+
     gl_begin(mode);
     for (int i = first; i < last; i++) {
         if (m_client_side_color_array_enabled) {
@@ -196,6 +251,32 @@ void GLContext::gl_draw_elements(GLenum mode, GLsizei count, GLenum type, void c
         index_data = m_element_array_buffer->offset_data(data_offset);
     }
 
+    auto index_at = [&](int index) -> int {
+        switch (type) {
+        case GL_UNSIGNED_BYTE:
+            return reinterpret_cast<GLubyte const*>(index_data)[index];
+        case GL_UNSIGNED_SHORT:
+            return reinterpret_cast<GLushort const*>(index_data)[index];
+        case GL_UNSIGNED_INT:
+            return reinterpret_cast<GLuint const*>(index_data)[index];
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    };
+
+    // When not compiling a display list, batch the entire array directly into
+    // the vertex list and submit it to the device in one go.
+    if (!should_append_to_listing()) {
+        gl_begin(mode);
+        if (m_client_side_vertex_array_enabled) {
+            m_vertex_list.ensure_capacity(count);
+            for (int index = 0; index < count; index++)
+                append_vertex_from_client_pointers(index_at(index));
+        }
+        gl_end();
+        return;
+    }
+
     gl_begin(mode);
     for (int index = 0; index < count; index++) {
         int i = 0;
@@ -8,6 +8,7 @@
 #include <LibCore/Timer.h>
 #include <LibGUI/AbstractScrollableWidget.h>
 #include <LibGUI/Scrollbar.h>
+#include <LibGUI/Window.h>
 
 namespace GUI {
 
@@ -19,7 +20,7 @@ AbstractScrollableWidget::AbstractScrollableWidget()
     m_vertical_scrollbar->set_step(4);
     m_vertical_scrollbar->on_change = [this](int) {
         did_scroll();
-        update();
+        update_scrolled_region();
     };
 
     m_horizontal_scrollbar = add<AbstractScrollableWidgetScrollbar>(*this, Orientation::Horizontal);
@@ -27,7 +28,7 @@ AbstractScrollableWidget::AbstractScrollableWidget()
     m_horizontal_scrollbar->set_page_step(30);
     m_horizontal_scrollbar->on_change = [this](int) {
         did_scroll();
-        update();
+        update_scrolled_region();
     };
 
     m_corner_widget = add<Widget>();
@@ -370,6 +371,39 @@ Gfx::IntPoint AbstractScrollableWidget::to_widget_position(Gfx::IntPoint content
     return widget_position;
 }
 
+void AbstractScrollableWidget::update_scrolled_region()
+{
+    Gfx::IntPoint scroll_offset { m_horizontal_scrollbar->value(), m_vertical_scrollbar->value() };
+    auto delta = m_last_scroll_offset - scroll_offset;
+    m_last_scroll_offset = scroll_offset;
+
+    if (m_scroll_by_shifting_backing_store && shift_scrolled_region_by(delta))
+        return;
+    update();
+}
+
+bool AbstractScrollableWidget::shift_scrolled_region_by(Gfx::IntPoint delta)
+{
+    if (!window() || !is_visible())
+        return false;
+
+    auto region = widget_inner_rect();
+    auto fixed_left_band = region.take_from_left(m_size_occupied_by_fixed_elements.width());
+    auto fixed_top_band = region.take_from_top(m_size_occupied_by_fixed_elements.height());
+
+    auto region_in_window = region.translated(window_relative_rect().location());
+    if (!window()->shift_backing_store_contents(region_in_window, delta))
+        return false;
+
+    // Fixed elements like rulers and column headers only scroll along one
+    // axis, so they have to be repainted the regular way.
+    if (!fixed_left_band.is_empty())
+        update(fixed_left_band);
+    if (!fixed_top_band.is_empty())
+        update(fixed_top_band);
+    return true;
+}
+
 Optional<UISize> AbstractScrollableWidget::calculated_min_size() const
 {
     auto vertical_scrollbar = m_vertical_scrollbar->effective_min_size().height().as_int();
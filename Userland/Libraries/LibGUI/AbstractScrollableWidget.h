@@ -89,6 +89,10 @@ protected:
     void set_content_size(Gfx::IntSize);
     void set_min_content_size(Gfx::IntSize);
     void set_size_occupied_by_fixed_elements(Gfx::IntSize);
+    // Widgets whose contents are a pure function of the scroll offset can opt
+    // in to scrolling by shifting the already-painted window contents instead
+    // of repainting everything.
+    void set_scroll_by_shifting_backing_store(bool value) { m_scroll_by_shifting_backing_store = value; }
     int autoscroll_threshold() const { return m_autoscroll_threshold; }
     void update_scrollbar_visibility();
 
@@ -113,6 +117,8 @@ private:
     friend class ScrollableWidgetScrollbar;
 
     void handle_wheel_event(MouseEvent&, Widget&);
+    void update_scrolled_region();
+    bool shift_scrolled_region_by(Gfx::IntPoint delta);
 
     RefPtr<AbstractScrollableWidgetScrollbar> m_vertical_scrollbar;
     RefPtr<AbstractScrollableWidgetScrollbar> m_horizontal_scrollbar;
@@ -121,7 +127,9 @@ private:
     Gfx::IntSize m_content_size;
     Gfx::IntSize m_min_content_size;
     Gfx::IntSize m_size_occupied_by_fixed_elements;
+    Gfx::IntPoint m_last_scroll_offset;
     bool m_scrollbars_enabled { true };
+    bool m_scroll_by_shifting_backing_store { false };
     bool m_should_hide_unnecessary_scrollbars { false };
 
     RefPtr<Core::Timer> m_automatic_scrolling_timer;
@@ -28,6 +28,16 @@ private:
     {
         Clipboard::the().clipboard_data_changed({}, mime_type);
     }
+
+    virtual Messages::ClipboardClient::RenderClipboardDataResponse render_clipboard_data() override
+    {
+        return Clipboard::the().render_delegated_data({});
+    }
+
+    virtual void clipboard_delegation_revoked() override
+    {
+        Clipboard::the().delegation_revoked({});
+    }
 };
 
 static RefPtr<ConnectionToClipboardServer> s_connection;
@@ -54,8 +64,18 @@ Clipboard& Clipboard::the()
     return s_the;
 }
 
+// Clips at least this large are delegated: the payload stays in this process
+// and is only transferred when somebody actually pastes.
+static constexpr size_t delegation_threshold = 256 * KiB;
+
 Clipboard::DataAndType Clipboard::fetch_data_and_type() const
 {
+    if (m_owns_delegated_clip) {
+        auto data = ByteBuffer::copy(m_delegated_data);
+        if (!data.is_error())
+            return { data.release_value(), m_delegated_mime_type, m_delegated_metadata };
+    }
+
     auto response = connection().get_clipboard_data();
     if (!response.data().is_valid())
         return {};
@@ -125,6 +145,21 @@ RefPtr<Gfx::Bitmap> Clipboard::DataAndType::as_bitmap() const
 
 void Clipboard::set_data(ReadonlyBytes data, DeprecatedString const& type, HashMap<DeprecatedString, DeprecatedString> const& metadata)
 {
+    if (data.size() >= delegation_threshold) {
+        auto local_copy = ByteBuffer::copy(data);
+        if (!local_copy.is_error()) {
+            m_delegated_data = local_copy.release_value();
+            m_delegated_mime_type = type;
+            m_delegated_metadata = metadata;
+            m_owns_delegated_clip = true;
+            connection().async_set_clipboard_descriptor(type, metadata);
+            return;
+        }
+        // Not enough memory for a local copy; fall back to an eager transfer.
+    }
+
+    drop_delegated_clip();
+
     auto buffer_or_error = Core::AnonymousBuffer::create_with_size(data.size());
     if (buffer_or_error.is_error()) {
         dbgln("GUI::Clipboard::set_data() failed to create a buffer");
@@ -150,9 +185,38 @@ void Clipboard::set_bitmap(Gfx::Bitmap const& bitmap, HashMap<DeprecatedString,
 
 void Clipboard::clear()
 {
+    drop_delegated_clip();
     connection().async_set_clipboard_data({}, {}, {});
 }
 
+Core::AnonymousBuffer Clipboard::render_delegated_data(Badge<ConnectionToClipboardServer>) const
+{
+    if (!m_owns_delegated_clip)
+        return {};
+    auto buffer_or_error = Core::AnonymousBuffer::create_with_size(m_delegated_data.size());
+    if (buffer_or_error.is_error()) {
+        dbgln("GUI::Clipboard::render_delegated_data() failed to create a buffer");
+        return {};
+    }
+    auto buffer = buffer_or_error.release_value();
+    if (!m_delegated_data.is_empty())
+        memcpy(buffer.data<void>(), m_delegated_data.data(), m_delegated_data.size());
+    return buffer;
+}
+
+void Clipboard::delegation_revoked(Badge<ConnectionToClipboardServer>)
+{
+    drop_delegated_clip();
+}
+
+void Clipboard::drop_delegated_clip()
+{
+    m_owns_delegated_clip = false;
+    m_delegated_data = {};
+    m_delegated_mime_type = {};
+    m_delegated_metadata = {};
+}
+
 void Clipboard::clipboard_data_changed(Badge<ConnectionToClipboardServer>, DeprecatedString const& mime_type)
 {
     if (on_change)
@@ -11,6 +11,7 @@
 #include <AK/DeprecatedString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGUI/Forward.h>
 #include <LibGfx/Forward.h>
 
@@ -48,6 +49,8 @@ public:
     void clear();
 
     void clipboard_data_changed(Badge<ConnectionToClipboardServer>, DeprecatedString const& mime_type);
+    Core::AnonymousBuffer render_delegated_data(Badge<ConnectionToClipboardServer>) const;
+    void delegation_revoked(Badge<ConnectionToClipboardServer>);
 
     void register_client(Badge<ClipboardClient>, ClipboardClient& client) { m_clients.set(&client); }
     void unregister_client(Badge<ClipboardClient>, ClipboardClient& client) { m_clients.remove(&client); }
@@ -57,7 +60,16 @@ public:
 private:
     Clipboard() = default;
 
+    void drop_delegated_clip();
+
     HashTable<ClipboardClient*> m_clients;
+
+    // Payload of a clip we delegated to the server: the data stays here and is
+    // only rendered into a shared buffer when somebody actually pastes.
+    ByteBuffer m_delegated_data;
+    DeprecatedString m_delegated_mime_type;
+    HashMap<DeprecatedString, DeprecatedString> m_delegated_metadata;
+    bool m_owns_delegated_clip { false };
 };
 
 }
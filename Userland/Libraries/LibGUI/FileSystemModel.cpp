@@ -11,14 +11,18 @@
 #include <AK/QuickSort.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/DirIterator.h>
+#include <LibCore/Directory.h>
 #include <LibCore/File.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/Stream.h>
 #include <LibGUI/AbstractView.h>
 #include <LibGUI/FileIconProvider.h>
 #include <LibGUI/FileSystemModel.h>
 #include <LibGUI/Painter.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/PNGWriter.h>
 #include <LibThreading/BackgroundAction.h>
+#include <errno.h>
 #include <grp.h>
 #include <pwd.h>
 #include <stdio.h>
@@ -642,8 +646,50 @@ Icon FileSystemModel::icon_for(Node const& node) const
 
 static HashMap<DeprecatedString, RefPtr<Gfx::Bitmap>> s_thumbnail_cache;
 
+static DeprecatedString thumbnail_cache_path_for(StringView path)
+{
+    // The source path is mirrored below the cache directory, so entries can't
+    // collide and stale ones are easy to find and delete by hand.
+    return DeprecatedString::formatted("{}/thumbnails{}.png", Core::StandardPaths::cache_directory(), path);
+}
+
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> load_thumbnail_from_disk_cache(StringView path, time_t source_mtime)
+{
+    auto cache_path = thumbnail_cache_path_for(path);
+    struct stat cache_st = {};
+    if (::stat(cache_path.characters(), &cache_st) < 0)
+        return Error::from_errno(errno);
+    // An entry older than the file it was rendered from is stale.
+    if (cache_st.st_mtime < source_mtime)
+        return Error::from_errno(ESTALE);
+    return Gfx::Bitmap::load_from_file(cache_path);
+}
+
+static void save_thumbnail_to_disk_cache(StringView path, Gfx::Bitmap const& thumbnail)
+{
+    // Failing to populate the cache only costs a re-render on the next visit.
+    auto encoded_or_error = Gfx::PNGWriter::encode(thumbnail);
+    if (encoded_or_error.is_error())
+        return;
+    auto cache_path = thumbnail_cache_path_for(path);
+    if (Core::Directory::create(LexicalPath(cache_path).parent(), Core::Directory::CreateDirectories::Yes).is_error())
+        return;
+    auto file_or_error = Core::Stream::File::open(cache_path, Core::Stream::OpenMode::Write);
+    if (file_or_error.is_error())
+        return;
+    if (file_or_error.value()->write_entire_buffer(encoded_or_error.value()).is_error())
+        (void)::unlink(cache_path.characters());
+}
+
 static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_thumbnail(StringView path)
 {
+    struct stat st = {};
+    bool has_source_stat = ::stat(DeprecatedString(path).characters(), &st) == 0;
+    if (has_source_stat) {
+        if (auto cached = load_thumbnail_from_disk_cache(path, st.st_mtime); !cached.is_error())
+            return cached.release_value();
+    }
+
     auto bitmap = TRY(Gfx::Bitmap::load_from_file(path));
     auto thumbnail = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 32, 32 }));
 
@@ -652,6 +698,12 @@ static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> render_thumbnail(StringView path)
 
     Painter painter(thumbnail);
     painter.draw_scaled_bitmap(destination, *bitmap, bitmap->rect());
+
+    // Only images that were actually downscaled are worth caching; anything
+    // thumbnail-sized or smaller is cheaper to re-decode than to read back.
+    if (has_source_stat && (bitmap->width() > thumbnail->width() || bitmap->height() > thumbnail->height()))
+        save_thumbnail_to_disk_cache(path, *thumbnail);
+
     return thumbnail;
 }
 
@@ -55,9 +55,14 @@ void ImageWidget::animate()
 {
     m_current_frame_index = (m_current_frame_index + 1) % m_image_decoder->frame_count();
 
-    auto current_frame = m_image_decoder->frame(m_current_frame_index).release_value_but_fixme_should_propagate_errors();
+    auto current_frame = m_image_decoder->frame_for_playback(m_current_frame_index).release_value_but_fixme_should_propagate_errors();
     set_bitmap(current_frame.image);
 
+    // The playback frame may be the decoder's retained canvas, in which case
+    // the bitmap pointer doesn't change between frames and set_bitmap() won't
+    // notice that the contents did.
+    update();
+
     if (current_frame.duration != m_timer->interval()) {
         m_timer->restart(current_frame.duration);
     }
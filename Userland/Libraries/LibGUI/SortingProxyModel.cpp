@@ -130,6 +130,14 @@ bool SortingProxyModel::less_than(ModelIndex const& index1, ModelIndex const& in
     return data1 < data2;
 }
 
+bool SortingProxyModel::less_than(Variant const& cached_key1, Variant const& cached_key2) const
+{
+    // String keys are already lowercased when the key cache is built.
+    if (cached_key1.is_string() && cached_key2.is_string())
+        return cached_key1.as_string() < cached_key2.as_string();
+    return cached_key1 < cached_key2;
+}
+
 ModelIndex SortingProxyModel::index(int row, int column, ModelIndex const& parent) const
 {
     if (row < 0 || column < 0)
@@ -177,17 +185,38 @@ void SortingProxyModel::sort_mapping(Mapping& mapping, int column, SortOrder sor
         return;
     }
 
+    // Fetch each row's sort key exactly once up front. Model::data() can be
+    // arbitrarily expensive (SystemMonitor recomputes process stats, for
+    // example), and quick_sort would otherwise re-fetch both sides of every
+    // comparison. String keys are lowercased here so the comparator doesn't
+    // allocate either.
+    Vector<Variant> sort_keys;
+    sort_keys.ensure_capacity(row_count);
+    for (int row = 0; row < row_count; ++row) {
+        auto key = source().index(row, column, mapping.source_parent).data(m_sort_role);
+        if (key.is_string())
+            sort_keys.unchecked_append(key.as_string().to_lowercase());
+        else
+            sort_keys.unchecked_append(move(key));
+    }
+
     for (int i = 0; i < row_count; ++i)
         mapping.source_rows[i] = i;
 
     quick_sort(mapping.source_rows, [&](auto row1, auto row2) -> bool {
-        bool is_less_than = less_than(source().index(row1, column, mapping.source_parent), source().index(row2, column, mapping.source_parent));
+        bool is_less_than = less_than(sort_keys[row1], sort_keys[row2]);
         return sort_order == SortOrder::Ascending ? is_less_than : !is_less_than;
     });
 
     for (int i = 0; i < row_count; ++i)
         mapping.proxy_rows[mapping.source_rows[i]] = i;
 
+    // If sorting didn't actually move any rows (common when rows only get
+    // appended in sorted order), the selections and cursors are still valid
+    // and there's nothing to fix up.
+    if (mapping.source_rows == old_source_rows)
+        return;
+
     // FIXME: I really feel like this should be done at the view layer somehow.
     for_each_view([&](AbstractView& view) {
         // Update the view's selection.
@@ -197,7 +226,8 @@ void SortingProxyModel::sort_mapping(Mapping& mapping, int column, SortOrder sor
             selection.for_each_index([&](ModelIndex const& index) {
                 if (index.parent() == mapping.source_parent) {
                     stale_indices_in_selection.append(index);
-                    selected_indices_in_source.append(source().index(old_source_rows[index.row()], index.column(), mapping.source_parent));
+                    if (static_cast<size_t>(index.row()) < old_source_rows.size())
+                        selected_indices_in_source.append(source().index(old_source_rows[index.row()], index.column(), mapping.source_parent));
                 }
             });
 
@@ -206,17 +236,17 @@ void SortingProxyModel::sort_mapping(Mapping& mapping, int column, SortOrder sor
             }
 
             for (auto& index : selected_indices_in_source) {
-                for (size_t i = 0; i < mapping.source_rows.size(); ++i) {
-                    if (mapping.source_rows[i] == index.row()) {
-                        auto new_source_index = this->index(i, index.column(), mapping.source_parent);
-                        selection.add(new_source_index);
-                        // Update the view's cursor.
-                        auto cursor = view.cursor_index();
-                        if (cursor.is_valid() && cursor.parent() == mapping.source_parent)
-                            view.set_cursor(new_source_index, AbstractView::SelectionUpdate::None, false);
-                        break;
-                    }
-                }
+                if (static_cast<size_t>(index.row()) >= mapping.proxy_rows.size())
+                    continue;
+                // proxy_rows is the inverse of source_rows, so it takes us
+                // straight from a source row to its new proxy row.
+                int proxy_row = mapping.proxy_rows[index.row()];
+                auto new_source_index = this->index(proxy_row, index.column(), mapping.source_parent);
+                selection.add(new_source_index);
+                // Update the view's cursor.
+                auto cursor = view.cursor_index();
+                if (cursor.is_valid() && cursor.parent() == mapping.source_parent)
+                    view.set_cursor(new_source_index, AbstractView::SelectionUpdate::None, false);
             }
         });
     });
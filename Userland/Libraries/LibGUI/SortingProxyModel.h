@@ -39,6 +39,10 @@ public:
     virtual bool is_column_sortable(int column_index) const override;
 
     virtual bool less_than(ModelIndex const&, ModelIndex const&) const;
+    // Sorting compares cached per-row sort keys through this overload, so
+    // each row's data() is only fetched once no matter how many comparisons
+    // the sort performs. String keys arrive pre-lowercased.
+    virtual bool less_than(Variant const& cached_key1, Variant const& cached_key2) const;
 
     ModelIndex map_to_source(ModelIndex const&) const;
     ModelIndex map_to_proxy(ModelIndex const&) const;
@@ -17,6 +17,7 @@
 #include <LibCore/Forward.h>
 #include <LibGUI/Command.h>
 #include <LibGUI/Forward.h>
+#include <LibGUI/TextLineGapBuffer.h>
 #include <LibGUI/TextRange.h>
 #include <LibGUI/UndoStack.h>
 #include <LibGUI/Widget.h>
@@ -69,8 +70,8 @@ public:
 
     bool set_text(StringView, AllowCallback = AllowCallback::Yes);
 
-    NonnullOwnPtrVector<TextDocumentLine> const& lines() const { return m_lines; }
-    NonnullOwnPtrVector<TextDocumentLine>& lines() { return m_lines; }
+    TextLineGapBuffer const& lines() const { return m_lines; }
+    TextLineGapBuffer& lines() { return m_lines; }
 
     bool has_spans() const { return !m_spans.is_empty(); }
     Vector<TextDocumentSpan>& spans() { return m_spans; }
@@ -142,7 +143,7 @@ protected:
 private:
     void merge_span_collections();
 
-    NonnullOwnPtrVector<TextDocumentLine> m_lines;
+    TextLineGapBuffer m_lines;
     HashMap<u32, Vector<TextDocumentSpan>> m_span_collections;
     Vector<TextDocumentSpan> m_spans;
 
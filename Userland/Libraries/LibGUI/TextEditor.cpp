@@ -32,6 +32,7 @@
 #include <LibGfx/Palette.h>
 #include <LibGfx/StandardCursor.h>
 #include <LibSyntax/Highlighter.h>
+#include <LibThreading/BackgroundAction.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <unistd.h>
@@ -61,6 +62,7 @@ TextEditor::TextEditor(Type type)
     if (is_single_line())
         set_visualize_trailing_whitespace(false);
     set_scrollbars_enabled(is_multi_line());
+    set_scroll_by_shifting_backing_store(is_multi_line());
     if (is_multi_line()) {
         set_font(Gfx::FontDatabase::default_fixed_width_font());
         set_wrapping_mode(WrappingMode::WrapAtWords);
@@ -1321,6 +1323,21 @@ Gfx::IntRect TextEditor::cursor_content_rect() const
     return content_rect_for_position(m_cursor);
 }
 
+Gfx::IntRect TextEditor::cursor_widget_rect() const
+{
+    // This is the inverse of the translations paint_event() applies before
+    // painting cursor_content_rect().
+    auto rect = cursor_content_rect();
+    rect.translate_by(-horizontal_scrollbar().value(), -vertical_scrollbar().value());
+    if (m_icon && horizontal_scrollbar().value() > 0)
+        rect.translate_by(min(icon_size() + icon_padding(), horizontal_scrollbar().value()), 0);
+    rect.translate_by(gutter_width() + ruler_width(), 0);
+    rect.translate_by(frame_thickness(), frame_thickness());
+    rect.translate_by(0, height_occupied_by_banner_widget());
+    rect.inflate(2, 2);
+    return rect.intersected(frame_inner_rect());
+}
+
 Gfx::IntRect TextEditor::line_widget_rect(size_t line_index) const
 {
     auto rect = line_content_rect(line_index);
@@ -1454,8 +1471,10 @@ void TextEditor::focusout_event(FocusEvent&)
 void TextEditor::timer_event(Core::TimerEvent&)
 {
     m_cursor_state = !m_cursor_state;
-    if (is_focused())
-        update_cursor();
+    if (is_focused()) {
+        // Only the cursor itself has changed, so don't repaint the whole line.
+        update(cursor_widget_rect());
+    }
 }
 
 bool TextEditor::write_to_file(DeprecatedString const& path)
@@ -2152,9 +2171,57 @@ void TextEditor::rehighlight_if_needed()
 
 void TextEditor::force_rehighlight()
 {
-    if (m_highlighter)
-        m_highlighter->rehighlight(palette());
     m_needs_rehighlight = false;
+    if (!m_highlighter)
+        return;
+
+    if (auto background_highlighter = m_highlighter->create_background_highlighter()) {
+        // Highlight on the background thread, and only up to the end of the
+        // viewport at first, so the visible part of the document updates as
+        // quickly as possible; the rest of the document follows afterwards.
+        auto generation = ++m_rehighlight_generation;
+        auto last_visible_line = text_position_at(frame_inner_rect().bottom_right()).line();
+        enqueue_background_rehighlight(background_highlighter.release_nonnull(), generation, last_visible_line);
+        return;
+    }
+
+    m_highlighter->rehighlight(palette());
+}
+
+void TextEditor::enqueue_background_rehighlight(NonnullOwnPtr<Syntax::Highlighter> background_highlighter, unsigned generation, Optional<size_t> last_line)
+{
+    DeprecatedString text_snapshot;
+    if (last_line.has_value() && last_line.value() + 1 < line_count()) {
+        text_snapshot = document().text_in_range({ { 0, 0 }, { last_line.value(), line(last_line.value()).length() } });
+    } else {
+        text_snapshot = text();
+        last_line = {};
+    }
+
+    auto proxy_client = make<Syntax::ProxyHighlighterClient>(*this, TextPosition { 0, 0 }, 0, text_snapshot);
+
+    (void)Threading::BackgroundAction<Vector<TextDocumentSpan>>::construct(
+        [background_highlighter = move(background_highlighter), proxy_client = move(proxy_client), text_snapshot = move(text_snapshot), palette = this->palette()](auto&) mutable {
+            background_highlighter->attach(*proxy_client);
+            background_highlighter->rehighlight(palette);
+            background_highlighter->detach();
+            return proxy_client->corrected_spans();
+        },
+        [weak_this = make_weak_ptr<TextEditor>(), generation, was_viewport_only = last_line.has_value()](Vector<TextDocumentSpan> spans) -> ErrorOr<void> {
+            auto self = weak_this.strong_ref();
+            if (!self)
+                return {};
+            // Drop results computed against a text snapshot that is no longer current.
+            if (generation != self->m_rehighlight_generation || self->m_needs_rehighlight)
+                return {};
+            self->highlighter_did_set_spans(move(spans));
+            self->update();
+            if (was_viewport_only && self->m_highlighter) {
+                if (auto next_highlighter = self->m_highlighter->create_background_highlighter())
+                    self->enqueue_background_rehighlight(next_highlighter.release_nonnull(), generation, {});
+            }
+            return {};
+        });
 }
 
 Syntax::Highlighter const* TextEditor::syntax_highlighter() const
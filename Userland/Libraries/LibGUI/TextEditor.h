@@ -121,8 +121,8 @@ public:
     size_t line_count() const { return document().line_count(); }
     TextDocumentLine& line(size_t index) { return document().line(index); }
     TextDocumentLine const& line(size_t index) const { return document().line(index); }
-    NonnullOwnPtrVector<TextDocumentLine>& lines() { return document().lines(); }
-    NonnullOwnPtrVector<TextDocumentLine> const& lines() const { return document().lines(); }
+    TextLineGapBuffer& lines() { return document().lines(); }
+    TextLineGapBuffer const& lines() const { return document().lines(); }
     int line_height() const;
     TextPosition cursor() const { return m_cursor; }
     TextRange normalized_selection() const { return m_selection.normalized(); }
@@ -345,6 +345,7 @@ private:
 
     Gfx::IntRect line_content_rect(size_t item_index) const;
     Gfx::IntRect line_widget_rect(size_t line_index) const;
+    Gfx::IntRect cursor_widget_rect() const;
     void delete_selection();
     int content_x_for_position(TextPosition const&) const;
     Gfx::IntRect ruler_rect_in_inner_coordinates() const;
@@ -353,6 +354,7 @@ private:
     void recompute_all_visual_lines();
     void ensure_cursor_is_valid();
     void rehighlight_if_needed();
+    void enqueue_background_rehighlight(NonnullOwnPtr<Syntax::Highlighter>, unsigned generation, Optional<size_t> last_line);
 
     size_t visual_line_containing(size_t line_index, size_t column) const;
     void recompute_visual_lines(size_t line_index);
@@ -383,6 +385,7 @@ private:
     bool m_ruler_visible { false };
     bool m_gutter_visible { false };
     bool m_needs_rehighlight { false };
+    unsigned m_rehighlight_generation { 0 };
     bool m_automatic_indentation_enabled { false };
     WrappingMode m_wrapping_mode { WrappingMode::NoWrap };
     bool m_visualize_trailing_whitespace { true };
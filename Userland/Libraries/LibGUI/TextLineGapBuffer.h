@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+#include <LibGUI/Forward.h>
+
+namespace GUI {
+
+// Stores the document's lines in a gap buffer: the line pointers live in one
+// buffer with a run of unused slots (the "gap") kept at the last edit
+// position. Edits first move the gap to the edit point, so consecutive
+// inserts and removes around the same spot - the common editing pattern -
+// shift no other lines, where a plain Vector would shift every line after
+// the edit point on each keystroke.
+class TextLineGapBuffer {
+public:
+    TextLineGapBuffer() = default;
+
+    size_t size() const { return m_buffer.size() - m_gap_size; }
+    bool is_empty() const { return size() == 0; }
+
+    TextDocumentLine& at(size_t index) { return *m_buffer[physical_index(index)]; }
+    TextDocumentLine const& at(size_t index) const { return *m_buffer[physical_index(index)]; }
+    TextDocumentLine& operator[](size_t index) { return at(index); }
+    TextDocumentLine const& operator[](size_t index) const { return at(index); }
+
+    TextDocumentLine& first() { return at(0); }
+    TextDocumentLine const& first() const { return at(0); }
+    TextDocumentLine& last() { return at(size() - 1); }
+    TextDocumentLine const& last() const { return at(size() - 1); }
+
+    void append(NonnullOwnPtr<TextDocumentLine> line) { insert(size(), move(line)); }
+
+    void insert(size_t index, NonnullOwnPtr<TextDocumentLine> line)
+    {
+        VERIFY(index <= size());
+        if (m_gap_size == 0)
+            regrow_gap_at(index);
+        else
+            move_gap_to(index);
+        m_buffer[m_gap_start] = move(line);
+        ++m_gap_start;
+        --m_gap_size;
+    }
+
+    NonnullOwnPtr<TextDocumentLine> take(size_t index)
+    {
+        VERIFY(index < size());
+        move_gap_to(index);
+        auto line = m_buffer[m_gap_start + m_gap_size].release_nonnull();
+        ++m_gap_size;
+        return line;
+    }
+
+    NonnullOwnPtr<TextDocumentLine> take_last() { return take(size() - 1); }
+    void remove(size_t index) { (void)take(index); }
+
+    void clear()
+    {
+        m_buffer.clear();
+        m_gap_start = 0;
+        m_gap_size = 0;
+    }
+
+    template<bool IsConst>
+    class IteratorImpl {
+    public:
+        friend TextLineGapBuffer;
+        using BufferType = Conditional<IsConst, TextLineGapBuffer const, TextLineGapBuffer>;
+        using ValueType = Conditional<IsConst, TextDocumentLine const, TextDocumentLine>;
+
+        ValueType& operator*() const { return m_buffer->at(m_index); }
+        ValueType* operator->() const { return &m_buffer->at(m_index); }
+
+        IteratorImpl& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+        IteratorImpl& operator--()
+        {
+            --m_index;
+            return *this;
+        }
+        IteratorImpl operator+(ptrdiff_t delta) const { return { *m_buffer, static_cast<size_t>(static_cast<ptrdiff_t>(m_index) + delta) }; }
+        IteratorImpl operator-(ptrdiff_t delta) const { return { *m_buffer, static_cast<size_t>(static_cast<ptrdiff_t>(m_index) - delta) }; }
+        ptrdiff_t operator-(IteratorImpl const& other) const { return static_cast<ptrdiff_t>(m_index) - static_cast<ptrdiff_t>(other.m_index); }
+
+        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index; }
+        bool operator!=(IteratorImpl const& other) const { return m_index != other.m_index; }
+        bool operator<(IteratorImpl const& other) const { return m_index < other.m_index; }
+        bool operator>(IteratorImpl const& other) const { return m_index > other.m_index; }
+        bool operator<=(IteratorImpl const& other) const { return m_index <= other.m_index; }
+        bool operator>=(IteratorImpl const& other) const { return m_index >= other.m_index; }
+
+    private:
+        IteratorImpl(BufferType& buffer, size_t index)
+            : m_buffer(&buffer)
+            , m_index(index)
+        {
+        }
+
+        BufferType* m_buffer { nullptr };
+        size_t m_index { 0 };
+    };
+
+    using Iterator = IteratorImpl<false>;
+    using ConstIterator = IteratorImpl<true>;
+
+    Iterator begin() { return { *this, 0 }; }
+    Iterator end() { return { *this, size() }; }
+    ConstIterator begin() const { return { *this, 0 }; }
+    ConstIterator end() const { return { *this, size() }; }
+
+private:
+    size_t physical_index(size_t logical_index) const
+    {
+        return logical_index < m_gap_start ? logical_index : logical_index + m_gap_size;
+    }
+
+    void move_gap_to(size_t index)
+    {
+        if (index == m_gap_start)
+            return;
+        if (index < m_gap_start) {
+            for (size_t i = m_gap_start; i > index; --i)
+                m_buffer[i - 1 + m_gap_size] = move(m_buffer[i - 1]);
+        } else {
+            for (size_t i = m_gap_start; i < index; ++i)
+                m_buffer[i] = move(m_buffer[i + m_gap_size]);
+        }
+        m_gap_start = index;
+    }
+
+    // Rebuilds the buffer with a fresh gap at the given index, sized
+    // proportionally to the line count so large documents do not regrow on
+    // every few inserts.
+    void regrow_gap_at(size_t index)
+    {
+        size_t new_gap_size = max(static_cast<size_t>(16), size() / 8);
+        Vector<OwnPtr<TextDocumentLine>> new_buffer;
+        new_buffer.ensure_capacity(size() + new_gap_size);
+        for (size_t i = 0; i < index; ++i)
+            new_buffer.unchecked_append(move(m_buffer[physical_index(i)]));
+        for (size_t i = 0; i < new_gap_size; ++i)
+            new_buffer.unchecked_append(nullptr);
+        for (size_t i = index; i < size(); ++i)
+            new_buffer.unchecked_append(move(m_buffer[physical_index(i)]));
+        m_buffer = move(new_buffer);
+        m_gap_start = index;
+        m_gap_size = new_gap_size;
+    }
+
+    Vector<OwnPtr<TextDocumentLine>> m_buffer;
+    size_t m_gap_start { 0 };
+    size_t m_gap_size { 0 };
+};
+
+}
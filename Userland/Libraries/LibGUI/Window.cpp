@@ -24,6 +24,7 @@
 #include <LibGUI/Widget.h>
 #include <LibGUI/Window.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/DisjointRectSet.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -201,6 +202,8 @@ void Window::server_did_destroy()
     m_window_id = 0;
     m_visible = false;
     m_pending_paint_event_rects.clear();
+    m_rects_being_painted.clear();
+    m_shifted_rects_to_flush.clear();
     m_back_store = nullptr;
     m_front_store = nullptr;
     m_cursor = Gfx::StandardCursor::None;
@@ -424,6 +427,15 @@ void Window::handle_multi_paint_event(MultiPaintEvent& event)
     }
     VERIFY(!rects.is_empty());
 
+    if (!m_rects_being_painted.is_empty()) {
+        // WindowServer coalesces invalidations, so the rects we receive may not
+        // match the ones we sent; drop everything this paint covers.
+        Gfx::DisjointIntRectSet received_rects;
+        for (auto& rect : rects)
+            received_rects.add(rect);
+        m_rects_being_painted.remove_all_matching([&](auto& rect) { return received_rects.contains(rect); });
+    }
+
     // Throw away our backing store if its size is different, and we've stopped resizing or double buffering is disabled.
     // This ensures that we shrink the backing store after a resize, and that we do not get flickering artifacts when
     // directly painting into a shared active backing store.
@@ -462,12 +474,20 @@ void Window::handle_multi_paint_event(MultiPaintEvent& event)
     if (created_new_backing_store) {
         rects.clear();
         rects.append({ {}, event.window_size() });
+        m_rects_being_painted.clear();
+        m_shifted_rects_to_flush.clear();
     }
 
     for (auto& rect : rects) {
         PaintEvent paint_event(rect);
         m_main_widget->dispatch_event(paint_event, this);
     }
+
+    // Contents that were shifted into place by shift_backing_store_contents()
+    // don't need repainting, but they do have to reach the screen.
+    if (!m_shifted_rects_to_flush.is_empty())
+        rects.extend(move(m_shifted_rects_to_flush));
+
     m_back_store->set_visible_size(event.window_size());
 
     if (m_double_buffering_enabled)
@@ -762,6 +782,7 @@ void Window::force_update()
     if (!is_visible())
         return;
     auto rect = this->rect();
+    m_rects_being_painted.append({ 0, 0, rect.width(), rect.height() });
     ConnectionToWindowServer::the().async_invalidate_rect(m_window_id, { { 0, 0, rect.width(), rect.height() } }, true);
 }
 
@@ -782,12 +803,59 @@ void Window::update(Gfx::IntRect const& a_rect)
             auto rects = move(m_pending_paint_event_rects);
             if (rects.is_empty())
                 return;
+            m_rects_being_painted.extend(rects);
             ConnectionToWindowServer::the().async_invalidate_rect(m_window_id, rects, false);
         });
     }
     m_pending_paint_event_rects.append(a_rect);
 }
 
+bool Window::shift_backing_store_contents(Gfx::IntRect const& a_region, Gfx::IntPoint delta)
+{
+    if (!is_visible() || !m_double_buffering_enabled || !m_back_store)
+        return false;
+    // Only a purely horizontal or vertical shift leaves a single exposed strip behind.
+    if (delta.is_zero() || (delta.x() != 0 && delta.y() != 0))
+        return false;
+    auto region = a_region.intersected(rect());
+    auto source_rect = region.translated(-delta).intersected(region);
+    if (source_rect.is_empty())
+        return false;
+    // If any part of the region is waiting on a repaint, the pixels we would
+    // shift are stale; let the caller repaint the whole region instead.
+    for (auto& pending_rect : m_pending_paint_event_rects) {
+        if (pending_rect.intersects(region))
+            return false;
+    }
+    for (auto& rect : m_rects_being_painted) {
+        if (rect.intersects(region))
+            return false;
+    }
+
+    bool was_purged = false;
+    if (!m_back_store->bitmap().set_nonvolatile(was_purged) || was_purged)
+        return false;
+
+    // The back store holds a full copy of the previous frame (flip() keeps it
+    // in sync), so we can move rows around in it directly. Pick the copy
+    // direction so overlapping rows are read before they're overwritten.
+    auto& bitmap = m_back_store->bitmap();
+    auto destination_rect = source_rect.translated(delta);
+    size_t row_length_in_bytes = source_rect.width() * sizeof(Gfx::ARGB32);
+    if (delta.y() <= 0) {
+        for (int row = 0; row < source_rect.height(); ++row)
+            memmove(bitmap.scanline(destination_rect.top() + row) + destination_rect.left(), bitmap.scanline(source_rect.top() + row) + source_rect.left(), row_length_in_bytes);
+    } else {
+        for (int row = source_rect.height() - 1; row >= 0; --row)
+            memmove(bitmap.scanline(destination_rect.top() + row) + destination_rect.left(), bitmap.scanline(source_rect.top() + row) + source_rect.left(), row_length_in_bytes);
+    }
+
+    m_shifted_rects_to_flush.append(destination_rect);
+    for (auto& exposed_rect : region.shatter(destination_rect))
+        update(exposed_rect);
+    return true;
+}
+
 void Window::set_main_widget(Widget* widget)
 {
     if (m_main_widget == widget)
@@ -864,6 +932,8 @@ void Window::set_has_alpha_channel(bool value)
         return;
 
     m_pending_paint_event_rects.clear();
+    m_rects_being_painted.clear();
+    m_shifted_rects_to_flush.clear();
     m_back_store = nullptr;
     m_front_store = nullptr;
 
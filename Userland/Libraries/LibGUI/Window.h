@@ -163,6 +163,13 @@ public:
     void update();
     void update(Gfx::IntRect const&);
 
+    // Shifts already-painted pixels within `region` by `delta` and schedules a
+    // repaint for the strip this exposes, so scrolling doesn't have to repaint
+    // the entire region. Returns false if the contents could not be shifted
+    // (e.g. part of the region is still waiting on a repaint); the caller is
+    // then responsible for invalidating the whole region itself.
+    bool shift_backing_store_contents(Gfx::IntRect const& region, Gfx::IntPoint delta);
+
     void set_automatic_cursor_tracking_widget(Widget*);
     Widget* automatic_cursor_tracking_widget() { return m_automatic_cursor_tracking_widget.ptr(); }
     Widget const* automatic_cursor_tracking_widget() const { return m_automatic_cursor_tracking_widget.ptr(); }
@@ -292,6 +299,12 @@ private:
     Gfx::IntSize m_minimum_size_when_windowless { 0, 0 };
     DeprecatedString m_title_when_windowless;
     Vector<Gfx::IntRect, 32> m_pending_paint_event_rects;
+    // Rects we've asked WindowServer to repaint but haven't received a paint event for yet.
+    Vector<Gfx::IntRect, 32> m_rects_being_painted;
+    // Rects whose back store contents are already up to date (because
+    // shift_backing_store_contents() copied them into place) and only need to
+    // be flushed to the screen along with the next paint.
+    Vector<Gfx::IntRect, 32> m_shifted_rects_to_flush;
     Gfx::IntSize m_size_increment;
     Gfx::IntSize m_base_size;
     WindowType m_window_type { WindowType::Normal };
@@ -34,9 +34,22 @@ public:
     {
         DisjointRectSet rects;
         rects.m_rects = m_rects;
+        rects.m_fragmentation_threshold = m_fragmentation_threshold;
         return rects;
     }
 
+    // Allows the set to over-approximate: once it fragments into more than the
+    // given number of rects, it collapses to the bounding box of its contents.
+    // This bounds the quadratic shatter/coalesce work on pathological damage
+    // patterns (e.g. blinking cursors in many terminals), at the cost of
+    // covering some area that was never added. It must stay off (the default)
+    // for sets whose exact coverage matters, such as opacity tracking.
+    void set_fragmentation_threshold(size_t maximum_rect_count)
+    {
+        m_fragmentation_threshold = maximum_rect_count;
+        enforce_fragmentation_threshold();
+    }
+
     void move_by(T dx, T dy)
     {
         for (auto& r : m_rects)
@@ -49,20 +62,36 @@ public:
 
     void add(Rect<T> const& rect)
     {
-        if (add_no_shatter(rect) && m_rects.size() > 1)
+        auto result = add_no_shatter(rect);
+        if (result == AddResult::NotAdded || m_rects.size() <= 1)
+            return;
+        // Only an overlap with an existing rect requires shattering; a
+        // disjoint rect (the common case for damage in unrelated windows)
+        // just needs a chance to coalesce with its neighbors.
+        if (result == AddResult::AddedOverlapping)
             shatter();
+        coalesce();
+        enforce_fragmentation_threshold();
     }
 
     template<typename Container>
     void add_many(Container const& rects)
     {
         bool added = false;
+        bool any_overlapping = false;
         for (auto const& rect : rects) {
-            if (add_no_shatter(rect))
+            auto result = add_no_shatter(rect);
+            if (result != AddResult::NotAdded)
                 added = true;
+            if (result == AddResult::AddedOverlapping)
+                any_overlapping = true;
+        }
+        if (added && m_rects.size() > 1) {
+            if (any_overlapping)
+                shatter();
+            coalesce();
+            enforce_fragmentation_threshold();
         }
-        if (added && m_rects.size() > 1)
-            shatter();
     }
 
     void add(DisjointRectSet const& rect_set)
@@ -71,6 +100,7 @@ public:
             return;
         if (m_rects.is_empty()) {
             m_rects = rect_set.m_rects;
+            enforce_fragmentation_threshold();
         } else {
             add_many(rect_set.rects());
         }
@@ -241,17 +271,37 @@ public:
     }
 
 private:
-    bool add_no_shatter(Rect<T> const& new_rect)
+    enum class AddResult {
+        NotAdded,
+        AddedDisjoint,
+        AddedOverlapping,
+    };
+
+    AddResult add_no_shatter(Rect<T> const& new_rect)
     {
         if (new_rect.is_empty())
-            return false;
+            return AddResult::NotAdded;
+        bool overlaps_existing_rect = false;
         for (auto& rect : m_rects) {
             if (rect.contains(new_rect))
-                return false;
+                return AddResult::NotAdded;
+            if (rect.intersects(new_rect))
+                overlaps_existing_rect = true;
         }
 
         m_rects.append(new_rect);
-        return true;
+        return overlaps_existing_rect ? AddResult::AddedOverlapping : AddResult::AddedDisjoint;
+    }
+
+    void enforce_fragmentation_threshold()
+    {
+        if (m_fragmentation_threshold == 0 || m_rects.size() <= m_fragmentation_threshold)
+            return;
+        auto bounding_box = m_rects.first();
+        for (size_t i = 1; i < m_rects.size(); ++i)
+            bounding_box = bounding_box.united(m_rects[i]);
+        m_rects.clear_with_capacity();
+        m_rects.append(bounding_box);
     }
 
     void shatter()
@@ -286,7 +336,32 @@ private:
         } while (pass_had_intersections);
     }
 
+    // Merges any two rects that tile a larger rect exactly, e.g. the shards
+    // left behind by shatter(). Keeping the set small means fewer (and larger)
+    // rects for users such as the compositor to iterate and paint.
+    void coalesce()
+    {
+        bool merged_any;
+        do {
+            merged_any = false;
+            for (size_t i = 0; i < m_rects.size() && !merged_any; ++i) {
+                for (size_t j = i + 1; j < m_rects.size(); ++j) {
+                    auto united = m_rects[i].united(m_rects[j]);
+                    if (united.size().area() != m_rects[i].size().area() + m_rects[j].size().area())
+                        continue;
+                    // The rects are disjoint and their areas add up to the area
+                    // of their bounding box, so they tile it exactly.
+                    m_rects[i] = united;
+                    m_rects.remove(j);
+                    merged_any = true;
+                    break;
+                }
+            }
+        } while (merged_any);
+    }
+
     Vector<Rect<T>, 32> m_rects;
+    size_t m_fragmentation_threshold { 0 };
 };
 
 }
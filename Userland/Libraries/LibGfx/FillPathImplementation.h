@@ -7,7 +7,7 @@
 #pragma once
 
 #include <AK/Debug.h>
-#include <AK/QuickSort.h>
+#include <AK/InsertionSort.h>
 #include <LibGfx/Color.h>
 #include <LibGfx/Painter.h>
 #include <LibGfx/Path.h>
@@ -47,9 +47,22 @@ void fill_path(Painter& painter, Path const& path, ColorFunction color_function,
     using GridCoordinateType = Conditional<fill_path_mode == FillPathMode::PlaceOnIntGrid, int, float>;
     using PointType = Point<GridCoordinateType>;
 
+    // Filling with a plain Color (rather than a sampling function) lets span
+    // interiors go through the painter's scanline fill instead of pixel by
+    // pixel through set_pixel().
+    constexpr bool has_constant_color = IsSame<ColorFunction, Color>;
+
+    const auto draw_offset = offset.value_or({ 0, 0 });
+    const auto draw_origin = (path.bounding_box().top_left() + draw_offset).to_type<int>();
+
+    auto color_at = [&](IntPoint point) {
+        if constexpr (has_constant_color)
+            return color_function;
+        else
+            return color_function(point);
+    };
+
     auto draw_scanline = [&](int y, float x1, float x2) {
-        const auto draw_offset = offset.value_or({ 0, 0 });
-        const auto draw_origin = (path.bounding_box().top_left() + draw_offset).to_type<int>();
         // FIMXE: Offset is added here to handle floating point translations in the AA painter,
         // really this should be done there but this function is a bit too specialised.
         y = floorf(y + draw_offset.y());
@@ -60,20 +73,32 @@ void fill_path(Painter& painter, Path const& path, ColorFunction color_function,
         auto set_pixel = [&](int x, int y, Color color) {
             painter.set_pixel(x, y, color, true);
         };
+        auto fill_span = [&](int x1, int x2, int y) {
+            if (x1 >= x2)
+                return;
+            if constexpr (has_constant_color) {
+                // set_pixel() deliberately does not scale the pixel, so only
+                // hand whole spans to fill_rect() when the two agree.
+                if (painter.scale() == 1) {
+                    painter.fill_rect({ x1, y, x2 - x1, 1 }, color_function);
+                    return;
+                }
+            }
+            for (int x = x1; x < x2; x++)
+                set_pixel(x, y, color_at(IntPoint(x, y) - draw_origin));
+        };
         if constexpr (fill_path_mode == FillPathMode::AllowFloatingPoints) {
             int int_x1 = ceilf(x1);
             int int_x2 = floorf(x2);
             float left_subpixel = int_x1 - x1;
             float right_subpixel = x2 - int_x2;
-            auto left_color = color_function(IntPoint(int_x1 - 1, y) - draw_origin);
-            auto right_color = color_function(IntPoint(int_x2, y) - draw_origin);
+            auto left_color = color_at(IntPoint(int_x1 - 1, y) - draw_origin);
+            auto right_color = color_at(IntPoint(int_x2, y) - draw_origin);
             set_pixel(int_x1 - 1, y, left_color.with_alpha(left_color.alpha() * left_subpixel));
             set_pixel(int_x2, y, right_color.with_alpha(right_color.alpha() * right_subpixel));
-            for (int x = int_x1; x < int_x2; x++)
-                set_pixel(x, y, color_function(IntPoint(x, y) - draw_origin));
+            fill_span(int_x1, int_x2, y);
         } else {
-            for (int x = x1; x < int(x2); x++)
-                set_pixel(x, y, color_function(IntPoint(x, y) - draw_origin));
+            fill_span(static_cast<int>(x1), static_cast<int>(x2), y);
         }
     };
 
@@ -129,8 +154,10 @@ void fill_path(Painter& painter, Path const& path, ColorFunction color_function,
     while (scanline >= last_y) {
         Optional<PointType> previous_to;
         if (active_list.size()) {
-            // sort the active list by 'x' from right to left
-            quick_sort(active_list, [](auto const& line0, auto const& line1) {
+            // Sort the active list by 'x' from right to left. The ordering
+            // barely changes between two scanlines, so insertion sort over the
+            // almost-sorted list beats re-running quicksort every line.
+            insertion_sort(active_list, [](auto const& line0, auto const& line1) {
                 return line1.x < line0.x;
             });
             if constexpr (fill_path_mode == FillPathMode::PlaceOnIntGrid && FILL_PATH_DEBUG) {
@@ -32,6 +32,11 @@ ScaledFont::ScaledFont(NonnullRefPtr<VectorFont> font, float point_width, float
     };
 }
 
+u32 ScaledFont::glyph_id_for_code_point(u32 code_point) const
+{
+    return m_cached_glyph_indices.ensure(code_point, [&] { return m_font->glyph_id_for_code_point(code_point); });
+}
+
 float ScaledFont::width(StringView view) const { return unicode_view_width(Utf8View(view)); }
 float ScaledFont::width(Utf8View const& view) const { return unicode_view_width(view); }
 float ScaledFont::width(Utf32View const& view) const { return unicode_view_width(view); }
@@ -63,12 +68,25 @@ ALWAYS_INLINE float ScaledFont::unicode_view_width(T const& view) const
 RefPtr<Gfx::Bitmap> ScaledFont::rasterize_glyph(u32 glyph_id, GlyphSubpixelOffset subpixel_offset) const
 {
     GlyphIndexWithSubpixelOffset index { glyph_id, subpixel_offset };
-    auto glyph_iterator = m_cached_glyph_bitmaps.find(index);
-    if (glyph_iterator != m_cached_glyph_bitmaps.end())
-        return glyph_iterator->value;
+    if (auto glyph_iterator = m_cached_glyph_bitmaps.find(index); glyph_iterator != m_cached_glyph_bitmaps.end()) {
+        glyph_iterator->value.last_used = ++m_glyph_bitmap_cache_use_counter;
+        return glyph_iterator->value.bitmap;
+    }
+
+    // Cap the cache so a glyph-heavy workload (every glyph times every
+    // subpixel bucket) cannot grow it without bound, evicting the bitmap
+    // that has gone unused the longest.
+    if (m_cached_glyph_bitmaps.size() >= maximum_cached_glyph_bitmap_count) {
+        auto least_recently_used = m_cached_glyph_bitmaps.begin();
+        for (auto it = m_cached_glyph_bitmaps.begin(); it != m_cached_glyph_bitmaps.end(); ++it) {
+            if (it->value.last_used < least_recently_used->value.last_used)
+                least_recently_used = it;
+        }
+        m_cached_glyph_bitmaps.remove(least_recently_used);
+    }
 
     auto glyph_bitmap = m_font->rasterize_glyph(glyph_id, m_x_scale, m_y_scale, subpixel_offset);
-    m_cached_glyph_bitmaps.set(index, glyph_bitmap);
+    m_cached_glyph_bitmaps.set(index, { glyph_bitmap, ++m_glyph_bitmap_cache_use_counter });
     return glyph_bitmap;
 }
 
@@ -26,7 +26,7 @@ struct GlyphIndexWithSubpixelOffset {
 class ScaledFont final : public Gfx::Font {
 public:
     ScaledFont(NonnullRefPtr<VectorFont>, float point_width, float point_height, unsigned dpi_x = DEFAULT_DPI, unsigned dpi_y = DEFAULT_DPI);
-    u32 glyph_id_for_code_point(u32 code_point) const { return m_font->glyph_id_for_code_point(code_point); }
+    u32 glyph_id_for_code_point(u32 code_point) const;
     ScaledFontMetrics metrics() const { return m_font->metrics(m_x_scale, m_y_scale); }
     ScaledGlyphMetrics glyph_metrics(u32 glyph_id) const { return m_font->glyph_metrics(glyph_id, m_x_scale, m_y_scale); }
     RefPtr<Gfx::Bitmap> rasterize_glyph(u32 glyph_id, GlyphSubpixelOffset) const;
@@ -73,7 +73,14 @@ private:
     float m_y_scale { 0.0f };
     float m_point_width { 0.0f };
     float m_point_height { 0.0f };
-    mutable HashMap<GlyphIndexWithSubpixelOffset, RefPtr<Gfx::Bitmap>> m_cached_glyph_bitmaps;
+    struct CachedGlyphBitmap {
+        RefPtr<Gfx::Bitmap> bitmap;
+        u64 last_used { 0 };
+    };
+    static constexpr size_t maximum_cached_glyph_bitmap_count = 2048;
+    mutable HashMap<GlyphIndexWithSubpixelOffset, CachedGlyphBitmap> m_cached_glyph_bitmaps;
+    mutable u64 m_glyph_bitmap_cache_use_counter { 0 };
+    mutable HashMap<u32, u32> m_cached_glyph_indices;
     Gfx::FontPixelMetrics m_pixel_metrics;
 
     template<typename T>
@@ -63,8 +63,21 @@ RefPtr<Font> Typeface::get_font(float point_size, Font::AllowInexactSizeMatch al
 {
     VERIFY(point_size > 0);
 
-    if (m_vector_font)
-        return adopt_ref(*new Gfx::ScaledFont(*m_vector_font, point_size, point_size));
+    if (m_vector_font) {
+        if (auto it = m_cached_scaled_fonts.find(point_size); it != m_cached_scaled_fonts.end())
+            return it->value;
+
+        // Cache the ScaledFont, and with it the rasterized glyphs it
+        // accumulates, so every user of this typeface at the same size shares
+        // one glyph cache instead of re-rasterizing the outlines.
+        constexpr size_t max_cached_font_size_count = 64;
+        if (m_cached_scaled_fonts.size() > max_cached_font_size_count)
+            m_cached_scaled_fonts.remove(m_cached_scaled_fonts.begin());
+
+        auto font = adopt_ref(*new Gfx::ScaledFont(*m_vector_font, point_size, point_size));
+        m_cached_scaled_fonts.set(point_size, font);
+        return font;
+    }
 
     RefPtr<BitmapFont> best_match;
     int size = roundf(point_size);
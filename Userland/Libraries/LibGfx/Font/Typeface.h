@@ -8,10 +8,12 @@
 
 #include <AK/DeprecatedFlyString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/RefCounted.h>
 #include <AK/Vector.h>
 #include <LibGfx/Font/BitmapFont.h>
 #include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/ScaledFont.h>
 #include <LibGfx/Font/VectorFont.h>
 
 namespace Gfx {
@@ -45,6 +47,8 @@ private:
 
     Vector<RefPtr<BitmapFont>> m_bitmap_fonts;
     RefPtr<VectorFont> m_vector_font;
+
+    mutable HashMap<float, NonnullRefPtr<ScaledFont>> m_cached_scaled_fonts;
 };
 
 }
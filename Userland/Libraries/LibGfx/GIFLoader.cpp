@@ -628,7 +628,7 @@ size_t GIFImageDecoderPlugin::frame_count()
     return m_context->images.size();
 }
 
-ErrorOr<ImageFrameDescriptor> GIFImageDecoderPlugin::frame(size_t index)
+ErrorOr<void> GIFImageDecoderPlugin::ensure_frame(size_t index)
 {
     if (m_context->error_state >= GIFLoadingContext::ErrorState::FailedToDecodeAnyFrame) {
         return Error::from_string_literal("GIFImageDecoderPlugin: Decoding failed");
@@ -655,14 +655,37 @@ ErrorOr<ImageFrameDescriptor> GIFImageDecoderPlugin::frame(size_t index)
         }
     }
 
+    return {};
+}
+
+static int duration_for_frame(GIFLoadingContext const& context, size_t index)
+{
+    int duration = context.images.at(index).duration * 10;
+    if (duration <= 10)
+        duration = 100;
+    return duration;
+}
+
+ErrorOr<ImageFrameDescriptor> GIFImageDecoderPlugin::frame(size_t index)
+{
+    TRY(ensure_frame(index));
+
     ImageFrameDescriptor frame {};
     frame.image = TRY(m_context->frame_buffer->clone());
-    frame.duration = m_context->images.at(index).duration * 10;
+    frame.duration = duration_for_frame(*m_context, index);
+    return frame;
+}
 
-    if (frame.duration <= 10) {
-        frame.duration = 100;
-    }
+ErrorOr<ImageFrameDescriptor> GIFImageDecoderPlugin::frame_for_playback(size_t index)
+{
+    TRY(ensure_frame(index));
 
+    // The retained canvas already has this frame's delta composited onto it,
+    // so hand it out as-is; a sequential advance then only costs the changed
+    // pixels instead of a decode plus a full-canvas copy.
+    ImageFrameDescriptor frame {};
+    frame.image = m_context->frame_buffer;
+    frame.duration = duration_for_frame(*m_context, index);
     return frame;
 }
 
@@ -40,6 +40,15 @@ public:
     virtual size_t loop_count() = 0;
     virtual size_t frame_count() = 0;
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index) = 0;
+
+    // Returns the frame like frame(), but a decoder that retains composited
+    // animation state between frames may hand out its internal frame buffer
+    // instead of a copy, making a sequential advance cost only the pixels that
+    // changed. The returned bitmap is then only valid until the next frame
+    // request, so this is only suitable for playback loops that repaint
+    // immediately and don't hold on to earlier frames.
+    virtual ErrorOr<ImageFrameDescriptor> frame_for_playback(size_t index) { return frame(index); }
+
     virtual ErrorOr<Optional<ReadonlyBytes>> icc_data() = 0;
 
 protected:
@@ -60,6 +69,7 @@ public:
     size_t loop_count() const { return m_plugin->loop_count(); }
     size_t frame_count() const { return m_plugin->frame_count(); }
     ErrorOr<ImageFrameDescriptor> frame(size_t index) const { return m_plugin->frame(index); }
+    ErrorOr<ImageFrameDescriptor> frame_for_playback(size_t index) const { return m_plugin->frame_for_playback(index); }
     ErrorOr<Optional<ReadonlyBytes>> icc_data() const { return m_plugin->icc_data(); }
 
 private:
@@ -15,6 +15,7 @@
 #include <AK/Try.h>
 #include <AK/Vector.h>
 #include <LibGfx/JPGLoader.h>
+#include <LibThreading/ThreadPool.h>
 
 #define JPG_INVALID 0X0000
 
@@ -846,9 +847,9 @@ static ErrorOr<void> skip_marker_with_length(AK::Stream& stream)
     return {};
 }
 
-static void dequantize(JPGLoadingContext& context, Vector<Macroblock>& macroblocks)
+static void dequantize(JPGLoadingContext& context, Vector<Macroblock>& macroblocks, u32 vcursor_begin, u32 vcursor_end)
 {
-    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
+    for (u32 vcursor = vcursor_begin; vcursor < vcursor_end; vcursor += context.vsample_factor) {
         for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
             for (u32 i = 0; i < context.component_count; i++) {
                 auto& component = context.components[i];
@@ -867,7 +868,7 @@ static void dequantize(JPGLoadingContext& context, Vector<Macroblock>& macrobloc
     }
 }
 
-static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks)
+static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks, u32 vcursor_begin, u32 vcursor_end)
 {
     static float const m0 = 2.0f * AK::cos(1.0f / 16.0f * 2.0f * AK::Pi<float>);
     static float const m1 = 2.0f * AK::cos(2.0f / 16.0f * 2.0f * AK::Pi<float>);
@@ -884,7 +885,7 @@ static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& ma
     static float const s6 = AK::cos(6.0f / 16.0f * AK::Pi<float>) / 2.0f;
     static float const s7 = AK::cos(7.0f / 16.0f * AK::Pi<float>) / 2.0f;
 
-    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
+    for (u32 vcursor = vcursor_begin; vcursor < vcursor_end; vcursor += context.vsample_factor) {
         for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
             for (u32 component_i = 0; component_i < context.component_count; component_i++) {
                 auto& component = context.components[component_i];
@@ -1034,9 +1035,9 @@ static void inverse_dct(JPGLoadingContext const& context, Vector<Macroblock>& ma
     }
 }
 
-static void ycbcr_to_rgb(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks)
+static void ycbcr_to_rgb(JPGLoadingContext const& context, Vector<Macroblock>& macroblocks, u32 vcursor_begin, u32 vcursor_end)
 {
-    for (u32 vcursor = 0; vcursor < context.mblock_meta.vcount; vcursor += context.vsample_factor) {
+    for (u32 vcursor = vcursor_begin; vcursor < vcursor_end; vcursor += context.vsample_factor) {
         for (u32 hcursor = 0; hcursor < context.mblock_meta.hcount; hcursor += context.hsample_factor) {
             const u32 chroma_block_index = vcursor * context.mblock_meta.hpadded_count + hcursor;
             Macroblock const& chroma = macroblocks[chroma_block_index];
@@ -1213,14 +1214,54 @@ static ErrorOr<void> decode_header(JPGLoadingContext& context)
     return {};
 }
 
+// Runs `process` over all MCU rows, split into contiguous ranges across the
+// shared thread pool. Ranges are aligned to the vertical sampling factor, so no
+// two ranges ever touch the same macroblocks.
+static void process_macroblock_rows_in_parallel(JPGLoadingContext const& context, Function<void(u32 vcursor_begin, u32 vcursor_end)> process)
+{
+    u32 const step = context.vsample_factor;
+    u32 const row_count = (context.mblock_meta.vcount + step - 1) / step;
+
+    // Keep enough rows per range that the fork/join overhead stays negligible.
+    static constexpr u32 minimum_rows_per_range = 16;
+    auto& pool = Threading::ThreadPool::the();
+    u32 const range_count = min<u32>(static_cast<u32>(pool.thread_count()) + 1, max<u32>(row_count / minimum_rows_per_range, 1));
+
+    if (range_count <= 1) {
+        process(0, context.mblock_meta.vcount);
+        return;
+    }
+
+    struct RowRange {
+        u32 vcursor_begin { 0 };
+        u32 vcursor_end { 0 };
+    };
+    u32 const rows_per_range = (row_count + range_count - 1) / range_count;
+    Vector<RowRange> ranges;
+    for (u32 i = 0; i < range_count; ++i) {
+        u32 const vcursor_begin = min(i * rows_per_range * step, context.mblock_meta.vcount);
+        u32 const vcursor_end = min((i + 1) * rows_per_range * step, context.mblock_meta.vcount);
+        if (vcursor_begin >= vcursor_end)
+            break;
+        ranges.append({ vcursor_begin, vcursor_end });
+    }
+    pool.parallel_for_each(ranges.span(), 1, [&process](RowRange const& range) {
+        process(range.vcursor_begin, range.vcursor_end);
+    });
+}
+
 static ErrorOr<void> decode_jpg(JPGLoadingContext& context)
 {
     TRY(decode_header(context));
     TRY(scan_huffman_stream(*context.stream, context));
     auto macroblocks = TRY(decode_huffman_stream(context));
-    dequantize(context, macroblocks);
-    inverse_dct(context, macroblocks);
-    ycbcr_to_rgb(context, macroblocks);
+    // Everything after entropy decoding works on independent MCU rows, so fan it
+    // out across the available processors.
+    process_macroblock_rows_in_parallel(context, [&](u32 vcursor_begin, u32 vcursor_end) {
+        dequantize(context, macroblocks, vcursor_begin, vcursor_end);
+        inverse_dct(context, macroblocks, vcursor_begin, vcursor_end);
+        ycbcr_to_rgb(context, macroblocks, vcursor_begin, vcursor_end);
+    });
     TRY(compose_bitmap(context, macroblocks));
     context.stream.clear();
     return {};
@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <AK/Endian.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Vector.h>
 #include <LibCompress/Zlib.h>
 #include <LibGfx/PNGLoader.h>
@@ -211,54 +212,113 @@ union [[gnu::packed]] Pixel {
 };
 static_assert(AssertSize<Pixel, 4>());
 
-static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data, u8 bytes_per_complete_pixel)
+ALWAYS_INLINE static AK::SIMD::u8x4 simd_load4(u8 const* data)
+{
+    AK::SIMD::u8x4 value;
+    __builtin_memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+ALWAYS_INLINE static void simd_store4(u8* data, AK::SIMD::u8x4 value)
+{
+    __builtin_memcpy(data, &value, sizeof(value));
+}
+
+ALWAYS_INLINE static AK::SIMD::u8x16 simd_load16(u8 const* data)
+{
+    AK::SIMD::u8x16 value;
+    __builtin_memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+ALWAYS_INLINE static void simd_store16(u8* data, AK::SIMD::u8x16 value)
+{
+    __builtin_memcpy(data, &value, sizeof(value));
+}
+
+// Unfiltering walks the scanline with a left/above/upper-left window, so the
+// pixel size is a template parameter: the compiler keeps the window in
+// registers and fully unrolls the per-pixel byte loops. Four-byte pixels (the
+// common truecolor-with-alpha case) additionally handle a whole pixel per
+// step with u8x4 vectors, mirroring the filter kernels in PNGWriter.
+template<size_t bytes_per_complete_pixel>
+static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data)
 {
     VERIFY(filter != PNG::FilterType::None);
+    VERIFY(scanline_data.size() % bytes_per_complete_pixel == 0);
 
     switch (filter) {
     case PNG::FilterType::Sub:
-        // This loop starts at bytes_per_complete_pixel because all bytes before that are
-        // guaranteed to have no valid byte at index (i - bytes_per_complete pixel).
-        // All such invalid byte indexes should be treated as 0, and adding 0 to the current
-        // byte would do nothing, so the first bytes_per_complete_pixel bytes can instead
-        // just be skipped.
-        for (size_t i = bytes_per_complete_pixel; i < scanline_data.size(); ++i) {
-            u8 left = scanline_data[i - bytes_per_complete_pixel];
-            scanline_data[i] += left;
+        if constexpr (bytes_per_complete_pixel == 4) {
+            auto left = AK::SIMD::u8x4 {};
+            for (size_t i = 0; i < scanline_data.size(); i += 4) {
+                auto pixel = simd_load4(scanline_data.data() + i) + left;
+                simd_store4(scanline_data.data() + i, pixel);
+                left = pixel;
+            }
+        } else {
+            // This loop starts at bytes_per_complete_pixel because all bytes before that are
+            // guaranteed to have no valid byte at index (i - bytes_per_complete pixel).
+            // All such invalid byte indexes should be treated as 0, and adding 0 to the current
+            // byte would do nothing, so the first bytes_per_complete_pixel bytes can instead
+            // just be skipped.
+            for (size_t i = bytes_per_complete_pixel; i < scanline_data.size(); ++i) {
+                u8 left = scanline_data[i - bytes_per_complete_pixel];
+                scanline_data[i] += left;
+            }
         }
         break;
-    case PNG::FilterType::Up:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
+    case PNG::FilterType::Up: {
+        // Every byte only depends on the one directly above it, so this is a
+        // plain bytewise add over the whole scanline.
+        size_t i = 0;
+        for (; i + 16 <= scanline_data.size(); i += 16) {
+            auto pixels = simd_load16(scanline_data.data() + i) + simd_load16(previous_scanlines_data.data() + i);
+            simd_store16(scanline_data.data() + i, pixels);
+        }
+        for (; i < scanline_data.size(); ++i) {
             u8 above = previous_scanlines_data[i];
             scanline_data[i] += above;
         }
         break;
+    }
     case PNG::FilterType::Average:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
-            u32 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
-            u32 above = previous_scanlines_data[i];
-            u8 average = (left + above) / 2;
-            scanline_data[i] += average;
+        if constexpr (bytes_per_complete_pixel == 4) {
+            auto left = AK::SIMD::u8x4 {};
+            for (size_t i = 0; i < scanline_data.size(); i += 4) {
+                auto above = simd_load4(previous_scanlines_data.data() + i);
+                auto sum = AK::SIMD::to_u16x4(left) + AK::SIMD::to_u16x4(above);
+                auto pixel = simd_load4(scanline_data.data() + i) + AK::SIMD::to_u8x4(sum / 2);
+                simd_store4(scanline_data.data() + i, pixel);
+                left = pixel;
+            }
+        } else {
+            for (size_t i = 0; i < scanline_data.size(); ++i) {
+                u32 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
+                u32 above = previous_scanlines_data[i];
+                u8 average = (left + above) / 2;
+                scanline_data[i] += average;
+            }
         }
         break;
     case PNG::FilterType::Paeth:
-        for (size_t i = 0; i < scanline_data.size(); ++i) {
-            u8 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
-            u8 above = previous_scanlines_data[i];
-            u8 upper_left = (i < bytes_per_complete_pixel) ? 0 : previous_scanlines_data[i - bytes_per_complete_pixel];
-            i32 predictor = left + above - upper_left;
-            u32 predictor_left = abs(predictor - left);
-            u32 predictor_above = abs(predictor - above);
-            u32 predictor_upper_left = abs(predictor - upper_left);
-            u8 nearest;
-            if (predictor_left <= predictor_above && predictor_left <= predictor_upper_left) {
-                nearest = left;
-            } else if (predictor_above <= predictor_upper_left) {
-                nearest = above;
-            } else {
-                nearest = upper_left;
+        if constexpr (bytes_per_complete_pixel == 4) {
+            auto left = AK::SIMD::u8x4 {};
+            auto upper_left = AK::SIMD::u8x4 {};
+            for (size_t i = 0; i < scanline_data.size(); i += 4) {
+                auto above = simd_load4(previous_scanlines_data.data() + i);
+                auto pixel = simd_load4(scanline_data.data() + i) + PNG::paeth_predictor(left, above, upper_left);
+                simd_store4(scanline_data.data() + i, pixel);
+                left = pixel;
+                upper_left = above;
+            }
+        } else {
+            for (size_t i = 0; i < scanline_data.size(); ++i) {
+                u8 left = (i < bytes_per_complete_pixel) ? 0 : scanline_data[i - bytes_per_complete_pixel];
+                u8 above = previous_scanlines_data[i];
+                u8 upper_left = (i < bytes_per_complete_pixel) ? 0 : previous_scanlines_data[i - bytes_per_complete_pixel];
+                scanline_data[i] += PNG::paeth_predictor(left, above, upper_left);
             }
-            scanline_data[i] += nearest;
         }
         break;
     default:
@@ -266,6 +326,26 @@ static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, Reado
     }
 }
 
+static void unfilter_scanline(PNG::FilterType filter, Bytes scanline_data, ReadonlyBytes previous_scanlines_data, u8 bytes_per_complete_pixel)
+{
+    switch (bytes_per_complete_pixel) {
+    case 1:
+        return unfilter_scanline<1>(filter, scanline_data, previous_scanlines_data);
+    case 2:
+        return unfilter_scanline<2>(filter, scanline_data, previous_scanlines_data);
+    case 3:
+        return unfilter_scanline<3>(filter, scanline_data, previous_scanlines_data);
+    case 4:
+        return unfilter_scanline<4>(filter, scanline_data, previous_scanlines_data);
+    case 6:
+        return unfilter_scanline<6>(filter, scanline_data, previous_scanlines_data);
+    case 8:
+        return unfilter_scanline<8>(filter, scanline_data, previous_scanlines_data);
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
 template<typename T>
 ALWAYS_INLINE static void unpack_grayscale_without_alpha(PNGLoadingContext& context)
 {
@@ -21,6 +21,7 @@
 #include <AK/Math.h>
 #include <AK/Memory.h>
 #include <AK/Queue.h>
+#include <AK/SIMD.h>
 #include <AK/QuickSort.h>
 #include <AK/StdLibExtras.h>
 #include <AK/StringBuilder.h>
@@ -46,6 +47,46 @@ static bool should_paint_as_space(u32 code_point)
     return is_ascii_space(code_point) || code_point == 0xa0;
 }
 
+// Blends `color` over `count` pixels of a scanline, four pixels at a time.
+// The vector fast path only covers fully opaque destination pixels, where
+// Color::blend() reduces to a single lerp per channel; anything else takes
+// the scalar path.
+static void fill_scanline_with_blended_color(ARGB32* dst, int count, Color color)
+{
+    using AK::SIMD::u8x16;
+    using AK::SIMD::u16x16;
+    using AK::SIMD::u32x4;
+
+    u16 const src_alpha = color.alpha();
+    u16 const inverse_src_alpha = 255 - src_alpha;
+
+    // Source contribution (channel * alpha) is constant across the span.
+    u16x16 src_contribution;
+    for (int slot = 0; slot < 16; slot += 4) {
+        src_contribution[slot + 0] = color.blue() * src_alpha;
+        src_contribution[slot + 1] = color.green() * src_alpha;
+        src_contribution[slot + 2] = color.red() * src_alpha;
+        src_contribution[slot + 3] = 0;
+    }
+
+    int x = 0;
+    for (; x + 4 <= count; x += 4) {
+        u32x4 pixels;
+        __builtin_memcpy(&pixels, &dst[x], sizeof(pixels));
+        auto alphas = pixels >> 24;
+        if ((alphas[0] & alphas[1] & alphas[2] & alphas[3]) != 0xff)
+            break;
+        auto widened = __builtin_convertvector((u8x16)pixels, u16x16);
+        auto blended = widened * inverse_src_alpha + src_contribution;
+        // Exact floor division by 255 for values up to 255 * 255.
+        blended = (blended + 1 + (blended >> 8)) >> 8;
+        auto narrowed = (u32x4)__builtin_convertvector(blended, u8x16) | 0xff000000;
+        __builtin_memcpy(&dst[x], &narrowed, sizeof(narrowed));
+    }
+    for (; x < count; ++x)
+        dst[x] = Color::from_argb(dst[x]).blend(color).value();
+}
+
 template<BitmapFormat format = BitmapFormat::Invalid>
 ALWAYS_INLINE Color get_pixel(Gfx::Bitmap const& bitmap, int x, int y)
 {
@@ -121,8 +162,7 @@ void Painter::fill_physical_rect(IntRect const& physical_rect, Color color)
     size_t const dst_skip = m_target->pitch() / sizeof(ARGB32);
 
     for (int i = physical_rect.height() - 1; i >= 0; --i) {
-        for (int j = 0; j < physical_rect.width(); ++j)
-            dst[j] = Color::from_argb(dst[j]).blend(color).value();
+        fill_scanline_with_blended_color(dst, physical_rect.width(), color);
         dst += dst_skip;
     }
 }
@@ -254,6 +294,46 @@ void Painter::fill_rect_with_gradient(Orientation orientation, IntRect const& a_
         fill_rect(a_rect, gradient_start);
         return;
     }
+
+    // Fast path for the fully-opaque two-color gradients the classic widget style paints
+    // constantly: mix each shade once per row (or once per column, for horizontal gradients)
+    // and fill whole spans with it, instead of sampling the general gradient machinery for
+    // every pixel.
+    if (draw_op() == DrawOp::Copy && gradient_start.alpha() == 0xff && gradient_end.alpha() == 0xff) {
+        auto rect = a_rect.translated(translation());
+        auto clipped_rect = rect.intersected(clip_rect());
+        if (clipped_rect.is_empty())
+            return;
+
+        auto physical_rect = rect * scale();
+        auto physical_clipped_rect = clipped_rect * scale();
+        ARGB32* dst = m_target->scanline(physical_clipped_rect.top()) + physical_clipped_rect.left();
+        size_t const dst_skip = m_target->pitch() / sizeof(ARGB32);
+
+        if (orientation == Orientation::Vertical) {
+            float increment = 1.0f / physical_rect.height();
+            int offset = physical_clipped_rect.top() - physical_rect.top();
+            for (int i = 0; i < physical_clipped_rect.height(); ++i) {
+                auto shade = gradient_start.mixed_with(gradient_end, (offset + i) * increment);
+                fast_u32_fill(dst, shade.value(), physical_clipped_rect.width());
+                dst += dst_skip;
+            }
+        } else {
+            float increment = 1.0f / physical_rect.width();
+            int offset = physical_clipped_rect.left() - physical_rect.left();
+            // Mix one row of shades, then copy it into the remaining rows.
+            Vector<ARGB32, 512> shades;
+            shades.resize(physical_clipped_rect.width());
+            for (int x = 0; x < physical_clipped_rect.width(); ++x)
+                shades[x] = gradient_start.mixed_with(gradient_end, (offset + x) * increment).value();
+            for (int i = 0; i < physical_clipped_rect.height(); ++i) {
+                memcpy(dst, shades.data(), shades.size() * sizeof(ARGB32));
+                dst += dst_skip;
+            }
+        }
+        return;
+    }
+
     return fill_rect_with_linear_gradient(a_rect, Array { ColorStop { gradient_start, 0 }, ColorStop { gradient_end, 1 } }, orientation == Orientation::Horizontal ? 90.0f : 0.0f);
 }
 
@@ -682,10 +762,22 @@ void Painter::draw_bitmap(IntPoint p, GlyphBitmap const& bitmap, Color color)
     size_t const dst_skip = m_target->pitch() / sizeof(ARGB32);
 
     if (scale == 1) {
+        // Process each row as one word of bits, and store opaque colors directly
+        // instead of reading back the destination for a no-op blend.
+        auto const color_value = color.value();
+        bool const color_is_opaque = color.alpha() == 0xff;
         for (int row = first_row; row <= last_row; ++row) {
-            for (int j = 0; j <= (last_column - first_column); ++j) {
-                if (bitmap.bit_at(j + first_column, row))
-                    dst[j] = Color::from_argb(dst[j]).blend(color).value();
+            auto row_bits = bitmap.row(row) >> first_column;
+            if (color_is_opaque) {
+                for (int j = 0; row_bits != 0 && j <= (last_column - first_column); ++j, row_bits >>= 1) {
+                    if (row_bits & 1)
+                        dst[j] = color_value;
+                }
+            } else {
+                for (int j = 0; row_bits != 0 && j <= (last_column - first_column); ++j, row_bits >>= 1) {
+                    if (row_bits & 1)
+                        dst[j] = Color::from_argb(dst[j]).blend(color).value();
+                }
             }
             dst += dst_skip;
         }
@@ -921,7 +1013,8 @@ void Painter::blit_with_opacity(IntPoint position, Gfx::Bitmap const& source, In
     }
 }
 
-void Painter::blit_filtered(IntPoint position, Gfx::Bitmap const& source, IntRect const& src_rect, Function<Color(Color)> filter)
+template<typename Filter>
+ALWAYS_INLINE void Painter::blit_filtered_impl(IntPoint position, Gfx::Bitmap const& source, IntRect const& src_rect, Filter&& filter)
 {
     VERIFY((source.scale() == 1 || source.scale() == scale()) && "blit_filtered only supports integer upsampling");
 
@@ -986,6 +1079,11 @@ void Painter::blit_filtered(IntPoint position, Gfx::Bitmap const& source, IntRec
     }
 }
 
+void Painter::blit_filtered(IntPoint position, Gfx::Bitmap const& source, IntRect const& src_rect, Function<Color(Color)> filter)
+{
+    blit_filtered_impl(position, source, src_rect, filter);
+}
+
 void Painter::blit_brightened(IntPoint position, Gfx::Bitmap const& source, IntRect const& src_rect)
 {
     return blit_filtered(position, source, src_rect, [](Color src) {
@@ -1160,6 +1258,27 @@ ALWAYS_INLINE static void do_draw_integer_scaled_bitmap(Gfx::Bitmap& target, Int
     }
 }
 
+// Blends the four neighboring texels with 8.8 fixed-point weights (0..256),
+// keeping the per-pixel loops free of floating point math.
+ALWAYS_INLINE static Color interpolate_pixels_fixed_point(Color top_left, Color top_right, Color bottom_left, Color bottom_right, u32 x_weight, u32 y_weight)
+{
+    u32 const inverse_x_weight = 256 - x_weight;
+    u32 const inverse_y_weight = 256 - y_weight;
+    u32 const top_left_weight = inverse_x_weight * inverse_y_weight;
+    u32 const top_right_weight = x_weight * inverse_y_weight;
+    u32 const bottom_left_weight = inverse_x_weight * y_weight;
+    u32 const bottom_right_weight = x_weight * y_weight;
+
+    auto mix_channel = [&](u32 top_left, u32 top_right, u32 bottom_left, u32 bottom_right) {
+        return static_cast<u8>((top_left * top_left_weight + top_right * top_right_weight + bottom_left * bottom_left_weight + bottom_right * bottom_right_weight + (1 << 15)) >> 16);
+    };
+    return Color(
+        mix_channel(top_left.red(), top_right.red(), bottom_left.red(), bottom_right.red()),
+        mix_channel(top_left.green(), top_right.green(), bottom_left.green(), bottom_right.green()),
+        mix_channel(top_left.blue(), top_right.blue(), bottom_left.blue(), bottom_right.blue()),
+        mix_channel(top_left.alpha(), top_right.alpha(), bottom_left.alpha(), bottom_right.alpha()));
+}
+
 template<bool has_alpha_channel, Painter::ScalingMode scaling_mode, typename GetPixel>
 ALWAYS_INLINE static void do_draw_scaled_bitmap(Gfx::Bitmap& target, IntRect const& dst_rect, IntRect const& clipped_rect, Gfx::Bitmap const& source, FloatRect const& src_rect, GetPixel get_pixel, float opacity)
 {
@@ -1189,6 +1308,35 @@ ALWAYS_INLINE static void do_draw_scaled_bitmap(Gfx::Bitmap& target, IntRect con
     }
 
     bool has_opacity = opacity != 1.0f;
+
+    if constexpr (scaling_mode == Painter::ScalingMode::BilinearBlend) {
+        // Exact 2x downscale of an unclipped, integer-aligned rect: average
+        // each 2x2 box of texels instead of running the generic sampler.
+        if (dst_rect == clipped_rect && int_src_rect == src_rect && clipped_src_rect == int_src_rect
+            && int_src_rect.width() == dst_rect.width() * 2 && int_src_rect.height() == dst_rect.height() * 2) {
+            for (int y = 0; y < dst_rect.height(); ++y) {
+                auto* scanline = (Color*)target.scanline(dst_rect.y() + y);
+                int src_y = int_src_rect.y() + y * 2;
+                for (int x = 0; x < dst_rect.width(); ++x) {
+                    int src_x = int_src_rect.x() + x * 2;
+                    auto src_pixel = interpolate_pixels_fixed_point(
+                        get_pixel(source, src_x, src_y),
+                        get_pixel(source, src_x + 1, src_y),
+                        get_pixel(source, src_x, src_y + 1),
+                        get_pixel(source, src_x + 1, src_y + 1),
+                        128, 128);
+                    if (has_opacity)
+                        src_pixel.set_alpha(src_pixel.alpha() * opacity);
+                    if constexpr (has_alpha_channel)
+                        scanline[dst_rect.x() + x] = scanline[dst_rect.x() + x].blend(src_pixel);
+                    else
+                        scanline[dst_rect.x() + x] = src_pixel;
+                }
+            }
+            return;
+        }
+    }
+
     i64 shift = (i64)1 << 32;
     i64 fractional_mask = (shift - (u64)1);
     i64 bilinear_offset_x = (1ll << 31) * (src_rect.width() / dst_rect.width() - 1);
@@ -1200,6 +1348,14 @@ ALWAYS_INLINE static void do_draw_scaled_bitmap(Gfx::Bitmap& target, IntRect con
     i64 clipped_src_bottom_shifted = (clipped_src_rect.y() + clipped_src_rect.height()) * shift;
     i64 clipped_src_right_shifted = (clipped_src_rect.x() + clipped_src_rect.width()) * shift;
 
+    // 8.8 fixed-point versions of dst/src for the SmoothPixels ratio scaling.
+    u32 smooth_x_factor = 0;
+    u32 smooth_y_factor = 0;
+    if constexpr (scaling_mode == Painter::ScalingMode::SmoothPixels) {
+        smooth_x_factor = static_cast<u32>(256.0f * dst_rect.width() / src_rect.width());
+        smooth_y_factor = static_cast<u32>(256.0f * dst_rect.height() / src_rect.height());
+    }
+
     for (int y = clipped_rect.top(); y <= clipped_rect.bottom(); ++y) {
         auto* scanline = (Color*)target.scanline(y);
         auto desired_y = ((y - dst_rect.y()) * vscale + src_top);
@@ -1221,39 +1377,30 @@ ALWAYS_INLINE static void do_draw_scaled_bitmap(Gfx::Bitmap& target, IntRect con
                 auto scaled_y0 = clamp(shifted_y >> 32, clipped_src_rect.top(), clipped_src_rect.bottom());
                 auto scaled_y1 = clamp((shifted_y >> 32) + 1, clipped_src_rect.top(), clipped_src_rect.bottom());
 
-                float x_ratio = (shifted_x & fractional_mask) / static_cast<float>(shift);
-                float y_ratio = (shifted_y & fractional_mask) / static_cast<float>(shift);
-
-                auto top_left = get_pixel(source, scaled_x0, scaled_y0);
-                auto top_right = get_pixel(source, scaled_x1, scaled_y0);
-                auto bottom_left = get_pixel(source, scaled_x0, scaled_y1);
-                auto bottom_right = get_pixel(source, scaled_x1, scaled_y1);
-
-                auto top = top_left.interpolate(top_right, x_ratio);
-                auto bottom = bottom_left.interpolate(bottom_right, x_ratio);
+                u32 x_weight = (shifted_x & fractional_mask) >> 24;
+                u32 y_weight = (shifted_y & fractional_mask) >> 24;
 
-                src_pixel = top.interpolate(bottom, y_ratio);
+                src_pixel = interpolate_pixels_fixed_point(
+                    get_pixel(source, scaled_x0, scaled_y0),
+                    get_pixel(source, scaled_x1, scaled_y0),
+                    get_pixel(source, scaled_x0, scaled_y1),
+                    get_pixel(source, scaled_x1, scaled_y1),
+                    x_weight, y_weight);
             } else if constexpr (scaling_mode == Painter::ScalingMode::SmoothPixels) {
                 auto scaled_x1 = clamp(desired_x >> 32, clipped_src_rect.left(), clipped_src_rect.right());
                 auto scaled_x0 = clamp(scaled_x1 - 1, clipped_src_rect.left(), clipped_src_rect.right());
                 auto scaled_y1 = clamp(desired_y >> 32, clipped_src_rect.top(), clipped_src_rect.bottom());
                 auto scaled_y0 = clamp(scaled_y1 - 1, clipped_src_rect.top(), clipped_src_rect.bottom());
 
-                float x_ratio = (desired_x & fractional_mask) / (float)shift;
-                float y_ratio = (desired_y & fractional_mask) / (float)shift;
-
-                float scaled_x_ratio = clamp(x_ratio * dst_rect.width() / (float)src_rect.width(), 0.0f, 1.0f);
-                float scaled_y_ratio = clamp(y_ratio * dst_rect.height() / (float)src_rect.height(), 0.0f, 1.0f);
-
-                auto top_left = get_pixel(source, scaled_x0, scaled_y0);
-                auto top_right = get_pixel(source, scaled_x1, scaled_y0);
-                auto bottom_left = get_pixel(source, scaled_x0, scaled_y1);
-                auto bottom_right = get_pixel(source, scaled_x1, scaled_y1);
-
-                auto top = top_left.interpolate(top_right, scaled_x_ratio);
-                auto bottom = bottom_left.interpolate(bottom_right, scaled_x_ratio);
+                u32 x_weight = min<u32>(256, (((desired_x & fractional_mask) >> 24) * smooth_x_factor) >> 8);
+                u32 y_weight = min<u32>(256, (((desired_y & fractional_mask) >> 24) * smooth_y_factor) >> 8);
 
-                src_pixel = top.interpolate(bottom, scaled_y_ratio);
+                src_pixel = interpolate_pixels_fixed_point(
+                    get_pixel(source, scaled_x0, scaled_y0),
+                    get_pixel(source, scaled_x1, scaled_y0),
+                    get_pixel(source, scaled_x0, scaled_y1),
+                    get_pixel(source, scaled_x1, scaled_y1),
+                    x_weight, y_weight);
             } else {
                 auto scaled_x = clamp(desired_x >> 32, clipped_src_rect.left(), clipped_src_rect.right());
                 auto scaled_y = clamp(desired_y >> 32, clipped_src_rect.top(), clipped_src_rect.bottom());
@@ -1368,7 +1515,9 @@ FLATTEN void Painter::draw_glyph(FloatPoint point, u32 code_point, Font const& f
     if (glyph.is_glyph_bitmap()) {
         draw_bitmap(top_left.to_type<int>(), glyph.glyph_bitmap(), color);
     } else {
-        blit_filtered(glyph_position.blit_position, *glyph.bitmap(), glyph.bitmap()->rect(), [color](Color pixel) -> Color {
+        // NOTE: Call through the template directly so the tint filter can be
+        //       inlined into the per-pixel loop.
+        blit_filtered_impl(glyph_position.blit_position, *glyph.bitmap(), glyph.bitmap()->rect(), [color](Color pixel) -> Color {
             return pixel.multiply(color);
         });
     }
@@ -2392,8 +2541,7 @@ void Painter::stroke_path(Path const& path, Color color, int thickness)
 void Painter::fill_path(Path const& path, Color color, WindingRule winding_rule)
 {
     VERIFY(scale() == 1); // FIXME: Add scaling support.
-    Detail::fill_path<Detail::FillPathMode::PlaceOnIntGrid>(
-        *this, path, [=](IntPoint) { return color; }, winding_rule);
+    Detail::fill_path<Detail::FillPathMode::PlaceOnIntGrid>(*this, path, color, winding_rule);
 }
 
 void Painter::fill_path(Path const& path, PaintStyle const& paint_style, Painter::WindingRule rule)
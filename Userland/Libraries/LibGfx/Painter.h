@@ -211,6 +211,8 @@ protected:
     Vector<State, 4> m_state_stack;
 
 private:
+    template<typename Filter>
+    void blit_filtered_impl(IntPoint, Gfx::Bitmap const&, IntRect const& src_rect, Filter&&);
     Vector<DirectionalRun> split_text_into_directional_runs(Utf8View const&, TextDirection initial_direction);
     bool text_contains_bidirectional_text(Utf8View const&, TextDirection);
     template<typename DrawGlyphFunction>
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/ParallelPainter.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Gfx {
+
+ParallelPainter::ParallelPainter(Bitmap& target)
+    : m_target(target)
+{
+}
+
+void ParallelPainter::queue_command(Function<void(Painter&)> command)
+{
+    m_commands.append(move(command));
+}
+
+void ParallelPainter::paint()
+{
+    if (m_commands.is_empty())
+        return;
+
+    auto& pool = Threading::ThreadPool::the();
+    size_t band_count = pool.thread_count() + 1;
+    int band_height = ceil_div(m_target.height(), static_cast<int>(band_count));
+
+    Vector<IntRect> bands;
+    for (size_t band_index = 0; band_index < band_count; ++band_index) {
+        auto band_rect = IntRect { 0, static_cast<int>(band_index) * band_height, m_target.width(), band_height }.intersected(m_target.rect());
+        if (!band_rect.is_empty())
+            bands.append(band_rect);
+    }
+
+    pool.parallel_for_each(bands.span(), 1, [&](IntRect const& band_rect) {
+        // Painters on the same bitmap don't share any state, and the band
+        // clip rects are disjoint, so the workers never write the same pixel.
+        Painter painter(m_target);
+        painter.add_clip_rect(band_rect);
+        for (auto& command : m_commands) {
+            painter.save();
+            command(painter);
+            painter.restore();
+        }
+    });
+
+    m_commands.clear();
+}
+
+}
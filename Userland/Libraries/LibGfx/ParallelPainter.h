@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+
+namespace Gfx {
+
+// Replays recorded draw commands over horizontal bands of the target bitmap,
+// one band per shared thread pool worker. Every band replays the full command list through
+// a Painter clipped to that band, so a command that straddles a band boundary
+// is simply drawn (and clipped) by each band it touches. Commands must only
+// paint through the Painter they are given; anything that depends on mutable
+// shared state is not safe to record.
+class ParallelPainter {
+public:
+    explicit ParallelPainter(Bitmap&);
+
+    void queue_command(Function<void(Painter&)>);
+
+    // Replays all queued commands and blocks until every band has been
+    // painted, then forgets the command list.
+    void paint();
+
+private:
+    Bitmap& m_target;
+    Vector<Function<void(Painter&)>> m_commands;
+};
+
+}
@@ -21,69 +21,77 @@
 
 namespace HTTP {
 
-static ErrorOr<ByteBuffer> handle_content_encoding(ByteBuffer const& buf, DeprecatedString const& content_encoding)
+ErrorOr<void> Job::setup_decompression_stream(ByteBuffer compressed_body, DeprecatedString const& content_encoding)
 {
-    dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: buf has content_encoding={}", content_encoding);
+    dbgln_if(JOB_DEBUG, "Job::setup_decompression_stream: {} bytes with content_encoding={}", compressed_body.size(), content_encoding);
 
-    // FIXME: Actually do the decompression of the data using streams, instead of all at once when everything has been
-    //        received. This will require that some of the decompression algorithms are implemented in a streaming way.
-    //        Gzip and Deflate are implemented using AK::Stream, while Brotli uses the newer Core::Stream. The Gzip and
-    //        Deflate implementations will likely need to be changed to LibCore::Stream for this to work easily.
+    m_compressed_body = move(compressed_body);
 
     if (content_encoding == "gzip") {
-        if (!Compress::GzipDecompressor::is_likely_compressed(buf)) {
-            dbgln("Job::handle_content_encoding: buf is not gzip compressed!");
+        if (!Compress::GzipDecompressor::is_likely_compressed(m_compressed_body)) {
+            dbgln("Job::setup_decompression_stream: buf is not gzip compressed!");
         }
-
-        dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: buf is gzip compressed!");
-
-        auto uncompressed = TRY(Compress::GzipDecompressor::decompress_all(buf));
-
-        if constexpr (JOB_DEBUG) {
-            dbgln("Job::handle_content_encoding: Gzip::decompress() successful.");
-            dbgln("  Input size: {}", buf.size());
-            dbgln("  Output size: {}", uncompressed.size());
-        }
-
-        return uncompressed;
+        auto body_stream = TRY(try_make<FixedMemoryStream>(m_compressed_body.bytes()));
+        m_decompression_stream = TRY(try_make<Compress::GzipDecompressor>(move(body_stream)));
     } else if (content_encoding == "deflate") {
-        dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: buf is deflate compressed!");
-
         // Even though the content encoding is "deflate", it's actually deflate with the zlib wrapper.
         // https://tools.ietf.org/html/rfc7230#section-4.2.2
-        auto uncompressed = Compress::ZlibDecompressor::decompress_all(buf);
-        if (!uncompressed.has_value()) {
-            // From the RFC:
-            // "Note: Some non-conformant implementations send the "deflate"
-            //        compressed data without the zlib wrapper."
-            dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: ZlibDecompressor::decompress_all() failed. Trying DeflateDecompressor::decompress_all()");
-            uncompressed = TRY(Compress::DeflateDecompressor::decompress_all(buf));
+        // From the RFC:
+        // "Note: Some non-conformant implementations send the "deflate"
+        //        compressed data without the zlib wrapper."
+        auto deflate_data = m_compressed_body.bytes();
+        if (Compress::ZlibDecompressor::try_create(deflate_data).has_value()) {
+            // Skip the zlib header; DeflateDecompressor stops at the final
+            // block, so the Adler-32 trailer is simply never read.
+            deflate_data = deflate_data.slice(sizeof(Compress::ZlibHeader));
+        } else {
+            dbgln_if(JOB_DEBUG, "Job::setup_decompression_stream: no zlib wrapper, assuming raw deflate");
         }
-
-        if constexpr (JOB_DEBUG) {
-            dbgln("Job::handle_content_encoding: Deflate decompression successful.");
-            dbgln("  Input size: {}", buf.size());
-            dbgln("  Output size: {}", uncompressed.value().size());
-        }
-
-        return uncompressed.release_value();
+        auto body_stream = TRY(try_make<FixedMemoryStream>(deflate_data));
+        m_decompression_stream = TRY(Compress::DeflateDecompressor::construct(MaybeOwned<AK::Stream>(move(body_stream))));
     } else if (content_encoding == "br") {
-        dbgln_if(JOB_DEBUG, "Job::handle_content_encoding: buf is brotli compressed!");
-
-        FixedMemoryStream bufstream { buf };
-        auto brotli_stream = Compress::BrotliDecompressionStream { bufstream };
-
-        auto uncompressed = TRY(brotli_stream.read_until_eof());
-        if constexpr (JOB_DEBUG) {
-            dbgln("Job::handle_content_encoding: Brotli::decompress() successful.");
-            dbgln("  Input size: {}", buf.size());
-            dbgln("  Output size: {}", uncompressed.size());
-        }
+        m_compressed_body_stream = TRY(try_make<FixedMemoryStream>(m_compressed_body.bytes()));
+        m_decompression_stream = TRY(try_make<Compress::BrotliDecompressionStream>(*m_compressed_body_stream));
+    } else {
+        // Unknown encoding; pass the body through untouched.
+        auto size = m_compressed_body.size();
+        m_received_buffers.append(make<ReceivedBuffer>(SharedByteBuffer::adopt(move(m_compressed_body))));
+        m_buffered_size += size;
+        m_compressed_body = {};
+    }
+    return {};
+}
 
-        return uncompressed;
+ErrorOr<void> Job::pump_decompression_stream()
+{
+    VERIFY(m_decompression_stream);
+
+    // Inflate at most a window's worth of output beyond what the client has
+    // yet to consume, so that only the compressed body and a bounded amount
+    // of decompressed data are in memory at the same time.
+    static constexpr size_t maximum_buffered_decompressed_size = 256 * KiB;
+    static constexpr size_t decompression_chunk_size = 64 * KiB;
+
+    while (!m_decompression_stream->is_eof()) {
+        if (m_buffered_size >= maximum_buffered_decompressed_size)
+            return {};
+        auto buffer = TRY(ByteBuffer::create_uninitialized(decompression_chunk_size));
+        auto read_bytes = TRY(m_decompression_stream->read(buffer));
+        if (read_bytes.is_empty())
+            break;
+        buffer.resize(read_bytes.size());
+        m_buffered_size += buffer.size();
+        m_received_buffers.append(make<ReceivedBuffer>(SharedByteBuffer::adopt(move(buffer))));
+        flush_received_buffers();
     }
 
-    return buf;
+    if (m_decompression_stream->is_eof()) {
+        dbgln_if(JOB_DEBUG, "Job::pump_decompression_stream: done decompressing {} compressed bytes", m_compressed_body.size());
+        m_decompression_stream = nullptr;
+        m_compressed_body_stream = nullptr;
+        m_compressed_body = {};
+    }
+    return {};
 }
 
 Job::Job(HttpRequest&& request, AK::Stream& output_stream)
@@ -123,7 +131,7 @@ void Job::flush_received_buffers()
     dbgln_if(JOB_DEBUG, "Job: Flushing received buffers: have {} bytes in {} buffers for {}", m_buffered_size, m_received_buffers.size(), m_request.url());
     for (size_t i = 0; i < m_received_buffers.size(); ++i) {
         auto& payload = m_received_buffers[i].pending_flush;
-        auto result = do_write(payload);
+        auto result = do_write(payload.bytes());
         if (result.is_error()) {
             if (!result.error().is_errno()) {
                 dbgln_if(JOB_DEBUG, "Job: Failed to flush received buffers: {}", result.error());
@@ -510,9 +518,10 @@ void Job::on_socket_connected()
                 }
             }
 
-            m_received_buffers.append(make<ReceivedBuffer>(payload));
-            m_buffered_size += payload.size();
-            m_received_size += payload.size();
+            auto payload_size = payload.size();
+            m_received_buffers.append(make<ReceivedBuffer>(SharedByteBuffer::adopt(move(payload))));
+            m_buffered_size += payload_size;
+            m_received_size += payload_size;
             flush_received_buffers();
 
             deferred_invoke([this] { did_progress(m_content_length, m_received_size); });
@@ -532,7 +541,7 @@ void Job::on_socket_connected()
             }
 
             if (m_current_chunk_remaining_size.has_value()) {
-                auto size = m_current_chunk_remaining_size.value() - payload.size();
+                auto size = m_current_chunk_remaining_size.value() - payload_size;
 
                 dbgln_if(JOB_DEBUG, "Job: We have {} bytes left over in this chunk", size);
                 if (size == 0) {
@@ -575,7 +584,7 @@ void Job::timer_event(Core::TimerEvent& event)
 {
     event.accept();
     finish_up();
-    if (m_buffered_size == 0)
+    if (m_buffered_size == 0 && !m_decompression_stream)
         stop_timer();
 }
 
@@ -595,24 +604,29 @@ void Job::finish_up()
             flat_ptr += received_buffer.pending_flush.size();
         }
         m_received_buffers.clear();
+        m_buffered_size = 0;
 
-        // For the time being, we cannot stream stuff with content-encoding set to _anything_.
-        // FIXME: LibCompress exposes a streaming interface, so this can be resolved
         auto content_encoding = m_headers.get("Content-Encoding");
         if (content_encoding.has_value()) {
-            if (auto result = handle_content_encoding(flattened_buffer, content_encoding.value()); !result.is_error())
-                flattened_buffer = result.release_value();
-            else
+            // The decompressed output is streamed out of the decompressor a
+            // window at a time (below), instead of being materialized next to
+            // the compressed body in one shot.
+            if (setup_decompression_stream(move(flattened_buffer), content_encoding.value()).is_error())
                 return did_fail(Core::NetworkJob::Error::TransmissionFailed);
+        } else {
+            m_buffered_size = flattened_buffer.size();
+            m_received_buffers.append(make<ReceivedBuffer>(SharedByteBuffer::adopt(move(flattened_buffer))));
         }
-
-        m_buffered_size = flattened_buffer.size();
-        m_received_buffers.append(make<ReceivedBuffer>(move(flattened_buffer)));
         m_can_stream_response = true;
     }
 
+    if (m_decompression_stream) {
+        if (pump_decompression_stream().is_error())
+            return did_fail(Core::NetworkJob::Error::TransmissionFailed);
+    }
+
     flush_received_buffers();
-    if (m_buffered_size != 0) {
+    if (m_buffered_size != 0 || m_decompression_stream) {
         // We have to wait for the client to consume all the downloaded data
         // before we can actually call `did_finish`. in a normal flow, this should
         // never be hit since the client is reading as we are writing, unless there
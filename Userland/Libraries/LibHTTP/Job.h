@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/Optional.h>
+#include <AK/SharedByteBuffer.h>
 #include <LibCore/NetworkJob.h>
 #include <LibHTTP/HttpRequest.h>
 #include <LibHTTP/HttpResponse.h>
@@ -38,6 +39,8 @@ protected:
     void register_on_ready_to_read(Function<void()>);
     ErrorOr<DeprecatedString> read_line(size_t);
     ErrorOr<ByteBuffer> receive(size_t);
+    ErrorOr<void> setup_decompression_stream(ByteBuffer compressed_body, DeprecatedString const& content_encoding);
+    ErrorOr<void> pump_decompression_stream();
     void timer_event(Core::TimerEvent&) override;
 
     enum class State {
@@ -57,17 +60,17 @@ protected:
     Vector<DeprecatedString> m_set_cookie_headers;
 
     struct ReceivedBuffer {
-        ReceivedBuffer(ByteBuffer d)
+        ReceivedBuffer(SharedByteBuffer d)
             : data(move(d))
-            , pending_flush(data.bytes())
+            , pending_flush(data)
         {
         }
 
         // The entire received buffer.
-        ByteBuffer data;
+        SharedByteBuffer data;
 
         // The bytes we have yet to flush. (This is a slice of `data`)
-        ReadonlyBytes pending_flush;
+        SharedByteBuffer pending_flush;
     };
 
     NonnullOwnPtrVector<ReceivedBuffer> m_received_buffers;
@@ -80,6 +83,13 @@ protected:
     bool m_can_stream_response { true };
     bool m_should_read_chunk_ending_line { false };
     bool m_has_scheduled_finish { false };
+
+    // Streaming decompression state, only used when Content-Encoding is set.
+    // m_compressed_body backs the streams; m_compressed_body_stream is only
+    // needed for decompressors that don't take ownership of their input.
+    ByteBuffer m_compressed_body;
+    OwnPtr<AK::Stream> m_compressed_body_stream;
+    OwnPtr<AK::Stream> m_decompression_stream;
 };
 
 }
@@ -8,7 +8,9 @@
 #include <LibCore/System.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Stub.h>
+#include <limits.h>
 #include <sys/select.h>
+#include <sys/uio.h>
 
 namespace IPC {
 
@@ -47,21 +49,43 @@ Core::Stream::LocalSocket& ConnectionBase::fd_passing_socket()
     return *m_socket;
 }
 
-ErrorOr<void> ConnectionBase::post_message(Message const& message)
+ConnectionBase::~ConnectionBase()
 {
-    return post_message(TRY(message.encode()));
+    // Give fire-and-forget messages posted just before teardown a chance to
+    // reach the peer.
+    if (m_socket->is_open())
+        (void)flush_outgoing_messages();
 }
 
-ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
+ErrorOr<void> ConnectionBase::post_message(Message const& message, SendImmediately send_immediately)
+{
+    return post_message(TRY(message.encode()), send_immediately);
+}
+
+ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer, SendImmediately send_immediately)
 {
     // NOTE: If this connection is being shut down, but has not yet been destroyed,
     //       the socket will be closed. Don't try to send more messages.
     if (!m_socket->is_open())
         return Error::from_string_literal("Trying to post_message during IPC shutdown");
 
-    // Prepend the message size.
-    uint32_t message_size = buffer.data.size();
-    TRY(buffer.data.try_prepend(reinterpret_cast<u8 const*>(&message_size), sizeof(message_size)));
+    if (buffer.data.size() >= large_message_threshold) {
+        // Move the payload out of band: the receiver gets the anonymous buffer's fd
+        // (before any fds belonging to the message itself) and a small marker frame.
+        auto out_of_band_buffer = TRY(Core::AnonymousBuffer::create_with_size(buffer.data.size()));
+        memcpy(out_of_band_buffer.data<u8>(), buffer.data.data(), buffer.data.size());
+        u32 const frame[2] = { out_of_band_message_marker, static_cast<u32>(buffer.data.size()) };
+        buffer.data.clear_with_capacity();
+        TRY(buffer.data.try_append(reinterpret_cast<u8 const*>(frame), sizeof(frame)));
+        if (auto result = fd_passing_socket().send_fd(out_of_band_buffer.fd()); result.is_error()) {
+            shutdown_with_error(result.error());
+            return result;
+        }
+    } else {
+        // Prepend the message size.
+        uint32_t message_size = buffer.data.size();
+        TRY(buffer.data.try_prepend(reinterpret_cast<u8 const*>(&message_size), sizeof(message_size)));
+    }
 
     for (auto& fd : buffer.fds) {
         if (auto result = fd_passing_socket().send_fd(fd.value()); result.is_error()) {
@@ -70,39 +94,80 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
         }
     }
 
-    ReadonlyBytes bytes_to_write { buffer.data.span() };
+    m_outgoing_byte_count += buffer.data.size();
+    TRY(m_outgoing_frames.try_append(move(buffer.data)));
+
+    if (send_immediately == SendImmediately::Yes || m_outgoing_byte_count >= outgoing_flush_threshold)
+        return flush_outgoing_messages();
+
+    // Note: Without an event loop there is nothing to schedule the flush on,
+    //       so just write the message out right away.
+    if (!Core::EventLoop::has_been_instantiated())
+        return flush_outgoing_messages();
+
+    if (!m_flush_scheduled) {
+        m_flush_scheduled = true;
+        m_deferred_invoker->schedule([strong_this = NonnullRefPtr(*this)] {
+            strong_this->m_flush_scheduled = false;
+            if (auto result = strong_this->flush_outgoing_messages(); result.is_error())
+                dbgln("IPC::ConnectionBase: Failed to flush outgoing messages: {}", result.error());
+        });
+    }
+    return {};
+}
+
+ErrorOr<void> ConnectionBase::flush_outgoing_messages()
+{
+    if (m_outgoing_frames.is_empty())
+        return {};
+
+    if (!m_socket->is_open())
+        return Error::from_string_literal("Trying to flush messages during IPC shutdown");
+
+    auto frames = move(m_outgoing_frames);
+    m_outgoing_byte_count = 0;
+
+    Vector<struct iovec, 16> iovecs;
+    TRY(iovecs.try_ensure_capacity(frames.size()));
+    for (auto& frame : frames)
+        iovecs.unchecked_append({ frame.data(), frame.size() });
+
+    size_t frame_index = 0;
+    size_t offset_into_frame = 0;
     int writes_done = 0;
-    size_t initial_size = bytes_to_write.size();
-    while (!bytes_to_write.is_empty()) {
-        auto maybe_nwritten = m_socket->write(bytes_to_write);
+    while (frame_index < frames.size()) {
+        iovecs[frame_index].iov_base = frames[frame_index].data() + offset_into_frame;
+        iovecs[frame_index].iov_len = frames[frame_index].size() - offset_into_frame;
+        size_t iovec_count = min(frames.size() - frame_index, static_cast<size_t>(IOV_MAX));
+        auto nwritten_or_error = ::writev(m_socket->fd().value(), iovecs.data() + frame_index, iovec_count);
         writes_done++;
-        if (maybe_nwritten.is_error()) {
-            auto error = maybe_nwritten.release_error();
-            if (error.is_errno()) {
-                // FIXME: This is a hacky way to at least not crash on large messages
-                // The limit of 100 writes is arbitrary, and there to prevent indefinite spinning on the EventLoop
-                if (error.code() == EAGAIN && writes_done < 100) {
-                    sched_yield();
-                    continue;
-                }
-                shutdown_with_error(error);
-                switch (error.code()) {
-                case EPIPE:
-                    return Error::from_string_literal("IPC::Connection::post_message: Disconnected from peer");
-                case EAGAIN:
-                    return Error::from_string_literal("IPC::Connection::post_message: Peer buffer overflowed");
-                default:
-                    return Error::from_syscall("IPC::Connection::post_message write"sv, -error.code());
-                }
-            } else {
-                return error;
+        if (nwritten_or_error < 0) {
+            auto error = errno;
+            // FIXME: This is a hacky way to at least not crash on large messages
+            // The limit of 100 writes is arbitrary, and there to prevent indefinite spinning on the EventLoop
+            if (error == EAGAIN && writes_done < 100) {
+                sched_yield();
+                continue;
+            }
+            auto write_error = Error::from_syscall("IPC::Connection::flush_outgoing_messages writev"sv, -error);
+            shutdown_with_error(write_error);
+            switch (error) {
+            case EPIPE:
+                return Error::from_string_literal("IPC::Connection::flush_outgoing_messages: Disconnected from peer");
+            case EAGAIN:
+                return Error::from_string_literal("IPC::Connection::flush_outgoing_messages: Peer buffer overflowed");
+            default:
+                return write_error;
             }
         }
 
-        bytes_to_write = bytes_to_write.slice(maybe_nwritten.value());
-    }
-    if (writes_done > 1) {
-        dbgln("LibIPC::Connection FIXME Warning, needed {} writes needed to send message of size {}B, this is pretty bad, as it spins on the EventLoop", writes_done, initial_size);
+        auto nwritten = static_cast<size_t>(nwritten_or_error);
+        while (frame_index < frames.size() && nwritten >= frames[frame_index].size() - offset_into_frame) {
+            nwritten -= frames[frame_index].size() - offset_into_frame;
+            offset_into_frame = 0;
+            ++frame_index;
+        }
+        offset_into_frame += nwritten;
     }
 
     // Note: This disables responsiveness detection when an event loop is absent.
@@ -112,6 +177,12 @@ ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
     return {};
 }
 
+ErrorOr<Core::AnonymousBuffer> ConnectionBase::receive_out_of_band_buffer(u32 size)
+{
+    auto fd = TRY(fd_passing_socket().receive_fd(0));
+    return Core::AnonymousBuffer::create_from_anon_fd(fd, size);
+}
+
 void ConnectionBase::shutdown()
 {
     m_socket->close();
@@ -136,7 +207,9 @@ void ConnectionBase::handle_messages()
             }
 
             if (auto response = handler_result.release_value()) {
-                if (auto post_result = post_message(*response); post_result.is_error()) {
+                // The peer is likely blocked waiting for this response, so
+                // don't make it wait for our next flush.
+                if (auto post_result = post_message(*response, SendImmediately::Yes); post_result.is_error()) {
                     dbgln("IPC::ConnectionBase::handle_messages: {}", post_result.error());
                 }
             }
@@ -255,6 +328,10 @@ OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32
         if (!m_socket->is_open())
             break;
 
+        // Anything still queued has to go out before we block on the reply.
+        if (auto result = flush_outgoing_messages(); result.is_error())
+            break;
+
         wait_for_socket_to_become_readable();
         if (drain_messages_from_peer().is_error())
             break;
@@ -10,6 +10,7 @@
 #include <AK/ByteBuffer.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/Try.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Event.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Notifier.h>
@@ -37,14 +38,24 @@ class ConnectionBase : public Core::Object {
     C_OBJECT_ABSTRACT(ConnectionBase);
 
 public:
-    virtual ~ConnectionBase() override = default;
+    virtual ~ConnectionBase() override;
 
     void set_fd_passing_socket(NonnullOwnPtr<Core::Stream::LocalSocket>);
     void set_deferred_invoker(NonnullOwnPtr<DeferredInvoker>);
     DeferredInvoker& deferred_invoker() { return *m_deferred_invoker; }
 
     bool is_open() const { return m_socket->is_open(); }
-    ErrorOr<void> post_message(Message const&);
+
+    // Posted messages are queued and normally flushed in one writev() at the
+    // end of the current event loop iteration; pass SendImmediately::Yes for
+    // latency-critical messages that should hit the socket right away.
+    enum class SendImmediately {
+        No,
+        Yes,
+    };
+
+    ErrorOr<void> post_message(Message const&, SendImmediately = SendImmediately::No);
+    ErrorOr<void> flush_outgoing_messages();
 
     void shutdown();
     virtual void die() { }
@@ -55,6 +66,14 @@ public:
 protected:
     explicit ConnectionBase(IPC::Stub&, NonnullOwnPtr<Core::Stream::LocalSocket>, u32 local_endpoint_magic);
 
+    // Messages whose payload is at least this large are transported out of band:
+    // the payload goes into an anonymous buffer whose fd crosses the fd-passing
+    // socket, and only a small marker frame is written to the byte stream.
+    static constexpr size_t large_message_threshold = 64 * KiB;
+    static constexpr u32 out_of_band_message_marker = 0xffffffff;
+
+    ErrorOr<Core::AnonymousBuffer> receive_out_of_band_buffer(u32 size);
+
     virtual void may_have_become_unresponsive() { }
     virtual void did_become_responsive() { }
     virtual void try_parse_messages(Vector<u8> const& bytes, size_t& index) = 0;
@@ -65,7 +84,7 @@ protected:
     ErrorOr<Vector<u8>> read_as_much_as_possible_from_socket_without_blocking();
     ErrorOr<void> drain_messages_from_peer();
 
-    ErrorOr<void> post_message(MessageBuffer);
+    ErrorOr<void> post_message(MessageBuffer, SendImmediately);
     void handle_messages();
 
     IPC::Stub& m_local_stub;
@@ -75,6 +94,12 @@ protected:
 
     RefPtr<Core::Timer> m_responsiveness_timer;
 
+    // Queued outgoing message frames, flushed in a single writev().
+    static constexpr size_t outgoing_flush_threshold = 64 * KiB;
+    Vector<Vector<u8, 1024>> m_outgoing_frames;
+    size_t m_outgoing_byte_count { 0 };
+    bool m_flush_scheduled { false };
+
     NonnullOwnPtrVector<Message> m_unprocessed_messages;
     ByteBuffer m_unprocessed_bytes;
 
@@ -131,30 +156,51 @@ protected:
 
     virtual void try_parse_messages(Vector<u8> const& bytes, size_t& index) override
     {
-        u32 message_size = 0;
-        for (; index + sizeof(message_size) < bytes.size(); index += message_size) {
-            memcpy(&message_size, bytes.data() + index, sizeof(message_size));
-            if (message_size == 0 || bytes.size() - index - sizeof(uint32_t) < message_size)
-                break;
-            index += sizeof(message_size);
-            auto remaining_bytes = ReadonlyBytes { bytes.data() + index, message_size };
-
-            auto local_message = LocalEndpoint::decode_message(remaining_bytes, fd_passing_socket());
+        auto decode_and_append = [&](ReadonlyBytes message_bytes) {
+            auto local_message = LocalEndpoint::decode_message(message_bytes, fd_passing_socket());
             if (!local_message.is_error()) {
                 m_unprocessed_messages.append(local_message.release_value());
-                continue;
+                return true;
             }
 
-            auto peer_message = PeerEndpoint::decode_message(remaining_bytes, fd_passing_socket());
+            auto peer_message = PeerEndpoint::decode_message(message_bytes, fd_passing_socket());
             if (!peer_message.is_error()) {
                 m_unprocessed_messages.append(peer_message.release_value());
-                continue;
+                return true;
             }
 
             dbgln("Failed to parse a message");
             dbgln("Local endpoint error: {}", local_message.error());
             dbgln("Peer endpoint error: {}", peer_message.error());
-            break;
+            return false;
+        };
+
+        u32 message_size = 0;
+        while (index + sizeof(message_size) < bytes.size()) {
+            memcpy(&message_size, bytes.data() + index, sizeof(message_size));
+            if (message_size == out_of_band_message_marker) {
+                // The payload of a large message lives in an anonymous buffer whose fd
+                // arrives on the fd-passing socket; only its size is in the byte stream.
+                u32 payload_size = 0;
+                if (bytes.size() - index - sizeof(u32) < sizeof(payload_size))
+                    break;
+                memcpy(&payload_size, bytes.data() + index + sizeof(u32), sizeof(payload_size));
+                auto buffer_or_error = receive_out_of_band_buffer(payload_size);
+                if (buffer_or_error.is_error()) {
+                    dbgln("Failed to receive an out-of-band message buffer: {}", buffer_or_error.error());
+                    break;
+                }
+                auto buffer = buffer_or_error.release_value();
+                index += sizeof(u32) + sizeof(payload_size);
+                decode_and_append({ buffer.data<u8 const>(), payload_size });
+                continue;
+            }
+            if (message_size == 0 || bytes.size() - index - sizeof(uint32_t) < message_size)
+                break;
+            index += sizeof(message_size);
+            if (!decode_and_append({ bytes.data() + index, message_size }))
+                break;
+            index += message_size;
         }
     }
 };
@@ -20,20 +20,42 @@ void Client::die()
         on_death();
 }
 
-Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional<DeprecatedString> mime_type)
+static Optional<DecodedImage> decoded_image_from_response(bool is_animated, u32 loop_count, Vector<Gfx::ShareableBitmap> const& bitmaps, Vector<u32> const& durations)
+{
+    if (bitmaps.is_empty())
+        return {};
+
+    DecodedImage image;
+    image.is_animated = is_animated;
+    image.loop_count = loop_count;
+    image.frames.resize(bitmaps.size());
+    for (size_t i = 0; i < image.frames.size(); ++i) {
+        auto& frame = image.frames[i];
+        frame.bitmap = bitmaps[i].bitmap();
+        frame.duration = durations[i];
+    }
+    return image;
+}
+
+static ErrorOr<Core::AnonymousBuffer> encoded_buffer_for_data(ReadonlyBytes encoded_data)
+{
+    auto encoded_buffer = TRY(Core::AnonymousBuffer::create_with_size(encoded_data.size()));
+    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
+    return encoded_buffer;
+}
+
+Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> ideal_size, Optional<DeprecatedString> mime_type)
 {
     if (encoded_data.is_empty())
         return {};
 
-    auto encoded_buffer_or_error = Core::AnonymousBuffer::create_with_size(encoded_data.size());
+    auto encoded_buffer_or_error = encoded_buffer_for_data(encoded_data);
     if (encoded_buffer_or_error.is_error()) {
         dbgln("Could not allocate encoded buffer");
         return {};
     }
-    auto encoded_buffer = encoded_buffer_or_error.release_value();
 
-    memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
-    auto response_or_error = try_decode_image(move(encoded_buffer), mime_type);
+    auto response_or_error = try_decode_image(encoded_buffer_or_error.release_value(), ideal_size, mime_type);
 
     if (response_or_error.is_error()) {
         dbgln("ImageDecoder died heroically");
@@ -41,20 +63,43 @@ Optional<DecodedImage> Client::decode_image(ReadonlyBytes encoded_data, Optional
     }
 
     auto& response = response_or_error.value();
+    return decoded_image_from_response(response.is_animated(), response.loop_count(), response.bitmaps(), response.durations());
+}
 
-    if (response.bitmaps().is_empty())
-        return {};
+i64 Client::enqueue_decoding(ReadonlyBytes encoded_data, Function<void(Optional<DecodedImage>)> on_complete, i32 priority, Optional<Gfx::IntSize> ideal_size, Optional<DeprecatedString> mime_type)
+{
+    auto job_id = m_next_job_id++;
 
-    DecodedImage image;
-    image.is_animated = response.is_animated();
-    image.loop_count = response.loop_count();
-    image.frames.resize(response.bitmaps().size());
-    for (size_t i = 0; i < image.frames.size(); ++i) {
-        auto& frame = image.frames[i];
-        frame.bitmap = response.bitmaps()[i].bitmap();
-        frame.duration = response.durations()[i];
+    if (encoded_data.is_empty()) {
+        deferred_invoke([on_complete = move(on_complete)] { on_complete({}); });
+        return job_id;
     }
-    return image;
+
+    auto encoded_buffer_or_error = encoded_buffer_for_data(encoded_data);
+    if (encoded_buffer_or_error.is_error()) {
+        dbgln("Could not allocate encoded buffer");
+        deferred_invoke([on_complete = move(on_complete)] { on_complete({}); });
+        return job_id;
+    }
+
+    m_pending_decodings.set(job_id, move(on_complete));
+    async_enqueue_decoding(job_id, encoded_buffer_or_error.release_value(), ideal_size, mime_type, priority);
+    return job_id;
+}
+
+void Client::cancel_decoding(i64 job_id)
+{
+    if (m_pending_decodings.remove(job_id))
+        async_cancel_decoding(job_id);
+}
+
+void Client::did_decode_image(i64 job_id, bool is_animated, u32 loop_count, Vector<Gfx::ShareableBitmap> const& bitmaps, Vector<u32> const& durations)
+{
+    // The job may have been cancelled while the response was in flight.
+    auto on_complete = m_pending_decodings.take(job_id);
+    if (!on_complete.has_value())
+        return;
+    on_complete.value()(decoded_image_from_response(is_animated, loop_count, bitmaps, durations));
 }
 
 }
@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
+#include <LibGfx/Size.h>
 #include <LibIPC/ConnectionToServer.h>
 
 namespace ImageDecoderClient {
@@ -30,7 +31,19 @@ class Client final
     IPC_CLIENT_CONNECTION(Client, "/tmp/session/%sid/portal/image"sv);
 
 public:
-    Optional<DecodedImage> decode_image(ReadonlyBytes, Optional<DeprecatedString> mime_type = {});
+    // If ideal_size is given, frames larger than it are downscaled (keeping
+    // their aspect ratio) in the decoder process, so the full-resolution
+    // bitmap never crosses the IPC boundary.
+    Optional<DecodedImage> decode_image(ReadonlyBytes, Optional<Gfx::IntSize> ideal_size = {}, Optional<DeprecatedString> mime_type = {});
+
+    // Queues a decode on the service without blocking; the callback runs on
+    // this process's event loop once the image is ready (or with an empty
+    // Optional if decoding failed). Jobs with a higher priority are decoded
+    // first, so images in the visible viewport should outrank offscreen ones.
+    // Returns a job id that can be passed to cancel_decoding(), e.g. when the
+    // user navigates away before the image was needed.
+    i64 enqueue_decoding(ReadonlyBytes, Function<void(Optional<DecodedImage>)> on_complete, i32 priority = 0, Optional<Gfx::IntSize> ideal_size = {}, Optional<DeprecatedString> mime_type = {});
+    void cancel_decoding(i64 job_id);
 
     Function<void()> on_death;
 
@@ -38,6 +51,11 @@ private:
     Client(NonnullOwnPtr<Core::Stream::LocalSocket>);
 
     virtual void die() override;
+
+    virtual void did_decode_image(i64 job_id, bool is_animated, u32 loop_count, Vector<Gfx::ShareableBitmap> const& bitmaps, Vector<u32> const& durations) override;
+
+    i64 m_next_job_id { 0 };
+    HashMap<i64, Function<void(Optional<DecodedImage>)>> m_pending_decodings;
 };
 
 }
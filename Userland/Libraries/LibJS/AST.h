@@ -1176,7 +1176,9 @@ private:
 
 class StringLiteral final : public Literal {
 public:
-    explicit StringLiteral(SourceRange source_range, DeprecatedString value)
+    // NOTE: Literal strings are interned; large scripts tend to repeat the
+    //       same (property name) strings over and over.
+    explicit StringLiteral(SourceRange source_range, DeprecatedFlyString value)
         : Literal(source_range)
         , m_value(move(value))
     {
@@ -1191,7 +1193,7 @@ public:
 private:
     virtual bool is_string_literal() const override { return true; }
 
-    DeprecatedString m_value;
+    DeprecatedFlyString m_value;
 };
 
 class NullLiteral final : public Literal {
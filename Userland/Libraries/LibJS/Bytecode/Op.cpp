@@ -127,13 +127,79 @@ static ThrowCompletionOr<Value> typed_equals(VM&, Value src1, Value src2)
     return Value(is_strictly_equal(src1, src2));
 }
 
+// OPTIMIZATION: These shadowing wrappers let the interpreter loop handle the
+//               all-numeric cases inline, instead of calling into the helpers in
+//               Runtime/Value.cpp that also deal with strings, BigInts and object
+//               coercion. Note that Value's double constructor re-packs integral
+//               results as Int32, and that a comparison involving NaN is false for
+//               all four relational operators, matching IsLessThan's undefined.
+//               The parenthesized callee in JS_DEFINE_COMMON_BINARY_OP suppresses
+//               argument-dependent lookup, so these take precedence over the
+//               identically-named functions in the JS namespace.
+
+static ThrowCompletionOr<Value> add(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() + rhs.as_double());
+    return JS::add(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> sub(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() - rhs.as_double());
+    return JS::sub(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> mul(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() * rhs.as_double());
+    return JS::mul(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> div(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() / rhs.as_double());
+    return JS::div(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> less_than(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() < rhs.as_double());
+    return JS::less_than(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> less_than_equals(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() <= rhs.as_double());
+    return JS::less_than_equals(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> greater_than(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() > rhs.as_double());
+    return JS::greater_than(vm, lhs, rhs);
+}
+
+static ThrowCompletionOr<Value> greater_than_equals(VM& vm, Value lhs, Value rhs)
+{
+    if (lhs.is_number() && rhs.is_number())
+        return Value(lhs.as_double() >= rhs.as_double());
+    return JS::greater_than_equals(vm, lhs, rhs);
+}
+
 #define JS_DEFINE_COMMON_BINARY_OP(OpTitleCase, op_snake_case)                                  \
     ThrowCompletionOr<void> OpTitleCase::execute_impl(Bytecode::Interpreter& interpreter) const \
     {                                                                                           \
         auto& vm = interpreter.vm();                                                            \
         auto lhs = interpreter.reg(m_lhs_reg);                                                  \
         auto rhs = interpreter.accumulator();                                                   \
-        interpreter.accumulator() = TRY(op_snake_case(vm, lhs, rhs));                           \
+        interpreter.accumulator() = TRY((op_snake_case)(vm, lhs, rhs));                         \
         return {};                                                                              \
     }                                                                                           \
     DeprecatedString OpTitleCase::to_deprecated_string_impl(Bytecode::Executable const&) const  \
@@ -365,7 +431,7 @@ ThrowCompletionOr<void> CopyObjectExcludingProperties::execute_impl(Bytecode::In
 ThrowCompletionOr<void> ConcatString::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    interpreter.reg(m_lhs) = TRY(add(vm, interpreter.reg(m_lhs), interpreter.accumulator()));
+    interpreter.reg(m_lhs) = TRY(JS::add(vm, interpreter.reg(m_lhs), interpreter.accumulator()));
     return {};
 }
 
@@ -489,21 +555,74 @@ ThrowCompletionOr<void> SetVariable::execute_impl(Bytecode::Interpreter& interpr
     return {};
 }
 
+// Remembers the receiver's Shape and storage offset in `cache` if the property
+// is a plain own data property, so the next execution can skip the lookup.
+static void update_property_lookup_cache(PropertyLookupCache& cache, Object& object, PropertyKey const& property_key, bool require_writable)
+{
+    cache = {};
+    if (property_key.is_number())
+        return;
+    auto& shape = object.shape();
+    // Unique shapes mutate in place, so their pointer identity doesn't pin down a property layout.
+    if (shape.is_unique())
+        return;
+    auto metadata = shape.lookup(property_key.to_string_or_symbol());
+    if (!metadata.has_value())
+        return;
+    if (object.get_direct(metadata->offset).is_accessor())
+        return;
+    if (require_writable && !metadata->attributes.is_writable())
+        return;
+    cache.shape = make_handle(shape);
+    cache.property_offset = metadata->offset;
+}
+
 ThrowCompletionOr<void> GetById::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.accumulator().to_object(vm));
-    interpreter.accumulator() = TRY(object->get(interpreter.current_executable().get_identifier(m_property)));
+    auto base_value = interpreter.accumulator();
+
+    // Fast path: the base's Shape matches what this instruction saw last time, so the
+    // property is a plain own data property at a known storage offset.
+    if (base_value.is_object()) {
+        auto& base_object = base_value.as_object();
+        if (m_cache.property_offset.has_value() && &base_object.shape() == m_cache.shape.cell()) {
+            interpreter.accumulator() = base_object.get_direct(*m_cache.property_offset);
+            return {};
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
+    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    interpreter.accumulator() = TRY(object->get(name));
+
+    if (base_value.is_object())
+        update_property_lookup_cache(m_cache, *object, name, false);
     return {};
 }
 
 ThrowCompletionOr<void> PutById::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto* object = TRY(interpreter.reg(m_base).to_object(vm));
-    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    auto base_value = interpreter.reg(m_base);
     auto value = interpreter.accumulator();
-    return put_by_property_key(object, value, name, interpreter, m_kind);
+
+    // Fast path: overwrite an existing writable own data property at a known storage offset.
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object()) {
+        auto& base_object = base_value.as_object();
+        if (m_cache.property_offset.has_value() && &base_object.shape() == m_cache.shape.cell()) {
+            base_object.put_direct(*m_cache.property_offset, value);
+            return {};
+        }
+    }
+
+    auto* object = TRY(base_value.to_object(vm));
+    PropertyKey name = interpreter.current_executable().get_identifier(m_property);
+    TRY(put_by_property_key(object, value, name, interpreter, m_kind));
+
+    if (m_kind == PropertyKind::KeyValue && base_value.is_object())
+        update_property_lookup_cache(m_cache, *object, name, true);
+    return {};
 }
 
 ThrowCompletionOr<void> DeleteById::execute_impl(Bytecode::Interpreter& interpreter) const
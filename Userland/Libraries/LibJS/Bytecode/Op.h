@@ -16,6 +16,7 @@
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Bytecode/StringTable.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibJS/Heap/Handle.h>
 #include <LibJS/Runtime/Environment.h>
 #include <LibJS/Runtime/EnvironmentCoordinate.h>
 #include <LibJS/Runtime/Value.h>
@@ -504,6 +505,14 @@ private:
     IdentifierTableIndex m_identifier;
 };
 
+// Inline cache for GetById/PutById: remembers the receiver's Shape and the
+// property's storage offset, so monomorphic sites become a pointer compare
+// plus an indexed load instead of a full property lookup.
+struct PropertyLookupCache {
+    Handle<Shape> shape;
+    Optional<u32> property_offset;
+};
+
 class GetById final : public Instruction {
 public:
     explicit GetById(IdentifierTableIndex property)
@@ -519,6 +528,7 @@ public:
 
 private:
     IdentifierTableIndex m_property;
+    mutable PropertyLookupCache m_cache;
 };
 
 enum class PropertyKind {
@@ -552,6 +562,7 @@ private:
     Register m_base;
     IdentifierTableIndex m_property;
     PropertyKind m_kind;
+    mutable PropertyLookupCache m_cache;
 };
 
 class DeleteById final : public Instruction {
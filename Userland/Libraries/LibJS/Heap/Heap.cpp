@@ -101,17 +101,40 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     if (print_report)
         collection_measurement_timer.start();
 
+    auto scope = CollectionScope::Full;
+
     if (collection_type == CollectionType::CollectGarbage) {
         if (m_gc_deferrals) {
             m_should_gc_when_deferral_ends = true;
             return;
         }
-        HashTable<Cell*> roots;
-        gather_roots(roots);
-        mark_live_cells(roots);
+
+        // NOTE: There is no write barrier on cell references, so a minor collection cannot
+        //       know which old-generation cells point into the young generation. Instead it
+        //       treats every live old-generation cell as a root scanner: their outgoing
+        //       references keep young cells alive, but old blocks are neither marked nor
+        //       swept. Old-generation garbage is reclaimed by the periodic full collection.
+        if (m_minor_collections_since_last_full_collection < s_minor_collections_per_full_collection) {
+            scope = CollectionScope::Minor;
+            ++m_minor_collections_since_last_full_collection;
+        } else {
+            m_minor_collections_since_last_full_collection = 0;
+        }
+
+        m_gc_roots.clear_with_capacity();
+        gather_roots(m_gc_roots);
+        mark_live_cells(m_gc_roots, scope);
+    }
+    finalize_unmarked_cells(scope);
+    sweep_dead_cells(print_report, collection_measurement_timer, scope);
+
+    // Everything that survived this collection is now part of the old generation.
+    if (collection_type == CollectionType::CollectGarbage) {
+        for_each_block([&](auto& block) {
+            block.set_old_generation(true);
+            return IterationDecision::Continue;
+        });
     }
-    finalize_unmarked_cells();
-    sweep_dead_cells(print_report, collection_measurement_timer);
 }
 
 void Heap::gather_roots(HashTable<Cell*>& roots)
@@ -141,7 +164,8 @@ __attribute__((no_sanitize("address"))) void Heap::gather_conservative_roots(Has
     jmp_buf buf;
     setjmp(buf);
 
-    HashTable<FlatPtr> possible_pointers;
+    auto& possible_pointers = m_gc_possible_pointers;
+    possible_pointers.clear_with_capacity();
 
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
@@ -183,7 +207,8 @@ __attribute__((no_sanitize("address"))) void Heap::gather_conservative_roots(Has
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
+    auto& all_live_heap_blocks = m_gc_live_blocks;
+    all_live_heap_blocks.clear_with_capacity();
     for_each_block([&](auto& block) {
         all_live_heap_blocks.set(&block);
         return IterationDecision::Continue;
@@ -209,17 +234,21 @@ __attribute__((no_sanitize("address"))) void Heap::gather_conservative_roots(Has
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(HashTable<Cell*> const& roots)
+    explicit MarkingVisitor(Heap::CollectionScope scope)
+        : m_scope(scope)
     {
-        for (auto* root : roots) {
-            visit(root);
-        }
     }
 
     virtual void visit_impl(Cell& cell) override
     {
         if (cell.is_marked())
             return;
+
+        // Minor collections never mark (or traverse into) the old generation; its live
+        // cells have already been visited as root scanners by mark_live_cells().
+        if (m_scope == Heap::CollectionScope::Minor && HeapBlock::from_cell(&cell)->is_old_generation())
+            return;
+
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
         cell.set_marked(true);
@@ -234,14 +263,30 @@ public:
     }
 
 private:
+    Heap::CollectionScope m_scope { Heap::CollectionScope::Full };
     Vector<Cell&> m_work_queue;
 };
 
-void Heap::mark_live_cells(HashTable<Cell*> const& roots)
+void Heap::mark_live_cells(HashTable<Cell*> const& roots, CollectionScope scope)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(roots);
+    MarkingVisitor visitor(scope);
+
+    if (scope == CollectionScope::Minor) {
+        for_each_block([&](auto& block) {
+            if (!block.is_old_generation())
+                return IterationDecision::Continue;
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                cell->visit_edges(visitor);
+            });
+            return IterationDecision::Continue;
+        });
+    }
+
+    for (auto* root : roots)
+        visitor.visit(root);
+
     visitor.mark_all_live_cells();
 
     for (auto& inverse_root : m_uprooted_cells)
@@ -257,9 +302,11 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
     return cell.must_survive_garbage_collection();
 }
 
-void Heap::finalize_unmarked_cells()
+void Heap::finalize_unmarked_cells(CollectionScope scope)
 {
     for_each_block([&](auto& block) {
+        if (scope == CollectionScope::Minor && block.is_old_generation())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked() && !cell_must_survive_garbage_collection(*cell))
                 cell->finalize();
@@ -268,7 +315,7 @@ void Heap::finalize_unmarked_cells()
     });
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer, CollectionScope scope)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
@@ -280,6 +327,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cell_bytes = 0;
 
     for_each_block([&](auto& block) {
+        if (scope == CollectionScope::Minor && block.is_old_generation())
+            return IterationDecision::Continue;
         bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
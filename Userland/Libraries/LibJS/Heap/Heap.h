@@ -55,6 +55,11 @@ public:
         CollectEverything,
     };
 
+    enum class CollectionScope {
+        Minor,
+        Full,
+    };
+
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
 
     VM& vm() { return m_vm; }
@@ -85,9 +90,9 @@ private:
 
     void gather_roots(HashTable<Cell*>&);
     void gather_conservative_roots(HashTable<Cell*>&);
-    void mark_live_cells(HashTable<Cell*> const& live_cells);
-    void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void mark_live_cells(HashTable<Cell*> const& live_cells, CollectionScope);
+    void finalize_unmarked_cells(CollectionScope);
+    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&, CollectionScope);
 
     CellAllocator& allocator_for_size(size_t);
 
@@ -103,6 +108,10 @@ private:
     size_t m_max_allocations_between_gc { 100000 };
     size_t m_allocations_since_last_gc { 0 };
 
+    // Every N'th collection is a full one; the rest only visit the young generation.
+    static constexpr size_t s_minor_collections_per_full_collection = 4;
+    size_t m_minor_collections_since_last_full_collection { 0 };
+
     bool m_should_collect_on_every_allocation { false };
 
     VM& m_vm;
@@ -115,6 +124,12 @@ private:
 
     Vector<Cell*> m_uprooted_cells;
 
+    // Scratch space for the collector, retained between collections so the root set
+    // and conservative scan tables don't have to re-grow inside the GC pause.
+    HashTable<Cell*> m_gc_roots;
+    HashTable<FlatPtr> m_gc_possible_pointers;
+    HashTable<HeapBlock*> m_gc_live_blocks;
+
     BlockAllocator m_block_allocator;
 
     size_t m_gc_deferrals { 0 };
@@ -31,6 +31,11 @@ public:
     size_t cell_count() const { return (block_size - sizeof(HeapBlock)) / m_cell_size; }
     bool is_full() const { return !has_lazy_freelist() && !m_freelist; }
 
+    // Blocks whose cells have survived a collection belong to the old generation
+    // and are skipped by minor collections. See Heap::collect_garbage().
+    bool is_old_generation() const { return m_is_old_generation; }
+    void set_old_generation(bool b) { m_is_old_generation = b; }
+
     ALWAYS_INLINE Cell* allocate()
     {
         Cell* allocated_cell = nullptr;
@@ -110,6 +115,7 @@ private:
     Heap& m_heap;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    bool m_is_old_generation { false };
     FreelistEntry* m_freelist { nullptr };
     alignas(Cell) u8 m_storage[];
 
@@ -17,18 +17,12 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : m_array_size(initial_values.size())
     , m_packed_elements(move(initial_values))
 {
-}
-
-bool SimpleIndexedPropertyStorage::has_index(u32 index) const
-{
-    return index < m_array_size && !m_packed_elements[index].is_empty();
-}
-
-Optional<ValueAndAttributes> SimpleIndexedPropertyStorage::get(u32 index) const
-{
-    if (!has_index(index))
-        return {};
-    return ValueAndAttributes { m_packed_elements[index], default_attributes };
+    for (auto& value : m_packed_elements) {
+        if (value.is_empty()) {
+            m_may_have_holes = true;
+            break;
+        }
+    }
 }
 
 void SimpleIndexedPropertyStorage::grow_storage_if_needed()
@@ -44,21 +38,11 @@ void SimpleIndexedPropertyStorage::grow_storage_if_needed()
     }
 }
 
-void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttributes attributes)
-{
-    VERIFY(attributes == default_attributes);
-
-    if (index >= m_array_size) {
-        m_array_size = index + 1;
-        grow_storage_if_needed();
-    }
-    m_packed_elements[index] = value;
-}
-
 void SimpleIndexedPropertyStorage::remove(u32 index)
 {
     VERIFY(index < m_array_size);
     m_packed_elements[index] = {};
+    m_may_have_holes = true;
 }
 
 ValueAndAttributes SimpleIndexedPropertyStorage::take_first()
@@ -77,6 +61,9 @@ ValueAndAttributes SimpleIndexedPropertyStorage::take_last()
 
 bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
 {
+    // Growing introduces holes between the old and new array size.
+    if (new_size > m_array_size)
+        m_may_have_holes = true;
     m_array_size = new_size;
     m_packed_elements.resize_and_keep_capacity(new_size);
     return true;
@@ -183,6 +170,12 @@ IndexedPropertyIterator::IndexedPropertyIterator(IndexedProperties const& indexe
     , m_skip_empty(skip_empty)
 {
     if (m_skip_empty) {
+        // Packed storage has no holes to skip, so don't bother materializing the
+        // index list; plain incrementing visits exactly the existing elements.
+        if (m_indexed_properties.is_packed()) {
+            m_skip_empty = false;
+            return;
+        }
         m_cached_indices = m_indexed_properties.indices();
         skip_empty_indices();
     }
@@ -219,14 +212,7 @@ void IndexedPropertyIterator::skip_empty_indices()
     m_index = m_indexed_properties.array_like_size();
 }
 
-Optional<ValueAndAttributes> IndexedProperties::get(u32 index) const
-{
-    if (!m_storage)
-        return {};
-    return m_storage->get(index);
-}
-
-void IndexedProperties::put(u32 index, Value value, PropertyAttributes attributes)
+void IndexedProperties::put_slow_case(u32 index, Value value, PropertyAttributes attributes)
 {
     ensure_storage();
     if (m_storage->is_simple_storage() && (attributes != default_attributes || index > (array_like_size() + SPARSE_ARRAY_HOLE_THRESHOLD))) {
@@ -265,9 +251,11 @@ size_t IndexedProperties::real_size() const
     if (!m_storage)
         return 0;
     if (m_storage->is_simple_storage()) {
-        auto& packed_elements = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).elements();
+        auto const& storage = static_cast<SimpleIndexedPropertyStorage const&>(*m_storage);
+        if (!storage.may_contain_holes())
+            return storage.array_like_size();
         size_t size = 0;
-        for (auto& element : packed_elements) {
+        for (auto& element : storage.elements()) {
             if (!element.is_empty())
                 ++size;
         }
@@ -285,6 +273,11 @@ Vector<u32> IndexedProperties::indices() const
         auto const& elements = storage.elements();
         Vector<u32> indices;
         indices.ensure_capacity(storage.array_like_size());
+        if (!storage.may_contain_holes()) {
+            for (size_t i = 0; i < storage.array_like_size(); ++i)
+                indices.unchecked_append(i);
+            return indices;
+        }
         for (size_t i = 0; i < elements.size(); ++i) {
             if (!elements.at(i).is_empty())
                 indices.unchecked_append(i);
@@ -45,9 +45,32 @@ public:
     SimpleIndexedPropertyStorage() = default;
     explicit SimpleIndexedPropertyStorage(Vector<Value>&& initial_values);
 
-    virtual bool has_index(u32 index) const override;
-    virtual Optional<ValueAndAttributes> get(u32 index) const override;
-    virtual void put(u32 index, Value value, PropertyAttributes attributes = default_attributes) override;
+    virtual bool has_index(u32 index) const override
+    {
+        return index < m_array_size && !m_packed_elements[index].is_empty();
+    }
+
+    virtual Optional<ValueAndAttributes> get(u32 index) const override
+    {
+        if (!has_index(index))
+            return {};
+        return ValueAndAttributes { m_packed_elements[index], default_attributes };
+    }
+
+    virtual void put(u32 index, Value value, PropertyAttributes attributes = default_attributes) override
+    {
+        VERIFY(attributes == default_attributes);
+
+        if (index >= m_array_size) {
+            // Writing past the end leaves holes between the old and new array size.
+            if (index > m_array_size)
+                m_may_have_holes = true;
+            m_array_size = index + 1;
+            grow_storage_if_needed();
+        }
+        m_packed_elements[index] = value;
+    }
+
     virtual void remove(u32 index) override;
 
     virtual ValueAndAttributes take_first() override;
@@ -60,12 +83,18 @@ public:
     virtual bool is_simple_storage() const override { return true; }
     Vector<Value> const& elements() const { return m_packed_elements; }
 
+    // A packed storage has a value at every index below array_like_size(), so
+    // iteration doesn't have to check each element for emptiness. The flag is
+    // conservative: filling in the last hole doesn't clear it.
+    bool may_contain_holes() const { return m_may_have_holes; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
     size_t m_array_size { 0 };
+    bool m_may_have_holes { false };
     Vector<Value> m_packed_elements;
 };
 
@@ -122,9 +151,39 @@ public:
             m_storage = make<SimpleIndexedPropertyStorage>(move(values));
     }
 
-    bool has_index(u32 index) const { return m_storage ? m_storage->has_index(index) : false; }
-    Optional<ValueAndAttributes> get(u32 index) const;
-    void put(u32 index, Value value, PropertyAttributes attributes = default_attributes);
+    // NOTE: SimpleIndexedPropertyStorage is final, so casting to it first lets
+    //       the hot paths below avoid virtual dispatch on every element access.
+    bool has_index(u32 index) const
+    {
+        if (!m_storage)
+            return false;
+        if (m_storage->is_simple_storage())
+            return static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).has_index(index);
+        return m_storage->has_index(index);
+    }
+
+    Optional<ValueAndAttributes> get(u32 index) const
+    {
+        if (!m_storage)
+            return {};
+        if (m_storage->is_simple_storage())
+            return static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).get(index);
+        return m_storage->get(index);
+    }
+
+    void put(u32 index, Value value, PropertyAttributes attributes = default_attributes)
+    {
+        if (attributes == default_attributes && m_storage && m_storage->is_simple_storage()) {
+            auto& storage = static_cast<SimpleIndexedPropertyStorage&>(*m_storage);
+            // In-bounds stores and appends can't make simple storage sparse.
+            if (index <= storage.array_like_size()) {
+                storage.put(index, value);
+                return;
+            }
+        }
+        put_slow_case(index, value, attributes);
+    }
+
     void remove(u32 index);
 
     void append(Value value, PropertyAttributes attributes = default_attributes) { put(array_like_size(), value, attributes); }
@@ -133,6 +192,14 @@ public:
     IndexedPropertyIterator end() const { return IndexedPropertyIterator(*this, array_like_size(), false); };
 
     bool is_empty() const { return array_like_size() == 0; }
+
+    bool is_packed() const
+    {
+        if (!m_storage)
+            return true;
+        return m_storage->is_simple_storage() && !static_cast<SimpleIndexedPropertyStorage const&>(*m_storage).may_contain_holes();
+    }
+
     size_t array_like_size() const { return m_storage ? m_storage->array_like_size() : 0; }
     bool set_array_like_size(size_t);
 
@@ -155,6 +222,7 @@ public:
     }
 
 private:
+    void put_slow_case(u32 index, Value value, PropertyAttributes attributes);
     void switch_to_generic_storage();
     void ensure_storage();
 
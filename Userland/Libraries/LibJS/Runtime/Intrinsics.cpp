@@ -187,17 +187,11 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     static_cast<FunctionPrototype*>(m_function_prototype)->initialize(realm);
     static_cast<ObjectPrototype*>(m_object_prototype)->initialize(realm);
 
-#define __JS_ENUMERATE(ClassName, snake_name) \
-    VERIFY(!m_##snake_name##_prototype);      \
-    m_##snake_name##_prototype = heap().allocate<ClassName##Prototype>(realm, realm).release_allocated_value_but_fixme_should_propagate_errors();
-    JS_ENUMERATE_ITERATOR_PROTOTYPES
-#undef __JS_ENUMERATE
-
-    // These must be initialized separately as they have no companion constructor
-    m_async_from_sync_iterator_prototype = heap().allocate<AsyncFromSyncIteratorPrototype>(realm, realm).release_allocated_value_but_fixme_should_propagate_errors();
+    // These must be initialized separately as they have no companion constructor.
+    // NOTE: The other constructor-less prototypes are created lazily by their accessors,
+    //       but these two are wired up to the generator function prototypes below.
     m_async_generator_prototype = heap().allocate<AsyncGeneratorPrototype>(realm, realm).release_allocated_value_but_fixme_should_propagate_errors();
     m_generator_prototype = heap().allocate<GeneratorPrototype>(realm, realm).release_allocated_value_but_fixme_should_propagate_errors();
-    m_intl_segments_prototype = heap().allocate<Intl::SegmentsPrototype>(realm, realm).release_allocated_value_but_fixme_should_propagate_errors();
 
     // These must be initialized before allocating...
     // - AggregateErrorPrototype, which uses ErrorPrototype as its prototype
@@ -249,14 +243,69 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
 
     // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
+}
+
+// NOTE: These are looked up lazily so that merely creating a realm doesn't force Array,
+//       Date and JSON to be fully initialized; the lookup itself initializes the builtin.
+FunctionObject* Intrinsics::array_prototype_values_function()
+{
+    if (!m_array_prototype_values_function)
+        m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm().names.values).as_function();
+    return m_array_prototype_values_function;
+}
 
-    m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
-    m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
+FunctionObject* Intrinsics::date_constructor_now_function()
+{
+    if (!m_date_constructor_now_function)
+        m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm().names.now).as_function();
+    return m_date_constructor_now_function;
 }
 
+FunctionObject* Intrinsics::json_parse_function()
+{
+    if (!m_json_parse_function)
+        m_json_parse_function = &json_object()->get_without_side_effects(vm().names.parse).as_function();
+    return m_json_parse_function;
+}
+
+FunctionObject* Intrinsics::json_stringify_function()
+{
+    if (!m_json_stringify_function)
+        m_json_stringify_function = &json_object()->get_without_side_effects(vm().names.stringify).as_function();
+    return m_json_stringify_function;
+}
+
+FunctionObject* Intrinsics::object_prototype_to_string_function()
+{
+    if (!m_object_prototype_to_string_function)
+        m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm().names.toString).as_function();
+    return m_object_prototype_to_string_function;
+}
+
+Object* Intrinsics::async_from_sync_iterator_prototype()
+{
+    if (!m_async_from_sync_iterator_prototype)
+        m_async_from_sync_iterator_prototype = heap().allocate<AsyncFromSyncIteratorPrototype>(m_realm, m_realm).release_allocated_value_but_fixme_should_propagate_errors();
+    return m_async_from_sync_iterator_prototype;
+}
+
+Object* Intrinsics::intl_segments_prototype()
+{
+    if (!m_intl_segments_prototype)
+        m_intl_segments_prototype = heap().allocate<Intl::SegmentsPrototype>(m_realm, m_realm).release_allocated_value_but_fixme_should_propagate_errors();
+    return m_intl_segments_prototype;
+}
+
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                                                          \
+    Object* Intrinsics::snake_name##_prototype()                                                                                                       \
+    {                                                                                                                                                  \
+        if (!m_##snake_name##_prototype)                                                                                                               \
+            m_##snake_name##_prototype = heap().allocate<ClassName##Prototype>(m_realm, m_realm).release_allocated_value_but_fixme_should_propagate_errors(); \
+        return m_##snake_name##_prototype;                                                                                                             \
+    }
+JS_ENUMERATE_ITERATOR_PROTOTYPES
+#undef __JS_ENUMERATE
+
 template<typename T>
 constexpr inline bool IsTypedArrayConstructor = false;
 
@@ -26,7 +26,7 @@ public:
     ProxyConstructor* proxy_constructor() { return m_proxy_constructor; }
 
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct constructor
-    Object* async_from_sync_iterator_prototype() { return m_async_from_sync_iterator_prototype; }
+    Object* async_from_sync_iterator_prototype();
     Object* async_generator_prototype() { return m_async_generator_prototype; }
     Object* generator_prototype() { return m_generator_prototype; }
 
@@ -36,7 +36,7 @@ public:
     Object* generator_function_prototype_prototype() { return m_generator_prototype; }
 
     // Not included in JS_ENUMERATE_INTL_OBJECTS due to missing distinct constructor
-    Object* intl_segments_prototype() { return m_intl_segments_prototype; }
+    Object* intl_segments_prototype();
 
     // Global object functions
     FunctionObject* eval_function() const { return m_eval_function; }
@@ -52,11 +52,13 @@ public:
     FunctionObject* unescape_function() const { return m_unescape_function; }
 
     // Namespace/constructor object functions
-    FunctionObject* array_prototype_values_function() const { return m_array_prototype_values_function; }
-    FunctionObject* date_constructor_now_function() const { return m_date_constructor_now_function; }
-    FunctionObject* json_parse_function() const { return m_json_parse_function; }
-    FunctionObject* json_stringify_function() const { return m_json_stringify_function; }
-    FunctionObject* object_prototype_to_string_function() const { return m_object_prototype_to_string_function; }
+    // NOTE: These perform the underlying builtin lookup on first access, so that a fresh
+    //       realm doesn't have to fully initialize Array, Date and JSON just to cache them.
+    FunctionObject* array_prototype_values_function();
+    FunctionObject* date_constructor_now_function();
+    FunctionObject* json_parse_function();
+    FunctionObject* json_stringify_function();
+    FunctionObject* object_prototype_to_string_function();
     FunctionObject* throw_type_error_function() const { return m_throw_type_error_function; }
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -83,10 +85,7 @@ public:
 #undef __JS_ENUMERATE
 
 #define __JS_ENUMERATE(ClassName, snake_name) \
-    Object* snake_name##_prototype()          \
-    {                                         \
-        return m_##snake_name##_prototype;    \
-    }
+    Object* snake_name##_prototype();
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
@@ -1078,10 +1078,16 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
             ensure_shape_is_unique();
         }
 
-        if (m_shape->is_unique())
+        if (m_shape->is_unique()) {
             m_shape->add_property_to_unique_shape(property_key_string_or_symbol, attributes);
-        else
+        } else {
             set_shape(*m_shape->create_put_transition(property_key_string_or_symbol, attributes));
+            if (m_storage.is_empty()) {
+                // If earlier objects already walked further down this transition
+                // chain, reserve storage for where we're likely headed.
+                m_storage.ensure_capacity(m_shape->descendant_property_count_hint());
+            }
+        }
 
         m_storage.append(value);
         return;
@@ -24,6 +24,13 @@ Shape* Shape::create_unique_clone() const
 
 Shape* Shape::get_or_prune_cached_forward_transition(TransitionKey const& key)
 {
+    if (m_inline_forward_transition_key.has_value() && *m_inline_forward_transition_key == key) {
+        if (auto* shape = m_inline_forward_transition.ptr())
+            return shape;
+        // The cached forward transition has gone stale (from garbage collection). Prune it.
+        m_inline_forward_transition_key.clear();
+        return nullptr;
+    }
     if (!m_forward_transitions)
         return nullptr;
     auto it = m_forward_transitions->find(key);
@@ -37,6 +44,21 @@ Shape* Shape::get_or_prune_cached_forward_transition(TransitionKey const& key)
     return it->value;
 }
 
+void Shape::cache_forward_transition(TransitionKey const& key, Shape* shape)
+{
+    if (!m_forward_transitions) {
+        if (!m_inline_forward_transition_key.has_value() || !m_inline_forward_transition) {
+            m_inline_forward_transition_key = key;
+            m_inline_forward_transition = shape;
+            return;
+        }
+        // A second distinct transition; time to escalate to a real table.
+        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+        m_forward_transitions->set(m_inline_forward_transition_key.release_value(), move(m_inline_forward_transition));
+    }
+    m_forward_transitions->set(key, shape);
+}
+
 Shape* Shape::get_or_prune_cached_prototype_transition(Object* prototype)
 {
     if (!m_prototype_transitions)
@@ -58,9 +80,7 @@ Shape* Shape::create_put_transition(StringOrSymbol const& property_key, Property
     if (auto* existing_shape = get_or_prune_cached_forward_transition(key))
         return existing_shape;
     auto new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Put);
-    if (!m_forward_transitions)
-        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-    m_forward_transitions->set(key, new_shape.ptr());
+    cache_forward_transition(key, new_shape.ptr());
     return new_shape;
 }
 
@@ -70,9 +90,7 @@ Shape* Shape::create_configure_transition(StringOrSymbol const& property_key, Pr
     if (auto* existing_shape = get_or_prune_cached_forward_transition(key))
         return existing_shape;
     auto new_shape = heap().allocate_without_realm<Shape>(*this, property_key, attributes, TransitionType::Configure);
-    if (!m_forward_transitions)
-        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-    m_forward_transitions->set(key, new_shape.ptr());
+    cache_forward_transition(key, new_shape.ptr());
     return new_shape;
 }
 
@@ -101,6 +119,16 @@ Shape::Shape(Shape& previous_shape, StringOrSymbol const& property_key, Property
     , m_attributes(attributes)
     , m_transition_type(transition_type)
 {
+    if (transition_type == TransitionType::Put) {
+        // Propagate how deep this transition chain has gotten so far, so
+        // objects about to follow it can pre-size their property storage.
+        m_descendant_property_count_hint = m_property_count;
+        for (auto* shape = &previous_shape; shape; shape = shape->m_previous) {
+            if (shape->m_descendant_property_count_hint >= m_property_count)
+                break;
+            shape->m_descendant_property_count_hint = m_property_count;
+        }
+    }
 }
 
 Shape::Shape(Shape& previous_shape, Object* new_prototype)
@@ -135,7 +163,7 @@ Optional<PropertyMetadata> Shape::lookup(StringOrSymbol const& property_key) con
     return property;
 }
 
-FLATTEN HashMap<StringOrSymbol, PropertyMetadata> const& Shape::property_table() const
+FLATTEN FlatHashMap<StringOrSymbol, PropertyMetadata> const& Shape::property_table() const
 {
     ensure_property_table();
     return *m_property_table;
@@ -157,7 +185,7 @@ void Shape::ensure_property_table() const
 {
     if (m_property_table)
         return;
-    m_property_table = make<HashMap<StringOrSymbol, PropertyMetadata>>();
+    m_property_table = make<FlatHashMap<StringOrSymbol, PropertyMetadata>>();
 
     u32 next_offset = 0;
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/FlatHashMap.h>
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
@@ -65,9 +66,14 @@ public:
     Object const* prototype() const { return m_prototype; }
 
     Optional<PropertyMetadata> lookup(StringOrSymbol const&) const;
-    HashMap<StringOrSymbol, PropertyMetadata> const& property_table() const;
+    FlatHashMap<StringOrSymbol, PropertyMetadata> const& property_table() const;
     u32 property_count() const { return m_property_count; }
 
+    // The highest property count seen in any shape that descends from this
+    // one. Objects use this to pre-size their property storage when they
+    // start down a transition chain some earlier object already walked.
+    u32 descendant_property_count_hint() const { return m_descendant_property_count_hint; }
+
     struct Property {
         StringOrSymbol key;
         PropertyMetadata value;
@@ -89,13 +95,20 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     Shape* get_or_prune_cached_forward_transition(TransitionKey const&);
+    void cache_forward_transition(TransitionKey const&, Shape*);
     Shape* get_or_prune_cached_prototype_transition(Object* prototype);
 
     void ensure_property_table() const;
 
     Realm& m_realm;
 
-    mutable OwnPtr<HashMap<StringOrSymbol, PropertyMetadata>> m_property_table;
+    mutable OwnPtr<FlatHashMap<StringOrSymbol, PropertyMetadata>> m_property_table;
+
+    // Most shapes only ever see a single forward transition, so that one
+    // lives in an inline slot; the hash map is only allocated once a second
+    // distinct transition shows up.
+    Optional<TransitionKey> m_inline_forward_transition_key;
+    WeakPtr<Shape> m_inline_forward_transition;
 
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<Object*, WeakPtr<Shape>>> m_prototype_transitions;
@@ -103,6 +116,7 @@ private:
     StringOrSymbol m_property_key;
     Object* m_prototype { nullptr };
     u32 m_property_count { 0 };
+    u32 m_descendant_property_count_hint { 0 };
 
     PropertyAttributes m_attributes { 0 };
     TransitionType m_transition_type : 6 { TransitionType::Invalid };
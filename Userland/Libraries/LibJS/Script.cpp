@@ -4,17 +4,56 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
+#include <LibJS/SourceCode.h>
 
 namespace JS {
 
+// NOTE: The same script source is often parsed many times over the lifetime of
+//       a process (think page reloads fetching an identical framework bundle),
+//       and parsing dominates the cost of those loads. We keep a process-wide
+//       cache of parsed programs keyed by source text, so parsing an identical
+//       script again becomes a hash lookup. Sharing a Program between scripts
+//       (and realms) is safe: the AST is immutable during execution, apart from
+//       caches that are either keyed per realm or derived purely from the scope
+//       structure, which is the same for identical source.
+static constexpr size_t maximum_cached_programs = 128;
+static constexpr size_t minimum_cacheable_source_length = 1 * KiB;
+
+static HashMap<u32, NonnullRefPtr<Program>>& cached_programs()
+{
+    static HashMap<u32, NonnullRefPtr<Program>> s_cached_programs;
+    return s_cached_programs;
+}
+
+static RefPtr<Program> find_cached_program(StringView source_text, StringView filename)
+{
+    auto it = cached_programs().find(source_text.hash());
+    if (it == cached_programs().end())
+        return nullptr;
+    auto const& source_code = it->value->source_range().code;
+    if (source_code->code().bytes_as_string_view() != source_text
+        || source_code->filename().bytes_as_string_view() != filename)
+        return nullptr;
+    return it->value;
+}
+
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    // Only sources starting at line 1 are cacheable; an inline script's line
+    // number offset is baked into the source ranges of its AST.
+    bool may_use_cached_program = line_number_offset == 1 && source_text.length() >= minimum_cacheable_source_length;
+    if (may_use_cached_program) {
+        if (auto cached_program = find_cached_program(source_text, filename))
+            return realm.heap().allocate_without_realm<Script>(realm, filename, cached_program.release_nonnull(), host_defined);
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -23,6 +62,12 @@ Result<NonnullGCPtr<Script>, Vector<ParserError>> Script::parse(StringView sourc
     if (parser.has_errors())
         return parser.errors();
 
+    if (may_use_cached_program) {
+        if (cached_programs().size() >= maximum_cached_programs)
+            cached_programs().clear();
+        cached_programs().set(source_text.hash(), script);
+    }
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate_without_realm<Script>(realm, filename, move(script), host_defined);
 }
@@ -197,21 +197,21 @@ Editor::~Editor()
         restore();
 }
 
-void Editor::ensure_free_lines_from_origin(size_t count)
+ErrorOr<void> Editor::ensure_free_lines_from_origin(size_t count, AK::Stream& stream)
 {
     if (count > m_num_lines) {
         // FIXME: Implement paging
     }
 
     if (m_origin_row + count <= m_num_lines)
-        return;
+        return {};
 
     auto diff = m_origin_row + count - m_num_lines - 1;
-    out(stderr, "\x1b[{}S", diff);
-    fflush(stderr);
+    TRY(stream.write_entire_buffer(DeprecatedString::formatted("\x1b[{}S", diff).bytes()));
     m_origin_row -= diff;
     m_refresh_needed = false;
     m_chars_touched_in_the_middle = 0;
+    return {};
 }
 
 void Editor::get_terminal_size()
@@ -1538,15 +1538,28 @@ ErrorOr<void> Editor::refresh_display()
         }
     }
 
-    // Ouch, reflow entire line.
-    if (!has_cleaned_up) {
-        TRY(cleanup());
-    }
-    TRY(VT::move_absolute(m_origin_row, m_origin_column, output_stream));
+    if (m_cached_prompt_valid && !m_always_refresh && !has_cleaned_up) {
+        // The prompt is unchanged and already on the screen, so move the cursor
+        // just past it and repaint only the buffer. On slow terminals (serial
+        // consoles, telnet sessions) re-emitting the prompt on every mid-line
+        // edit is most of the traffic.
+        auto saved_cursor = m_cursor;
+        m_cursor = 0;
+        TRY(reposition_cursor(output_stream));
+        m_cursor = saved_cursor;
+        TRY(VT::clear_to_end_of_screen(output_stream));
+        m_extra_forward_lines = 0;
+    } else {
+        // Ouch, reflow entire line.
+        if (!has_cleaned_up) {
+            TRY(cleanup());
+        }
+        TRY(VT::move_absolute(m_origin_row, m_origin_column, output_stream));
 
-    TRY(output_stream.write_entire_buffer(m_new_prompt.bytes()));
+        TRY(output_stream.write_entire_buffer(m_new_prompt.bytes()));
 
-    TRY(VT::clear_to_end_of_line(output_stream));
+        TRY(VT::clear_to_end_of_line(output_stream));
+    }
     StringBuilder builder;
     for (size_t i = 0; i < m_buffer.size(); ++i) {
         TRY(apply_styles(i));
@@ -1595,7 +1608,7 @@ ErrorOr<void> Editor::reposition_cursor(AK::Stream& stream, bool to_end)
     auto line = cursor_line() - 1;
     auto column = offset_in_line();
 
-    ensure_free_lines_from_origin(line);
+    TRY(ensure_free_lines_from_origin(line, stream));
 
     VERIFY(column + m_origin_column <= m_num_columns);
     TRY(VT::move_absolute(line + m_origin_row, column + m_origin_column, stream));
@@ -1813,6 +1826,11 @@ ErrorOr<void> VT::clear_to_end_of_line(AK::Stream& stream)
     return stream.write_entire_buffer("\033[K"sv.bytes());
 }
 
+ErrorOr<void> VT::clear_to_end_of_screen(AK::Stream& stream)
+{
+    return stream.write_entire_buffer("\033[J"sv.bytes());
+}
+
 enum VTState {
     Free = 1,
     Escape = 3,
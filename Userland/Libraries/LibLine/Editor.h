@@ -275,7 +275,7 @@ private:
     ErrorOr<void> handle_read_event();
     ErrorOr<void> handle_resize_event(bool reset_origin);
 
-    void ensure_free_lines_from_origin(size_t count);
+    ErrorOr<void> ensure_free_lines_from_origin(size_t count, AK::Stream&);
 
     Result<Vector<size_t, 2>, Error> vt_dsr();
     void remove_at_index(size_t);
@@ -222,7 +222,8 @@ void Editor::enter_search()
             m_pre_search_buffer.append(code_point);
         m_pre_search_cursor = m_cursor;
 
-        ensure_free_lines_from_origin(1 + num_lines());
+        if (auto stderr_stream_or_error = Core::Stream::File::standard_error(); !stderr_stream_or_error.is_error())
+            (void)ensure_free_lines_from_origin(1 + num_lines(), *stderr_stream_or_error.value());
 
         // Disable our own notifier so as to avoid interfering with the search editor.
         m_notifier->set_enabled(false);
@@ -87,18 +87,24 @@ static bool try_parse_block(LineIterator& lines, NonnullOwnPtrVector<Block>& blo
     return true;
 }
 
-OwnPtr<ContainerBlock> ContainerBlock::parse(LineIterator& lines)
+OwnPtr<ContainerBlock> ContainerBlock::parse(LineIterator& lines, Vector<size_t>* top_level_block_start_lines)
 {
     NonnullOwnPtrVector<Block> blocks;
 
     StringBuilder paragraph_text;
     Heading* current_section = nullptr;
 
+    LineIterator const origin = lines;
+    Optional<size_t> paragraph_start_line;
+
     auto flush_paragraph = [&] {
         if (paragraph_text.is_empty())
             return;
         auto paragraph = make<Paragraph>(Text::parse(paragraph_text.to_deprecated_string()));
         blocks.append(move(paragraph));
+        if (top_level_block_start_lines)
+            top_level_block_start_lines->append(paragraph_start_line.value());
+        paragraph_start_line = {};
         paragraph_text.clear();
     };
 
@@ -119,6 +125,8 @@ OwnPtr<ContainerBlock> ContainerBlock::parse(LineIterator& lines)
             has_blank_lines = has_blank_lines || has_trailing_blank_lines;
         }
 
+        size_t const current_line = static_cast<size_t>(lines - origin);
+
         bool heading = false;
         if ((heading = try_parse_block<Heading>(lines, blocks)))
             current_section = dynamic_cast<Heading*>(&blocks.last());
@@ -138,9 +146,13 @@ OwnPtr<ContainerBlock> ContainerBlock::parse(LineIterator& lines)
                 flush_paragraph();
                 blocks.append(move(last_block));
             }
+            if (top_level_block_start_lines)
+                top_level_block_start_lines->append(current_line);
             continue;
         }
 
+        if (!paragraph_start_line.has_value())
+            paragraph_start_line = current_line;
         if (!paragraph_text.is_empty())
             paragraph_text.append('\n');
         paragraph_text.append(*lines++);
@@ -30,7 +30,9 @@ public:
     virtual Vector<DeprecatedString> render_lines_for_terminal(size_t view_width = 0) const override;
     virtual RecursionDecision walk(Visitor&) const override;
 
-    static OwnPtr<ContainerBlock> parse(LineIterator& lines);
+    // If top_level_block_start_lines is non-null, the 0-based source line on
+    // which each parsed block starts is appended to it, parallel to blocks().
+    static OwnPtr<ContainerBlock> parse(LineIterator& lines, Vector<size_t>* top_level_block_start_lines = nullptr);
 
     bool has_blank_lines() const { return m_has_blank_lines; }
     bool has_trailing_blank_lines() const { return m_has_trailing_blank_lines; }
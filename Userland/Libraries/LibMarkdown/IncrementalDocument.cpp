@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibMarkdown/ContainerBlock.h>
+#include <LibMarkdown/IncrementalDocument.h>
+#include <LibMarkdown/LineIterator.h>
+
+namespace Markdown {
+
+// An edit can change how its immediate neighbours parse (typing right above a
+// list may continue it, for example), so the reparsed span is padded by one
+// extra block on each side.
+static constexpr size_t block_slop = 1;
+
+// Returns the fence ("```...", "~~~...") opening the line, if any, mirroring
+// CodeBlock's fence syntax.
+static StringView fence_of(StringView line)
+{
+    size_t indent = 0;
+    while (indent < line.length() && indent < 3 && line[indent] == ' ')
+        ++indent;
+    line = line.substring_view(indent);
+    if (line.is_empty() || (line[0] != '`' && line[0] != '~'))
+        return {};
+    size_t length = 0;
+    while (length < line.length() && line[length] == line[0])
+        ++length;
+    if (length < 3)
+        return {};
+    return line.substring_view(0, length);
+}
+
+static bool span_reparses_in_isolation(Vector<StringView> const& lines)
+{
+    // A code fence or HTML comment still open at the end of the span would
+    // swallow the blocks following it, so such spans force a full reparse.
+    // This mirrors how CodeBlock and CommentBlock consume lines.
+    StringView open_fence;
+    bool in_comment = false;
+
+    for (auto const& line : lines) {
+        if (in_comment) {
+            if (line.ends_with("-->"sv))
+                in_comment = false;
+            continue;
+        }
+        if (!open_fence.is_empty()) {
+            auto fence = fence_of(line);
+            if (!fence.is_empty() && fence[0] == open_fence[0] && fence.length() >= open_fence.length() && line.trim_whitespace().length() == fence.length())
+                open_fence = {};
+            continue;
+        }
+        auto fence = fence_of(line);
+        if (!fence.is_empty()) {
+            open_fence = fence;
+            continue;
+        }
+        if (line.starts_with("<!--"sv) && !line.ends_with("-->"sv))
+            in_comment = true;
+    }
+
+    return open_fence.is_empty() && !in_comment;
+}
+
+DeprecatedString const& IncrementalDocument::render_to_inline_html(StringView source)
+{
+    Vector<StringView> const new_lines = source.lines();
+
+    if (!try_incremental_update(new_lines))
+        reparse_all(new_lines);
+
+    return m_rendered_html;
+}
+
+DeprecatedString IncrementalDocument::render_to_html(StringView source, StringView extra_head_contents)
+{
+    StringBuilder builder;
+    builder.append(R"~~~(<!DOCTYPE html>
+<html>
+<head>
+    <style>
+        code { white-space: pre; }
+    </style>
+)~~~"sv);
+    if (!extra_head_contents.is_empty())
+        builder.append(extra_head_contents);
+    builder.append(R"~~~(
+</head>
+<body>
+)~~~"sv);
+
+    builder.append(render_to_inline_html(source));
+
+    builder.append(R"~~~(
+</body>
+</html>)~~~"sv);
+
+    return builder.to_deprecated_string();
+}
+
+void IncrementalDocument::parse_into_cache(Vector<StringView> const& lines, size_t first_line, Vector<CachedBlock>& cache)
+{
+    Vector<size_t> block_start_lines;
+    LineIterator iterator(lines.begin());
+    auto container = ContainerBlock::parse(iterator, &block_start_lines);
+    VERIFY(block_start_lines.size() == container->blocks().size());
+
+    // The document is not a tight container, so concatenating the blocks'
+    // individual HTML is exactly what ContainerBlock::render_to_html() emits.
+    for (size_t i = 0; i < container->blocks().size(); ++i)
+        cache.append({ first_line + block_start_lines[i], container->blocks()[i].render_to_html() });
+}
+
+void IncrementalDocument::reparse_all(Vector<StringView> const& new_lines)
+{
+    m_blocks.clear();
+    parse_into_cache(new_lines, 0, m_blocks);
+    remember_source_and_rebuild_html(new_lines);
+}
+
+bool IncrementalDocument::try_incremental_update(Vector<StringView> const& new_lines)
+{
+    if (m_blocks.is_empty())
+        return false;
+
+    size_t const old_line_count = m_source_lines.size();
+    size_t const new_line_count = new_lines.size();
+
+    size_t common_prefix = 0;
+    while (common_prefix < old_line_count && common_prefix < new_line_count && m_source_lines[common_prefix] == new_lines[common_prefix])
+        ++common_prefix;
+
+    if (common_prefix == old_line_count && old_line_count == new_line_count)
+        return true;
+
+    size_t const max_suffix = min(old_line_count, new_line_count) - common_prefix;
+    size_t common_suffix = 0;
+    while (common_suffix < max_suffix && m_source_lines[old_line_count - 1 - common_suffix] == new_lines[new_line_count - 1 - common_suffix])
+        ++common_suffix;
+
+    size_t const first_dirty_line = common_prefix;
+    size_t const dirty_old_end = old_line_count - common_suffix;
+
+    auto block_containing = [&](size_t line) -> size_t {
+        size_t index = 0;
+        for (size_t i = 0; i < m_blocks.size(); ++i) {
+            if (m_blocks[i].start_line > line)
+                break;
+            index = i;
+        }
+        return index;
+    };
+
+    size_t first_block = block_containing(first_dirty_line);
+    size_t last_block = block_containing(max(dirty_old_end, static_cast<size_t>(1)) - 1);
+    first_block -= min(first_block, block_slop);
+    last_block = min(last_block + block_slop, m_blocks.size() - 1);
+
+    size_t const reparse_start_line = first_block == 0 ? 0 : m_blocks[first_block].start_line;
+    size_t const old_reparse_end_line = last_block + 1 < m_blocks.size() ? m_blocks[last_block + 1].start_line : old_line_count;
+
+    // Everything after the reparsed span has to sit inside the unchanged
+    // suffix for the cached blocks there to remain valid.
+    if (old_line_count - old_reparse_end_line > common_suffix)
+        return false;
+    size_t const new_reparse_end_line = new_line_count - (old_line_count - old_reparse_end_line);
+    if (new_reparse_end_line < reparse_start_line)
+        return false;
+
+    Vector<StringView> middle_lines;
+    middle_lines.ensure_capacity(new_reparse_end_line - reparse_start_line);
+    for (size_t i = reparse_start_line; i < new_reparse_end_line; ++i)
+        middle_lines.unchecked_append(new_lines[i]);
+
+    if (!span_reparses_in_isolation(middle_lines))
+        return false;
+
+    Vector<CachedBlock> updated_blocks;
+    for (size_t i = 0; i < first_block; ++i)
+        updated_blocks.append(move(m_blocks[i]));
+
+    parse_into_cache(middle_lines, reparse_start_line, updated_blocks);
+
+    for (size_t i = last_block + 1; i < m_blocks.size(); ++i) {
+        auto block = move(m_blocks[i]);
+        block.start_line = block.start_line - old_reparse_end_line + new_reparse_end_line;
+        updated_blocks.append(move(block));
+    }
+
+    m_blocks = move(updated_blocks);
+    remember_source_and_rebuild_html(new_lines);
+    return true;
+}
+
+void IncrementalDocument::remember_source_and_rebuild_html(Vector<StringView> const& new_lines)
+{
+    m_source_lines.clear_with_capacity();
+    m_source_lines.ensure_capacity(new_lines.size());
+    for (auto const& line : new_lines)
+        m_source_lines.unchecked_append(line);
+
+    StringBuilder builder;
+    for (auto const& block : m_blocks)
+        builder.append(block.html);
+    m_rendered_html = builder.to_deprecated_string();
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/DeprecatedString.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+
+namespace Markdown {
+
+// Renders successive revisions of a markdown document, reparsing only the
+// top-level blocks that intersect the edit and reusing the cached HTML of
+// every untouched block. Intended for live previews, where each revision
+// differs from the previous one by a few lines at most.
+class IncrementalDocument final {
+public:
+    IncrementalDocument() = default;
+
+    DeprecatedString const& render_to_inline_html(StringView source);
+    DeprecatedString render_to_html(StringView source, StringView extra_head_contents = ""sv);
+
+private:
+    struct CachedBlock {
+        size_t start_line { 0 };
+        DeprecatedString html;
+    };
+
+    bool try_incremental_update(Vector<StringView> const& new_lines);
+    void reparse_all(Vector<StringView> const& new_lines);
+    void parse_into_cache(Vector<StringView> const& lines, size_t first_line, Vector<CachedBlock>& cache);
+    void remember_source_and_rebuild_html(Vector<StringView> const& new_lines);
+
+    Vector<DeprecatedString> m_source_lines;
+    Vector<CachedBlock> m_blocks;
+    DeprecatedString m_rendered_html;
+};
+
+}
@@ -57,6 +57,13 @@ PDFErrorOr<NonnullRefPtr<Document>> Document::create(ReadonlyBytes bytes)
     return document;
 }
 
+PDFErrorOr<NonnullRefPtr<Document>> Document::create(NonnullRefPtr<Core::MappedFile> mapped_file)
+{
+    auto document = TRY(create(mapped_file->bytes()));
+    document->m_mapped_file = move(mapped_file);
+    return document;
+}
+
 Document::Document(NonnullRefPtr<DocumentParser> const& parser)
     : m_parser(parser)
 {
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/RefCounted.h>
 #include <AK/Weakable.h>
+#include <LibCore/MappedFile.h>
 #include <LibGfx/Color.h>
 #include <LibPDF/DocumentParser.h>
 #include <LibPDF/Encryption.h>
@@ -82,6 +83,11 @@ class Document final
 public:
     static PDFErrorOr<NonnullRefPtr<Document>> create(ReadonlyBytes bytes);
 
+    // Keeps the mapping alive for the lifetime of the document. Objects are
+    // materialized lazily straight from the mapped bytes, so only the parts of
+    // a large file that are actually visited get touched.
+    static PDFErrorOr<NonnullRefPtr<Document>> create(NonnullRefPtr<Core::MappedFile> mapped_file);
+
     // If a security handler is present, it is the caller's responsibility to ensure
     // this document is unencrypted before calling this function. The user does not
     // need to handle the case where the user password is the empty string.
@@ -149,6 +155,7 @@ private:
     PDFErrorOr<NonnullRefPtr<Object>> find_in_name_tree_nodes(NonnullRefPtr<ArrayObject> siblings, DeprecatedFlyString name);
     PDFErrorOr<NonnullRefPtr<Object>> find_in_key_value_array(NonnullRefPtr<ArrayObject> key_value_array, DeprecatedFlyString name);
 
+    RefPtr<Core::MappedFile> m_mapped_file;
     NonnullRefPtr<DocumentParser> m_parser;
     RefPtr<DictObject> m_catalog;
     RefPtr<DictObject> m_trailer;
@@ -324,7 +324,7 @@ void StandardSecurityHandler::encrypt(NonnullRefPtr<Object> object, Reference re
         bytes = stream->bytes();
 
         assign = [&stream](ByteBuffer const& buffer) {
-            stream->buffer() = buffer;
+            stream->set_buffer(buffer);
         };
 
         if (stream->dict()->contains(CommonNames::Filter)) {
@@ -156,14 +156,29 @@ public:
     explicit StreamObject(NonnullRefPtr<DictObject> const& dict, ByteBuffer const& bytes)
         : m_dict(dict)
         , m_buffer(bytes)
+        , m_bytes(m_buffer.bytes())
+    {
+    }
+
+    // Creates a stream whose data is a view into memory owned by someone else,
+    // typically the document's backing buffer or mapping. The backing memory
+    // must outlive the stream object.
+    StreamObject(NonnullRefPtr<DictObject> const& dict, ReadonlyBytes unowned_bytes)
+        : m_dict(dict)
+        , m_bytes(unowned_bytes)
     {
     }
 
     virtual ~StreamObject() override = default;
 
     [[nodiscard]] ALWAYS_INLINE NonnullRefPtr<DictObject> dict() const { return m_dict; }
-    [[nodiscard]] ReadonlyBytes bytes() const { return m_buffer.bytes(); };
-    [[nodiscard]] ByteBuffer& buffer() { return m_buffer; };
+    [[nodiscard]] ReadonlyBytes bytes() const { return m_bytes; };
+
+    void set_buffer(ByteBuffer buffer)
+    {
+        m_buffer = move(buffer);
+        m_bytes = m_buffer.bytes();
+    }
 
     char const* type_name() const override { return "stream"; }
     DeprecatedString to_deprecated_string(int indent) const override;
@@ -172,7 +187,10 @@ private:
     bool is_stream() const override { return true; }
 
     NonnullRefPtr<DictObject> m_dict;
+    // Owns the stream data, unless the data is an unowned view into the
+    // document's backing memory, in which case this buffer is empty.
     ByteBuffer m_buffer;
+    ReadonlyBytes m_bytes;
 };
 
 class IndirectValue final : public Object {
@@ -469,7 +469,10 @@ PDFErrorOr<NonnullRefPtr<StreamObject>> Parser::parse_stream(NonnullRefPtr<DictO
     m_reader.move_by(9);
     m_reader.consume_whitespace();
 
-    auto stream_object = make_object<StreamObject>(dict, MUST(ByteBuffer::copy(bytes)));
+    // The stream object starts out referencing the document's backing memory
+    // directly; decryption and filters below replace the data with an owned
+    // buffer, so unencrypted, unfiltered streams never get copied.
+    auto stream_object = make_object<StreamObject>(dict, bytes);
 
     if (m_document->security_handler() && !m_disable_encryption)
         m_document->security_handler()->decrypt(stream_object, m_current_reference_stack.last());
@@ -511,7 +514,7 @@ PDFErrorOr<NonnullRefPtr<StreamObject>> Parser::parse_stream(NonnullRefPtr<DictO
             if (!decode_parms_vector.is_empty())
                 decode_parms = decode_parms_vector.at(i);
 
-            stream_object->buffer() = TRY(Filter::decode(stream_object->bytes(), filters.at(i), decode_parms));
+            stream_object->set_buffer(TRY(Filter::decode(stream_object->bytes(), filters.at(i), decode_parms)));
         }
     }
 
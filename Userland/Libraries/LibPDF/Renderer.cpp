@@ -7,6 +7,7 @@
 #include <AK/Utf8View.h>
 #include <LibPDF/CommonNames.h>
 #include <LibPDF/Fonts/PDFFont.h>
+#include <LibPDF/RenderingCache.h>
 #include <LibPDF/Interpolation.h>
 #include <LibPDF/Renderer.h>
 
@@ -21,9 +22,9 @@
 
 namespace PDF {
 
-PDFErrorsOr<void> Renderer::render(Document& document, Page const& page, RefPtr<Gfx::Bitmap> bitmap, RenderingPreferences rendering_preferences)
+PDFErrorsOr<void> Renderer::render(Document& document, Page const& page, RefPtr<Gfx::Bitmap> bitmap, RenderingPreferences rendering_preferences, RefPtr<RenderingCache> rendering_cache)
 {
-    return Renderer(document, page, bitmap, rendering_preferences).render();
+    return Renderer(document, page, bitmap, rendering_preferences, move(rendering_cache)).render();
 }
 
 static void rect_path(Gfx::Path& path, float x, float y, float width, float height)
@@ -49,13 +50,14 @@ static Gfx::Path rect_path(Gfx::Rect<T> const& rect)
     return path;
 }
 
-Renderer::Renderer(RefPtr<Document> document, Page const& page, RefPtr<Gfx::Bitmap> bitmap, RenderingPreferences rendering_preferences)
+Renderer::Renderer(RefPtr<Document> document, Page const& page, RefPtr<Gfx::Bitmap> bitmap, RenderingPreferences rendering_preferences, RefPtr<RenderingCache> rendering_cache)
     : m_document(document)
     , m_bitmap(bitmap)
     , m_page(page)
     , m_painter(*bitmap)
     , m_anti_aliasing_painter(m_painter)
     , m_rendering_preferences(rendering_preferences)
+    , m_rendering_cache(move(rendering_cache))
 {
     auto media_box = m_page.media_box;
 
@@ -90,23 +92,33 @@ PDFErrorsOr<void> Renderer::render()
     // FIXME: Text operators are supposed to only have effects on the current
     // stream object. Do the text operators treat this concatenated stream
     // as one stream or multiple?
-    ByteBuffer byte_buffer;
-
-    if (m_page.contents->is<ArrayObject>()) {
-        auto contents = m_page.contents->cast<ArrayObject>();
-        for (auto& ref : *contents) {
-            auto bytes = TRY(m_document->resolve_to<StreamObject>(ref))->bytes();
+    Vector<Operator> const* operators = nullptr;
+    Vector<Operator> parsed_operators;
+    if (m_rendering_cache)
+        operators = m_rendering_cache->operators_for(*m_page.contents);
+    if (!operators) {
+        ByteBuffer byte_buffer;
+
+        if (m_page.contents->is<ArrayObject>()) {
+            auto contents = m_page.contents->cast<ArrayObject>();
+            for (auto& ref : *contents) {
+                auto bytes = TRY(m_document->resolve_to<StreamObject>(ref))->bytes();
+                byte_buffer.append(bytes.data(), bytes.size());
+            }
+        } else {
+            auto bytes = m_page.contents->cast<StreamObject>()->bytes();
             byte_buffer.append(bytes.data(), bytes.size());
         }
-    } else {
-        auto bytes = m_page.contents->cast<StreamObject>()->bytes();
-        byte_buffer.append(bytes.data(), bytes.size());
-    }
 
-    auto operators = TRY(Parser::parse_operators(m_document, byte_buffer));
+        parsed_operators = TRY(Parser::parse_operators(m_document, byte_buffer));
+        if (m_rendering_cache)
+            operators = &m_rendering_cache->set_operators_for(*m_page.contents, move(parsed_operators));
+        else
+            operators = &parsed_operators;
+    }
 
     Errors errors;
-    for (auto& op : operators) {
+    for (auto& op : *operators) {
         auto maybe_error = handle_operator(op);
         if (maybe_error.is_error()) {
             errors.add_error(maybe_error.release_error());
@@ -424,7 +436,14 @@ RENDERER_HANDLER(text_set_font)
 
     auto& text_rendering_matrix = calculate_text_rendering_matrix();
     auto font_size = text_rendering_matrix.x_scale() * text_state().font_size;
-    auto font = TRY(PDFFont::create(m_document, font_dictionary, font_size));
+    RefPtr<PDFFont> font;
+    if (m_rendering_cache)
+        font = m_rendering_cache->font_for(*font_dictionary, font_size);
+    if (!font) {
+        font = TRY(PDFFont::create(m_document, font_dictionary, font_size));
+        if (m_rendering_cache)
+            m_rendering_cache->set_font_for(font_dictionary, font_size, *font);
+    }
     text_state().font = font;
 
     m_text_rendering_matrix_is_dirty = true;
@@ -641,8 +660,18 @@ RENDERER_HANDLER(paint_xobject)
         matrix = Vector { Value { 1 }, Value { 0 }, Value { 0 }, Value { 1 }, Value { 0 }, Value { 0 } };
     }
     MUST(handle_concatenate_matrix(matrix));
-    auto operators = TRY(Parser::parse_operators(m_document, xobject->bytes()));
-    for (auto& op : operators)
+    Vector<Operator> const* operators = nullptr;
+    Vector<Operator> parsed_operators;
+    if (m_rendering_cache)
+        operators = m_rendering_cache->operators_for(*xobject);
+    if (!operators) {
+        parsed_operators = TRY(Parser::parse_operators(m_document, xobject->bytes()));
+        if (m_rendering_cache)
+            operators = &m_rendering_cache->set_operators_for(*xobject, move(parsed_operators));
+        else
+            operators = &parsed_operators;
+    }
+    for (auto& op : *operators)
         TRY(handle_operator(op, xobject_resources));
     MUST(handle_restore_state({}));
     return {};
@@ -857,23 +886,30 @@ PDFErrorOr<void> Renderer::show_image(NonnullRefPtr<StreamObject> image)
         show_empty_image(width, height);
         return {};
     }
-    auto image_bitmap = TRY(load_image(image));
-    if (image_dict->contains(CommonNames::SMask)) {
-        auto smask_bitmap = TRY(load_image(TRY(image_dict->get_stream(m_document, CommonNames::SMask))));
-        VERIFY(smask_bitmap->rect() == image_bitmap->rect());
-        for (int j = 0; j < image_bitmap->height(); ++j) {
-            for (int i = 0; i < image_bitmap->width(); ++i) {
-                auto image_color = image_bitmap->get_pixel(i, j);
-                auto smask_color = smask_bitmap->get_pixel(i, j);
-                image_color = image_color.with_alpha(smask_color.luminosity());
-                image_bitmap->set_pixel(i, j, image_color);
+    RefPtr<Gfx::Bitmap> image_bitmap;
+    if (m_rendering_cache)
+        image_bitmap = m_rendering_cache->image_for(*image);
+    if (!image_bitmap) {
+        image_bitmap = TRY(load_image(image));
+        if (image_dict->contains(CommonNames::SMask)) {
+            auto smask_bitmap = TRY(load_image(TRY(image_dict->get_stream(m_document, CommonNames::SMask))));
+            VERIFY(smask_bitmap->rect() == image_bitmap->rect());
+            for (int j = 0; j < image_bitmap->height(); ++j) {
+                for (int i = 0; i < image_bitmap->width(); ++i) {
+                    auto image_color = image_bitmap->get_pixel(i, j);
+                    auto smask_color = smask_bitmap->get_pixel(i, j);
+                    image_color = image_color.with_alpha(smask_color.luminosity());
+                    image_bitmap->set_pixel(i, j, image_color);
+                }
             }
         }
+        if (m_rendering_cache)
+            m_rendering_cache->set_image_for(image, *image_bitmap);
     }
 
     auto image_space = calculate_image_space_transformation(width, height);
     auto image_rect = Gfx::FloatRect { 0, 0, width, height };
-    m_painter.draw_scaled_bitmap_with_transform(image_bitmap->rect(), image_bitmap, image_rect, image_space);
+    m_painter.draw_scaled_bitmap_with_transform(image_bitmap->rect(), *image_bitmap, image_rect, image_space);
     return {};
 }
 
@@ -96,10 +96,12 @@ struct RenderingPreferences {
 
 class Renderer {
 public:
-    static PDFErrorsOr<void> render(Document&, Page const&, RefPtr<Gfx::Bitmap>, RenderingPreferences preferences);
+    // The cache is optional; with one, parsed content streams and decoded
+    // fonts and images are shared between renders (and thus between pages).
+    static PDFErrorsOr<void> render(Document&, Page const&, RefPtr<Gfx::Bitmap>, RenderingPreferences preferences, RefPtr<RenderingCache> = {});
 
 private:
-    Renderer(RefPtr<Document>, Page const&, RefPtr<Gfx::Bitmap>, RenderingPreferences);
+    Renderer(RefPtr<Document>, Page const&, RefPtr<Gfx::Bitmap>, RenderingPreferences, RefPtr<RenderingCache>);
 
     PDFErrorsOr<void> render();
 
@@ -144,6 +146,7 @@ private:
     Gfx::Painter m_painter;
     Gfx::AntiAliasingPainter m_anti_aliasing_painter;
     RenderingPreferences m_rendering_preferences;
+    RefPtr<RenderingCache> m_rendering_cache;
 
     Gfx::Path m_current_path;
     Vector<GraphicsState> m_graphics_state_stack;
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
+#include <LibGfx/Bitmap.h>
+#include <LibPDF/Fonts/PDFFont.h>
+#include <LibPDF/Operator.h>
+
+namespace PDF {
+
+// Caches parsed content streams and decoded resources across Renderer
+// instances. A Renderer only lives for a single render of a single page, so
+// without a cache every repaint re-parses the page's content stream and
+// re-decodes every font and image, and pages sharing resources decode them
+// over and over.
+class RenderingCache : public RefCounted<RenderingCache> {
+public:
+    Vector<Operator> const* operators_for(Object const& content_object) const
+    {
+        if (auto it = m_operators.find(&content_object); it != m_operators.end())
+            return it->value.operators.ptr();
+        return nullptr;
+    }
+
+    Vector<Operator> const& set_operators_for(NonnullRefPtr<Object> content_object, Vector<Operator> operators)
+    {
+        auto operator_list = make<Vector<Operator>>(move(operators));
+        auto const* pointer = operator_list.ptr();
+        m_operators.set(content_object.ptr(), CachedOperators { move(content_object), move(operator_list) });
+        return *pointer;
+    }
+
+    RefPtr<PDFFont> font_for(DictObject const& font_dictionary, float font_size) const
+    {
+        if (auto it = m_fonts.find(&font_dictionary); it != m_fonts.end()) {
+            for (auto& cached : it->value.sizes) {
+                if (cached.font_size == font_size)
+                    return cached.font;
+            }
+        }
+        return nullptr;
+    }
+
+    void set_font_for(NonnullRefPtr<DictObject> font_dictionary, float font_size, NonnullRefPtr<PDFFont> font)
+    {
+        if (auto it = m_fonts.find(font_dictionary.ptr()); it != m_fonts.end()) {
+            it->value.sizes.append({ font_size, move(font) });
+            return;
+        }
+        CachedFonts fonts { move(font_dictionary), {} };
+        fonts.sizes.append({ font_size, move(font) });
+        m_fonts.set(fonts.font_dictionary.ptr(), move(fonts));
+    }
+
+    RefPtr<Gfx::Bitmap> image_for(StreamObject const& image_object) const
+    {
+        if (auto it = m_images.find(&image_object); it != m_images.end())
+            return it->value.bitmap;
+        return nullptr;
+    }
+
+    void set_image_for(NonnullRefPtr<StreamObject> image_object, NonnullRefPtr<Gfx::Bitmap> bitmap)
+    {
+        m_images.set(image_object.ptr(), CachedImage { move(image_object), move(bitmap) });
+    }
+
+private:
+    // Each entry keeps a reference on the object it is keyed by, so a key
+    // pointer can never be reused for a different object while it is cached.
+    struct CachedOperators {
+        NonnullRefPtr<Object> content_object;
+        // The operator list lives on the heap so that references handed out
+        // by set_operators_for() survive rehashes of the map.
+        NonnullOwnPtr<Vector<Operator>> operators;
+    };
+    struct CachedFontSize {
+        float font_size;
+        NonnullRefPtr<PDFFont> font;
+    };
+    struct CachedFonts {
+        NonnullRefPtr<DictObject> font_dictionary;
+        Vector<CachedFontSize, 1> sizes;
+    };
+    struct CachedImage {
+        NonnullRefPtr<StreamObject> image_object;
+        NonnullRefPtr<Gfx::Bitmap> bitmap;
+    };
+
+    HashMap<Object const*, CachedOperators> m_operators;
+    HashMap<DictObject const*, CachedFonts> m_fonts;
+    HashMap<StreamObject const*, CachedImage> m_images;
+};
+
+}
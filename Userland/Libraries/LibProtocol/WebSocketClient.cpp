@@ -76,6 +76,15 @@ void WebSocketClient::received(i32 connection_id, bool is_text, ByteBuffer const
         maybe_connection.value()->did_receive({}, data, is_text);
 }
 
+void WebSocketClient::received_batch(i32 connection_id, bool is_text, Vector<ByteBuffer> const& messages)
+{
+    auto maybe_connection = m_connections.get(connection_id);
+    if (!maybe_connection.has_value())
+        return;
+    for (auto& data : messages)
+        maybe_connection.value()->did_receive({}, data, is_text);
+}
+
 void WebSocketClient::errored(i32 connection_id, i32 message)
 {
     auto maybe_connection = m_connections.get(connection_id);
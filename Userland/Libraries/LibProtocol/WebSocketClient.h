@@ -34,6 +34,7 @@ private:
 
     virtual void connected(i32) override;
     virtual void received(i32, bool, ByteBuffer const&) override;
+    virtual void received_batch(i32, bool, Vector<ByteBuffer> const&) override;
     virtual void errored(i32, i32) override;
     virtual void closed(i32, u16, DeprecatedString const&, bool) override;
     virtual void certificate_requested(i32) override;
@@ -185,6 +185,11 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
 
+    // FIXME: Insensitive patterns could still use the hint by lowercasing both sides.
+    auto first_character_hint = m_pattern->first_character_hint;
+    if (input.regex_options.has_flag_set(AllFlags::Insensitive))
+        first_character_hint.clear();
+
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
             ++input.line;
@@ -245,6 +250,16 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            // If the pattern can only start with one specific character, reject
+            // start positions that don't have it instead of paying for a full
+            // bytecode execution that would fail at the very first compare.
+            if (first_character_hint.has_value() && view_index < view_length
+                && input.view.substring_view(view_index, 1)[0] != *first_character_hint) {
+                if (!continue_search)
+                    break;
+                continue;
+            }
+
             input.column = match_count;
             input.match_index = match_count;
 
@@ -88,6 +88,11 @@ public:
     OwnPtr<Matcher<Parser>> matcher { nullptr };
     mutable size_t start_offset { 0 };
 
+    // If the pattern can only ever start matching at one specific (ASCII)
+    // character, it's recorded here so the matcher can reject hopeless start
+    // positions without entering the bytecode interpreter at all.
+    Optional<u32> first_character_hint;
+
     static regex::Parser::Result parse_pattern(StringView pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
 
     explicit Regex(DeprecatedString pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
@@ -232,6 +237,7 @@ public:
 private:
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
+    void compute_first_character_hint();
 };
 
 // free standing functions for match, search and has_match
@@ -29,6 +29,57 @@ void Regex<Parser>::run_optimization_passes()
     attempt_rewrite_loops_as_atomic_groups(split_basic_blocks(parser_result.bytecode));
 
     parser_result.bytecode.flatten();
+
+    compute_first_character_hint();
+}
+
+template<typename Parser>
+void Regex<Parser>::compute_first_character_hint()
+{
+    first_character_hint.clear();
+
+    auto& bytecode = parser_result.bytecode;
+    if (bytecode.is_empty())
+        return;
+
+    // Skip over leading opcodes that never consume input and always fall
+    // through, then check whether the first thing the pattern does is compare
+    // against a single known character.
+    MatchState state;
+    state.instruction_position = 0;
+    for (;;) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckBoundary:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::Save:
+            break;
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            if (compare.arguments_count() != 1)
+                return;
+            auto flat_compares = compare.flat_compares();
+            if (flat_compares.size() != 1)
+                return;
+            auto& pair = flat_compares.first();
+            // Note: Strings are stored as raw bytes, so only an ASCII first
+            //       character is guaranteed to equal its code point.
+            if ((pair.type == CharacterCompareType::Char || pair.type == CharacterCompareType::String) && pair.value < 0x80)
+                first_character_hint = pair.value;
+            return;
+        }
+        default:
+            return;
+        }
+
+        auto next_ip = state.instruction_position + opcode.size();
+        if (next_ip >= bytecode.size())
+            return;
+        state.instruction_position = next_ip;
+    }
 }
 
 template<typename Parser>
@@ -92,6 +92,7 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
     tuple.append(Value { true });
     rows.append(tuple);
 
+    NonnullRefPtrVector<TableDef> table_defs;
     for (auto& table_descriptor : table_or_subquery_list()) {
         if (!table_descriptor.is_table())
             return Result { SQLCommand::Select, SQLErrorCode::NotYetImplemented, "Sub-selects are not yet implemented"sv };
@@ -100,16 +101,38 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
         if (table_def->num_columns() == 0)
             continue;
 
+        table_defs.append(move(table_def));
+    }
+
+    bool where_clause_pushed_down = !table_defs.is_empty() && where_clause();
+
+    for (size_t table_index = 0; table_index < table_defs.size(); ++table_index) {
+        auto const& table_def = table_defs[table_index];
+
         auto old_descriptor_size = descriptor->size();
-        descriptor->extend(table_def->to_tuple_descriptor());
+        descriptor->extend(table_def.to_tuple_descriptor());
+
+        // Rows are complete once the last table has been joined, so the WHERE
+        // clause can be applied while scanning it instead of materializing the
+        // entire cartesian product first.
+        bool is_last_table = table_index == table_defs.size() - 1;
+        auto table_rows = TRY(context.database->select_all(table_def));
 
         while (!rows.is_empty() && (rows.first().size() == old_descriptor_size)) {
             auto cartesian_row = rows.take_first();
-            auto table_rows = TRY(context.database->select_all(*table_def));
 
             for (auto& table_row : table_rows) {
                 auto new_row = cartesian_row;
                 new_row.extend(table_row);
+
+                if (is_last_table && where_clause()) {
+                    context.current_row = &new_row;
+
+                    auto where_result = TRY(where_clause()->evaluate(context)).to_bool();
+                    if (!where_result.has_value() || !where_result.value())
+                        continue;
+                }
+
                 rows.append(new_row);
             }
         }
@@ -126,7 +149,7 @@ ResultOr<ResultSet> Select::execute(ExecutionContext& context) const
     for (auto& row : rows) {
         context.current_row = &row;
 
-        if (where_clause()) {
+        if (where_clause() && !where_clause_pushed_down) {
             auto where_result = TRY(where_clause()->evaluate(context)).to_bool();
             if (!where_result.has_value() || !where_result.value())
                 continue;
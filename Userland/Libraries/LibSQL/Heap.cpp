@@ -4,13 +4,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteReader.h>
 #include <AK/DeprecatedString.h>
 #include <AK/Format.h>
 #include <AK/QuickSort.h>
 #include <LibCore/IODevice.h>
 #include <LibCore/System.h>
+#include <LibCrypto/Checksum/CRC32.h>
 #include <LibSQL/Heap.h>
 #include <LibSQL/Serializer.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -47,9 +50,23 @@ ErrorOr<void> Heap::open()
     if (file_size > 0)
         m_next_block = m_end_of_file = file_size / BLOCKSIZE;
 
+    m_block_cache.clear();
+
     auto file = TRY(Core::Stream::File::open(name(), Core::Stream::OpenMode::ReadWrite));
+    m_file_fd = file->fd();
     m_file = TRY(Core::Stream::BufferedFile::create(move(file)));
 
+    if (auto error_maybe = replay_wal_file(); error_maybe.is_error()) {
+        m_file = nullptr;
+        return error_maybe.release_error();
+    }
+
+    // Replaying the log may have appended blocks to the heap file.
+    auto stat_after_replay = TRY(Core::System::fstat(m_file_fd));
+    file_size = stat_after_replay.st_size;
+    if (file_size > 0)
+        m_next_block = m_end_of_file = file_size / BLOCKSIZE;
+
     if (file_size > 0) {
         if (auto error_maybe = read_zero_block(); error_maybe.is_error()) {
             m_file = nullptr;
@@ -82,6 +99,13 @@ ErrorOr<ByteBuffer> Heap::read_block(u32 block)
     if (auto buffer = m_write_ahead_log.get(block); buffer.has_value())
         return TRY(ByteBuffer::copy(*buffer));
 
+    if (auto entry = m_block_cache.get(block); entry.has_value()) {
+        dbgln_if(SQL_DEBUG, "Read heap block {} from cache", block);
+        entry->last_access = ++m_block_cache_time;
+        entry->was_reused = true;
+        return TRY(ByteBuffer::copy(entry->data));
+    }
+
     if (block >= m_next_block) {
         warnln("Heap({})::read_block({}): block # out of range (>= {})"sv, name(), block, m_next_block);
         return Error::from_string_literal("Heap()::read_block(): block # out of range");
@@ -96,9 +120,35 @@ ErrorOr<ByteBuffer> Heap::read_block(u32 block)
     dbgln_if(SQL_DEBUG, "{:hex-dump}", bytes.trim(8));
     TRY(buffer.try_resize(bytes.size()));
 
+    TRY(cache_block(block, TRY(ByteBuffer::copy(buffer))));
     return buffer;
 }
 
+ErrorOr<void> Heap::cache_block(u32 block, ByteBuffer data)
+{
+    if (auto entry = m_block_cache.get(block); entry.has_value()) {
+        entry->data = move(data);
+        entry->last_access = ++m_block_cache_time;
+        return {};
+    }
+
+    if (m_block_cache.size() >= block_cache_capacity) {
+        auto victim = m_block_cache.begin();
+        for (auto it = m_block_cache.begin(); it != m_block_cache.end(); ++it) {
+            if (it->value.was_reused != victim->value.was_reused) {
+                if (!it->value.was_reused)
+                    victim = it;
+            } else if (it->value.last_access < victim->value.last_access) {
+                victim = it;
+            }
+        }
+        m_block_cache.remove(victim);
+    }
+
+    TRY(m_block_cache.try_set(block, { move(data), ++m_block_cache_time, false }));
+    return {};
+}
+
 ErrorOr<void> Heap::write_block(u32 block, ByteBuffer& buffer)
 {
     if (!m_file) {
@@ -125,6 +175,8 @@ ErrorOr<void> Heap::write_block(u32 block, ByteBuffer& buffer)
     dbgln_if(SQL_DEBUG, "{:hex-dump}", buffer.bytes().trim(8));
     TRY(m_file->write(buffer));
 
+    TRY(cache_block(block, TRY(ByteBuffer::copy(buffer))));
+
     if (block == m_end_of_file)
         m_end_of_file++;
     return {};
@@ -169,6 +221,24 @@ u32 Heap::new_record_pointer()
 ErrorOr<void> Heap::flush()
 {
     VERIFY(m_file);
+    if (m_write_ahead_log.is_empty())
+        return {};
+
+    // The commit group becomes durable once the log file has been written and
+    // synced; writing the blocks back into the heap file afterwards is safe
+    // because the log is only discarded once the checkpoint has been synced
+    // as well. A crash in between replays the log on the next open().
+    TRY(write_wal_file());
+    TRY(apply_wal());
+    TRY(Core::System::fsync(m_file_fd));
+    TRY(Core::System::unlink(wal_file_name()));
+
+    dbgln_if(SQL_DEBUG, "WAL flushed. Heap size = {}", size());
+    return {};
+}
+
+ErrorOr<void> Heap::apply_wal()
+{
     Vector<u32> blocks;
     for (auto& wal_entry : m_write_ahead_log) {
         blocks.append(wal_entry.key);
@@ -181,7 +251,130 @@ ErrorOr<void> Heap::flush()
         TRY(write_block(block, buffer_it->value));
     }
     m_write_ahead_log.clear();
-    dbgln_if(SQL_DEBUG, "WAL flushed. Heap size = {}", size());
+    return {};
+}
+
+constexpr static auto WAL_ID = "SerenityWAL "sv;
+
+DeprecatedString Heap::wal_file_name() const
+{
+    return DeprecatedString::formatted("{}.wal", name());
+}
+
+ErrorOr<void> Heap::write_wal_file()
+{
+    Vector<u32> blocks;
+    for (auto& wal_entry : m_write_ahead_log)
+        blocks.append(wal_entry.key);
+    quick_sort(blocks);
+
+    size_t buffer_size = WAL_ID.length() + sizeof(u32);
+    for (auto& block : blocks)
+        buffer_size += 2 * sizeof(u32) + m_write_ahead_log.get(block)->size();
+    buffer_size += sizeof(u32);
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(buffer_size));
+    size_t offset = 0;
+    auto append = [&](void const* data, size_t size) {
+        buffer.overwrite(offset, data, size);
+        offset += size;
+    };
+
+    append(WAL_ID.characters_without_null_termination(), WAL_ID.length());
+    u32 block_count = blocks.size();
+    append(&block_count, sizeof(u32));
+    for (auto& block : blocks) {
+        auto const& data = *m_write_ahead_log.get(block);
+        u32 data_size = data.size();
+        append(&block, sizeof(u32));
+        append(&data_size, sizeof(u32));
+        append(data.data(), data.size());
+    }
+
+    Crypto::Checksum::CRC32 crc32;
+    crc32.update(buffer.bytes().slice(WAL_ID.length(), offset - WAL_ID.length()));
+    u32 checksum = crc32.digest();
+    append(&checksum, sizeof(u32));
+    VERIFY(offset == buffer_size);
+
+    auto fd = TRY(Core::System::open(wal_file_name(), O_WRONLY | O_CREAT | O_TRUNC, 0600));
+    auto result = [&]() -> ErrorOr<void> {
+        size_t nwritten = 0;
+        while (nwritten < buffer.size())
+            nwritten += TRY(Core::System::write(fd, buffer.bytes().slice(nwritten)));
+        TRY(Core::System::fsync(fd));
+        return {};
+    }();
+    TRY(Core::System::close(fd));
+    return result;
+}
+
+ErrorOr<void> Heap::replay_wal_file()
+{
+    struct stat stat_buffer;
+    if (stat(wal_file_name().characters(), &stat_buffer) != 0) {
+        if (errno != ENOENT)
+            return Error::from_syscall("stat"sv, -errno);
+        return {};
+    }
+
+    auto discard_incomplete_log = [&]() -> ErrorOr<void> {
+        // An unreadable or partially written log means the commit never
+        // became durable; the heap file is still consistent without it.
+        warnln("Heap({}): discarding incomplete write-ahead log"sv, name());
+        return Core::System::unlink(wal_file_name());
+    };
+
+    auto buffer = TRY(ByteBuffer::create_uninitialized(stat_buffer.st_size));
+    {
+        auto fd = TRY(Core::System::open(wal_file_name(), O_RDONLY));
+        auto result = [&]() -> ErrorOr<void> {
+            size_t nread = 0;
+            while (nread < buffer.size()) {
+                auto n = TRY(Core::System::read(fd, buffer.bytes().slice(nread)));
+                if (n == 0)
+                    break;
+                nread += n;
+            }
+            if (nread != buffer.size())
+                return Error::from_string_literal("Heap()::replay_wal_file(): Short read");
+            return {};
+        }();
+        TRY(Core::System::close(fd));
+        if (result.is_error())
+            return discard_incomplete_log();
+    }
+
+    if (buffer.size() < WAL_ID.length() + 2 * sizeof(u32) || StringView(buffer.bytes().trim(WAL_ID.length())) != WAL_ID)
+        return discard_incomplete_log();
+
+    Crypto::Checksum::CRC32 crc32;
+    crc32.update(buffer.bytes().slice(WAL_ID.length(), buffer.size() - WAL_ID.length() - sizeof(u32)));
+    auto checksum = ByteReader::load32(buffer.offset_pointer(buffer.size() - sizeof(u32)));
+    if (checksum != crc32.digest())
+        return discard_incomplete_log();
+
+    size_t offset = WAL_ID.length();
+    auto block_count = ByteReader::load32(buffer.offset_pointer(offset));
+    offset += sizeof(u32);
+
+    for (u32 i = 0; i < block_count; ++i) {
+        if (offset + 2 * sizeof(u32) > buffer.size() - sizeof(u32))
+            return discard_incomplete_log();
+        auto block = ByteReader::load32(buffer.offset_pointer(offset));
+        auto data_size = ByteReader::load32(buffer.offset_pointer(offset + sizeof(u32)));
+        offset += 2 * sizeof(u32);
+        if (data_size > BLOCKSIZE || offset + data_size > buffer.size() - sizeof(u32))
+            return discard_incomplete_log();
+        auto data = TRY(buffer.slice(offset, data_size));
+        add_to_wal(block, data);
+        offset += data_size;
+    }
+
+    dbgln_if(SQL_DEBUG, "Heap({}): replaying write-ahead log with {} blocks", name(), block_count);
+    TRY(apply_wal());
+    TRY(Core::System::fsync(m_file_fd));
+    TRY(Core::System::unlink(wal_file_name()));
     return {};
 }
 
@@ -33,7 +33,7 @@ class Heap : public Core::Object {
     C_OBJECT(Heap);
 
 public:
-    static constexpr inline u32 current_version = 3;
+    static constexpr inline u32 current_version = 4;
 
     virtual ~Heap() override;
 
@@ -93,13 +93,31 @@ public:
 private:
     explicit Heap(DeprecatedString);
 
+    DeprecatedString wal_file_name() const;
+    ErrorOr<void> write_wal_file();
+    ErrorOr<void> apply_wal();
+    ErrorOr<void> replay_wal_file();
+
     ErrorOr<void> write_block(u32, ByteBuffer&);
     ErrorOr<void> seek_block(u32);
     ErrorOr<void> read_zero_block();
     void initialize_zero_block();
     void update_zero_block();
 
+    // Caches recently read or written blocks so B-Tree traversals don't hit
+    // the file for every node. Blocks that were only ever touched once are
+    // evicted first, so a single large scan cannot flush out the hot set.
+    struct BlockCacheEntry {
+        ByteBuffer data;
+        u64 last_access { 0 };
+        bool was_reused { false };
+    };
+    static constexpr size_t block_cache_capacity = 256;
+
+    ErrorOr<void> cache_block(u32 block, ByteBuffer);
+
     OwnPtr<Core::Stream::BufferedFile> m_file;
+    int m_file_fd { -1 };
     u32 m_free_list { 0 };
     u32 m_next_block { 1 };
     u32 m_end_of_file { 1 };
@@ -109,6 +127,8 @@ private:
     u32 m_version { current_version };
     Array<u32, 16> m_user_values { 0 };
     HashMap<u32, ByteBuffer> m_write_ahead_log;
+    HashMap<u32, BlockCacheEntry> m_block_cache;
+    u64 m_block_cache_time { 0 };
 };
 
 }
@@ -8,21 +8,65 @@
 
 namespace SQL {
 
+// Strings are stored with a variable-length header instead of a fixed u32
+// length prefix. The header is the string length shifted left by one bit;
+// if the low bit is set, the value is not a length but an index into the
+// strings previously written to the same block, and the character data is
+// not repeated. Since every row carries its full tuple descriptor, column
+// names make up a good chunk of each block, and they always repeat.
+
+void Serializer::serialize_varuint(u64 value)
+{
+    do {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        serialize<u8>(byte);
+    } while (value != 0);
+}
+
+u64 Serializer::deserialize_varuint()
+{
+    u64 value = 0;
+    u8 shift = 0;
+    u8 byte;
+    do {
+        byte = deserialize<u8>();
+        value |= static_cast<u64>(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
 void Serializer::serialize(DeprecatedString const& text)
 {
-    serialize<u32>((u32)text.length());
+    if (auto back_reference = m_serialized_strings.get(text); back_reference.has_value()) {
+        serialize_varuint((back_reference.value() << 1) | 1);
+        return;
+    }
+    serialize_varuint(static_cast<u64>(text.length()) << 1);
     if (!text.is_empty())
         write((u8 const*)text.characters(), text.length());
+    m_serialized_strings.set(text, m_serialized_strings.size());
 }
 
 void Serializer::deserialize_to(DeprecatedString& text)
 {
-    auto length = deserialize<u32>();
+    auto header = deserialize_varuint();
+    if (header & 1) {
+        auto back_reference = header >> 1;
+        VERIFY(back_reference < m_deserialized_strings.size());
+        text = m_deserialized_strings[back_reference];
+        return;
+    }
+    auto length = header >> 1;
     if (length > 0) {
         text = DeprecatedString(reinterpret_cast<char const*>(read(length)), length);
     } else {
         text = "";
     }
+    m_deserialized_strings.append(text);
 }
 
 }
@@ -10,7 +10,9 @@
 #include <AK/Debug.h>
 #include <AK/DeprecatedString.h>
 #include <AK/Format.h>
+#include <AK/HashMap.h>
 #include <AK/ScopeGuard.h>
+#include <AK/Vector.h>
 #include <LibSQL/Forward.h>
 #include <LibSQL/Heap.h>
 #include <string.h>
@@ -34,17 +36,22 @@ public:
             VERIFY_NOT_REACHED();
         m_buffer = buffer_or_error.value();
         m_current_offset = 0;
+        m_serialized_strings.clear();
+        m_deserialized_strings.clear();
     }
 
     void reset()
     {
         m_buffer.clear();
         m_current_offset = 0;
+        m_serialized_strings.clear();
+        m_deserialized_strings.clear();
     }
 
     void rewind()
     {
         m_current_offset = 0;
+        m_deserialized_strings.clear();
     }
 
     template<typename T, typename... Args>
@@ -137,6 +144,9 @@ public:
     }
 
 private:
+    void serialize_varuint(u64);
+    u64 deserialize_varuint();
+
     void write(u8 const* ptr, size_t sz)
     {
         if constexpr (SQL_DEBUG)
@@ -171,6 +181,11 @@ private:
     ByteBuffer m_buffer {};
     size_t m_current_offset { 0 };
     RefPtr<Heap> m_heap { nullptr };
+    // Strings already written to resp. read from the current block, so
+    // repeated strings (column names, mostly) can be stored as back
+    // references. Cleared whenever a new block is started.
+    HashMap<DeprecatedString, u64> m_serialized_strings;
+    Vector<DeprecatedString> m_deserialized_strings;
 };
 
 }
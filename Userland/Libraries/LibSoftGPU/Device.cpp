@@ -22,6 +22,7 @@
 #include <LibSoftGPU/Image.h>
 #include <LibSoftGPU/PixelConverter.h>
 #include <LibSoftGPU/PixelQuad.h>
+#include <LibSoftGPU/RasterizerWorkerPool.h>
 #include <LibSoftGPU/SIMD.h>
 #include <LibSoftGPU/Shader.h>
 #include <LibSoftGPU/ShaderCompiler.h>
@@ -173,7 +174,7 @@ ALWAYS_INLINE static Vector4<f32x4> get_blend_factor(GPU::BlendFactor blend_fact
     }
 }
 
-template<typename CB1, typename CB2, typename CB3>
+template<bool AllowThreading, typename CB1, typename CB2, typename CB3>
 ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_coverage_mask, CB2 set_quad_depth, CB3 set_quad_attributes)
 {
     // Return if alpha testing is a no-op
@@ -251,9 +252,10 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
             dst_factor = get_blend_factor(m_options.blend_destination_factor, {}, {});
     }
 
-    // Rasterize all quads
-    // FIXME: this could be embarrassingly parallel
-    for (int qy = qy0; qy <= qy1; qy += 2) {
+    // Rasterize all quads in a single row of the framebuffer
+    auto rasterize_quad_row = [&](int qy) {
+        auto row_src_factor = src_factor;
+        auto row_dst_factor = dst_factor;
         for (int qx = qx0; qx <= qx1; qx += 2) {
             PixelQuad quad;
             quad.screen_coordinates = {
@@ -405,7 +407,7 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
             INCREASE_STATISTICS_COUNTER(g_num_pixels_shaded, maskcount(quad.mask));
 
             set_quad_attributes(quad);
-            shade_fragments(quad);
+            (this->*m_shade_fragments_for_state)(quad);
 
             // Alpha testing
             if (m_options.enable_alpha_test) {
@@ -444,11 +446,11 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
                 auto const dst = to_vec4(dst_u32);
 
                 if (!src_factor_is_constant)
-                    src_factor = get_blend_factor(m_options.blend_source_factor, src, dst);
+                    row_src_factor = get_blend_factor(m_options.blend_source_factor, src, dst);
                 if (!dst_factor_is_constant)
-                    dst_factor = get_blend_factor(m_options.blend_destination_factor, src, dst);
+                    row_dst_factor = get_blend_factor(m_options.blend_destination_factor, src, dst);
 
-                out_color = src * src_factor + dst * dst_factor;
+                out_color = src * row_src_factor + dst * row_dst_factor;
             }
 
             auto const argb32_color = to_argb32(out_color);
@@ -457,7 +459,33 @@ ALWAYS_INLINE void Device::rasterize(Gfx::IntRect& render_bounds, CB1 set_covera
             else
                 store4_masked((argb32_color & m_options.color_mask) | (dst_u32 & ~m_options.color_mask), color_ptrs[0], color_ptrs[1], color_ptrs[2], color_ptrs[3], quad.mask);
         }
+    };
+
+    // Distribute rows of quads across a worker pool when the fixed-function
+    // pipeline is in use. Stripes interleave whole rows, so every thread owns
+    // its rows of the framebuffer outright and no locking is needed. Custom
+    // fragment shaders rasterize serially, because the ShaderProcessor register
+    // file is shared; so does the statistics overlay, whose counters are
+    // unsynchronized.
+    auto const number_of_quad_rows = (qy1 - qy0) / 2 + 1;
+    bool const parallelize_rasterization = AllowThreading
+        && !ENABLE_STATISTICS_OVERLAY
+        && m_current_fragment_shader == nullptr
+        && number_of_quad_rows >= 8;
+    if (parallelize_rasterization) {
+        auto& worker_pool = RasterizerWorkerPool::the();
+        auto const stripe_count = static_cast<int>(worker_pool.stripe_count());
+        if (stripe_count > 1) {
+            worker_pool.run([&](size_t stripe_index) {
+                for (int qy = qy0 + 2 * static_cast<int>(stripe_index); qy <= qy1; qy += 2 * stripe_count)
+                    rasterize_quad_row(qy);
+            });
+            return;
+        }
     }
+
+    for (int qy = qy0; qy <= qy1; qy += 2)
+        rasterize_quad_row(qy);
 }
 
 void Device::rasterize_line_aliased(GPU::Vertex& from, GPU::Vertex& to)
@@ -495,7 +523,7 @@ void Device::rasterize_line_antialiased(GPU::Vertex& from, GPU::Vertex& to)
     // Rasterize using a 2D signed distance field for a line segment
     // FIXME: performance-wise, this might be the absolute worst way to draw an anti-aliased line
     f32x4 distance_along_line;
-    rasterize(
+    rasterize<false>(
         render_bounds,
         [&from_coords4, &distance_along_line, &line_vector4, &line_dot4, &line_radius](auto& quad) {
             auto const screen_coordinates4 = to_vec2_f32x4(quad.screen_coordinates);
@@ -551,7 +579,7 @@ void Device::rasterize_point_aliased(GPU::Vertex& point)
     };
 
     // Rasterize the point as a rect
-    rasterize(
+    rasterize<false>(
         point_rect,
         [](auto& quad) {
             // We already passed in point_rect, so this doesn't matter
@@ -583,7 +611,7 @@ void Device::rasterize_point_antialiased(GPU::Vertex& point)
     };
 
     // Rasterize using a 2D signed distance field for a circle
-    rasterize(
+    rasterize<false>(
         render_bounds,
         [&center4, &radius](auto& quad) {
             auto screen_coords = to_vec2_f32x4(quad.screen_coordinates);
@@ -723,7 +751,7 @@ void Device::rasterize_triangle(Triangle& triangle)
         expand4(vertex2.window_coordinates.z() + depth_offset),
     };
 
-    rasterize(
+    rasterize<true>(
         render_bounds,
         [&](auto& quad) {
             auto edge_values = calculate_edge_values4(quad.screen_coordinates * subpixel_factor + half_pixel_offset);
@@ -1311,6 +1339,142 @@ ALWAYS_INLINE void Device::shade_fragments(PixelQuad& quad)
     quad.set_output(SHADER_OUTPUT_FIRST_COLOR + 3, current_color.w() * quad.coverage);
 }
 
+template<Device::TextureShading texture_shading, Device::FogShading fog_shading>
+void Device::shade_fragments_specialized(PixelQuad& quad)
+{
+    auto current_color = quad.get_input_vector4(SHADER_INPUT_VERTEX_COLOR);
+
+    if constexpr (texture_shading != TextureShading::None) {
+        auto const& sampler = m_samplers[0];
+
+        // Texture coordinates must be divided by Q; see shade_fragments()
+        auto homogeneous_texture_coordinate = quad.get_input_vector4(SHADER_INPUT_FIRST_TEXCOORD);
+        auto texel = sampler.sample_2d(homogeneous_texture_coordinate.xy() / homogeneous_texture_coordinate.w());
+        INCREASE_STATISTICS_COUNTER(g_num_sampler_calls, 1);
+
+        if constexpr (texture_shading == TextureShading::Modulate) {
+            current_color = current_color * texel;
+        } else if constexpr (texture_shading == TextureShading::Replace) {
+            current_color = texel;
+        } else if constexpr (texture_shading == TextureShading::Decal) {
+            auto dst_alpha = texel.w();
+            current_color.set_x(mix(current_color.x(), texel.x(), dst_alpha));
+            current_color.set_y(mix(current_color.y(), texel.y(), dst_alpha));
+            current_color.set_z(mix(current_color.z(), texel.z(), dst_alpha));
+        } else if constexpr (texture_shading == TextureShading::Add) {
+            current_color.set_x(current_color.x() + texel.x());
+            current_color.set_y(current_color.y() + texel.y());
+            current_color.set_z(current_color.z() + texel.z());
+            current_color.set_w(current_color.w() * texel.w());
+        }
+    }
+
+    if constexpr (fog_shading != FogShading::None) {
+        f32x4 factor {};
+        if constexpr (fog_shading == FogShading::Linear) {
+            factor = (m_options.fog_end - quad.fog_depth) / (m_options.fog_end - m_options.fog_start);
+        } else if constexpr (fog_shading == FogShading::Exp) {
+            factor = exp(-m_options.fog_density * quad.fog_depth);
+        } else if constexpr (fog_shading == FogShading::Exp2) {
+            auto argument = m_options.fog_density * quad.fog_depth;
+            argument *= -argument;
+            factor = exp(argument);
+        }
+
+        // Mix texel's RGB with fog's RBG - leave alpha alone
+        auto fog_color = expand4(m_options.fog_color);
+        current_color.set_x(mix(fog_color.x(), current_color.x(), factor));
+        current_color.set_y(mix(fog_color.y(), current_color.y(), factor));
+        current_color.set_z(mix(fog_color.z(), current_color.z(), factor));
+    }
+
+    quad.set_output(SHADER_OUTPUT_FIRST_COLOR, current_color.x());
+    quad.set_output(SHADER_OUTPUT_FIRST_COLOR + 1, current_color.y());
+    quad.set_output(SHADER_OUTPUT_FIRST_COLOR + 2, current_color.z());
+    // Multiply coverage with the fragment's alpha to obtain the final alpha value
+    quad.set_output(SHADER_OUTPUT_FIRST_COLOR + 3, current_color.w() * quad.coverage);
+}
+
+// Selects a fused fragment shading function for the current fixed-function
+// state, if one of the precompiled specializations matches it. Rare or complex
+// combinations (multitexturing, blend/combine texture environments, custom
+// fragment shaders) keep using the generic interpreting path.
+void Device::select_shade_fragments_specialization()
+{
+    m_shade_fragments_for_state = &Device::shade_fragments;
+
+    if (!m_current_fragment_shader.is_null())
+        return;
+
+    // The specializations cover at most one enabled texture unit, which must
+    // be the first one.
+    u32 enabled_texture_units = 0;
+    for (auto const& texture_unit_configuration : m_texture_unit_configuration) {
+        if (texture_unit_configuration.enabled)
+            ++enabled_texture_units;
+    }
+    if (enabled_texture_units > 1 || (enabled_texture_units == 1 && !m_texture_unit_configuration[0].enabled))
+        return;
+
+    auto texture_shading = TextureShading::None;
+    if (enabled_texture_units == 1) {
+        switch (m_samplers[0].config().fixed_function_texture_environment.env_mode) {
+        case GPU::TextureEnvMode::Modulate:
+            texture_shading = TextureShading::Modulate;
+            break;
+        case GPU::TextureEnvMode::Replace:
+            texture_shading = TextureShading::Replace;
+            break;
+        case GPU::TextureEnvMode::Decal:
+            texture_shading = TextureShading::Decal;
+            break;
+        case GPU::TextureEnvMode::Add:
+            texture_shading = TextureShading::Add;
+            break;
+        default:
+            return;
+        }
+    }
+
+    auto select_with_fog = [&]<TextureShading texture_shading_constant>() {
+        if (!m_options.fog_enabled) {
+            m_shade_fragments_for_state = &Device::shade_fragments_specialized<texture_shading_constant, FogShading::None>;
+            return;
+        }
+        switch (m_options.fog_mode) {
+        case GPU::FogMode::Linear:
+            m_shade_fragments_for_state = &Device::shade_fragments_specialized<texture_shading_constant, FogShading::Linear>;
+            return;
+        case GPU::FogMode::Exp:
+            m_shade_fragments_for_state = &Device::shade_fragments_specialized<texture_shading_constant, FogShading::Exp>;
+            return;
+        case GPU::FogMode::Exp2:
+            m_shade_fragments_for_state = &Device::shade_fragments_specialized<texture_shading_constant, FogShading::Exp2>;
+            return;
+        }
+        VERIFY_NOT_REACHED();
+    };
+
+    switch (texture_shading) {
+    case TextureShading::None:
+        select_with_fog.template operator()<TextureShading::None>();
+        return;
+    case TextureShading::Modulate:
+        select_with_fog.template operator()<TextureShading::Modulate>();
+        return;
+    case TextureShading::Replace:
+        select_with_fog.template operator()<TextureShading::Replace>();
+        return;
+    case TextureShading::Decal:
+        select_with_fog.template operator()<TextureShading::Decal>();
+        return;
+    case TextureShading::Add:
+        select_with_fog.template operator()<TextureShading::Add>();
+        return;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 void Device::resize(Gfx::IntSize size)
 {
     auto frame_buffer_or_error = FrameBuffer<GPU::ColorType, GPU::DepthType, GPU::StencilType>::try_create(size);
@@ -1556,6 +1720,7 @@ void Device::draw_statistics_overlay(Gfx::Bitmap& target)
 void Device::set_options(GPU::RasterizerOptions const& options)
 {
     m_options = options;
+    select_shade_fragments_specialization();
 }
 
 void Device::set_light_model_params(GPU::LightModelParameters const& lighting_model)
@@ -1593,6 +1758,8 @@ void Device::set_sampler_config(unsigned sampler, GPU::SamplerConfig const& conf
         return any_of(fixed_function_env.alpha_source, [](auto texture_source) { return texture_source == GPU::TextureSource::TextureStage; })
             || any_of(fixed_function_env.rgb_source, [](auto texture_source) { return texture_source == GPU::TextureSource::TextureStage; });
     });
+
+    select_shade_fragments_specialization();
 }
 
 void Device::set_light_state(unsigned int light_id, GPU::Light const& light)
@@ -1613,6 +1780,7 @@ void Device::set_stencil_configuration(GPU::Face face, GPU::StencilConfiguration
 void Device::set_texture_unit_configuration(GPU::TextureUnitIndex index, GPU::TextureUnitConfiguration const& configuration)
 {
     m_texture_unit_configuration[index] = configuration;
+    select_shade_fragments_specialization();
 }
 
 void Device::set_raster_position(GPU::RasterPosition const& raster_position)
@@ -1662,11 +1830,13 @@ void Device::bind_fragment_shader(RefPtr<GPU::Shader> shader)
 
     if (shader.is_null()) {
         m_current_fragment_shader = nullptr;
+        select_shade_fragments_specialization();
         return;
     }
 
     auto softgpu_shader = static_ptr_cast<Shader>(shader);
     m_current_fragment_shader = softgpu_shader;
+    select_shade_fragments_specialization();
 }
 
 Gfx::IntRect Device::get_rasterization_rect_of_size(Gfx::IntSize size) const
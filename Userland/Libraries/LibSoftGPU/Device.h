@@ -89,7 +89,7 @@ private:
     GPU::ImageDataLayout color_buffer_data_layout(Vector2<u32> size, Vector2<i32> offset);
     GPU::ImageDataLayout depth_buffer_data_layout(Vector2<u32> size, Vector2<i32> offset);
 
-    template<typename CB1, typename CB2, typename CB3>
+    template<bool AllowThreading, typename CB1, typename CB2, typename CB3>
     void rasterize(Gfx::IntRect& render_bounds, CB1 set_coverage_mask, CB2 set_quad_depth, CB3 set_quad_attributes);
 
     void rasterize_line_aliased(GPU::Vertex&, GPU::Vertex&);
@@ -103,6 +103,27 @@ private:
     void rasterize_triangle(Triangle&);
     void shade_fragments(PixelQuad&);
 
+    // The generic shade_fragments() interprets the texture environment and fog
+    // configuration with branches per quad. For the handful of fixed-function
+    // state combinations that make up almost all real content, a fused
+    // specialization is selected up front whenever the relevant state changes.
+    enum class TextureShading {
+        None,
+        Modulate,
+        Replace,
+        Decal,
+        Add,
+    };
+    enum class FogShading {
+        None,
+        Linear,
+        Exp,
+        Exp2,
+    };
+    template<TextureShading, FogShading>
+    void shade_fragments_specialized(PixelQuad&);
+    void select_shade_fragments_specialization();
+
     RefPtr<FrameBuffer<GPU::ColorType, GPU::DepthType, GPU::StencilType>> m_frame_buffer {};
     GPU::RasterizerOptions m_options;
     GPU::LightModelParameters m_lighting_model;
@@ -120,6 +141,7 @@ private:
     Array<GPU::TextureUnitConfiguration, GPU::NUM_TEXTURE_UNITS> m_texture_unit_configuration;
     RefPtr<Shader> m_current_fragment_shader;
     ShaderProcessor m_shader_processor;
+    void (Device::*m_shade_fragments_for_state)(PixelQuad&) { &Device::shade_fragments };
 };
 
 }
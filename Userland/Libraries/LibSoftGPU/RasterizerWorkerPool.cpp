@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibSoftGPU/RasterizerWorkerPool.h>
+#include <LibThreading/Thread.h>
+#include <unistd.h>
+
+namespace SoftGPU {
+
+RasterizerWorkerPool& RasterizerWorkerPool::the()
+{
+    static RasterizerWorkerPool s_pool;
+    return s_pool;
+}
+
+RasterizerWorkerPool::RasterizerWorkerPool()
+{
+    auto processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+    m_worker_count = processor_count > 1 ? static_cast<size_t>(processor_count - 1) : 0;
+    for (size_t i = 0; i < m_worker_count; ++i) {
+        // NOTE: Worker threads live for the rest of the process, so we leak the
+        //       references to them.
+        auto& thread = Threading::Thread::construct([this, i]() -> intptr_t {
+            worker_loop(i);
+            return 0;
+        },
+            "SoftGPU rasterizer"sv)
+                           .leak_ref();
+        thread.start();
+    }
+}
+
+void RasterizerWorkerPool::worker_loop(size_t stripe_index)
+{
+    u64 last_seen_generation = 0;
+    for (;;) {
+        {
+            Threading::MutexLocker locker(m_mutex);
+            while (m_generation == last_seen_generation)
+                m_wake_condition.wait();
+            last_seen_generation = m_generation;
+        }
+        m_job(stripe_index);
+        Threading::MutexLocker locker(m_mutex);
+        if (--m_remaining_workers == 0)
+            m_done_condition.signal();
+    }
+}
+
+void RasterizerWorkerPool::run(Function<void(size_t)> job)
+{
+    VERIFY(m_worker_count > 0);
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_job = move(job);
+        m_remaining_workers = m_worker_count;
+        ++m_generation;
+        m_wake_condition.broadcast();
+    }
+
+    // The submitting thread takes the last stripe.
+    m_job(m_worker_count);
+
+    Threading::MutexLocker locker(m_mutex);
+    while (m_remaining_workers > 0)
+        m_done_condition.wait();
+    m_job = nullptr;
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/Types.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+
+namespace SoftGPU {
+
+// A persistent pool of rasterizer threads. Work is handed out as a single job
+// that every thread invokes with its own stripe index; the submitting thread
+// participates as the last stripe and blocks until the whole pool is done.
+class RasterizerWorkerPool {
+    AK_MAKE_NONCOPYABLE(RasterizerWorkerPool);
+    AK_MAKE_NONMOVABLE(RasterizerWorkerPool);
+
+public:
+    static RasterizerWorkerPool& the();
+
+    size_t stripe_count() const { return m_worker_count + 1; }
+    void run(Function<void(size_t stripe_index)>);
+
+private:
+    RasterizerWorkerPool();
+
+    void worker_loop(size_t stripe_index);
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_wake_condition { m_mutex };
+    Threading::ConditionVariable m_done_condition { m_mutex };
+    Function<void(size_t)> m_job;
+    size_t m_worker_count { 0 };
+    size_t m_remaining_workers { 0 };
+    u64 m_generation { 0 };
+};
+
+}
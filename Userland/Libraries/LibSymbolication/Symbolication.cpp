@@ -5,26 +5,176 @@
  */
 
 #include <AK/Array.h>
+#include <AK/BinarySearch.h>
 #include <AK/Checked.h>
+#include <AK/Demangle.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <LibCore/Directory.h>
 #include <LibCore/File.h>
 #include <LibCore/MappedFile.h>
+#include <LibCore/StandardPaths.h>
+#include <LibCore/Stream.h>
+#include <LibCore/System.h>
 #include <LibDebug/DebugInfo.h>
 #include <LibSymbolication/Symbolication.h>
+#include <sys/stat.h>
 
 namespace Symbolication {
 
 struct CachedELF {
     NonnullRefPtr<Core::MappedFile> mapped_file;
-    NonnullOwnPtr<Debug::DebugInfo> debug_info;
+    // Only created once a query actually asks for source positions; parsing
+    // the DWARF data of something like LibWeb takes far longer than the
+    // symbol table walk.
+    OwnPtr<Debug::DebugInfo> debug_info;
     NonnullOwnPtr<ELF::Image> image;
 };
 
 static HashMap<DeprecatedString, OwnPtr<CachedELF>> s_cache;
 
+// A persistent per-binary symbol index: a sorted address -> demangled name
+// table generated the first time a binary is symbolicated and reused by
+// later processes, so symbolication without source positions is a binary
+// search in a mapped file instead of an ELF symbol table parse.
+struct [[gnu::packed]] SymbolIndexHeader {
+    u32 magic;
+    u32 version;
+    u64 source_size;
+    u64 source_mtime;
+    u64 entry_count;
+};
+
+struct [[gnu::packed]] SymbolIndexEntry {
+    u64 address;
+    u32 name_offset;
+    u32 name_length;
+};
+
+static constexpr u32 symbol_index_magic = 0x53594d49; // "SYMI"
+static constexpr u32 symbol_index_version = 1;
+
+static HashMap<DeprecatedString, RefPtr<Core::MappedFile>> s_index_cache;
+
+static DeprecatedString symbol_index_path_for(DeprecatedString const& path)
+{
+    // Note: The binary's path is mirrored below the cache directory, which
+    //       also serves as the cache key; staleness is caught via the source
+    //       size and mtime stored in the header. (This tree's ELF images
+    //       don't expose a build ID to key on.)
+    return DeprecatedString::formatted("{}/symbol-index{}.idx", Core::StandardPaths::cache_directory(), path);
+}
+
+static RefPtr<Core::MappedFile> load_symbol_index(DeprecatedString const& path, struct stat const& source_stat)
+{
+    if (auto it = s_index_cache.find(path); it != s_index_cache.end())
+        return it->value;
+
+    auto file_or_error = Core::MappedFile::map(symbol_index_path_for(path));
+    if (file_or_error.is_error())
+        return nullptr;
+    auto file = file_or_error.release_value();
+
+    auto bytes = file->bytes();
+    if (bytes.size() < sizeof(SymbolIndexHeader))
+        return nullptr;
+    auto const& header = *reinterpret_cast<SymbolIndexHeader const*>(bytes.data());
+    if (header.magic != symbol_index_magic || header.version != symbol_index_version)
+        return nullptr;
+    if (header.source_size != static_cast<u64>(source_stat.st_size) || header.source_mtime != static_cast<u64>(source_stat.st_mtime))
+        return nullptr;
+    if (sizeof(SymbolIndexHeader) + header.entry_count * sizeof(SymbolIndexEntry) > bytes.size())
+        return nullptr;
+
+    s_index_cache.set(path, file);
+    return file;
+}
+
+static Optional<Symbol> symbolicate_from_index(Core::MappedFile const& index, DeprecatedString const& path, FlatPtr address)
+{
+    auto bytes = index.bytes();
+    auto const& header = *reinterpret_cast<SymbolIndexHeader const*>(bytes.data());
+    auto entries = Span<SymbolIndexEntry const> {
+        reinterpret_cast<SymbolIndexEntry const*>(bytes.data() + sizeof(SymbolIndexHeader)),
+        header.entry_count
+    };
+    auto string_table = bytes.slice(sizeof(SymbolIndexHeader) + header.entry_count * sizeof(SymbolIndexEntry));
+
+    size_t nearest_index = 0;
+    binary_search(entries, nullptr, &nearest_index, [&address](auto, auto& candidate) {
+        if (address < candidate.address)
+            return -1;
+        if (address > candidate.address)
+            return 1;
+        return 0;
+    });
+    if (entries.is_empty() || address < entries[nearest_index].address)
+        return {};
+
+    auto& entry = entries[nearest_index];
+    if (entry.name_offset + entry.name_length > string_table.size())
+        return {};
+
+    return Symbol {
+        .address = address,
+        .name = DeprecatedString { StringView { string_table.slice(entry.name_offset, entry.name_length) } },
+        .object = LexicalPath::basename(path),
+        .offset = static_cast<u32>(address - entry.address),
+        .source_positions = {},
+    };
+}
+
+static void write_symbol_index(DeprecatedString const& path, ELF::Image const& image, struct stat const& source_stat)
+{
+    struct FlatSymbol {
+        FlatPtr address;
+        DeprecatedString name;
+    };
+    Vector<FlatSymbol> symbols;
+    symbols.ensure_capacity(image.symbol_count());
+    image.for_each_symbol([&](auto const& symbol) {
+        symbols.append({ symbol.value(), demangle(symbol.name()) });
+    });
+    quick_sort(symbols, [](auto& a, auto& b) {
+        return a.address < b.address;
+    });
+
+    SymbolIndexHeader header {
+        .magic = symbol_index_magic,
+        .version = symbol_index_version,
+        .source_size = static_cast<u64>(source_stat.st_size),
+        .source_mtime = static_cast<u64>(source_stat.st_mtime),
+        .entry_count = symbols.size(),
+    };
+
+    auto result = [&]() -> ErrorOr<void> {
+        auto index_path = symbol_index_path_for(path);
+        TRY(Core::Directory::create(LexicalPath { index_path }.parent(), Core::Directory::CreateDirectories::Yes));
+        auto file = TRY(Core::Stream::File::open(index_path, Core::Stream::OpenMode::Write));
+        TRY(file->write_entire_buffer({ &header, sizeof(header) }));
+        u32 name_offset = 0;
+        for (auto& symbol : symbols) {
+            SymbolIndexEntry entry {
+                .address = symbol.address,
+                .name_offset = name_offset,
+                .name_length = static_cast<u32>(symbol.name.length()),
+            };
+            TRY(file->write_entire_buffer({ &entry, sizeof(entry) }));
+            name_offset += symbol.name.length();
+        }
+        for (auto& symbol : symbols)
+            TRY(file->write_entire_buffer(symbol.name.bytes()));
+        return {};
+    }();
+    if (result.is_error()) {
+        dbgln("Failed to write symbol index for {}: {}", path, result.error());
+        (void)Core::System::unlink(symbol_index_path_for(path));
+    }
+}
+
 enum class KernelBaseState {
     Uninitialized,
     Valid,
@@ -76,6 +226,27 @@ Optional<Symbol> symbolicate(DeprecatedString const& path, FlatPtr address, Incl
             return {};
         }
     }
+    struct stat source_stat {};
+    bool have_source_stat = stat(full_path.characters(), &source_stat) == 0;
+
+    // With no source positions requested, a valid on-disk index answers the
+    // query without parsing the ELF at all.
+    if (include_source_positions == IncludeSourcePosition::No && have_source_stat && !s_cache.contains(full_path)) {
+        if (auto index = load_symbol_index(full_path, source_stat)) {
+            if (auto symbol = symbolicate_from_index(*index, path, address); symbol.has_value())
+                return symbol;
+            // The address lies below every indexed symbol; report it the same
+            // way the ELF symbol table walk would.
+            return Symbol {
+                .address = address,
+                .name = "??",
+                .object = LexicalPath::basename(path),
+                .offset = 0,
+                .source_positions = {},
+            };
+        }
+    }
+
     if (!s_cache.contains(full_path)) {
         auto mapped_file = Core::MappedFile::map(full_path);
         if (mapped_file.is_error()) {
@@ -89,7 +260,9 @@ Optional<Symbol> symbolicate(DeprecatedString const& path, FlatPtr address, Incl
             s_cache.set(full_path, {});
             return {};
         }
-        auto cached_elf = make<CachedELF>(mapped_file.release_value(), make<Debug::DebugInfo>(*elf), move(elf));
+        if (have_source_stat && !load_symbol_index(full_path, source_stat))
+            write_symbol_index(full_path, *elf, source_stat);
+        auto cached_elf = make<CachedELF>(mapped_file.release_value(), OwnPtr<Debug::DebugInfo> {}, move(elf));
         s_cache.set(full_path, move(cached_elf));
     }
 
@@ -101,10 +274,12 @@ Optional<Symbol> symbolicate(DeprecatedString const& path, FlatPtr address, Incl
         return {};
 
     u32 offset = 0;
-    auto symbol = cached_elf->debug_info->elf().symbolicate(address, &offset);
+    auto symbol = cached_elf->image->symbolicate(address, &offset);
 
     Vector<Debug::DebugInfo::SourcePosition> positions;
     if (include_source_positions == IncludeSourcePosition::Yes) {
+        if (!cached_elf->debug_info)
+            cached_elf->debug_info = make<Debug::DebugInfo>(*cached_elf->image);
         auto source_position_with_inlines = cached_elf->debug_info->get_source_position_with_inlines(address).release_value_but_fixme_should_propagate_errors();
 
         for (auto& position : source_position_with_inlines.inline_chain) {
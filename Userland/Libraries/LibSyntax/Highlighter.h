@@ -48,6 +48,12 @@ public:
     virtual void rehighlight(Palette const&) = 0;
     virtual void highlight_matching_token_pair();
 
+    // Stateless highlighters can return a fresh instance here, which lets
+    // clients run rehighlight() on a background thread against a snapshot of
+    // the text instead of blocking the GUI thread. Highlighters carrying
+    // state across rehighlights should return nullptr to stay synchronous.
+    virtual OwnPtr<Highlighter> create_background_highlighter() const { return nullptr; }
+
     virtual bool is_identifier(u64) const { return false; };
     virtual bool is_navigatable(u64) const { return false; };
 
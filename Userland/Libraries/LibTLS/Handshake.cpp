@@ -20,6 +20,18 @@ ByteBuffer TLSv12::build_hello()
 {
     fill_with_random(&m_context.local_random, 32);
 
+    // Offer to resume an earlier session with this host, if we remember one.
+    m_context.session_id_size = 0;
+    m_context.session_resumption_offered = false;
+    if (auto session = SessionCache::take(m_context.extensions.SNI); session.has_value()) {
+        memcpy(m_context.session_id, session->session_id, session->session_id_size);
+        m_context.session_id_size = session->session_id_size;
+        m_context.master_key = move(session->master_key);
+        m_context.resumption_cipher = session->cipher;
+        m_context.session_resumption_offered = true;
+        dbgln_if(TLS_DEBUG, "Offering session resumption to {}", m_context.extensions.SNI);
+    }
+
     auto packet_version = (u16)m_context.options.version;
     auto version = (u16)m_context.options.version;
     PacketBuilder builder { MessageType::Handshake, packet_version };
@@ -218,8 +230,27 @@ ssize_t TLSv12::handle_handshake_finished(ReadonlyBytes buffer, WritePacketStage
 
     // TODO: Compare Hashes
     dbgln_if(TLS_DEBUG, "FIXME: handle_handshake_finished :: Check message validity");
+
+    // In an abbreviated handshake the server finishes first, and our own
+    // ChangeCipherSpec and Finished still have to go out.
+    if (m_context.session_resumed)
+        write_packets = WritePacketStage::Finished;
+
     m_context.connection_status = ConnectionStatus::Established;
 
+    // Remember this session so later connections to the host can resume it.
+    if (m_context.session_id_size && !m_context.extensions.SNI.is_empty()) {
+        SessionCache::CachedSession session;
+        memcpy(session.session_id, m_context.session_id, m_context.session_id_size);
+        session.session_id_size = m_context.session_id_size;
+        auto master_key_copy = ByteBuffer::copy(m_context.master_key);
+        if (!master_key_copy.is_error()) {
+            session.master_key = master_key_copy.release_value();
+            session.cipher = m_context.cipher;
+            SessionCache::store(m_context.extensions.SNI, move(session));
+        }
+    }
+
     if (m_handshake_timeout_timer) {
         // Disable the handshake timeout timer as handshake has been established.
         m_handshake_timeout_timer->stop();
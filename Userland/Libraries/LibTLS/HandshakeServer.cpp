@@ -62,6 +62,15 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
     }
 
     if (session_length && session_length <= 32) {
+        // If the server echoed the session ID we offered, this is the
+        // abbreviated handshake resuming the cached session; a fresh ID
+        // continues as a full handshake as usual.
+        if (m_context.session_resumption_offered
+            && session_length == m_context.session_id_size
+            && memcmp(m_context.session_id, buffer.offset_pointer(res), session_length) == 0) {
+            m_context.session_resumed = true;
+            dbgln_if(TLS_DEBUG, "Session resumed by {}", m_context.extensions.SNI);
+        }
         memcpy(m_context.session_id, buffer.offset_pointer(res), session_length);
         m_context.session_id_size = session_length;
         if constexpr (TLS_DEBUG) {
@@ -84,6 +93,10 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
         dbgln("No supported cipher could be agreed upon");
         return (i8)Error::NoCommonCipher;
     }
+    if (m_context.session_resumed && cipher != m_context.resumption_cipher) {
+        dbgln("Server tried to resume the session with a different cipher suite");
+        return (i8)Error::NotSafe;
+    }
     m_context.cipher = cipher;
     dbgln_if(TLS_DEBUG, "Cipher: {}", (u16)cipher);
 
@@ -99,6 +112,15 @@ ssize_t TLSv12::handle_server_hello(ReadonlyBytes buffer, WritePacketStage& writ
 
     if (m_context.connection_status != ConnectionStatus::Renegotiating)
         m_context.connection_status = ConnectionStatus::Negotiating;
+
+    if (m_context.session_resumed) {
+        // The cached master secret and the fresh randoms give us the session
+        // keys directly; the server's ChangeCipherSpec and Finished are next.
+        if (!expand_key())
+            return (i8)Error::NotSafe;
+        m_context.connection_status = ConnectionStatus::KeyExchange;
+    }
+
     if (m_context.is_server) {
         dbgln("unsupported: server mode");
         write_packets = WritePacketStage::ServerHandshake;
@@ -90,6 +90,11 @@ void TLSv12::update_packet(ByteBuffer& packet)
                     padding = 0;
                     mac_size = 0; // AEAD provides its own authentication scheme.
                 },
+                [&](Crypto::Cipher::ChaCha20Poly1305&) {
+                    VERIFY(is_aead());
+                    padding = 0;
+                    mac_size = 0; // AEAD provides its own authentication scheme.
+                },
                 [&](Crypto::Cipher::AESCipher::CBCMode& cbc) {
                     VERIFY(!is_aead());
                     block_size = cbc.cipher().block_size();
@@ -103,20 +108,8 @@ void TLSv12::update_packet(ByteBuffer& packet)
                 });
 
             if (m_context.crypto.created == 1) {
-                // `buffer' will continue to be encrypted
-                auto buffer_result = ByteBuffer::create_uninitialized(length);
-                if (buffer_result.is_error()) {
-                    dbgln("LibTLS: Failed to allocate enough memory");
-                    VERIFY_NOT_REACHED();
-                }
-                auto buffer = buffer_result.release_value();
-                size_t buffer_position = 0;
                 auto iv_size = iv_length();
 
-                // copy the packet, sans the header
-                buffer.overwrite(buffer_position, packet.offset_pointer(header_size), packet.size() - header_size);
-                buffer_position += packet.size() - header_size;
-
                 ByteBuffer ct;
 
                 m_cipher_local.visit(
@@ -175,8 +168,62 @@ void TLSv12::update_packet(ByteBuffer& packet)
 
                         VERIFY(header_size + 8 + length + 16 == ct.size());
                     },
+                    [&](Crypto::Cipher::ChaCha20Poly1305& chacha) {
+                        VERIFY(is_aead());
+                        // RFC 7905: nothing is added to the record; the nonce
+                        // is the 12-byte IV XORed with the padded sequence number.
+                        auto ct_buffer_result = ByteBuffer::create_uninitialized(length + header_size + 16);
+                        if (ct_buffer_result.is_error()) {
+                            dbgln("LibTLS: Failed to allocate enough memory for the ciphertext");
+                            VERIFY_NOT_REACHED();
+                        }
+                        ct = ct_buffer_result.release_value();
+
+                        // copy the header over
+                        ct.overwrite(0, packet.data(), header_size - 2);
+
+                        u8 aad[13];
+                        Bytes aad_bytes { aad, 13 };
+                        FixedMemoryStream aad_stream { aad_bytes };
+
+                        u64 seq_no = AK::convert_between_host_and_network_endian(m_context.local_sequence_number);
+                        u16 len = AK::convert_between_host_and_network_endian((u16)(packet.size() - header_size));
+
+                        MUST(aad_stream.write_value(seq_no));                             // sequence number
+                        MUST(aad_stream.write_entire_buffer(packet.bytes().slice(0, 3))); // content-type + version
+                        MUST(aad_stream.write_value(len));                                // length
+                        VERIFY(MUST(aad_stream.tell()) == MUST(aad_stream.size()));
+
+                        u8 nonce[12];
+                        memcpy(nonce, m_context.crypto.local_aead_iv, 12);
+                        for (size_t i = 0; i < 8; ++i)
+                            nonce[4 + i] ^= (u8)(m_context.local_sequence_number >> (56 - 8 * i));
+
+                        chacha.encrypt(
+                            packet.bytes().slice(header_size, length),
+                            ct.bytes().slice(header_size, length),
+                            ReadonlyBytes { nonce, 12 },
+                            aad_bytes,
+                            ct.bytes().slice(header_size + length, 16));
+
+                        VERIFY(header_size + length + 16 == ct.size());
+                    },
                     [&](Crypto::Cipher::AESCipher::CBCMode& cbc) {
                         VERIFY(!is_aead());
+                        // `buffer' will continue to be encrypted; GCM reads the
+                        // plaintext straight out of the packet instead.
+                        auto buffer_result = ByteBuffer::create_uninitialized(length);
+                        if (buffer_result.is_error()) {
+                            dbgln("LibTLS: Failed to allocate enough memory");
+                            VERIFY_NOT_REACHED();
+                        }
+                        auto buffer = buffer_result.release_value();
+                        size_t buffer_position = 0;
+
+                        // copy the packet, sans the header
+                        buffer.overwrite(buffer_position, packet.offset_pointer(header_size), packet.size() - header_size);
+                        buffer_position += packet.size() - header_size;
+
                         // We need enough space for a header, iv_length bytes of IV and whatever the packet contains
                         auto ct_buffer_result = ByteBuffer::create_uninitialized(length + header_size + iv_size);
                         if (ct_buffer_result.is_error()) {
@@ -346,6 +393,13 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
 
     ByteBuffer decrypted;
 
+    // Application data on an established connection is decrypted straight into
+    // the application buffer; everything else goes through a scratch buffer.
+    bool deliver_into_application_buffer = m_context.cipher_spec_set
+        && type == MessageType::ApplicationData
+        && m_context.connection_status == ConnectionStatus::Established;
+    size_t previous_application_buffer_size = m_context.application_buffer.size();
+
     if (m_context.cipher_spec_set && type != MessageType::ChangeCipher) {
         if constexpr (TLS_DEBUG) {
             dbgln("Encrypted: ");
@@ -367,13 +421,24 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
 
                 auto packet_length = length - iv_length() - 16;
                 auto payload = plain;
-                auto decrypted_result = ByteBuffer::create_uninitialized(packet_length);
-                if (decrypted_result.is_error()) {
-                    dbgln("Failed to allocate memory for the packet");
-                    return_value = Error::DecryptionFailed;
-                    return;
+                Bytes destination;
+                if (deliver_into_application_buffer) {
+                    if (m_context.application_buffer.try_resize(previous_application_buffer_size + packet_length).is_error()) {
+                        dbgln("Failed to allocate memory for the packet");
+                        return_value = Error::DecryptionFailed;
+                        return;
+                    }
+                    destination = m_context.application_buffer.bytes().slice(previous_application_buffer_size);
+                } else {
+                    auto decrypted_result = ByteBuffer::create_uninitialized(packet_length);
+                    if (decrypted_result.is_error()) {
+                        dbgln("Failed to allocate memory for the packet");
+                        return_value = Error::DecryptionFailed;
+                        return;
+                    }
+                    decrypted = decrypted_result.release_value();
+                    destination = decrypted.bytes();
                 }
-                decrypted = decrypted_result.release_value();
 
                 // AEAD AAD (13)
                 // Seq. no (8)
@@ -411,13 +476,15 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
 
                 auto consistency = gcm.decrypt(
                     ciphertext,
-                    decrypted,
+                    destination,
                     iv_bytes,
                     aad_bytes,
                     tag);
 
                 if (consistency != Crypto::VerificationConsistency::Consistent) {
                     dbgln("integrity check failed (tag length {})", tag.size());
+                    if (deliver_into_application_buffer)
+                        m_context.application_buffer.resize(previous_application_buffer_size);
                     auto packet = build_alert(true, (u8)AlertDescription::BadRecordMAC);
                     write_packet(packet);
 
@@ -425,34 +492,119 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
                     return;
                 }
 
-                plain = decrypted;
+                plain = destination;
+            },
+            [&](Crypto::Cipher::ChaCha20Poly1305& chacha) {
+                VERIFY(is_aead());
+                if (length < 16) {
+                    dbgln("Invalid packet length");
+                    auto packet = build_alert(true, (u8)AlertDescription::DecryptError);
+                    write_packet(packet);
+                    return_value = Error::BrokenPacket;
+                    return;
+                }
+
+                auto packet_length = length - 16;
+                auto payload = plain;
+                Bytes destination;
+                if (deliver_into_application_buffer) {
+                    if (m_context.application_buffer.try_resize(previous_application_buffer_size + packet_length).is_error()) {
+                        dbgln("Failed to allocate memory for the packet");
+                        return_value = Error::DecryptionFailed;
+                        return;
+                    }
+                    destination = m_context.application_buffer.bytes().slice(previous_application_buffer_size);
+                } else {
+                    auto decrypted_result = ByteBuffer::create_uninitialized(packet_length);
+                    if (decrypted_result.is_error()) {
+                        dbgln("Failed to allocate memory for the packet");
+                        return_value = Error::DecryptionFailed;
+                        return;
+                    }
+                    decrypted = decrypted_result.release_value();
+                    destination = decrypted.bytes();
+                }
+
+                u8 aad[13];
+                Bytes aad_bytes { aad, 13 };
+                FixedMemoryStream aad_stream { aad_bytes };
+
+                u64 seq_no = AK::convert_between_host_and_network_endian(m_context.remote_sequence_number);
+                u16 len = AK::convert_between_host_and_network_endian((u16)packet_length);
+
+                MUST(aad_stream.write_value(seq_no));                                   // sequence number
+                MUST(aad_stream.write_entire_buffer(buffer.slice(0, header_size - 2))); // content-type + version
+                MUST(aad_stream.write_value(len));                                      // length
+                VERIFY(MUST(aad_stream.tell()) == MUST(aad_stream.size()));
+
+                // RFC 7905: the nonce is the 12-byte IV XORed with the padded sequence number.
+                u8 nonce[12];
+                memcpy(nonce, m_context.crypto.remote_aead_iv, 12);
+                for (size_t i = 0; i < 8; ++i)
+                    nonce[4 + i] ^= (u8)(m_context.remote_sequence_number >> (56 - 8 * i));
+
+                auto ciphertext = payload.slice(0, packet_length);
+                auto tag = payload.slice(packet_length);
+
+                auto consistency = chacha.decrypt(
+                    ciphertext,
+                    destination,
+                    ReadonlyBytes { nonce, 12 },
+                    aad_bytes,
+                    tag);
+
+                if (consistency != Crypto::VerificationConsistency::Consistent) {
+                    dbgln("integrity check failed (tag length {})", tag.size());
+                    if (deliver_into_application_buffer)
+                        m_context.application_buffer.resize(previous_application_buffer_size);
+                    auto packet = build_alert(true, (u8)AlertDescription::BadRecordMAC);
+                    write_packet(packet);
+
+                    return_value = Error::IntegrityCheckFailed;
+                    return;
+                }
+
+                plain = destination;
             },
             [&](Crypto::Cipher::AESCipher::CBCMode& cbc) {
                 VERIFY(!is_aead());
                 auto iv_size = iv_length();
 
-                auto decrypted_result = cbc.create_aligned_buffer(length - iv_size);
-                if (decrypted_result.is_error()) {
-                    dbgln("Failed to allocate memory for the packet");
-                    return_value = Error::DecryptionFailed;
-                    return;
+                Bytes destination;
+                if (deliver_into_application_buffer) {
+                    if (m_context.application_buffer.try_resize(previous_application_buffer_size + length - iv_size).is_error()) {
+                        dbgln("Failed to allocate memory for the packet");
+                        return_value = Error::DecryptionFailed;
+                        return;
+                    }
+                    destination = m_context.application_buffer.bytes().slice(previous_application_buffer_size);
+                } else {
+                    auto decrypted_result = cbc.create_aligned_buffer(length - iv_size);
+                    if (decrypted_result.is_error()) {
+                        dbgln("Failed to allocate memory for the packet");
+                        return_value = Error::DecryptionFailed;
+                        return;
+                    }
+                    decrypted = decrypted_result.release_value();
+                    destination = decrypted.bytes();
                 }
-                decrypted = decrypted_result.release_value();
                 auto iv = buffer.slice(header_size, iv_size);
 
-                Bytes decrypted_span = decrypted;
+                Bytes decrypted_span = destination;
                 cbc.decrypt(buffer.slice(header_size + iv_size, length - iv_size), decrypted_span, iv);
 
                 length = decrypted_span.size();
 
                 if constexpr (TLS_DEBUG) {
                     dbgln("Decrypted: ");
-                    print_buffer(decrypted);
+                    print_buffer(decrypted_span);
                 }
 
                 auto mac_size = mac_length();
                 if (length < mac_size) {
                     dbgln("broken packet");
+                    if (deliver_into_application_buffer)
+                        m_context.application_buffer.resize(previous_application_buffer_size);
                     auto packet = build_alert(true, (u8)AlertDescription::DecryptError);
                     write_packet(packet);
                     return_value = Error::BrokenPacket;
@@ -473,13 +625,18 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
                     print_buffer(message_mac);
                     dbgln("mac computed:");
                     print_buffer(hmac);
+                    if (deliver_into_application_buffer)
+                        m_context.application_buffer.resize(previous_application_buffer_size);
                     auto packet = build_alert(true, (u8)AlertDescription::BadRecordMAC);
                     write_packet(packet);
 
                     return_value = Error::IntegrityCheckFailed;
                     return;
                 }
-                plain = decrypted.bytes().slice(0, length);
+                // Drop the MAC and padding off the end of the delivered data.
+                if (deliver_into_application_buffer)
+                    m_context.application_buffer.resize(previous_application_buffer_size + length);
+                plain = destination.slice(0, length);
             });
 
         if (return_value != Error::NoError) {
@@ -498,7 +655,8 @@ ssize_t TLSv12::handle_message(ReadonlyBytes buffer)
         } else {
             dbgln_if(TLS_DEBUG, "application data message of size {}", plain.size());
 
-            if (m_context.application_buffer.try_append(plain.data(), plain.size()).is_error()) {
+            if (!deliver_into_application_buffer
+                && m_context.application_buffer.try_append(plain.data(), plain.size()).is_error()) {
                 payload_res = (i8)Error::DecryptionFailed;
                 auto packet = build_alert(true, (u8)AlertDescription::DecryptionFailed);
                 write_packet(packet);
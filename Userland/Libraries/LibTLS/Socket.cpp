@@ -27,8 +27,8 @@ ErrorOr<Bytes> TLSv12::read(Bytes bytes)
         return Bytes {};
     }
 
-    TRY(m_context.application_buffer.slice(0, size_to_read)).span().copy_to(bytes);
-    m_context.application_buffer = TRY(m_context.application_buffer.slice(size_to_read, m_context.application_buffer.size() - size_to_read));
+    m_context.application_buffer.bytes().slice(0, size_to_read).copy_to(bytes);
+    discard_application_data(size_to_read);
     return Bytes { bytes.data(), size_to_read };
 }
 
@@ -47,12 +47,21 @@ DeprecatedString TLSv12::read_line(size_t max_size)
         return {};
 
     DeprecatedString line { bit_cast<char const*>(start), offset, Chomp };
-    // FIXME: Propagate errors.
-    m_context.application_buffer = MUST(m_context.application_buffer.slice(offset + 1, m_context.application_buffer.size() - offset - 1));
+    discard_application_data(offset + 1);
 
     return line;
 }
 
+void TLSv12::discard_application_data(size_t size)
+{
+    auto& buffer = m_context.application_buffer;
+    auto remaining = buffer.size() - size;
+    // Shift the unread tail down instead of reallocating the remainder on every read.
+    if (remaining > 0)
+        buffer.overwrite(0, buffer.offset_pointer(size), remaining);
+    buffer.resize(remaining);
+}
+
 ErrorOr<size_t> TLSv12::write(ReadonlyBytes bytes)
 {
     if (m_context.connection_status != ConnectionStatus::Established) {
@@ -17,6 +17,7 @@
 #include <LibCrypto/PK/Code/EMSA_PSS.h>
 #include <LibTLS/TLSv12.h>
 #include <errno.h>
+#include <time.h>
 
 #ifndef SOCK_NONBLOCK
 #    include <sys/ioctl.h>
@@ -24,6 +25,30 @@
 
 namespace TLS {
 
+Singleton<SessionCache> SessionCache::s_the;
+
+Optional<SessionCache::CachedSession> SessionCache::take(DeprecatedString const& host)
+{
+    if (host.is_empty())
+        return {};
+    auto session = s_the->m_sessions.take(host);
+    if (!session.has_value())
+        return {};
+    if (time(nullptr) - session->stored_time > session_lifetime_in_seconds)
+        return {};
+    return session;
+}
+
+void SessionCache::store(DeprecatedString const& host, CachedSession session)
+{
+    if (host.is_empty() || session.session_id_size == 0 || session.master_key.is_empty())
+        return;
+    session.stored_time = time(nullptr);
+    if (s_the->m_sessions.size() >= maximum_session_count && !s_the->m_sessions.contains(host))
+        s_the->m_sessions.remove(s_the->m_sessions.begin()->key);
+    s_the->m_sessions.set(host, move(session));
+}
+
 void TLSv12::consume(ReadonlyBytes record)
 {
     if (m_context.critical_error) {
@@ -37,13 +62,20 @@ void TLSv12::consume(ReadonlyBytes record)
 
     dbgln_if(TLS_DEBUG, "Consuming {} bytes", record.size());
 
-    if (m_context.message_buffer.try_append(record).is_error()) {
-        dbgln("Not enough space in message buffer, dropping the record");
-        return;
+    // Process records straight out of the newly received data when nothing is
+    // buffered; only a trailing partial record has to be copied aside then.
+    ReadonlyBytes buffer = record;
+    bool const process_in_place = m_context.message_buffer.is_empty();
+    if (!process_in_place) {
+        if (m_context.message_buffer.try_append(record).is_error()) {
+            dbgln("Not enough space in message buffer, dropping the record");
+            return;
+        }
+        buffer = m_context.message_buffer.bytes();
     }
 
     size_t index { 0 };
-    size_t buffer_length = m_context.message_buffer.size();
+    size_t buffer_length = buffer.size();
 
     size_t size_offset { 3 }; // read the common record header
     size_t header_size { 5 };
@@ -51,12 +83,12 @@ void TLSv12::consume(ReadonlyBytes record)
     dbgln_if(TLS_DEBUG, "message buffer length {}", buffer_length);
 
     while (buffer_length >= 5) {
-        auto length = AK::convert_between_host_and_network_endian(ByteReader::load16(m_context.message_buffer.offset_pointer(index + size_offset))) + header_size;
+        auto length = AK::convert_between_host_and_network_endian(ByteReader::load16(buffer.offset_pointer(index + size_offset))) + header_size;
         if (length > buffer_length) {
             dbgln_if(TLS_DEBUG, "Need more data: {} > {}", length, buffer_length);
             break;
         }
-        auto consumed = handle_message(m_context.message_buffer.bytes().slice(index, length));
+        auto consumed = handle_message(buffer.slice(index, length));
 
         if constexpr (TLS_DEBUG) {
             if (consumed > 0)
@@ -91,9 +123,14 @@ void TLSv12::consume(ReadonlyBytes record)
         return;
     }
 
-    if (index) {
-        // FIXME: Propagate errors.
-        m_context.message_buffer = MUST(m_context.message_buffer.slice(index, m_context.message_buffer.size() - index));
+    if (process_in_place) {
+        if (buffer_length > 0 && m_context.message_buffer.try_append(buffer.slice(index)).is_error())
+            dbgln("Not enough space in message buffer, dropping a partial record");
+    } else if (index) {
+        auto remaining = m_context.message_buffer.size() - index;
+        if (remaining > 0)
+            m_context.message_buffer.overwrite(0, m_context.message_buffer.offset_pointer(index), remaining);
+        m_context.message_buffer.resize(remaining);
     }
 }
 
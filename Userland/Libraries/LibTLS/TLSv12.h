@@ -15,6 +15,7 @@
 #include <LibCrypto/Authentication/HMAC.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
 #include <LibCrypto/Cipher/AES.h>
+#include <LibCrypto/Cipher/ChaCha20Poly1305.h>
 #include <LibCrypto/Curves/EllipticCurve.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibCrypto/PK/RSA.h>
@@ -182,7 +183,8 @@ enum class ECCurveType : u8 {
     C(true, CipherSuite::DHE_RSA_WITH_AES_128_GCM_SHA256, KeyExchangeAlgorithm::DHE_RSA, CipherAlgorithm::AES_128_GCM, Crypto::Hash::SHA256, 8, true)     \
     C(true, CipherSuite::DHE_RSA_WITH_AES_256_GCM_SHA384, KeyExchangeAlgorithm::DHE_RSA, CipherAlgorithm::AES_256_GCM, Crypto::Hash::SHA384, 8, true)     \
     C(true, CipherSuite::ECDHE_RSA_WITH_AES_128_GCM_SHA256, KeyExchangeAlgorithm::ECDHE_RSA, CipherAlgorithm::AES_128_GCM, Crypto::Hash::SHA256, 8, true) \
-    C(true, CipherSuite::ECDHE_RSA_WITH_AES_256_GCM_SHA384, KeyExchangeAlgorithm::ECDHE_RSA, CipherAlgorithm::AES_256_GCM, Crypto::Hash::SHA384, 8, true)
+    C(true, CipherSuite::ECDHE_RSA_WITH_AES_256_GCM_SHA384, KeyExchangeAlgorithm::ECDHE_RSA, CipherAlgorithm::AES_256_GCM, Crypto::Hash::SHA384, 8, true)     \
+    C(true, CipherSuite::ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256, KeyExchangeAlgorithm::ECDHE_RSA, CipherAlgorithm::CHACHA20_POLY1305, Crypto::Hash::SHA256, 12, true)
 
 constexpr KeyExchangeAlgorithm get_key_exchange_algorithm(CipherSuite suite)
 {
@@ -288,8 +290,9 @@ struct Context {
         u8 local_mac[32];
         u8 local_iv[16];
         u8 remote_iv[16];
-        u8 local_aead_iv[4];
-        u8 remote_aead_iv[4];
+        // 4 bytes of implicit IV for AES-GCM, all 12 for ChaCha20-Poly1305.
+        u8 local_aead_iv[12];
+        u8 remote_aead_iv[12];
     } crypto;
 
     Crypto::Hash::Manager handshake_hash;
@@ -342,6 +345,36 @@ struct Context {
     } server_diffie_hellman_params;
 
     OwnPtr<Crypto::Curves::EllipticCurve> server_key_exchange_curve;
+
+    bool session_resumption_offered { false };
+    bool session_resumed { false };
+    CipherSuite resumption_cipher { CipherSuite::Invalid };
+};
+
+// Master secrets of recently established sessions, keyed by host name, so
+// that later connections to the same host can offer the abbreviated
+// (session ID) handshake instead of a full key exchange.
+class SessionCache {
+public:
+    struct CachedSession {
+        u8 session_id[32] {};
+        u8 session_id_size { 0 };
+        ByteBuffer master_key;
+        CipherSuite cipher { CipherSuite::Invalid };
+        time_t stored_time { 0 };
+    };
+
+    // Removes and returns the cached session for the given host; it is stored
+    // back only once the resumed handshake actually succeeds.
+    static Optional<CachedSession> take(DeprecatedString const& host);
+    static void store(DeprecatedString const& host, CachedSession);
+
+private:
+    static constexpr time_t session_lifetime_in_seconds = 3600;
+    static constexpr size_t maximum_session_count = 64;
+
+    static Singleton<SessionCache> s_the;
+    HashMap<DeprecatedString, CachedSession> m_sessions;
 };
 
 class TLSv12 final : public Core::Stream::Socket {
@@ -462,6 +495,7 @@ private:
 
     ErrorOr<bool> flush();
     void write_into_socket();
+    void discard_application_data(size_t);
     ErrorOr<void> read_from_socket();
 
     bool check_connection_state(bool read);
@@ -564,7 +598,8 @@ private:
     using CipherVariant = Variant<
         Empty,
         Crypto::Cipher::AESCipher::CBCMode,
-        Crypto::Cipher::AESCipher::GCMMode>;
+        Crypto::Cipher::AESCipher::GCMMode,
+        Crypto::Cipher::ChaCha20Poly1305>;
     CipherVariant m_cipher_local {};
     CipherVariant m_cipher_remote {};
 
@@ -8,8 +8,13 @@
 #include <LibTest/Macros.h> // intentionally first -- we redefine VERIFY and friends in here
 
 #include <AK/Function.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <LibCore/ArgsParser.h>
 #include <LibTest/TestSuite.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <sys/time.h>
 
@@ -24,6 +29,11 @@ public:
     void restart() { gettimeofday(&m_started, nullptr); }
 
     u64 elapsed_milliseconds()
+    {
+        return elapsed_microseconds() / 1000;
+    }
+
+    u64 elapsed_microseconds()
     {
         struct timeval now = {};
         gettimeofday(&now, nullptr);
@@ -31,13 +41,42 @@ public:
         struct timeval delta = {};
         timersub(&now, &m_started, &delta);
 
-        return delta.tv_sec * 1000 + delta.tv_usec / 1000;
+        return delta.tv_sec * 1'000'000 + delta.tv_usec;
     }
 
 private:
     struct timeval m_started = {};
 };
 
+static u64 read_cycle_counter()
+{
+#if ARCH(X86_64)
+    return __builtin_ia32_rdtsc();
+#elif ARCH(AARCH64)
+    u64 counter;
+    asm volatile("mrs %0, cntvct_el0"
+                 : "=r"(counter));
+    return counter;
+#else
+    return 0;
+#endif
+}
+
+// A benchmark case is repeated until it has either used up its time budget or
+// produced enough samples for the median and the median absolute deviation to
+// mean something; a case whose single run blows the budget is measured once.
+static constexpr u64 benchmark_time_budget_microseconds = 500'000;
+static constexpr size_t benchmark_max_iteration_count = 25;
+
+static u64 median_of_sorted(Vector<u64> const& sorted_values)
+{
+    VERIFY(!sorted_values.is_empty());
+    auto size = sorted_values.size();
+    if (size % 2 != 0)
+        return sorted_values[size / 2];
+    return (sorted_values[size / 2 - 1] + sorted_values[size / 2]) / 2;
+}
+
 // Declared in Macros.h
 void current_test_case_did_fail()
 {
@@ -66,13 +105,18 @@ int TestSuite::main(DeprecatedString const& suite_name, int argc, char** argv)
     bool do_benchmarks_only = false;
     bool do_list_cases = false;
     char const* search_string = "*";
+    char const* benchmark_json_path = nullptr;
 
     args_parser.add_option(do_tests_only, "Only run tests.", "tests", 0);
     args_parser.add_option(do_benchmarks_only, "Only run benchmarks.", "bench", 0);
+    args_parser.add_option(benchmark_json_path, "Write benchmark results to a JSON file.", "bench-json", 0, "path");
     args_parser.add_option(do_list_cases, "List available test cases.", "list", 0);
     args_parser.add_positional_argument(search_string, "Only run matching cases.", "pattern", Core::ArgsParser::Required::No);
     args_parser.parse(argc, argv);
 
+    if (benchmark_json_path != nullptr)
+        m_benchmark_json_path = benchmark_json_path;
+
     if (m_setup)
         m_setup();
 
@@ -124,16 +168,26 @@ int TestSuite::run(NonnullRefPtrVector<TestCase> const& tests)
         warnln("Running {} '{}'.", test_type, t.name());
         m_current_test_case_passed = true;
 
-        TestElapsedTimer timer;
-        t.func()();
-        auto const time = timer.elapsed_milliseconds();
+        if (t.is_benchmark()) {
+            auto result = run_benchmark_case(t);
 
-        dbgln("{} {} '{}' in {}ms", m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(), time);
+            dbgln("{} {} '{}' in {}ms ({} iterations, median {}us +/- {}us)",
+                m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(),
+                result.total_microseconds / 1000,
+                result.iteration_count,
+                result.median_microseconds,
+                result.median_absolute_deviation_microseconds);
 
-        if (t.is_benchmark()) {
-            m_benchtime += time;
+            m_benchtime += result.total_microseconds / 1000;
             benchmark_count++;
+            m_benchmark_results.append(move(result));
         } else {
+            TestElapsedTimer timer;
+            t.func()();
+            auto const time = timer.elapsed_milliseconds();
+
+            dbgln("{} {} '{}' in {}ms", m_current_test_case_passed ? "Completed" : "Failed", test_type, t.name(), time);
+
             m_testtime += time;
             test_count++;
         }
@@ -143,6 +197,9 @@ int TestSuite::run(NonnullRefPtrVector<TestCase> const& tests)
         }
     }
 
+    if (!m_benchmark_json_path.is_empty())
+        write_benchmark_results_json();
+
     dbgln("Finished {} tests and {} benchmarks in {}ms ({}ms tests, {}ms benchmarks, {}ms other).",
         test_count,
         benchmark_count,
@@ -155,4 +212,78 @@ int TestSuite::run(NonnullRefPtrVector<TestCase> const& tests)
     return (int)test_failed_count;
 }
 
+BenchmarkResult TestSuite::run_benchmark_case(TestCase const& test_case)
+{
+    Vector<u64> sample_microseconds;
+    Vector<u64> sample_cycles;
+    u64 total_microseconds = 0;
+
+    while (sample_microseconds.size() < benchmark_max_iteration_count
+        && (sample_microseconds.is_empty() || total_microseconds < benchmark_time_budget_microseconds)) {
+        TestElapsedTimer timer;
+        auto const cycles_before = read_cycle_counter();
+        test_case.func()();
+        auto const cycles_after = read_cycle_counter();
+        auto const microseconds = timer.elapsed_microseconds();
+
+        sample_microseconds.append(microseconds);
+        sample_cycles.append(cycles_after - cycles_before);
+        total_microseconds += microseconds;
+
+        if (!m_current_test_case_passed)
+            break;
+    }
+
+    quick_sort(sample_microseconds);
+    quick_sort(sample_cycles);
+
+    BenchmarkResult result;
+    result.name = test_case.name();
+    result.iteration_count = sample_microseconds.size();
+    result.total_microseconds = total_microseconds;
+    result.median_microseconds = median_of_sorted(sample_microseconds);
+    result.min_microseconds = sample_microseconds.first();
+    result.max_microseconds = sample_microseconds.last();
+    result.median_cycles = median_of_sorted(sample_cycles);
+
+    Vector<u64> absolute_deviations;
+    absolute_deviations.ensure_capacity(sample_microseconds.size());
+    for (auto microseconds : sample_microseconds)
+        absolute_deviations.unchecked_append(AK::max(microseconds, result.median_microseconds) - AK::min(microseconds, result.median_microseconds));
+    quick_sort(absolute_deviations);
+    result.median_absolute_deviation_microseconds = median_of_sorted(absolute_deviations);
+
+    return result;
+}
+
+void TestSuite::write_benchmark_results_json() const
+{
+    JsonArray benchmarks;
+    for (auto const& result : m_benchmark_results) {
+        JsonObject benchmark;
+        benchmark.set("name", result.name);
+        benchmark.set("iteration_count", result.iteration_count);
+        benchmark.set("total_microseconds", result.total_microseconds);
+        benchmark.set("median_microseconds", result.median_microseconds);
+        benchmark.set("median_absolute_deviation_microseconds", result.median_absolute_deviation_microseconds);
+        benchmark.set("min_microseconds", result.min_microseconds);
+        benchmark.set("max_microseconds", result.max_microseconds);
+        benchmark.set("median_cycles", result.median_cycles);
+        benchmarks.append(move(benchmark));
+    }
+
+    JsonObject root;
+    root.set("suite", m_suite_name);
+    root.set("benchmarks", move(benchmarks));
+
+    auto* file = fopen(m_benchmark_json_path.characters(), "w");
+    if (file == nullptr) {
+        warnln("Failed to open {} for writing benchmark results.", m_benchmark_json_path);
+        return;
+    }
+    fputs(root.to_deprecated_string().characters(), file);
+    fputc('\n', file);
+    fclose(file);
+}
+
 }
@@ -12,10 +12,22 @@
 #include <AK/DeprecatedString.h>
 #include <AK/Function.h>
 #include <AK/NonnullRefPtrVector.h>
+#include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 
 namespace Test {
 
+struct BenchmarkResult {
+    DeprecatedString name;
+    size_t iteration_count { 0 };
+    u64 total_microseconds { 0 };
+    u64 median_microseconds { 0 };
+    u64 median_absolute_deviation_microseconds { 0 };
+    u64 min_microseconds { 0 };
+    u64 max_microseconds { 0 };
+    u64 median_cycles { 0 };
+};
+
 class TestSuite {
 public:
     static TestSuite& the()
@@ -45,11 +57,16 @@ public:
     void set_suite_setup(Function<void()> setup) { m_setup = move(setup); }
 
 private:
+    BenchmarkResult run_benchmark_case(TestCase const&);
+    void write_benchmark_results_json() const;
+
     static TestSuite* s_global;
     NonnullRefPtrVector<TestCase> m_cases;
     u64 m_testtime = 0;
     u64 m_benchtime = 0;
     DeprecatedString m_suite_name;
+    DeprecatedString m_benchmark_json_path;
+    Vector<BenchmarkResult> m_benchmark_results;
     bool m_current_test_case_passed = true;
     Function<void()> m_setup;
 };
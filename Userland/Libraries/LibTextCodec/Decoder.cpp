@@ -238,14 +238,29 @@ DeprecatedString UTF8Decoder::to_utf8(StringView input)
     return bomless_input;
 }
 
-void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point)
+enum class Utf16Endianness {
+    Big,
+    Little,
+};
+
+// rfc2781, 2.2 Decoding UTF-16
+// This takes the code point sink as a template parameter so bulk conversions
+// don't pay for a Function dispatch per code point.
+template<Utf16Endianness endianness, typename Callback>
+static void process_utf16(StringView input, Callback&& on_code_point)
 {
-    // rfc2781, 2.2 Decoding UTF-16
+    auto read_code_unit = [&](size_t i) -> u16 {
+        if constexpr (endianness == Utf16Endianness::Big)
+            return (static_cast<u8>(input[i]) << 8) | static_cast<u8>(input[i + 1]);
+        else
+            return static_cast<u8>(input[i]) | (static_cast<u8>(input[i + 1]) << 8);
+    };
+
     size_t utf16_length = input.length() - (input.length() % 2);
     for (size_t i = 0; i < utf16_length; i += 2) {
         // 1) If W1 < 0xD800 or W1 > 0xDFFF, the character value U is the value
         //    of W1. Terminate.
-        u16 w1 = (static_cast<u8>(input[i]) << 8) | static_cast<u8>(input[i + 1]);
+        u16 w1 = read_code_unit(i);
         if (!is_unicode_surrogate(w1)) {
             on_code_point(w1);
             continue;
@@ -262,7 +277,7 @@ void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point
             continue;
         }
 
-        u16 w2 = (static_cast<u8>(input[i + 2]) << 8) | static_cast<u8>(input[i + 3]);
+        u16 w2 = read_code_unit(i + 2);
         if (!Utf16View::is_low_surrogate(w2)) {
             on_code_point(replacement_code_point);
             continue;
@@ -277,6 +292,11 @@ void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point
     }
 }
 
+void UTF16BEDecoder::process(StringView input, Function<void(u32)> on_code_point)
+{
+    process_utf16<Utf16Endianness::Big>(input, [&](u32 code_point) { on_code_point(code_point); });
+}
+
 DeprecatedString UTF16BEDecoder::to_utf8(StringView input)
 {
     // Discard the BOM
@@ -285,47 +305,13 @@ DeprecatedString UTF16BEDecoder::to_utf8(StringView input)
         bomless_input = input.substring_view(2);
 
     StringBuilder builder(bomless_input.length() / 2);
-    process(bomless_input, [&builder](u32 c) { builder.append_code_point(c); });
+    process_utf16<Utf16Endianness::Big>(bomless_input, [&builder](u32 code_point) { builder.append_code_point(code_point); });
     return builder.to_deprecated_string();
 }
 
 void UTF16LEDecoder::process(StringView input, Function<void(u32)> on_code_point)
 {
-    // rfc2781, 2.2 Decoding UTF-16
-    size_t utf16_length = input.length() - (input.length() % 2);
-    for (size_t i = 0; i < utf16_length; i += 2) {
-        // 1) If W1 < 0xD800 or W1 > 0xDFFF, the character value U is the value
-        //    of W1. Terminate.
-        u16 w1 = static_cast<u8>(input[i]) | (static_cast<u8>(input[i + 1]) << 8);
-        if (!is_unicode_surrogate(w1)) {
-            on_code_point(w1);
-            continue;
-        }
-
-        // 2) Determine if W1 is between 0xD800 and 0xDBFF. If not, the sequence
-        //    is in error and no valid character can be obtained using W1.
-        //    Terminate.
-        // 3) If there is no W2 (that is, the sequence ends with W1), or if W2
-        //    is not between 0xDC00 and 0xDFFF, the sequence is in error.
-        //    Terminate.
-        if (!Utf16View::is_high_surrogate(w1) || i + 2 == utf16_length) {
-            on_code_point(replacement_code_point);
-            continue;
-        }
-
-        u16 w2 = static_cast<u8>(input[i + 2]) | (static_cast<u8>(input[i + 3]) << 8);
-        if (!Utf16View::is_low_surrogate(w2)) {
-            on_code_point(replacement_code_point);
-            continue;
-        }
-
-        // 4) Construct a 20-bit unsigned integer U', taking the 10 low-order
-        //    bits of W1 as its 10 high-order bits and the 10 low-order bits of
-        //    W2 as its 10 low-order bits.
-        // 5) Add 0x10000 to U' to obtain the character value U. Terminate.
-        on_code_point(Utf16View::decode_surrogate_pair(w1, w2));
-        i += 2;
-    }
+    process_utf16<Utf16Endianness::Little>(input, [&](u32 code_point) { on_code_point(code_point); });
 }
 
 DeprecatedString UTF16LEDecoder::to_utf8(StringView input)
@@ -336,7 +322,7 @@ DeprecatedString UTF16LEDecoder::to_utf8(StringView input)
         bomless_input = input.substring_view(2);
 
     StringBuilder builder(bomless_input.length() / 2);
-    process(bomless_input, [&builder](u32 c) { builder.append_code_point(c); });
+    process_utf16<Utf16Endianness::Little>(bomless_input, [&builder](u32 code_point) { builder.append_code_point(code_point); });
     return builder.to_deprecated_string();
 }
 
@@ -348,6 +334,40 @@ void Latin1Decoder::process(StringView input, Function<void(u32)> on_code_point)
     }
 }
 
+DeprecatedString Latin1Decoder::to_utf8(StringView input)
+{
+    StringBuilder builder(input.length());
+    auto const* data = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    size_t i = 0;
+    while (i < input.length()) {
+        // Copy runs of ASCII bytes verbatim, scanning a machine word at a time.
+        // The compiler vectorizes this scan, and appending the whole run at once
+        // is just a memcpy, so plain ASCII input decodes at memory speed.
+        size_t start_of_run = i;
+        constexpr size_t high_bits = static_cast<size_t>(0x8080808080808080ull);
+        while (i + sizeof(size_t) <= input.length()) {
+            size_t word;
+            __builtin_memcpy(&word, data + i, sizeof(word));
+            if (word & high_bits)
+                break;
+            i += sizeof(size_t);
+        }
+        while (i < input.length() && data[i] < 0x80)
+            ++i;
+        if (i > start_of_run)
+            builder.append(input.substring_view(start_of_run, i - start_of_run));
+
+        // Latin1 is the same as the first 256 Unicode code points, so the
+        // remaining bytes each become a two-byte UTF-8 sequence.
+        while (i < input.length() && data[i] >= 0x80) {
+            u8 byte = data[i++];
+            builder.append(static_cast<char>(0xc0 | (byte >> 6)));
+            builder.append(static_cast<char>(0x80 | (byte & 0x3f)));
+        }
+    }
+    return builder.to_deprecated_string();
+}
+
 namespace {
 u32 convert_latin2_to_utf8(u8 in)
 {
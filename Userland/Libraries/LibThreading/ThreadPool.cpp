@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/DeprecatedString.h>
+#include <LibThreading/ThreadPool.h>
+#include <unistd.h>
+
+namespace Threading {
+
+ThreadPool& ThreadPool::the()
+{
+    static ThreadPool s_the = [] {
+        auto processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+        size_t thread_count = processor_count > 1 ? min(static_cast<size_t>(processor_count - 1), static_cast<size_t>(8)) : 1;
+        return ThreadPool { thread_count };
+    }();
+    return s_the;
+}
+
+ThreadPool::ThreadPool(size_t thread_count)
+{
+    VERIFY(thread_count > 0);
+    m_threads.ensure_capacity(thread_count);
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto thread = Thread::construct([this] { return worker_loop(); }, DeprecatedString::formatted("ThreadPool {}", i));
+        thread->start();
+        m_threads.unchecked_append(move(thread));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexLocker locker { m_mutex };
+        m_should_exit = true;
+        m_tasks_available.broadcast();
+    }
+    for (auto& thread : m_threads)
+        (void)thread.join();
+}
+
+void ThreadPool::enqueue(Function<void()> task)
+{
+    MutexLocker locker { m_mutex };
+    m_tasks.append(move(task));
+    m_tasks_available.signal();
+}
+
+bool ThreadPool::try_execute_one_task()
+{
+    Function<void()> task;
+    {
+        MutexLocker locker { m_mutex };
+        if (m_tasks.is_empty())
+            return false;
+        task = m_tasks.take_first();
+    }
+    task();
+    return true;
+}
+
+intptr_t ThreadPool::worker_loop()
+{
+    for (;;) {
+        Function<void()> task;
+        {
+            MutexLocker locker { m_mutex };
+            m_tasks_available.wait_while([this] { return m_tasks.is_empty() && !m_should_exit; });
+            if (m_tasks.is_empty())
+                return 0;
+            task = m_tasks.take_first();
+        }
+        task();
+    }
+}
+
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/NonnullRefPtrVector.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Promise.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A fixed set of worker threads fed from a shared task queue.
+// Anything in the process that wants cheap parallelism should go through the
+// shared pool returned by the(), so that the total number of worker threads
+// stays bounded no matter how many subsystems use it.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    // The process-wide pool. Created on first use with one worker per
+    // available processor (minus one for the calling threads), capped so a
+    // single process doesn't flood the scheduler.
+    static ThreadPool& the();
+
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    size_t thread_count() const { return m_threads.size(); }
+
+    // Runs the given task on one of the worker threads at some point in the
+    // future. Tasks are executed in FIFO order and must not block on other
+    // queued tasks, or the pool can deadlock.
+    void enqueue(Function<void()>);
+
+    // Runs the task on the pool and resolves the returned promise with its
+    // result on the event loop this was called from, in the style of
+    // BackgroundAction. The calling thread must therefore be running a
+    // Core::EventLoop, and Result must be default-constructible.
+    template<typename Result, typename TaskAction>
+    NonnullRefPtr<Core::Promise<Result>> submit(TaskAction action)
+    {
+        auto promise = Core::Promise<Result>::construct();
+        enqueue([action = move(action), promise, origin_event_loop = &Core::EventLoop::current()]() mutable {
+            auto result = action();
+            origin_event_loop->deferred_invoke([promise, result = move(result)]() mutable {
+                promise->resolve(move(result));
+            });
+            origin_event_loop->wake();
+        });
+        return promise;
+    }
+
+    // Calls the callback with contiguous subspans of the given span, spread
+    // over the workers, and returns once all of them have been processed.
+    // The calling thread processes a slice itself, so this also works with a
+    // busy pool (it just degrades towards serial execution). The callback is
+    // invoked concurrently and must not touch shared mutable state.
+    // Slices are never smaller than minimum_slice_size elements, which
+    // callers should set high enough to amortize the queueing overhead.
+    template<typename T, typename Callback>
+    void parallel_for_each_slice(Span<T> span, size_t minimum_slice_size, Callback const& callback)
+    {
+        VERIFY(minimum_slice_size > 0);
+        if (span.size() <= minimum_slice_size) {
+            if (!span.is_empty())
+                callback(span);
+            return;
+        }
+
+        size_t const slice_count = min(thread_count() + 1, span.size() / minimum_slice_size);
+        size_t const slice_size = ceil_div(span.size(), slice_count);
+
+        Mutex mutex;
+        ConditionVariable slices_done { mutex };
+        size_t remaining_slices = slice_count - 1;
+
+        for (size_t i = 1; i < slice_count; ++i) {
+            auto slice = span.slice(i * slice_size, min(slice_size, span.size() - i * slice_size));
+            enqueue([&, slice] {
+                callback(slice);
+                MutexLocker locker { mutex };
+                if (--remaining_slices == 0)
+                    slices_done.signal();
+            });
+        }
+
+        callback(span.slice(0, slice_size));
+
+        // Help drain the task queue while waiting: this may itself be running
+        // on a pool worker (nested parallelism), and if every worker blocked
+        // here, the slices queued above would never get picked up.
+        for (;;) {
+            {
+                MutexLocker locker { mutex };
+                if (remaining_slices == 0)
+                    return;
+            }
+            if (try_execute_one_task())
+                continue;
+            // The queue is empty, so all our remaining slices are already
+            // executing on other threads; they will signal us when done.
+            MutexLocker locker { mutex };
+            slices_done.wait_while([&] { return remaining_slices != 0; });
+            return;
+        }
+    }
+
+    // Convenience wrapper that hands out individual elements instead of slices.
+    template<typename T, typename Callback>
+    void parallel_for_each(Span<T> span, size_t minimum_slice_size, Callback const& callback)
+    {
+        parallel_for_each_slice(span, minimum_slice_size, [&callback](Span<T> slice) {
+            for (auto& element : slice)
+                callback(element);
+        });
+    }
+
+private:
+    intptr_t worker_loop();
+    bool try_execute_one_task();
+
+    Mutex m_mutex;
+    ConditionVariable m_tasks_available { m_mutex };
+    // All of the following are protected by m_mutex.
+    Vector<Function<void()>> m_tasks;
+    bool m_should_exit { false };
+
+    NonnullRefPtrVector<Thread> m_threads;
+};
+
+}
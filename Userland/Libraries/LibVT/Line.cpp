@@ -40,6 +40,25 @@ void Line::set_length(size_t new_length)
         m_terminated_at = min(*m_terminated_at, new_length);
 }
 
+void Line::trim_trailing_blank_cells()
+{
+    // Only lines with a known termination column can be safely shortened;
+    // on an unterminated (soft-wrapped) line every cell is content that
+    // rewrapping may need later.
+    if (!m_terminated_at.has_value())
+        return;
+
+    // Blank cells with a non-default attribute are kept, since their
+    // background still gets painted.
+    size_t new_length = m_cells.size();
+    while (new_length > 1 && new_length > *m_terminated_at && !(m_cells[new_length - 1] != Cell()))
+        --new_length;
+    if (new_length == m_cells.size())
+        return;
+    set_length(new_length);
+    m_cells.shrink_to_fit();
+}
+
 void Line::push_cells_into_next_line(size_t new_length, Line* next_line, bool cursor_is_on_next_line, CursorPosition* cursor)
 {
     if (is_empty())
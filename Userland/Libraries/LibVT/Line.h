@@ -55,6 +55,7 @@ public:
         return m_cells.size();
     }
     void set_length(size_t);
+    void trim_trailing_blank_cells();
     void rewrap(size_t new_length, Line* next_line, CursorPosition* cursor, bool cursor_is_on_next_line = true);
 
     u32 code_point(size_t index) const
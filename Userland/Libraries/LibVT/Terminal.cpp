@@ -779,10 +779,13 @@ void Terminal::scroll_up(u16 region_top, u16 region_bottom, size_t count)
         for (u16 row = region_bottom + 1 - count; row <= region_bottom; ++row)
             active_buffer()[row].clear();
     }
-    // Set dirty flag on swapped lines.
+    // Set dirty flag on swapped lines, unless the client will shift its
+    // rendition of them into place instead.
     // The other lines have implicitly been set dirty by being cleared.
-    for (u16 row = region_top; row + count <= region_bottom; ++row)
-        active_buffer()[row].set_dirty(true);
+    if (!m_client.terminal_did_perform_scroll(region_top, region_bottom, -static_cast<int>(count))) {
+        for (u16 row = region_top; row + count <= region_bottom; ++row)
+            active_buffer()[row].set_dirty(true);
+    }
     m_client.terminal_history_changed(history_delta);
 }
 
@@ -804,10 +807,13 @@ void Terminal::scroll_down(u16 region_top, u16 region_bottom, size_t count)
     // Clear the 'new' lines at the top.
     for (u16 row = region_top; row < region_top + count; ++row)
         active_buffer()[row].clear();
-    // Set dirty flag on swapped lines.
+    // Set dirty flag on swapped lines, unless the client will shift its
+    // rendition of them into place instead.
     // The other lines have implicitly been set dirty by being cleared.
-    for (u16 row = region_top + count; row <= region_bottom; ++row)
-        active_buffer()[row].set_dirty(true);
+    if (!m_client.terminal_did_perform_scroll(region_top, region_bottom, static_cast<int>(count))) {
+        for (u16 row = region_top + count; row <= region_bottom; ++row)
+            active_buffer()[row].set_dirty(true);
+    }
 }
 
 // Insert `count` blank cells at the end of the line. Text moves left.
@@ -1584,6 +1590,11 @@ void Terminal::set_size(u16 columns, u16 rows)
             m_normal_screen_buffer.unchecked_append(make<Line>(columns));
     }
 
+    // resize_and_rewrap() padded every line back to full width; lines that
+    // stayed in the scrollback don't need that padding.
+    for (auto& line : m_history)
+        line.trim_trailing_blank_cells();
+
     cursor_tracker.row -= m_history.size();
 
     if (m_history.size() != old_history_size) {
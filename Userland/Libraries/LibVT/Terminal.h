@@ -53,6 +53,12 @@ public:
     virtual void emit(u8 const*, size_t) = 0;
     virtual void set_cursor_shape(CursorShape) = 0;
     virtual void set_cursor_blinking(bool) = 0;
+
+    // Called when the surviving lines in a scrolled region were shifted by
+    // `delta` rows (negative means towards the top). Returning true promises
+    // that the client will move its rendition of those lines itself, so they
+    // are not marked dirty.
+    virtual bool terminal_did_perform_scroll(u16, u16, int) { return false; }
 };
 
 class Terminal : public EscapeSequenceExecutor {
@@ -387,6 +393,11 @@ protected:
         if (max_history_size() == 0)
             return;
 
+        // Scrollback lines are mostly padding; drop the trailing blank cells
+        // so a deep history doesn't hold on to full-width lines. Everyone who
+        // looks at history lines respects Line::length().
+        line->trim_trailing_blank_cells();
+
         // If m_history can expand, add the new line to the end of the list.
         // If there is an overflow wrap, the end is at the index before the start.
         if (m_history.size() < max_history_size()) {
@@ -97,7 +97,10 @@ TerminalWidget::TerminalWidget(int ptm_fd, bool automatic_size_policy)
     m_scrollbar->set_scroll_animation(GUI::Scrollbar::Animation::CoarseScroll);
     m_scrollbar->set_relative_rect(0, 0, 16, 0);
     m_scrollbar->on_change = [this](int) {
-        update();
+        // When we're merely following freshly scrolled-in history, the dirty
+        // lines (or a backing store shift) already cover the visual change.
+        if (!m_in_automatic_scrollbar_update)
+            update();
     };
 
     m_cursor_blink_timer->set_interval(Config::read_i32("Terminal"sv, "Text"sv, "CursorBlinkInterval"sv, 500));
@@ -482,12 +485,15 @@ void TerminalWidget::invalidate_cursor()
 
 void TerminalWidget::flush_dirty_lines()
 {
+    auto pending_scroll_delta = exchange(m_pending_scroll_delta, 0);
     // FIXME: Update smarter when scrolled
     if (m_terminal.m_need_full_flush || m_scrollbar->value() != m_scrollbar->max()) {
         update();
         m_terminal.m_need_full_flush = false;
         return;
     }
+    if (pending_scroll_delta != 0)
+        shift_scrolled_lines(pending_scroll_delta);
     Gfx::IntRect rect;
     for (int i = 0; i < m_terminal.rows(); ++i) {
         if (m_terminal.visible_line(i).is_dirty()) {
@@ -498,6 +504,36 @@ void TerminalWidget::flush_dirty_lines()
     update(rect);
 }
 
+bool TerminalWidget::terminal_did_perform_scroll(u16 region_top, u16 region_bottom, int delta)
+{
+    // Only promise to reuse rendered lines when we're following the live
+    // screen and nothing is painted on top of the text that would move along
+    // with it incorrectly.
+    if (m_scrollbar->value() != m_scrollbar->max() || m_terminal.m_need_full_flush)
+        return false;
+    if (m_visual_beep_timer->is_active() || m_selection.is_valid() || !m_hovered_href_id.is_null())
+        return false;
+    if (m_pending_scroll_delta != 0 && (m_pending_scroll_region_top != region_top || m_pending_scroll_region_bottom != region_bottom))
+        return false;
+    m_pending_scroll_region_top = region_top;
+    m_pending_scroll_region_bottom = region_bottom;
+    m_pending_scroll_delta += delta;
+    return true;
+}
+
+void TerminalWidget::shift_scrolled_lines(int delta)
+{
+    auto region_rect = row_rect(m_pending_scroll_region_top).united(row_rect(m_pending_scroll_region_bottom));
+    int region_size = m_pending_scroll_region_bottom - m_pending_scroll_region_top + 1;
+    if (abs(delta) < region_size && window()) {
+        auto region_in_window = region_rect.translated(window_relative_rect().location());
+        if (window()->shift_backing_store_contents(region_in_window, { 0, delta * m_line_height }))
+            return;
+    }
+    // We couldn't reuse the already-rendered lines; repaint the whole region.
+    update(region_rect);
+}
+
 void TerminalWidget::resize_event(GUI::ResizeEvent& event)
 {
     relayout(event.size());
@@ -1025,8 +1061,10 @@ void TerminalWidget::terminal_history_changed(int delta)
 {
     bool was_max = m_scrollbar->value() == m_scrollbar->max();
     m_scrollbar->set_max(m_terminal.history_size());
-    if (was_max)
+    if (was_max) {
+        TemporaryChange change { m_in_automatic_scrollbar_update, true };
         m_scrollbar->set_value(m_scrollbar->max());
+    }
     m_scrollbar->update();
     // If the history buffer wrapped around, the selection needs to be offset accordingly.
     if (m_selection.is_valid() && delta < 0)
@@ -1035,6 +1073,9 @@ void TerminalWidget::terminal_history_changed(int delta)
 
 void TerminalWidget::terminal_did_resize(u16 columns, u16 rows)
 {
+    // Any scroll we promised to perform is against the old geometry.
+    m_pending_scroll_delta = 0;
+
     auto pixel_size = widget_size_for_font(font());
     m_pixel_width = pixel_size.width();
     m_pixel_height = pixel_size.height();
@@ -134,6 +134,7 @@ private:
     virtual void terminal_did_resize(u16 columns, u16 rows) override;
     virtual void terminal_history_changed(int delta) override;
     virtual void emit(u8 const*, size_t) override;
+    virtual bool terminal_did_perform_scroll(u16 region_top, u16 region_bottom, int delta) override;
 
     // ^GUI::Clipboard::ClipboardClient
     virtual void clipboard_content_did_change(DeprecatedString const&) override { update_paste_action(); }
@@ -148,6 +149,8 @@ private:
     void update_cursor();
     void invalidate_cursor();
 
+    void shift_scrolled_lines(int delta);
+
     void relayout(Gfx::IntSize);
 
     void update_copy_action();
@@ -201,6 +204,13 @@ private:
     bool m_has_logical_focus { false };
     bool m_in_relayout { false };
 
+    // A scroll the terminal performed since the last flush whose surviving
+    // lines we promised to move by shifting the window backing store.
+    int m_pending_scroll_delta { 0 };
+    u16 m_pending_scroll_region_top { 0 };
+    u16 m_pending_scroll_region_bottom { 0 };
+    bool m_in_automatic_scrollbar_update { false };
+
     RefPtr<Core::Notifier> m_notifier;
 
     u8 m_opacity { 255 };
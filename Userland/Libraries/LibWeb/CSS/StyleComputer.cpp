@@ -10,6 +10,7 @@
 #include <AK/Error.h>
 #include <AK/HashMap.h>
 #include <AK/QuickSort.h>
+#include <AK/StringHash.h>
 #include <AK/TemporaryChange.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
@@ -148,71 +149,145 @@ void StyleComputer::for_each_stylesheet(CascadeOrigin cascade_origin, Callback c
     }
 }
 
-Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement> pseudo_element) const
+static u32 ancestor_tag_name_hash(StringView name)
 {
-    if (cascade_origin == CascadeOrigin::Author) {
-        Vector<MatchingRule> rules_to_run;
-        if (pseudo_element.has_value()) {
-            if (auto it = m_rule_cache->rules_by_pseudo_element.find(pseudo_element.value()); it != m_rule_cache->rules_by_pseudo_element.end())
-                rules_to_run.extend(it->value);
-        } else {
-            for (auto const& class_name : element.class_names()) {
-                if (auto it = m_rule_cache->rules_by_class.find(class_name); it != m_rule_cache->rules_by_class.end())
-                    rules_to_run.extend(it->value);
-            }
-            if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null()) {
-                if (auto it = m_rule_cache->rules_by_id.find(id); it != m_rule_cache->rules_by_id.end())
-                    rules_to_run.extend(it->value);
-            }
-            if (auto it = m_rule_cache->rules_by_tag_name.find(element.local_name()); it != m_rule_cache->rules_by_tag_name.end())
-                rules_to_run.extend(it->value);
-            rules_to_run.extend(m_rule_cache->other_rules);
+    // Tag names hash case-insensitively so that document-language case rules
+    // can never cause a false negative in the ancestor filter.
+    return case_insensitive_string_hash(name.characters_without_null_termination(), name.length());
+}
+
+// A bloom filter of the identifiers (tag names, ids and class names) present on
+// an element's ancestors. A selector requiring an ancestor identifier that is
+// not in the filter cannot possibly match, so most descendant rules are
+// rejected without running the selector engine.
+class AncestorHashFilter {
+public:
+    explicit AncestorHashFilter(DOM::Element const& element)
+    {
+        for (auto const* ancestor = element.parent_element(); ancestor; ancestor = ancestor->parent_element()) {
+            add(ancestor_tag_name_hash(ancestor->local_name().view()));
+            if (auto id = ancestor->get_attribute(HTML::AttributeNames::id); !id.is_null())
+                add(id.hash());
+            for (auto const& class_name : ancestor->class_names())
+                add(class_name.hash());
         }
+    }
 
-        Vector<MatchingRule> matching_rules;
-        matching_rules.ensure_capacity(rules_to_run.size());
-        for (auto const& rule_to_run : rules_to_run) {
-            auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
-            if (SelectorEngine::matches(selector, element, pseudo_element))
-                matching_rules.append(rule_to_run);
+    bool may_match(MatchingRule const& rule) const
+    {
+        for (u8 i = 0; i < rule.required_ancestor_hash_count; ++i) {
+            if (!may_contain(rule.required_ancestor_hashes[i]))
+                return false;
         }
-        return matching_rules;
+        return true;
     }
 
-    Vector<MatchingRule> matching_rules;
-    size_t style_sheet_index = 0;
-    for_each_stylesheet(cascade_origin, [&](auto& sheet) {
-        size_t rule_index = 0;
-        sheet.for_each_effective_style_rule([&](auto const& rule) {
-            size_t selector_index = 0;
-            for (auto& selector : rule.selectors()) {
-                if (SelectorEngine::matches(selector, element, pseudo_element)) {
-                    matching_rules.append({ &rule, style_sheet_index, rule_index, selector_index, selector.specificity() });
-                    break;
-                }
-                ++selector_index;
+private:
+    static constexpr u32 bit_count = 2048;
+
+    void add(u32 hash)
+    {
+        set_bit(hash & (bit_count - 1));
+        set_bit((hash >> 16) & (bit_count - 1));
+    }
+
+    bool may_contain(u32 hash) const
+    {
+        return test_bit(hash & (bit_count - 1)) && test_bit((hash >> 16) & (bit_count - 1));
+    }
+
+    void set_bit(u32 index) { m_bits[index >> 3] |= 1 << (index & 7); }
+    bool test_bit(u32 index) const { return m_bits[index >> 3] & (1 << (index & 7)); }
+
+    u8 m_bits[bit_count / 8] {};
+};
+
+static void collect_required_ancestor_hashes(CSS::Selector const& selector, MatchingRule& matching_rule)
+{
+    auto const& compound_selectors = selector.compound_selectors();
+    for (size_t i = compound_selectors.size() - 1; i > 0; --i) {
+        // compound_selectors[i].combinator relates compound i to compound i - 1 on its left.
+        // Identifiers to the left of a sibling combinator belong to a sibling (or its
+        // ancestors), not to an ancestor of the subject element, so stop collecting there.
+        auto combinator = compound_selectors[i].combinator;
+        if (combinator != CSS::Selector::Combinator::Descendant && combinator != CSS::Selector::Combinator::ImmediateChild)
+            break;
+        for (auto const& simple_selector : compound_selectors[i - 1].simple_selectors) {
+            u32 hash = 0;
+            switch (simple_selector.type) {
+            case CSS::Selector::SimpleSelector::Type::TagName:
+                hash = ancestor_tag_name_hash(simple_selector.lowercase_name().view());
+                break;
+            case CSS::Selector::SimpleSelector::Type::Id:
+            case CSS::Selector::SimpleSelector::Type::Class:
+                hash = simple_selector.name().hash();
+                break;
+            default:
+                continue;
             }
-            ++rule_index;
-        });
-        ++style_sheet_index;
-    });
+            if (matching_rule.required_ancestor_hash_count == MatchingRule::maximum_required_ancestor_hashes)
+                return;
+            matching_rule.required_ancestor_hashes[matching_rule.required_ancestor_hash_count++] = hash;
+        }
+    }
+}
 
+Vector<MatchingRule> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement> pseudo_element) const
+{
+    auto const& rule_cache = rule_cache_for_cascade_origin(cascade_origin);
+
+    // Gather the relevant rule buckets first so rules_to_run can be reserved
+    // exactly once; this runs for every element on every style update.
+    Vector<Vector<MatchingRule> const*, 8> buckets_to_run;
+    if (pseudo_element.has_value()) {
+        if (auto it = rule_cache.rules_by_pseudo_element.find(pseudo_element.value()); it != rule_cache.rules_by_pseudo_element.end())
+            buckets_to_run.append(&it->value);
+    } else {
+        for (auto const& class_name : element.class_names()) {
+            if (auto it = rule_cache.rules_by_class.find(class_name); it != rule_cache.rules_by_class.end())
+                buckets_to_run.append(&it->value);
+        }
+        if (auto id = element.get_attribute(HTML::AttributeNames::id); !id.is_null()) {
+            if (auto it = rule_cache.rules_by_id.find(id); it != rule_cache.rules_by_id.end())
+                buckets_to_run.append(&it->value);
+        }
+        if (auto it = rule_cache.rules_by_tag_name.find(element.local_name()); it != rule_cache.rules_by_tag_name.end())
+            buckets_to_run.append(&it->value);
+        buckets_to_run.append(&rule_cache.other_rules);
+    }
+
+    size_t rule_to_run_count = 0;
+    for (auto const* bucket : buckets_to_run)
+        rule_to_run_count += bucket->size();
+
+    Vector<MatchingRule> rules_to_run;
+    rules_to_run.ensure_capacity(rule_to_run_count);
+    for (auto const* bucket : buckets_to_run)
+        rules_to_run.unchecked_append(bucket->data(), bucket->size());
+
+    AncestorHashFilter ancestor_filter { element };
+
+    Vector<MatchingRule> matching_rules;
+    matching_rules.ensure_capacity(rules_to_run.size());
+    for (auto const& rule_to_run : rules_to_run) {
+        if (!ancestor_filter.may_match(rule_to_run))
+            continue;
+        auto const& selector = rule_to_run.rule->selectors()[rule_to_run.selector_index];
+        if (SelectorEngine::matches(selector, element, pseudo_element))
+            matching_rules.append(rule_to_run);
+    }
     return matching_rules;
 }
 
 static void sort_matching_rules(Vector<MatchingRule>& matching_rules)
 {
     quick_sort(matching_rules, [&](MatchingRule& a, MatchingRule& b) {
-        auto const& a_selector = a.rule->selectors()[a.selector_index];
-        auto const& b_selector = b.rule->selectors()[b.selector_index];
-        auto a_specificity = a_selector.specificity();
-        auto b_specificity = b_selector.specificity();
-        if (a_selector.specificity() == b_selector.specificity()) {
+        if (a.specificity == b.specificity) {
             if (a.style_sheet_index == b.style_sheet_index)
                 return a.rule_index < b.rule_index;
             return a.style_sheet_index < b.style_sheet_index;
         }
-        return a_specificity < b_specificity;
+        return a.specificity < b.specificity;
     });
 }
 
@@ -908,35 +983,49 @@ static DOM::Element const* element_to_inherit_style_from(DOM::Element const* ele
     return parent_element;
 }
 
-static NonnullRefPtr<StyleValue> get_inherit_value(CSS::PropertyID property_id, DOM::Element const* element, Optional<CSS::Selector::PseudoElement> pseudo_element)
+static StyleProperties const* style_to_inherit_from(DOM::Element const* element, Optional<CSS::Selector::PseudoElement> pseudo_element)
 {
     auto* parent_element = element_to_inherit_style_from(element, pseudo_element);
+    if (!parent_element)
+        return nullptr;
+    return parent_element->computed_css_values();
+}
 
-    if (!parent_element || !parent_element->computed_css_values())
-        return property_initial_value(property_id);
-    return parent_element->computed_css_values()->property(property_id);
+static NonnullRefPtr<StyleValue> get_inherit_value(CSS::PropertyID property_id, StyleProperties const* parent_style)
+{
+    // Inheriting is just sharing the parent's already-computed value.
+    if (parent_style) {
+        if (auto value = parent_style->maybe_null_property(property_id))
+            return value.release_nonnull();
+    }
+    return property_initial_value(property_id);
 };
 
-void StyleComputer::compute_defaulted_property_value(StyleProperties& style, DOM::Element const* element, CSS::PropertyID property_id, Optional<CSS::Selector::PseudoElement> pseudo_element) const
+void StyleComputer::compute_defaulted_property_value(StyleProperties& style, StyleProperties const* parent_style, CSS::PropertyID property_id) const
 {
     // FIXME: If we don't know the correct initial value for a property, we fall back to InitialStyleValue.
 
     auto& value_slot = style.m_property_values[to_underlying(property_id)];
     if (!value_slot) {
         if (is_inherited_property(property_id))
-            style.m_property_values[to_underlying(property_id)] = get_inherit_value(property_id, element, pseudo_element);
+            value_slot = get_inherit_value(property_id, parent_style);
         else
-            style.m_property_values[to_underlying(property_id)] = property_initial_value(property_id);
+            value_slot = property_initial_value(property_id);
         return;
     }
 
+    // Values the cascade didn't set were filled in by an earlier defaulting
+    // pass (e.g. compute_font()) and are already resolved.
+    if (!style.is_property_explicitly_set(property_id))
+        return;
+
     if (value_slot->is_initial()) {
         value_slot = property_initial_value(property_id);
         return;
     }
 
     if (value_slot->is_inherit()) {
-        value_slot = get_inherit_value(property_id, element, pseudo_element);
+        value_slot = get_inherit_value(property_id, parent_style);
         return;
     }
 
@@ -945,7 +1034,7 @@ void StyleComputer::compute_defaulted_property_value(StyleProperties& style, DOM
     if (value_slot->is_unset()) {
         if (is_inherited_property(property_id)) {
             // then if it is an inherited property, this is treated as inherit,
-            value_slot = get_inherit_value(property_id, element, pseudo_element);
+            value_slot = get_inherit_value(property_id, parent_style);
         } else {
             // and if it is not, this is treated as initial.
             value_slot = property_initial_value(property_id);
@@ -956,12 +1045,16 @@ void StyleComputer::compute_defaulted_property_value(StyleProperties& style, DOM
 // https://www.w3.org/TR/css-cascade/#defaulting
 void StyleComputer::compute_defaulted_values(StyleProperties& style, DOM::Element const* element, Optional<CSS::Selector::PseudoElement> pseudo_element) const
 {
+    // NOTE: We look up the style to inherit from once, instead of redoing the
+    //       parent traversal for every single longhand property.
+    auto const* parent_style = style_to_inherit_from(element, pseudo_element);
+
     // Walk the list of all known CSS properties and:
     // - Add them to `style` if they are missing.
     // - Resolve `inherit` and `initial` as needed.
     for (auto i = to_underlying(CSS::first_longhand_property_id); i <= to_underlying(CSS::last_longhand_property_id); ++i) {
         auto property_id = (CSS::PropertyID)i;
-        compute_defaulted_property_value(style, element, property_id, pseudo_element);
+        compute_defaulted_property_value(style, parent_style, property_id);
     }
 }
 
@@ -986,13 +1079,13 @@ void StyleComputer::compute_font(StyleProperties& style, DOM::Element const* ele
 {
     // To compute the font, first ensure that we've defaulted the relevant CSS font properties.
     // FIXME: This should be more sophisticated.
-    compute_defaulted_property_value(style, element, CSS::PropertyID::FontFamily, pseudo_element);
-    compute_defaulted_property_value(style, element, CSS::PropertyID::FontSize, pseudo_element);
-    compute_defaulted_property_value(style, element, CSS::PropertyID::FontStretch, pseudo_element);
-    compute_defaulted_property_value(style, element, CSS::PropertyID::FontStyle, pseudo_element);
-    compute_defaulted_property_value(style, element, CSS::PropertyID::FontWeight, pseudo_element);
-
     auto* parent_element = element_to_inherit_style_from(element, pseudo_element);
+    auto const* parent_style = parent_element ? parent_element->computed_css_values() : nullptr;
+    compute_defaulted_property_value(style, parent_style, CSS::PropertyID::FontFamily);
+    compute_defaulted_property_value(style, parent_style, CSS::PropertyID::FontSize);
+    compute_defaulted_property_value(style, parent_style, CSS::PropertyID::FontStretch);
+    compute_defaulted_property_value(style, parent_style, CSS::PropertyID::FontStyle);
+    compute_defaulted_property_value(style, parent_style, CSS::PropertyID::FontWeight);
 
     auto font_size = style.property(CSS::PropertyID::FontSize);
     auto font_style = style.property(CSS::PropertyID::FontStyle);
@@ -1431,16 +1524,26 @@ bool PropertyDependencyNode::has_cycles()
 
 void StyleComputer::build_rule_cache_if_needed() const
 {
-    if (m_rule_cache)
+    if (m_author_rule_cache && m_user_agent_rule_cache)
         return;
     const_cast<StyleComputer&>(*this).build_rule_cache();
 }
 
-void StyleComputer::build_rule_cache()
+StyleComputer::RuleCache const& StyleComputer::rule_cache_for_cascade_origin(CascadeOrigin cascade_origin) const
 {
-    // FIXME: Make a rule cache for UA style as well.
+    switch (cascade_origin) {
+    case CascadeOrigin::Author:
+        return *m_author_rule_cache;
+    case CascadeOrigin::UserAgent:
+        return *m_user_agent_rule_cache;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
 
-    m_rule_cache = make<RuleCache>();
+NonnullOwnPtr<StyleComputer::RuleCache> StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin)
+{
+    auto rule_cache = make<RuleCache>();
 
     size_t num_class_rules = 0;
     size_t num_id_rules = 0;
@@ -1449,17 +1552,18 @@ void StyleComputer::build_rule_cache()
 
     Vector<MatchingRule> matching_rules;
     size_t style_sheet_index = 0;
-    for_each_stylesheet(CascadeOrigin::Author, [&](auto& sheet) {
+    for_each_stylesheet(cascade_origin, [&](auto& sheet) {
         size_t rule_index = 0;
         sheet.for_each_effective_style_rule([&](auto const& rule) {
             size_t selector_index = 0;
             for (CSS::Selector const& selector : rule.selectors()) {
                 MatchingRule matching_rule { &rule, style_sheet_index, rule_index, selector_index, selector.specificity() };
+                collect_required_ancestor_hashes(selector, matching_rule);
 
                 bool added_to_bucket = false;
                 for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
                     if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                        m_rule_cache->rules_by_pseudo_element.ensure(simple_selector.pseudo_element()).append(move(matching_rule));
+                        rule_cache->rules_by_pseudo_element.ensure(simple_selector.pseudo_element()).append(move(matching_rule));
                         ++num_pseudo_element_rules;
                         added_to_bucket = true;
                         break;
@@ -1468,19 +1572,19 @@ void StyleComputer::build_rule_cache()
                 if (!added_to_bucket) {
                     for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
                         if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
-                            m_rule_cache->rules_by_id.ensure(simple_selector.name()).append(move(matching_rule));
+                            rule_cache->rules_by_id.ensure(simple_selector.name()).append(move(matching_rule));
                             ++num_id_rules;
                             added_to_bucket = true;
                             break;
                         }
                         if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
-                            m_rule_cache->rules_by_class.ensure(simple_selector.name()).append(move(matching_rule));
+                            rule_cache->rules_by_class.ensure(simple_selector.name()).append(move(matching_rule));
                             ++num_class_rules;
                             added_to_bucket = true;
                             break;
                         }
                         if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
-                            m_rule_cache->rules_by_tag_name.ensure(simple_selector.name()).append(move(matching_rule));
+                            rule_cache->rules_by_tag_name.ensure(simple_selector.name()).append(move(matching_rule));
                             ++num_tag_name_rules;
                             added_to_bucket = true;
                             break;
@@ -1488,7 +1592,7 @@ void StyleComputer::build_rule_cache()
                     }
                 }
                 if (!added_to_bucket)
-                    m_rule_cache->other_rules.append(move(matching_rule));
+                    rule_cache->other_rules.append(move(matching_rule));
 
                 ++selector_index;
             }
@@ -1503,14 +1607,26 @@ void StyleComputer::build_rule_cache()
         dbgln("        Class: {}", num_class_rules);
         dbgln("      TagName: {}", num_tag_name_rules);
         dbgln("PseudoElement: {}", num_pseudo_element_rules);
-        dbgln("        Other: {}", m_rule_cache->other_rules.size());
-        dbgln("        Total: {}", num_class_rules + num_id_rules + num_tag_name_rules + m_rule_cache->other_rules.size());
+        dbgln("        Other: {}", rule_cache->other_rules.size());
+        dbgln("        Total: {}", num_class_rules + num_id_rules + num_tag_name_rules + rule_cache->other_rules.size());
     }
+    return rule_cache;
+}
+
+void StyleComputer::build_rule_cache()
+{
+    m_author_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::Author);
+    m_user_agent_rule_cache = make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent);
 }
 
 void StyleComputer::invalidate_rule_cache()
 {
-    m_rule_cache = nullptr;
+    m_author_rule_cache = nullptr;
+
+    // NOTE: We could be smarter about keeping the UA rule cache, and style rule
+    //       cache, across document mutations, but we do this for now to keep
+    //       things simple.
+    m_user_agent_rule_cache = nullptr;
 }
 
 CSSPixelRect StyleComputer::viewport_rect() const
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtrVector.h>
 #include <AK/Optional.h>
@@ -27,6 +28,14 @@ struct MatchingRule {
     size_t rule_index { 0 };
     size_t selector_index { 0 };
     u32 specificity { 0 };
+
+    // Hashes of identifiers that must be present on an element's ancestors for
+    // this selector to possibly match. collect_matching_rules() checks them
+    // against a bloom filter of the element's ancestor identifiers before
+    // running the selector engine.
+    static constexpr size_t maximum_required_ancestor_hashes = 4;
+    Array<u32, maximum_required_ancestor_hashes> required_ancestor_hashes {};
+    u8 required_ancestor_hash_count { 0 };
 };
 
 class PropertyDependencyNode : public RefCounted<PropertyDependencyNode> {
@@ -84,7 +93,7 @@ private:
     void absolutize_values(StyleProperties&, DOM::Element const*, Optional<CSS::Selector::PseudoElement>) const;
     void transform_box_type_if_needed(StyleProperties&, DOM::Element const&, Optional<CSS::Selector::PseudoElement>) const;
 
-    void compute_defaulted_property_value(StyleProperties&, DOM::Element const*, CSS::PropertyID, Optional<CSS::Selector::PseudoElement>) const;
+    void compute_defaulted_property_value(StyleProperties&, StyleProperties const* parent_style, CSS::PropertyID) const;
 
     RefPtr<StyleValue> resolve_unresolved_style_value(DOM::Element&, PropertyID, UnresolvedStyleValue const&) const;
     bool expand_variables(DOM::Element&, StringView property_name, HashMap<DeprecatedFlyString, NonnullRefPtr<PropertyDependencyNode>>& dependencies, Parser::TokenStream<Parser::ComponentValue>& source, Vector<Parser::ComponentValue>& dest) const;
@@ -115,7 +124,12 @@ private:
         HashMap<Selector::PseudoElement, Vector<MatchingRule>> rules_by_pseudo_element;
         Vector<MatchingRule> other_rules;
     };
-    OwnPtr<RuleCache> m_rule_cache;
+
+    NonnullOwnPtr<RuleCache> make_rule_cache_for_cascade_origin(CascadeOrigin);
+    RuleCache const& rule_cache_for_cascade_origin(CascadeOrigin) const;
+
+    OwnPtr<RuleCache> m_author_rule_cache;
+    OwnPtr<RuleCache> m_user_agent_rule_cache;
 
     class FontLoader;
     HashMap<DeprecatedString, NonnullOwnPtr<FontLoader>> m_loaded_fonts;
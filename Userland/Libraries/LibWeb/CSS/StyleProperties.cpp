@@ -18,6 +18,7 @@ namespace Web::CSS {
 
 StyleProperties::StyleProperties(StyleProperties const& other)
     : m_property_values(other.m_property_values)
+    , m_explicitly_set_property_bits(other.m_explicitly_set_property_bits)
 {
     if (other.m_font) {
         m_font = other.m_font->clone();
@@ -34,6 +35,7 @@ NonnullRefPtr<StyleProperties> StyleProperties::clone() const
 void StyleProperties::set_property(CSS::PropertyID id, NonnullRefPtr<StyleValue> value)
 {
     m_property_values[to_underlying(id)] = move(value);
+    m_explicitly_set_property_bits[to_underlying(id) / 64] |= 1ull << (to_underlying(id) % 64);
 }
 
 NonnullRefPtr<StyleValue> StyleProperties::property(CSS::PropertyID property_id) const
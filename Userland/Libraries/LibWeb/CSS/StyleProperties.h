@@ -42,6 +42,14 @@ public:
     NonnullRefPtr<StyleValue> property(CSS::PropertyID) const;
     RefPtr<StyleValue> maybe_null_property(CSS::PropertyID) const;
 
+    // Whether this property was assigned a value by the cascade, as opposed to
+    // being filled in later by a defaulting pass.
+    bool is_property_explicitly_set(CSS::PropertyID property_id) const
+    {
+        auto bit = to_underlying(property_id);
+        return (m_explicitly_set_property_bits[bit / 64] >> (bit % 64)) & 1;
+    }
+
     CSS::Size size_value(CSS::PropertyID) const;
     LengthPercentage length_percentage_or_fallback(CSS::PropertyID, LengthPercentage const& fallback) const;
     Optional<LengthPercentage> length_percentage(CSS::PropertyID) const;
@@ -121,6 +129,7 @@ private:
     friend class StyleComputer;
 
     Array<RefPtr<StyleValue>, to_underlying(CSS::last_property_id) + 1> m_property_values;
+    Array<u64, (to_underlying(CSS::last_property_id) + 64) / 64> m_explicitly_set_property_bits {};
     Optional<CSS::Overflow> overflow(CSS::PropertyID) const;
     Vector<CSS::ShadowData> shadow(CSS::PropertyID) const;
 
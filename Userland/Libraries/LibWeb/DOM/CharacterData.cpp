@@ -111,7 +111,7 @@ WebIDL::ExceptionOr<void> CharacterData::replace_data(size_t offset, size_t coun
         parent()->children_changed();
 
     set_needs_style_update(true);
-    document().set_needs_layout();
+    document().set_needs_layout_for_node(*this);
     return {};
 }
 
@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/StringBuilder.h>
@@ -63,6 +64,7 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowProxy.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/InitialContainingBlock.h>
 #include <LibWeb/Layout/TreeBuilder.h>
@@ -809,6 +811,89 @@ void Document::set_needs_layout()
     schedule_layout_update();
 }
 
+// A "relayout boundary" is a box whose subtree can be laid out in isolation:
+// its used size cannot depend on its contents, and its contents cannot affect
+// anything laid out outside of it.
+static bool is_relayout_boundary(Layout::Box const& box)
+{
+    if (!is<Layout::BlockContainer>(box))
+        return false;
+    if (!box.dom_node() || !box.paint_box())
+        return false;
+    if (box.is_floating() || box.is_absolutely_positioned())
+        return false;
+    auto display = box.display();
+    if (!display.is_block_outside() || !(display.is_flow_inside() || display.is_flow_root_inside()))
+        return false;
+    auto const& computed_values = box.computed_values();
+    // Anything but a fixed length for the preferred and min/max sizes could let
+    // the contents (or the ancestors) influence the used size.
+    auto is_fixed_length = [](CSS::Size const& size) {
+        return size.is_length() && !size.length().is_calculated();
+    };
+    if (!is_fixed_length(computed_values.width()) || !is_fixed_length(computed_values.height()))
+        return false;
+    if (!computed_values.min_width().is_auto() && !is_fixed_length(computed_values.min_width()))
+        return false;
+    if (!computed_values.min_height().is_auto() && !is_fixed_length(computed_values.min_height()))
+        return false;
+    if (!computed_values.max_width().is_none() && !is_fixed_length(computed_values.max_width()))
+        return false;
+    if (!computed_values.max_height().is_none() && !is_fixed_length(computed_values.max_height()))
+        return false;
+    // Overflowing content would escape into (and dirty) the ancestors.
+    if (computed_values.overflow_x() == CSS::Overflow::Visible || computed_values.overflow_y() == CSS::Overflow::Visible)
+        return false;
+    return true;
+}
+
+static Layout::Box* find_relayout_boundary(Layout::Node* layout_node)
+{
+    for (auto* ancestor = layout_node; ancestor; ancestor = ancestor->parent()) {
+        if (ancestor->is_initial_containing_block_box())
+            break;
+        if (!is<Layout::Box>(*ancestor))
+            continue;
+        auto& box = static_cast<Layout::Box&>(*ancestor);
+        if (is_relayout_boundary(box))
+            return &box;
+    }
+    return nullptr;
+}
+
+static bool subtree_is_safe_for_partial_layout(Layout::Box const& boundary)
+{
+    // Absolutely positioned descendants may be positioned (and laid out) by a
+    // containing block outside the subtree, so don't try to be clever here.
+    bool safe = true;
+    boundary.for_each_in_subtree([&](auto const& descendant) {
+        if (descendant.is_absolutely_positioned()) {
+            safe = false;
+            return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    });
+    return safe;
+}
+
+void Document::set_needs_layout_for_node(Node& node)
+{
+    if (m_needs_layout)
+        return;
+    auto* boundary = find_relayout_boundary(node.layout_node());
+    if (!boundary) {
+        set_needs_layout();
+        return;
+    }
+    auto* boundary_dom_node = boundary->dom_node();
+    bool already_pending = any_of(m_pending_partial_layout_roots, [&](auto& pending_root) {
+        return pending_root.cell() == boundary_dom_node;
+    });
+    if (!already_pending)
+        m_pending_partial_layout_roots.append(JS::make_handle(*boundary_dom_node));
+    schedule_layout_update();
+}
+
 void Document::force_layout()
 {
     tear_down_layout_tree();
@@ -830,9 +915,6 @@ void Document::update_layout()
 
     update_style();
 
-    if (!m_needs_layout && m_layout_root)
-        return;
-
     // NOTE: If this is a document hosting <template> contents, layout is unnecessary.
     if (m_created_for_appropriate_template_contents)
         return;
@@ -840,6 +922,16 @@ void Document::update_layout()
     if (!browsing_context())
         return;
 
+    if (!m_needs_layout && m_layout_root) {
+        if (m_pending_partial_layout_roots.is_empty())
+            return;
+        if (attempt_pending_partial_layouts())
+            return;
+        // NOTE: The dirty subtrees couldn't be laid out in isolation after all;
+        //       fall through to a full layout.
+    }
+    m_pending_partial_layout_roots.clear();
+
     auto viewport_rect = browsing_context()->viewport_rect();
 
     if (!m_layout_root) {
@@ -882,6 +974,67 @@ void Document::update_layout()
     m_layout_update_timer->stop();
 }
 
+bool Document::attempt_pending_partial_layouts()
+{
+    for (auto& pending_root : m_pending_partial_layout_roots) {
+        auto* layout_node = pending_root.cell()->layout_node();
+        // Re-validate against the current tree; anything may have changed since
+        // the node was marked dirty.
+        if (!layout_node || !is<Layout::Box>(*layout_node))
+            return false;
+        auto& boundary = static_cast<Layout::Box&>(*layout_node);
+        if (!is_relayout_boundary(boundary) || !subtree_is_safe_for_partial_layout(boundary))
+            return false;
+
+        auto const& paint_box = *boundary.paint_box();
+
+        Layout::LayoutState layout_state;
+        layout_state.used_values_per_layout_node.resize(layout_node_count());
+
+        // Seed the boundary's used values from its previous layout, so its
+        // children resolve against the same inputs and commit() writes back
+        // identical geometry for the boundary itself.
+        auto& boundary_state = layout_state.get_mutable_for_subtree_root(boundary);
+        boundary_state.set_content_width(paint_box.content_width());
+        boundary_state.set_content_height(paint_box.content_height());
+        boundary_state.offset = paint_box.effective_offset();
+        auto const& box_model = boundary.box_model();
+        boundary_state.margin_top = box_model.margin.top;
+        boundary_state.margin_right = box_model.margin.right;
+        boundary_state.margin_bottom = box_model.margin.bottom;
+        boundary_state.margin_left = box_model.margin.left;
+        boundary_state.border_top = box_model.border.top;
+        boundary_state.border_right = box_model.border.right;
+        boundary_state.border_bottom = box_model.border.bottom;
+        boundary_state.border_left = box_model.border.left;
+        boundary_state.padding_top = box_model.padding.top;
+        boundary_state.padding_right = box_model.padding.right;
+        boundary_state.padding_bottom = box_model.padding.bottom;
+        boundary_state.padding_left = box_model.padding.left;
+        boundary_state.inset_top = box_model.inset.top;
+        boundary_state.inset_right = box_model.inset.right;
+        boundary_state.inset_bottom = box_model.inset.bottom;
+        boundary_state.inset_left = box_model.inset.left;
+
+        Layout::BlockFormattingContext formatting_context(layout_state, static_cast<Layout::BlockContainer const&>(boundary), nullptr);
+        formatting_context.run(
+            boundary,
+            Layout::LayoutMode::Normal,
+            Layout::AvailableSpace(
+                Layout::AvailableSize::make_definite(paint_box.content_width()),
+                Layout::AvailableSize::make_definite(paint_box.content_height())));
+
+        layout_state.commit();
+    }
+
+    m_pending_partial_layout_roots.clear();
+
+    browsing_context()->set_needs_display();
+    m_layout_root->recompute_selection_states();
+    m_layout_update_timer->stop();
+    return true;
+}
+
 [[nodiscard]] static bool update_style_recursively(DOM::Node& node)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
@@ -191,6 +191,10 @@ public:
 
     void set_needs_layout();
 
+    // Like set_needs_layout(), but tries to only schedule a relayout of the
+    // dirty node's nearest relayout boundary instead of the whole tree.
+    void set_needs_layout_for_node(Node&);
+
     void invalidate_layout();
     void invalidate_stacking_context_tree();
 
@@ -461,6 +465,8 @@ private:
 
     void tear_down_layout_tree();
 
+    bool attempt_pending_partial_layouts();
+
     void evaluate_media_rules();
 
     WebIDL::ExceptionOr<void> run_the_document_write_steps(DeprecatedString);
@@ -561,6 +567,10 @@ private:
 
     bool m_needs_layout { false };
 
+    // Subtree roots that can be laid out in isolation instead of doing a full
+    // layout. Only consulted when no full layout is pending.
+    Vector<JS::Handle<Node>> m_pending_partial_layout_roots;
+
     bool m_needs_full_style_update { false };
 
     HashTable<NodeIterator*> m_node_iterators;
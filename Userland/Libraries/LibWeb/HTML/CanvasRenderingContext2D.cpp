@@ -11,6 +11,7 @@
 #include <LibGfx/Quad.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/HTMLImageElement.h>
@@ -18,7 +19,9 @@
 #include <LibWeb/HTML/Path2D.h>
 #include <LibWeb/HTML/TextMetrics.h>
 #include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/TextNode.h>
+#include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Platform/FontPlugin.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -181,12 +184,33 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::draw_image_internal(CanvasIm
     return {};
 }
 
-void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
+void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const& dirty_rect)
 {
-    // FIXME: Make use of the rect to reduce the invalidated area when possible.
-    if (!canvas_element().layout_node())
+    auto* layout_node = canvas_element().layout_node();
+    if (!layout_node)
         return;
-    canvas_element().layout_node()->set_needs_display();
+
+    // If we know where the canvas is painted, invalidate only the painted area covered by
+    // the drawn rect (scaled from canvas pixels to the on-screen canvas rect), instead of
+    // repainting the whole canvas on every drawing operation.
+    if (is<Layout::Box>(*layout_node) && canvas_element().bitmap()) {
+        auto const* paint_box = static_cast<Layout::Box const&>(*layout_node).paint_box();
+        auto bitmap_size = canvas_element().bitmap()->size().to_type<float>();
+        if (paint_box && !bitmap_size.is_empty()) {
+            auto canvas_rect = paint_box->absolute_rect().to_type<float>();
+            auto scaled_dirty_rect = dirty_rect;
+            scaled_dirty_rect.scale_by(canvas_rect.width() / bitmap_size.width(), canvas_rect.height() / bitmap_size.height());
+            scaled_dirty_rect.translate_by(canvas_rect.x(), canvas_rect.y());
+            // Cover bleed from antialiasing and the scaled bitmap presentation.
+            scaled_dirty_rect.inflate(2, 2);
+            scaled_dirty_rect.intersect(canvas_rect);
+            if (!scaled_dirty_rect.is_empty())
+                layout_node->browsing_context().set_needs_display(scaled_dirty_rect.to_type<CSSPixels>());
+            return;
+        }
+    }
+
+    layout_node->set_needs_display();
 }
 
 Gfx::Painter* CanvasRenderingContext2D::painter()
@@ -150,6 +150,24 @@ void EventLoop::process()
         return document->browsing_context() && !document->browsing_context()->has_a_rendering_opportunity();
     });
 
+    // AD-HOC: A browsing context gets at most one rendering opportunity per display frame, but
+    //         process() runs after every task. If we've already run the rendering steps within
+    //         the last frame interval, skip them in this round and schedule another round of
+    //         processing at the next frame boundary, so animation frame callbacks run at a
+    //         steady cadence instead of after every task.
+    constexpr double rendering_frame_interval_ms = 1000.0 / 60.0;
+    double now_for_rendering = HighResolutionTime::unsafe_shared_current_time();
+    if (!docs.is_empty() && now_for_rendering < m_last_render_opportunity_time + rendering_frame_interval_ms) {
+        docs.clear();
+        if (!m_rendering_update_timer) {
+            m_rendering_update_timer = Platform::Timer::create_single_shot(0, [this] {
+                process();
+            });
+        }
+        if (!m_rendering_update_timer->is_active())
+            m_rendering_update_timer->start(max(1, static_cast<int>(m_last_render_opportunity_time + rendering_frame_interval_ms - now_for_rendering)));
+    }
+
     // 3. If docs is not empty, then set hasARenderingOpportunity to true
     //    and set this event loop's last render opportunity time to taskStartTime.
     if (!docs.is_empty()) {
@@ -95,6 +95,10 @@ private:
 
     RefPtr<Platform::Timer> m_system_event_loop_timer;
 
+    // Used to schedule a round of processing at the next frame boundary when a rendering
+    // update was skipped because one already happened within the current frame interval.
+    RefPtr<Platform::Timer> m_rendering_update_timer;
+
     // https://html.spec.whatwg.org/#performing-a-microtask-checkpoint
     bool m_performing_a_microtask_checkpoint { false };
 
@@ -511,13 +511,13 @@ void HTMLScriptElement::resource_did_load()
 
     // If the resource has an explicit encoding (i.e from a HTTP Content-Type header)
     // we have to re-encode it to UTF-8.
+    DeprecatedString utf8_data;
     if (resource()->has_encoding()) {
-        if (auto* codec = TextCodec::decoder_for(resource()->encoding().value())) {
-            data = codec->to_utf8(data).to_byte_buffer();
-        }
+        if (auto* codec = TextCodec::decoder_for(resource()->encoding().value()))
+            utf8_data = codec->to_utf8(data);
     }
 
-    auto script = ClassicScript::create(resource()->url().to_deprecated_string(), data, document().relevant_settings_object(), AK::URL());
+    auto script = ClassicScript::create(resource()->url().to_deprecated_string(), utf8_data.is_null() ? StringView { data } : utf8_data.view(), document().relevant_settings_object(), AK::URL());
 
     // When the chosen algorithm asynchronously completes, set the script's script to the result. At that time, the script is ready.
     mark_as_ready(Result(script));
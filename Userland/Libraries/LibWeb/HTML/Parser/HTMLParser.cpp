@@ -6,6 +6,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
 #include <AK/SourceLocation.h>
 #include <AK/Utf32View.h>
 #include <LibTextCodec/Decoder.h>
@@ -30,6 +31,7 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/SVG/TagNames.h>
 
@@ -209,9 +211,86 @@ void HTMLParser::run(const AK::URL& url)
 {
     m_document->set_url(url);
     m_document->set_source(m_tokenizer.source());
+    speculatively_fetch_document_resources();
     run();
     the_end();
     m_document->detach_parser({});
+    m_speculatively_fetched_resources.clear();
+}
+
+// Scan the document source for subresources we're certainly going to need
+// (external scripts, stylesheets and images) and start fetching them before
+// tree construction gets there. Tree construction stops and waits every time
+// it hits a parser-blocking script, so without this, resources later in the
+// document aren't even requested until every script before them has loaded
+// and executed. The fetches here only warm the resource cache; the elements
+// that actually want the data pick it up from there once they're inserted.
+void HTMLParser::speculatively_fetch_document_resources()
+{
+    if (!m_document->url().is_valid())
+        return;
+
+    HTMLTokenizer tokenizer { m_document->source(), "utf-8" };
+    HashTable<DeprecatedString> seen_urls;
+    auto base_url = m_document->url();
+    bool seen_base_element = false;
+
+    auto fetch = [&](StringView href, Resource::Type type) {
+        if (href.is_empty())
+            return;
+        auto url = base_url.complete_url(href);
+        if (!url.is_valid() || url.scheme() == "data")
+            return;
+        if (seen_urls.set(url.to_deprecated_string()) != HashSetResult::InsertedNewEntry)
+            return;
+        dbgln_if(HTML_PARSER_DEBUG, "Speculatively fetching {}", url);
+        auto request = LoadRequest::create_for_url_on_page(url, m_document->page());
+        if (auto resource = ResourceLoader::the().load_resource(type, request))
+            m_speculatively_fetched_resources.append(resource.release_nonnull());
+    };
+
+    for (;;) {
+        auto optional_token = tokenizer.next_token();
+        if (!optional_token.has_value())
+            break;
+        auto& token = optional_token.value();
+        if (token.is_end_of_file())
+            break;
+        if (!token.is_start_tag())
+            continue;
+
+        auto const& tag_name = token.tag_name();
+        if (tag_name == HTML::TagNames::base) {
+            // Only the first <base> element with an href attribute is honored.
+            if (!seen_base_element && token.has_attribute(HTML::AttributeNames::href)) {
+                if (auto new_base_url = m_document->url().complete_url(token.attribute(HTML::AttributeNames::href)); new_base_url.is_valid()) {
+                    base_url = move(new_base_url);
+                    seen_base_element = true;
+                }
+            }
+        } else if (tag_name == HTML::TagNames::script) {
+            fetch(token.attribute(HTML::AttributeNames::src), Resource::Type::Generic);
+            // There's no tree builder switching tokenizer states for us here,
+            // so do it ourselves to avoid tokenizing raw text as markup.
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        } else if (tag_name == HTML::TagNames::style) {
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        } else if (tag_name == HTML::TagNames::title || tag_name == HTML::TagNames::textarea) {
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        } else if (tag_name == HTML::TagNames::img) {
+            fetch(token.attribute(HTML::AttributeNames::src), Resource::Type::Image);
+        } else if (tag_name == HTML::TagNames::link) {
+            // Only fetch stylesheets; the other rel types are cheap enough to
+            // leave to the real element, which knows how to interpret them.
+            bool is_stylesheet = false;
+            for (auto part : token.attribute(HTML::AttributeNames::rel).split_view(' ')) {
+                if (part.equals_ignoring_case("stylesheet"sv))
+                    is_stylesheet = true;
+            }
+            if (is_stylesheet)
+                fetch(token.attribute(HTML::AttributeNames::href), Resource::Type::Generic);
+        }
+    }
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#the-end
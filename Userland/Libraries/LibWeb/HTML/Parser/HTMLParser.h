@@ -115,6 +115,8 @@ private:
 
     void the_end();
 
+    void speculatively_fetch_document_resources();
+
     void stop_parsing() { m_stop_parsing = true; }
 
     void generate_implied_end_tags(DeprecatedFlyString const& exception = {});
@@ -196,6 +198,11 @@ private:
 
     JS::GCPtr<DOM::Text> m_character_insertion_node;
     StringBuilder m_character_insertion_builder;
+
+    // Resources discovered by the speculative pre-scan of the document source.
+    // We keep them alive until parsing finishes so the elements that actually
+    // want them find them still in flight (or done) in the resource cache.
+    Vector<NonnullRefPtr<Resource>> m_speculatively_fetched_resources;
 };
 
 RefPtr<CSS::StyleValue> parse_dimension_value(StringView);
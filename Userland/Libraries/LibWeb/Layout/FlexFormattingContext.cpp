@@ -1101,6 +1101,13 @@ void FlexFormattingContext::determine_hypothetical_cross_size_of_item(FlexItem&
     }
 
     // For indefinite cross sizes, we perform a throwaway layout and then measure it.
+    // This measurement only depends on the used main size, so if we've already measured the item
+    // at this main size, reuse that result and just redo the clamping.
+    if (item.automatic_cross_size_measurement.has_value() && item.automatic_cross_size_measurement->main_size == item.main_size.value()) {
+        item.hypothetical_cross_size = css_clamp(item.automatic_cross_size_measurement->cross_size, clamp_min, clamp_max);
+        return;
+    }
+
     LayoutState throwaway_state(&m_state);
 
     auto& box_state = throwaway_state.get_mutable(item.box);
@@ -1123,6 +1130,7 @@ void FlexFormattingContext::determine_hypothetical_cross_size_of_item(FlexItem&
     auto automatic_cross_size = is_row_layout() ? independent_formatting_context->automatic_content_height()
                                                 : independent_formatting_context->automatic_content_width();
 
+    item.automatic_cross_size_measurement = FlexItem::AutomaticCrossSizeMeasurement { .main_size = item.main_size.value(), .cross_size = automatic_cross_size };
     item.hypothetical_cross_size = css_clamp(automatic_cross_size, clamp_min, clamp_max);
 }
 
@@ -64,6 +64,16 @@ private:
         // The used main size of this flex item. Empty until determined.
         Optional<CSSPixels> main_size {};
 
+        // Cached result of the hypothetical cross size throwaway layout, together with the
+        // main size it was measured at. The percentage re-resolve pass repeats the measurement
+        // with the same main size and only needs different min/max clamping, so this lets it
+        // skip the (expensive) repeat layout.
+        struct AutomaticCrossSizeMeasurement {
+            CSSPixels main_size;
+            CSSPixels cross_size;
+        };
+        Optional<AutomaticCrossSizeMeasurement> automatic_cross_size_measurement {};
+
         // The used cross size of this flex item. Empty until determined.
         Optional<CSSPixels> cross_size {};
 
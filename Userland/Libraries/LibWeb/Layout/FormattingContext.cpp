@@ -1156,18 +1156,17 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
     if (box.has_intrinsic_height())
         return *box.intrinsic_height();
 
-    bool is_cacheable = available_width.is_definite() || available_width.is_intrinsic_sizing_constraint();
+    auto& root_state = m_state.m_root;
+    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
     Optional<CSSPixels>* cache_slot = nullptr;
-    if (is_cacheable) {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        if (available_width.is_definite()) {
-            cache_slot = &cache.min_content_height_with_definite_available_width.ensure(available_width.to_px());
-        } else if (available_width.is_min_content()) {
-            cache_slot = &cache.min_content_height_with_min_content_available_width;
-        } else if (available_width.is_max_content()) {
-            cache_slot = &cache.min_content_height_with_max_content_available_width;
-        }
+    if (available_width.is_definite()) {
+        cache_slot = &cache.min_content_height_with_definite_available_width.ensure(available_width.to_px());
+    } else if (available_width.is_min_content()) {
+        cache_slot = &cache.min_content_height_with_min_content_available_width;
+    } else if (available_width.is_max_content()) {
+        cache_slot = &cache.min_content_height_with_max_content_available_width;
+    } else {
+        cache_slot = &cache.min_content_height_with_indefinite_available_width;
     }
 
     if (cache_slot && cache_slot->has_value())
@@ -1201,18 +1200,17 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
     if (box.has_intrinsic_height())
         return *box.intrinsic_height();
 
-    bool is_cacheable = available_width.is_definite() || available_width.is_intrinsic_sizing_constraint();
+    auto& root_state = m_state.m_root;
+    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
     Optional<CSSPixels>* cache_slot = nullptr;
-    if (is_cacheable) {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        if (available_width.is_definite()) {
-            cache_slot = &cache.max_content_height_with_definite_available_width.ensure(available_width.to_px());
-        } else if (available_width.is_min_content()) {
-            cache_slot = &cache.max_content_height_with_min_content_available_width;
-        } else if (available_width.is_max_content()) {
-            cache_slot = &cache.max_content_height_with_max_content_available_width;
-        }
+    if (available_width.is_definite()) {
+        cache_slot = &cache.max_content_height_with_definite_available_width.ensure(available_width.to_px());
+    } else if (available_width.is_min_content()) {
+        cache_slot = &cache.max_content_height_with_min_content_available_width;
+    } else if (available_width.is_max_content()) {
+        cache_slot = &cache.max_content_height_with_max_content_available_width;
+    } else {
+        cache_slot = &cache.max_content_height_with_indefinite_available_width;
     }
 
     if (cache_slot && cache_slot->has_value())
@@ -139,7 +139,10 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next(CSSPixels availabl
             return next(available_width);
         }
 
-        m_text_node_context->next_chunk = m_text_node_context->chunk_iterator.next();
+        if (m_text_node_context->next_chunk_index < m_text_node_context->chunks->size())
+            m_text_node_context->next_chunk = m_text_node_context->chunks->at(m_text_node_context->next_chunk_index++);
+        else
+            m_text_node_context->next_chunk = {};
         if (!m_text_node_context->next_chunk.has_value())
             m_text_node_context->is_last_chunk = true;
 
@@ -267,9 +270,11 @@ void InlineLevelIterator::enter_text_node(Layout::TextNode const& text_node)
         .do_respect_linebreaks = do_respect_linebreaks,
         .is_first_chunk = true,
         .is_last_chunk = false,
-        .chunk_iterator = TextNode::ChunkIterator { text_node.text_for_rendering(), do_wrap_lines, do_respect_linebreaks, text_node.is_generated() && text_node.text_for_rendering().is_empty() },
+        // FIXME: ...and here.
+        .chunks = &const_cast<TextNode&>(text_node).chunks(do_wrap_lines, do_respect_linebreaks),
     };
-    m_text_node_context->next_chunk = m_text_node_context->chunk_iterator.next();
+    if (!m_text_node_context->chunks->is_empty())
+        m_text_node_context->next_chunk = m_text_node_context->chunks->at(m_text_node_context->next_chunk_index++);
 }
 
 void InlineLevelIterator::add_extra_box_model_metrics_to_item(Item& item, bool add_leading_metrics, bool add_trailing_metrics)
@@ -80,7 +80,8 @@ private:
         bool do_respect_linebreaks {};
         bool is_first_chunk {};
         bool is_last_chunk {};
-        TextNode::ChunkIterator chunk_iterator;
+        Vector<TextNode::Chunk> const* chunks { nullptr };
+        size_t next_chunk_index { 0 };
         Optional<TextNode::Chunk> next_chunk {};
     };
 
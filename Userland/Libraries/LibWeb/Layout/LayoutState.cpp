@@ -33,6 +33,16 @@ LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyleAndBoxModelMetric
     return *used_values_per_layout_node[serial_id];
 }
 
+LayoutState::UsedValues& LayoutState::get_mutable_for_subtree_root(NodeWithStyleAndBoxModelMetrics const& box)
+{
+    auto serial_id = box.serial_id();
+    if (!used_values_per_layout_node[serial_id]) {
+        used_values_per_layout_node[serial_id] = adopt_own(*new UsedValues);
+        used_values_per_layout_node[serial_id]->set_node(const_cast<NodeWithStyleAndBoxModelMetrics&>(box), nullptr);
+    }
+    return *used_values_per_layout_node[serial_id];
+}
+
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyleAndBoxModelMetrics const& box) const
 {
     auto serial_id = box.serial_id();
@@ -153,6 +153,12 @@ struct LayoutState {
     // NOTE: get() will not CoW the UsedValues.
     UsedValues const& get(NodeWithStyleAndBoxModelMetrics const&) const;
 
+    // Used when laying out a dirty subtree in isolation: materializes UsedValues for
+    // the subtree root without pulling its containing block chain into this state.
+    // (Anything materialized here gets committed, and committing default-constructed
+    // values for boxes outside the subtree would clobber their up-to-date paintables.)
+    UsedValues& get_mutable_for_subtree_root(NodeWithStyleAndBoxModelMetrics const&);
+
     Vector<OwnPtr<UsedValues>> used_values_per_layout_node;
 
     // We cache intrinsic sizes once determined, as they will not change over the course of a full layout.
@@ -162,13 +168,15 @@ struct LayoutState {
         Optional<CSSPixels> max_content_width;
 
         // NOTE: Since intrinsic heights depend on the amount of available width, we have to cache
-        //       three separate kinds of results, depending on the available width at the time of calculation.
+        //       four separate kinds of results, depending on the available width at the time of calculation.
         HashMap<CSSPixels, Optional<CSSPixels>> min_content_height_with_definite_available_width;
         HashMap<CSSPixels, Optional<CSSPixels>> max_content_height_with_definite_available_width;
         Optional<CSSPixels> min_content_height_with_min_content_available_width;
         Optional<CSSPixels> max_content_height_with_min_content_available_width;
         Optional<CSSPixels> min_content_height_with_max_content_available_width;
         Optional<CSSPixels> max_content_height_with_max_content_available_width;
+        Optional<CSSPixels> min_content_height_with_indefinite_available_width;
+        Optional<CSSPixels> max_content_height_with_indefinite_available_width;
     };
 
     HashMap<NodeWithStyleAndBoxModelMetrics const*, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
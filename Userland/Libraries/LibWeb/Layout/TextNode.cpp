@@ -44,6 +44,15 @@ static ErrorOr<DeprecatedString> apply_text_transform(DeprecatedString const& st
 // NOTE: This collapses whitespace into a single ASCII space if collapse is true.
 void TextNode::compute_text_for_rendering(bool collapse)
 {
+    // NOTE: Layout runs over the same tree many times (e.g for intrinsic size measurement),
+    //       so we cache the result and reuse it as long as the input text is unchanged.
+    //       Style changes rebuild the layout tree, so they don't need to be part of the key.
+    if (m_text_for_rendering_collapse == collapse && m_text_for_rendering_source.impl() == dom_node().data().impl())
+        return;
+    m_text_for_rendering_source = dom_node().data();
+    m_text_for_rendering_collapse = collapse;
+    m_chunk_cache.clear();
+
     auto data = apply_text_transform(dom_node().data(), computed_values().text_transform()).release_value_but_fixme_should_propagate_errors();
 
     if (dom_node().is_password_input()) {
@@ -101,6 +110,23 @@ void TextNode::compute_text_for_rendering(bool collapse)
     m_text_for_rendering = builder.to_deprecated_string();
 }
 
+Vector<TextNode::Chunk> const& TextNode::chunks(bool wrap_lines, bool respect_linebreaks)
+{
+    if (m_chunk_cache.has_value() && m_chunk_cache->wrap_lines == wrap_lines && m_chunk_cache->respect_linebreaks == respect_linebreaks)
+        return m_chunk_cache->chunks;
+
+    Vector<Chunk> chunks;
+    ChunkIterator iterator { m_text_for_rendering, wrap_lines, respect_linebreaks, is_generated() && m_text_for_rendering.is_empty() };
+    for (auto chunk = iterator.next(); chunk.has_value(); chunk = iterator.next())
+        chunks.append(chunk.release_value());
+
+    // NOTE: The chunk views point into m_text_for_rendering, which is immutable for as long
+    //       as this cache is valid. (compute_text_for_rendering() clears the cache before
+    //       replacing the text.)
+    m_chunk_cache = ChunkCache { wrap_lines, respect_linebreaks, move(chunks) };
+    return m_chunk_cache->chunks;
+}
+
 TextNode::ChunkIterator::ChunkIterator(StringView text, bool wrap_lines, bool respect_linebreaks, bool is_generated_empty_string)
     : m_wrap_lines(wrap_lines)
     , m_respect_linebreaks(respect_linebreaks)
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Utf8View.h>
+#include <AK/Vector.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Layout/Node.h>
 
@@ -50,12 +51,29 @@ public:
 
     void compute_text_for_rendering(bool collapse);
 
+    // Returns the chunks of the current text-for-rendering, splitting as dictated by the
+    // wrap-lines and respect-linebreaks flags. The result is cached, so repeated layout
+    // passes over unchanged text don't re-segment it every time.
+    Vector<Chunk> const& chunks(bool wrap_lines, bool respect_linebreaks);
+
     virtual JS::GCPtr<Painting::Paintable> create_paintable() const override;
 
 private:
     virtual bool is_text_node() const final { return true; }
 
     DeprecatedString m_text_for_rendering;
+
+    // NOTE: Since partial relayout may reuse this layout node after a CharacterData
+    //       mutation, the source text is part of the cache key, not just the collapse mode.
+    DeprecatedString m_text_for_rendering_source;
+    Optional<bool> m_text_for_rendering_collapse;
+
+    struct ChunkCache {
+        bool wrap_lines { false };
+        bool respect_linebreaks { false };
+        Vector<Chunk> chunks;
+    };
+    Optional<ChunkCache> m_chunk_cache;
 };
 
 template<>
@@ -379,6 +379,13 @@ void StackingContext::paint(PaintContext& context) const
         auto transformed_destination_rect = affine_transform.map(source_rect).translated(transform_origin);
         auto destination_rect = transformed_destination_rect.to_rounded<int>();
 
+        // Only composite the part of the stacking context that's within the painter's clip rect.
+        // This way, a small damage rect doesn't force us to re-render the entire context,
+        // and contents transformed off-screen cost nothing at all.
+        auto clipped_destination_rect = destination_rect.intersected(context.painter().clip_rect().translated(-context.painter().translation()));
+        if (clipped_destination_rect.is_empty())
+            return;
+
         // FIXME: We should find a way to scale the paintable, rather than paint into a separate bitmap,
         // then scale it. This snippet now copies the background at the destination, then scales it down/up
         // to the size of the source (which could add some artefacts, though just scaling the bitmap already does that).
@@ -387,7 +394,7 @@ void StackingContext::paint(PaintContext& context) const
         CSSPixelPoint destination_clipped_fixup {};
         auto try_get_scaled_destination_bitmap = [&]() -> ErrorOr<NonnullRefPtr<Gfx::Bitmap>> {
             Gfx::IntRect actual_destination_rect;
-            auto bitmap = TRY(context.painter().get_region_bitmap(destination_rect, Gfx::BitmapFormat::BGRA8888, actual_destination_rect));
+            auto bitmap = TRY(context.painter().get_region_bitmap(clipped_destination_rect, Gfx::BitmapFormat::BGRA8888, actual_destination_rect));
             // get_region_bitmap() may clip to a smaller region if the requested rect goes outside the painter, so we need to account for that.
             destination_clipped_fixup = CSSPixelPoint { destination_rect.location() - actual_destination_rect.location() };
             destination_rect = actual_destination_rect;
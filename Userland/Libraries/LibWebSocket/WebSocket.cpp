@@ -383,22 +383,30 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
+// XOR the payload with the repeating 4-byte masking key a machine word at a
+// time instead of byte-by-byte; frames are usually much longer than the key.
+static void apply_masking_key(Bytes payload, u8 const (&masking_key)[4])
+{
+    u8 repeated_key_bytes[8] = { masking_key[0], masking_key[1], masking_key[2], masking_key[3], masking_key[0], masking_key[1], masking_key[2], masking_key[3] };
+    u64 repeated_key;
+    memcpy(&repeated_key, repeated_key_bytes, sizeof(repeated_key));
+    size_t i = 0;
+    for (; i + sizeof(u64) <= payload.size(); i += sizeof(u64)) {
+        u64 word;
+        memcpy(&word, payload.offset(i), sizeof(word));
+        word ^= repeated_key;
+        memcpy(payload.offset(i), &word, sizeof(word));
+    }
+    for (; i < payload.size(); ++i)
+        payload[i] ^= masking_key[i % 4];
+}
+
 void WebSocket::read_frame()
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
-    size_t cursor = 0;
-    auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
-        if (cursor + count > m_buffered_data.size())
-            return {};
-        auto bytes = m_buffered_data.span().slice(cursor, count);
-        cursor += count;
-        return bytes;
-    };
-
-    auto head_bytes = get_buffered_bytes(2);
-    if (head_bytes.is_null() || head_bytes.is_empty()) {
+    if (m_buffered_data.is_empty()) {
         // The connection got closed.
         m_state = WebSocket::InternalState::Closed;
         notify_close(m_last_close_code, m_last_close_message, true);
@@ -406,117 +414,126 @@ void WebSocket::read_frame()
         return;
     }
 
-    bool is_final_frame = head_bytes[0] & 0x80;
-    if (!is_final_frame) {
-        // FIXME: Support fragmented frames
-        TODO();
-    }
+    // Process every complete frame we have buffered and only compact the
+    // buffer once at the end, so a burst of small frames costs a single pass
+    // over the buffered data instead of a reallocation per frame.
+    size_t frame_start = 0;
+    while (frame_start < m_buffered_data.size() && (m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing)) {
+        size_t cursor = frame_start;
+        auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
+            if (cursor + count > m_buffered_data.size())
+                return {};
+            auto bytes = m_buffered_data.span().slice(cursor, count);
+            cursor += count;
+            return bytes;
+        };
 
-    auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
-    bool is_masked = head_bytes[1] & 0x80;
+        auto head_bytes = get_buffered_bytes(2);
+        if (head_bytes.is_null())
+            break;
 
-    // Parse the payload length.
-    size_t payload_length;
-    auto payload_length_bits = head_bytes[1] & 0x7f;
-    if (payload_length_bits == 127) {
-        // A code of 127 means that the next 8 bytes contains the payload length
-        auto actual_bytes = get_buffered_bytes(8);
-        if (actual_bytes.is_null())
-            return;
-        u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
-            | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
-            | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
-            | (u64)((u64)(actual_bytes[3] & 0xff) << 32)
-            | (u64)((u64)(actual_bytes[4] & 0xff) << 24)
-            | (u64)((u64)(actual_bytes[5] & 0xff) << 16)
-            | (u64)((u64)(actual_bytes[6] & 0xff) << 8)
-            | (u64)((u64)(actual_bytes[7] & 0xff) << 0);
-        VERIFY(full_payload_length <= NumericLimits<size_t>::max());
-        payload_length = (size_t)full_payload_length;
-    } else if (payload_length_bits == 126) {
-        // A code of 126 means that the next 2 bytes contains the payload length
-        auto actual_bytes = get_buffered_bytes(2);
-        if (actual_bytes.is_null())
-            return;
-        payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
-            | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
-    } else {
-        payload_length = (size_t)payload_length_bits;
-    }
+        bool is_final_frame = head_bytes[0] & 0x80;
+        if (!is_final_frame) {
+            // FIXME: Support fragmented frames
+            TODO();
+        }
 
-    // Parse the mask, if it exists.
-    // Note : this is technically non-conformant with Section 5.1 :
-    // > A server MUST NOT mask any frames that it sends to the client.
-    // > A client MUST close a connection if it detects a masked frame.
-    // > (These rules might be relaxed in a future specification.)
-    // But because it doesn't cost much, we can support receiving masked frames anyways.
-    u8 masking_key[4];
-    if (is_masked) {
-        auto masking_key_data = get_buffered_bytes(4);
-        if (masking_key_data.is_null())
-            return;
-        masking_key[0] = masking_key_data[0];
-        masking_key[1] = masking_key_data[1];
-        masking_key[2] = masking_key_data[2];
-        masking_key[3] = masking_key_data[3];
-    }
+        auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
+        bool is_masked = head_bytes[1] & 0x80;
+
+        // Parse the payload length.
+        size_t payload_length;
+        auto payload_length_bits = head_bytes[1] & 0x7f;
+        if (payload_length_bits == 127) {
+            // A code of 127 means that the next 8 bytes contains the payload length
+            auto actual_bytes = get_buffered_bytes(8);
+            if (actual_bytes.is_null())
+                break;
+            u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
+                | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
+                | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
+                | (u64)((u64)(actual_bytes[3] & 0xff) << 32)
+                | (u64)((u64)(actual_bytes[4] & 0xff) << 24)
+                | (u64)((u64)(actual_bytes[5] & 0xff) << 16)
+                | (u64)((u64)(actual_bytes[6] & 0xff) << 8)
+                | (u64)((u64)(actual_bytes[7] & 0xff) << 0);
+            VERIFY(full_payload_length <= NumericLimits<size_t>::max());
+            payload_length = (size_t)full_payload_length;
+        } else if (payload_length_bits == 126) {
+            // A code of 126 means that the next 2 bytes contains the payload length
+            auto actual_bytes = get_buffered_bytes(2);
+            if (actual_bytes.is_null())
+                break;
+            payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
+                | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
+        } else {
+            payload_length = (size_t)payload_length_bits;
+        }
 
-    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    u64 read_length = 0;
-    while (read_length < payload_length) {
-        auto payload_part = get_buffered_bytes(payload_length - read_length);
-        if (payload_part.is_null())
-            return;
-        // We read at most "actual_length - read" bytes, so this is safe to do.
-        payload.overwrite(read_length, payload_part.data(), payload_part.size());
-        read_length += payload_part.size();
-    }
+        // Parse the mask, if it exists.
+        // Note : this is technically non-conformant with Section 5.1 :
+        // > A server MUST NOT mask any frames that it sends to the client.
+        // > A client MUST close a connection if it detects a masked frame.
+        // > (These rules might be relaxed in a future specification.)
+        // But because it doesn't cost much, we can support receiving masked frames anyways.
+        u8 masking_key[4];
+        if (is_masked) {
+            auto masking_key_data = get_buffered_bytes(4);
+            if (masking_key_data.is_null())
+                break;
+            masking_key[0] = masking_key_data[0];
+            masking_key[1] = masking_key_data[1];
+            masking_key[2] = masking_key_data[2];
+            masking_key[3] = masking_key_data[3];
+        }
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+        if (cursor + payload_length > m_buffered_data.size())
+            break;
+        auto payload_bytes = m_buffered_data.span().slice(cursor, payload_length);
+        cursor += payload_length;
 
-    if (is_masked) {
-        // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
-        }
-    }
+        if (is_masked)
+            apply_masking_key(payload_bytes, masking_key);
 
-    if (op_code == WebSocket::OpCode::ConnectionClose) {
-        if (payload.size() > 1) {
-            m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
-            m_last_close_message = DeprecatedString(ReadonlyBytes(payload.offset_pointer(2), payload.size() - 2));
+        auto payload = ByteBuffer::copy(payload_bytes).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
+        frame_start = cursor;
+
+        if (op_code == WebSocket::OpCode::ConnectionClose) {
+            if (payload.size() > 1) {
+                m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
+                m_last_close_message = DeprecatedString(ReadonlyBytes(payload.offset_pointer(2), payload.size() - 2));
+            }
+            m_state = WebSocket::InternalState::Closing;
+            continue;
         }
-        m_state = WebSocket::InternalState::Closing;
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Ping) {
-        // Immediately send a pong frame as a reply, with the given payload.
-        send_frame(WebSocket::OpCode::Pong, payload, true);
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Pong) {
-        // We can safely ignore the pong
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Continuation) {
-        // FIXME: Support fragmented frames
-        TODO();
-    }
-    if (op_code == WebSocket::OpCode::Text) {
-        notify_message(Message(payload, true));
-        return;
-    }
-    if (op_code == WebSocket::OpCode::Binary) {
-        notify_message(Message(payload, false));
-        return;
+        if (op_code == WebSocket::OpCode::Ping) {
+            // Immediately send a pong frame as a reply, with the given payload.
+            send_frame(WebSocket::OpCode::Pong, payload, true);
+            continue;
+        }
+        if (op_code == WebSocket::OpCode::Pong) {
+            // We can safely ignore the pong
+            continue;
+        }
+        if (op_code == WebSocket::OpCode::Continuation) {
+            // FIXME: Support fragmented frames
+            TODO();
+        }
+        if (op_code == WebSocket::OpCode::Text) {
+            notify_message(Message(move(payload), true));
+            continue;
+        }
+        if (op_code == WebSocket::OpCode::Binary) {
+            notify_message(Message(move(payload), false));
+            continue;
+        }
+        dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
     }
-    dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
+
+    if (frame_start == m_buffered_data.size())
+        m_buffered_data.clear_with_capacity();
+    else if (frame_start > 0)
+        m_buffered_data.remove(0, frame_start);
 }
 
 void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
@@ -585,12 +602,10 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
         if (payload.size() == 0)
             return;
         // Mask the payload
-        auto buffer_result = ByteBuffer::create_uninitialized(payload.size());
+        auto buffer_result = ByteBuffer::copy(payload);
         if (!buffer_result.is_error()) {
             auto& masked_payload = buffer_result.value();
-            for (size_t i = 0; i < payload.size(); ++i) {
-                masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
-            }
+            apply_masking_key(masked_payload.bytes(), masking_key);
             m_impl->send(masked_payload);
         }
     } else if (payload.size() > 0) {
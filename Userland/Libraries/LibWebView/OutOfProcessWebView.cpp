@@ -62,7 +62,7 @@ void OutOfProcessWebView::create_client()
 {
     m_client_state = {};
 
-    m_client_state.client = WebContentClient::try_create(*this).release_value_but_fixme_should_propagate_errors();
+    m_client_state.client = WebContentClient::try_create_with_spare_process(*this).release_value_but_fixme_should_propagate_errors();
     m_client_state.client->on_web_content_process_crash = [this] {
         deferred_invoke([this] {
             handle_web_content_process_crash();
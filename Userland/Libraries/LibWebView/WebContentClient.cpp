@@ -7,10 +7,39 @@
 #include "WebContentClient.h"
 #include "OutOfProcessWebView.h"
 #include <AK/Debug.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/SessionManagement.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
 
 namespace WebView {
 
+static OwnPtr<Core::Stream::LocalSocket> s_spare_socket;
+
+ErrorOr<void> WebContentClient::prewarm_spare_process()
+{
+    if (s_spare_socket)
+        return {};
+    auto parsed_socket_path = TRY(Core::SessionManagement::parse_path_with_sid("/tmp/session/%sid/portal/webcontent"sv));
+    auto socket = TRY(Core::Stream::LocalSocket::connect(move(parsed_socket_path)));
+    TRY(socket->set_blocking(true));
+    s_spare_socket = move(socket);
+    return {};
+}
+
+ErrorOr<NonnullRefPtr<WebContentClient>> WebContentClient::try_create_with_spare_process(ViewImplementation& view)
+{
+    if (!s_spare_socket)
+        return try_create(view);
+    auto client = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) WebContentClient(s_spare_socket.release_nonnull(), view)));
+    // Replenish the spare once we're back in the event loop, so the new
+    // process spawns off the critical path of whatever claimed this one.
+    Core::deferred_invoke([] {
+        if (auto result = prewarm_spare_process(); result.is_error())
+            dbgln("Failed to prewarm spare WebContent process: {}", result.error());
+    });
+    return client;
+}
+
 WebContentClient::WebContentClient(NonnullOwnPtr<Core::Stream::LocalSocket> socket, ViewImplementation& view)
     : IPC::ConnectionToServer<WebContentClientEndpoint, WebContentServerEndpoint>(*this, move(socket))
     , m_view(view)
@@ -23,6 +23,17 @@ class WebContentClient final
 public:
     WebContentClient(NonnullOwnPtr<Core::Stream::LocalSocket>, ViewImplementation&);
 
+    // Connects a spare socket to the WebContent portal ahead of time, which
+    // makes SystemServer spawn and fully initialize a WebContent process that
+    // then sits parked until a view claims it. Apps that open views on user
+    // action (like Browser tabs) can call this once at startup; the spare is
+    // replenished in the background every time one is claimed.
+    static ErrorOr<void> prewarm_spare_process();
+
+    // Uses the parked spare process if one is available, and falls back to
+    // try_create() (spawning synchronously) otherwise.
+    static ErrorOr<NonnullRefPtr<WebContentClient>> try_create_with_spare_process(ViewImplementation&);
+
     Function<void()> on_web_content_process_crash;
 
 private:
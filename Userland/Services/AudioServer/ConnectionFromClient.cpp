@@ -95,8 +95,10 @@ void ConnectionFromClient::set_self_volume(double volume)
 
 void ConnectionFromClient::start_playback()
 {
-    if (m_queue)
+    if (m_queue) {
         m_queue->set_paused(false);
+        m_mixer.did_resume_client_playback();
+    }
 }
 
 void ConnectionFromClient::pause_playback()
@@ -6,6 +6,7 @@
  */
 
 #include "Mixer.h"
+#include <AK/AllOf.h>
 #include <AK/Array.h>
 #include <AK/Format.h>
 #include <AK/MemoryStream.h>
@@ -37,6 +38,8 @@ Mixer::Mixer(NonnullRefPtr<Core::ConfigFile> config)
 
     m_muted = m_config->read_bool_entry("Master", "Mute", false);
     m_main_volume = static_cast<double>(m_config->read_num_entry("Master", "Volume", 100)) / 100.0;
+    m_target_latency_ms = max(1, m_config->read_num_entry("Master", "TargetLatencyMs", DEFAULT_TARGET_LATENCY_MS));
+    update_period_size();
 
     m_sound_thread->start();
 }
@@ -61,8 +64,14 @@ void Mixer::mix()
     for (;;) {
         {
             Threading::MutexLocker const locker(m_pending_mutex);
-            // While we have nothing to mix, wait on the condition.
-            m_mixing_necessary.wait_while([this, &active_mix_queues]() { return m_pending_mixing.is_empty() && active_mix_queues.is_empty(); });
+            // While we have nothing to mix, or everyone is paused, wait on the condition.
+            // Resuming clients signal the condition so that we don't busily mix silence in the meantime.
+            m_mixing_necessary.wait_while([this, &active_mix_queues]() {
+                if (!m_pending_mixing.is_empty())
+                    return false;
+                return active_mix_queues.is_empty()
+                    || all_of(active_mix_queues, [](auto const& queue) { return queue->is_paused(); });
+            });
             if (!m_pending_mixing.is_empty()) {
                 active_mix_queues.extend(move(m_pending_mixing));
                 m_pending_mixing.clear();
@@ -71,7 +80,10 @@ void Mixer::mix()
 
         active_mix_queues.remove_all_matching([&](auto& entry) { return !entry->is_connected(); });
 
+        auto const period_size = m_period_size.load();
+
         Array<Audio::Sample, HARDWARE_BUFFER_SIZE> mixed_buffer;
+        auto mixed_samples = mixed_buffer.span().trim(period_size);
 
         m_main_volume.advance_time();
 
@@ -83,26 +95,31 @@ void Mixer::mix()
             }
             queue->volume().advance_time();
 
-            for (auto& mixed_sample : mixed_buffer) {
+            // The headroom and the client volume are constant across the period,
+            // so pay for the expensive logarithmic scaling only once instead of twice per sample.
+            float const gain = Audio::Sample::linear_to_log(SAMPLE_HEADROOM) * Audio::Sample::linear_to_log(static_cast<float>(queue->volume()));
+
+            for (auto& mixed_sample : mixed_samples) {
                 Audio::Sample sample;
                 if (!queue->get_next_sample(sample))
                     break;
                 if (queue->is_muted())
                     continue;
-                sample.log_multiply(SAMPLE_HEADROOM);
-                sample.log_multiply(static_cast<float>(queue->volume()));
+                sample *= gain;
                 mixed_sample += sample;
             }
         }
 
         // Even though it's not realistic, the user expects no sound at 0%.
         if (m_muted || m_main_volume < 0.01) {
-            m_device->write(m_zero_filled_buffer.data(), static_cast<int>(m_zero_filled_buffer.size()));
+            m_device->write(m_zero_filled_buffer.data(), static_cast<int>(period_size * 2 * sizeof(i16)));
         } else {
             FixedMemoryStream stream { m_stream_buffer.span() };
 
-            for (auto& mixed_sample : mixed_buffer) {
-                mixed_sample.log_multiply(static_cast<float>(m_main_volume));
+            float const main_gain = Audio::Sample::linear_to_log(static_cast<float>(m_main_volume));
+
+            for (auto& mixed_sample : mixed_samples) {
+                mixed_sample *= main_gain;
                 mixed_sample.clip();
 
                 LittleEndian<i16> out_sample;
@@ -114,7 +131,7 @@ void Mixer::mix()
             }
 
             auto buffered_bytes = MUST(stream.tell());
-            VERIFY(buffered_bytes == m_stream_buffer.size());
+            VERIFY(buffered_bytes == period_size * 2 * sizeof(i16));
             m_device->write(m_stream_buffer.data(), static_cast<int>(buffered_bytes));
         }
     }
@@ -156,6 +173,8 @@ int Mixer::audiodevice_set_sample_rate(u32 sample_rate)
     int code = ioctl(m_device->fd(), SOUNDCARD_IOCTL_SET_SAMPLE_RATE, sample_rate);
     if (code != 0)
         dbgln("Error while setting sample rate to {}: ioctl error: {}", sample_rate, strerror(errno));
+    else
+        update_period_size();
     return code;
 }
 
@@ -168,6 +187,18 @@ u32 Mixer::audiodevice_get_sample_rate() const
     return sample_rate;
 }
 
+// The period size determines how much audio the mixer thread prepares per device write, and
+// therefore the output latency. Aim for the configured target latency, but never exceed the
+// hardware buffer and never go below one client audio chunk.
+void Mixer::update_period_size()
+{
+    auto sample_rate = audiodevice_get_sample_rate();
+    if (sample_rate == 0)
+        sample_rate = 44100;
+    auto samples_for_target_latency = static_cast<size_t>(sample_rate) * m_target_latency_ms / 1000;
+    m_period_size = clamp(samples_for_target_latency, Audio::AUDIO_BUFFER_SIZE, HARDWARE_BUFFER_SIZE);
+}
+
 void Mixer::request_setting_sync()
 {
     if (m_config_write_timer.is_null() || !m_config_write_timer->is_active()) {
@@ -29,8 +29,12 @@ namespace AudioServer {
 // Headroom, i.e. fixed attenuation for all audio streams.
 // This is to prevent clipping when two streams with low headroom (e.g. normalized & compressed) are playing.
 constexpr double SAMPLE_HEADROOM = 0.95;
-// The size of the buffer in samples that the hardware receives through write() calls to the audio device.
+// The maximum size of the buffer in samples that the hardware receives through write() calls to the audio device.
+// The actual period size is derived from the target latency and may be smaller.
 constexpr size_t HARDWARE_BUFFER_SIZE = 512;
+// How much audio (in milliseconds) each mixing period covers by default.
+// Shorter periods reduce output latency at the cost of more mixer thread wakeups.
+constexpr unsigned DEFAULT_TARGET_LATENCY_MS = 10;
 // The hardware buffer size in bytes; there's two channels of 16-bit samples.
 constexpr size_t HARDWARE_BUFFER_SIZE_BYTES = HARDWARE_BUFFER_SIZE * 2 * sizeof(i16);
 
@@ -84,6 +88,7 @@ public:
     }
 
     void set_paused(bool paused) { m_paused = paused; }
+    bool is_paused() const { return m_paused; }
 
     FadingProperty<double>& volume() { return m_volume; }
     double volume() const { return m_volume; }
@@ -96,7 +101,8 @@ private:
     Array<Audio::Sample, Audio::AUDIO_BUFFER_SIZE> m_current_audio_chunk;
     size_t m_in_chunk_location;
 
-    bool m_paused { true };
+    // Accessed by both the IPC thread and the mixer thread.
+    Atomic<bool> m_paused { true };
     bool m_muted { false };
 
     WeakPtr<ConnectionFromClient> m_client;
@@ -120,10 +126,14 @@ public:
     int audiodevice_set_sample_rate(u32 sample_rate);
     u32 audiodevice_get_sample_rate() const;
 
+    // Wakes the mixer thread back up after it went to sleep because all client streams were paused.
+    void did_resume_client_playback() { m_mixing_necessary.signal(); }
+
 private:
     Mixer(NonnullRefPtr<Core::ConfigFile> config);
 
     void request_setting_sync();
+    void update_period_size();
 
     Vector<NonnullRefPtr<ClientAudioStream>> m_pending_mixing;
     Threading::Mutex m_pending_mutex;
@@ -136,6 +146,10 @@ private:
     bool m_muted { false };
     FadingProperty<double> m_main_volume { 1 };
 
+    unsigned m_target_latency_ms { DEFAULT_TARGET_LATENCY_MS };
+    // How many samples the mixer thread mixes and writes out per iteration. Recomputed when the sample rate changes.
+    Atomic<size_t> m_period_size { HARDWARE_BUFFER_SIZE };
+
     NonnullRefPtr<Core::ConfigFile> m_config;
     RefPtr<Core::Timer> m_config_write_timer;
 
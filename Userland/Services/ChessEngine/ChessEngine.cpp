@@ -6,8 +6,11 @@
 
 #include "ChessEngine.h"
 #include "MCTSTree.h"
+#include <AK/NonnullOwnPtrVector.h>
 #include <AK/Random.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibThreading/Thread.h>
+#include <unistd.h>
 
 using namespace Chess::UCI;
 
@@ -47,12 +50,48 @@ void ChessEngine::handle_go(GoCommand const& command)
         return { m_board };
     }();
 
+    // Root-parallel search: every extra processor runs an independent tree on
+    // the same position for the whole move time. The worker trees only share
+    // the transposition table; their statistics are merged below, once they
+    // can no longer race with anything.
+    struct SearchWorker {
+        explicit SearchWorker(Chess::Board const& board)
+            : tree(board)
+        {
+        }
+
+        MCTSTree tree;
+        RefPtr<Threading::Thread> thread;
+        int rounds { 0 };
+    };
+
+    auto processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+    NonnullOwnPtrVector<SearchWorker> workers;
+    for (long i = 1; i < processor_count; ++i) {
+        auto worker = make<SearchWorker>(m_board);
+        worker->thread = Threading::Thread::construct([&elapsed_time, &command, worker = worker.ptr()]() -> intptr_t {
+            while (elapsed_time.elapsed() <= command.movetime.value()) {
+                worker->tree.do_round();
+                ++worker->rounds;
+            }
+            return 0;
+        }, "MCTS worker"sv);
+        worker->thread->start();
+        workers.append(move(worker));
+    }
+
     int rounds = 0;
     while (elapsed_time.elapsed() <= command.movetime.value()) {
         mcts.do_round();
         ++rounds;
     }
-    dbgln("MCTS finished {} rounds.", rounds);
+
+    for (auto& worker : workers) {
+        (void)worker.thread->join();
+        mcts.merge_statistics(move(worker.tree));
+        rounds += worker.rounds;
+    }
+    dbgln("MCTS finished {} rounds on {} thread(s).", rounds, workers.size() + 1);
     dbgln("MCTS evaluation {}", mcts.expected_value());
     auto& best_node = mcts.best_node();
     auto const& best_move = best_node.last_move();
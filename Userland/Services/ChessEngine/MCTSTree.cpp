@@ -6,8 +6,11 @@
 
 #include "MCTSTree.h"
 #include <AK/DeprecatedString.h>
+#include <AK/Traits.h>
 #include <stdlib.h>
 
+TranspositionTable MCTSTree::s_transposition_table;
+
 MCTSTree::MCTSTree(Chess::Board const& board, MCTSTree* parent)
     : m_parent(parent)
     , m_board(make<Chess::Board>(board))
@@ -22,6 +25,7 @@ MCTSTree::MCTSTree(MCTSTree&& other)
     , m_white_points(other.m_white_points)
     , m_simulations(other.m_simulations)
     , m_board(move(other.m_board))
+    , m_unexpanded_moves(move(other.m_unexpanded_moves))
     , m_last_move(move(other.m_last_move))
     , m_turn(other.m_turn)
     , m_moves_generated(other.m_moves_generated)
@@ -53,14 +57,22 @@ MCTSTree& MCTSTree::expand()
 
     if (!m_moves_generated) {
         m_board->generate_moves([&](Chess::Move chess_move) {
-            auto clone = m_board->clone_without_history();
-            clone.apply_move(chess_move);
-            m_children.append(make<MCTSTree>(move(clone), this));
+            m_unexpanded_moves.append(chess_move);
             return IterationDecision::Continue;
         });
         m_moves_generated = true;
-        if (m_children.size() != 0)
+    }
+
+    // Materialize one child per visit instead of cloning a board for every
+    // legal move up front; most moves never get selected at all.
+    if (!m_unexpanded_moves.is_empty()) {
+        auto chess_move = m_unexpanded_moves.take_last();
+        auto clone = m_board->clone_without_history();
+        clone.apply_move(chess_move);
+        m_children.append(make<MCTSTree>(move(clone), this));
+        if (m_unexpanded_moves.is_empty())
             m_board = nullptr; // Release the board to save memory.
+        return m_children.last();
     }
 
     if (m_children.size() == 0) {
@@ -86,10 +98,24 @@ int MCTSTree::simulate_game() const
 
 int MCTSTree::heuristic() const
 {
-    if (m_board->game_finished())
-        return m_board->game_score();
+    // The expensive part of the evaluation (move generation to detect mates
+    // and the material count) only depends on the position, so transpositions
+    // share it through a table keyed by the board hash.
+    auto board_hash = Traits<Chess::Board>::hash(*m_board);
+    auto evaluation = s_transposition_table.get(board_hash);
+    if (!evaluation.has_value()) {
+        auto game_finished = m_board->game_finished();
+        evaluation = TranspositionTable::Evaluation {
+            .game_finished = game_finished,
+            .value = static_cast<i16>(game_finished ? m_board->game_score() : m_board->material_imbalance()),
+        };
+        s_transposition_table.set(board_hash, *evaluation);
+    }
 
-    double winchance = max(min(double(m_board->material_imbalance()) / 6, 1.0), -1.0);
+    if (evaluation->game_finished)
+        return evaluation->value;
+
+    double winchance = max(min(double(evaluation->value) / 6, 1.0), -1.0);
 
     double random = double(rand()) / RAND_MAX;
     if (winchance >= random)
@@ -139,6 +165,33 @@ Optional<MCTSTree&> MCTSTree::child_with_move(Chess::Move chess_move)
     return {};
 }
 
+void MCTSTree::merge_statistics(MCTSTree&& other)
+{
+    VERIFY(!m_parent && !other.m_parent);
+
+    m_white_points += other.m_white_points;
+    m_simulations += other.m_simulations;
+
+    if (!m_moves_generated && other.m_moves_generated) {
+        m_moves_generated = true;
+        m_unexpanded_moves = move(other.m_unexpanded_moves);
+    }
+
+    while (!other.m_children.is_empty()) {
+        auto other_child = other.m_children.take_last();
+        auto matching_child = child_with_move(other_child->last_move());
+        if (matching_child.has_value()) {
+            matching_child.value().m_white_points += other_child->m_white_points;
+            matching_child.value().m_simulations += other_child->m_simulations;
+            continue;
+        }
+        // Adopt subtrees for moves we never got around to materializing.
+        m_unexpanded_moves.remove_first_matching([&](auto& chess_move) { return chess_move == other_child->last_move(); });
+        other_child->m_parent = this;
+        m_children.append(move(other_child));
+    }
+}
+
 MCTSTree& MCTSTree::best_node()
 {
     int score_multiplier = (m_turn == Chess::Color::White) ? 1 : -1;
@@ -183,7 +236,7 @@ double MCTSTree::uct(Chess::Color color) const
 
 bool MCTSTree::expanded() const
 {
-    if (!m_moves_generated)
+    if (!m_moves_generated || !m_unexpanded_moves.is_empty())
         return false;
 
     for (auto& child : m_children) {
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include "TranspositionTable.h"
 #include <AK/Function.h>
 #include <AK/NonnullOwnPtrVector.h>
 #include <AK/OwnPtr.h>
+#include <AK/Vector.h>
 #include <LibChess/Chess.h>
 #include <math.h>
 
@@ -31,6 +33,11 @@ public:
 
     Optional<MCTSTree&> child_with_move(Chess::Move);
 
+    // Folds the root and first-ply statistics of another tree searching the
+    // same position into ours. Used to combine the results of parallel
+    // searches; both trees must be roots.
+    void merge_statistics(MCTSTree&& other);
+
     MCTSTree& best_node();
 
     Chess::Move last_move() const;
@@ -46,11 +53,14 @@ private:
     // FIXME: Optimize simulations enough for use.
     static constexpr EvalMethod s_eval_method { EvalMethod::Heuristic };
 
+    static TranspositionTable s_transposition_table;
+
     NonnullOwnPtrVector<MCTSTree> m_children;
     MCTSTree* m_parent { nullptr };
     int m_white_points { 0 };
     int m_simulations { 0 };
     OwnPtr<Chess::Board> m_board;
+    Vector<Chess::Move> m_unexpanded_moves;
     Optional<Chess::Move> m_last_move;
     Chess::Color m_turn : 2;
     bool m_moves_generated : 1 { false };
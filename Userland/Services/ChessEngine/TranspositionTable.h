@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/Optional.h>
+#include <AK/Types.h>
+
+// A fixed-size, lock-free cache of static board evaluations, keyed by
+// Traits<Chess::Board>::hash. Key and payload are packed into a single u64 per
+// slot, so concurrent readers and writers only ever observe complete entries;
+// colliding positions simply overwrite each other.
+class TranspositionTable {
+public:
+    struct Evaluation {
+        bool game_finished { false };
+        // game_score() for finished games, material_imbalance() otherwise.
+        i16 value { 0 };
+    };
+
+    Optional<Evaluation> get(unsigned board_hash) const
+    {
+        auto packed = m_slots[board_hash % slot_count].load(AK::MemoryOrder::memory_order_relaxed);
+        if ((packed & present_flag) == 0 || (packed >> 32) != board_hash)
+            return {};
+        return Evaluation {
+            .game_finished = (packed & finished_flag) != 0,
+            .value = static_cast<i16>(static_cast<u16>(packed >> 16)),
+        };
+    }
+
+    void set(unsigned board_hash, Evaluation evaluation)
+    {
+        u64 packed = (static_cast<u64>(board_hash) << 32)
+            | (static_cast<u64>(static_cast<u16>(evaluation.value)) << 16)
+            | (evaluation.game_finished ? finished_flag : 0)
+            | present_flag;
+        m_slots[board_hash % slot_count].store(packed, AK::MemoryOrder::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t slot_count = 64 * KiB;
+    static constexpr u64 present_flag = 1 << 0;
+    static constexpr u64 finished_flag = 1 << 1;
+
+    Array<Atomic<u64>, slot_count> m_slots {};
+};
@@ -28,16 +28,53 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<Core::Stream::LocalSock
 void ConnectionFromClient::die()
 {
     s_connections.remove(client_id());
+
+    // If the current clip's data still lives in this client, it's gone now.
+    auto& storage = Storage::the();
+    if (storage.is_delegated() && storage.delegate_client_id() == client_id())
+        storage.set_data({}, {}, {});
+}
+
+void ConnectionFromClient::revoke_delegation_of_current_clip(ConnectionFromClient* new_owner)
+{
+    auto& storage = Storage::the();
+    if (!storage.is_delegated())
+        return;
+    auto it = s_connections.find(storage.delegate_client_id());
+    if (it == s_connections.end() || it->value == new_owner)
+        return;
+    it->value->async_clipboard_delegation_revoked();
 }
 
 void ConnectionFromClient::set_clipboard_data(Core::AnonymousBuffer const& data, DeprecatedString const& mime_type, IPC::Dictionary const& metadata)
 {
+    revoke_delegation_of_current_clip(this);
     Storage::the().set_data(data, mime_type, metadata.entries());
 }
 
+void ConnectionFromClient::set_clipboard_descriptor(DeprecatedString const& mime_type, IPC::Dictionary const& metadata)
+{
+    revoke_delegation_of_current_clip(this);
+    Storage::the().set_delegated_data(client_id(), mime_type, metadata.entries());
+}
+
 Messages::ClipboardServer::GetClipboardDataResponse ConnectionFromClient::get_clipboard_data()
 {
     auto& storage = Storage::the();
+    if (storage.is_delegated()) {
+        auto it = s_connections.find(storage.delegate_client_id());
+        // The owner serves its own pastes from its local copy, so a request from
+        // the owner itself means it has lost that copy; hand out an empty clip
+        // rather than deadlocking on a synchronous round-trip to the requester.
+        if (it == s_connections.end() || it->value == this)
+            return { Core::AnonymousBuffer(), storage.mime_type(), storage.metadata() };
+
+        auto response = it->value->send_sync_but_allow_failure<Messages::ClipboardClient::RenderClipboardData>();
+        if (!response)
+            return { Core::AnonymousBuffer(), storage.mime_type(), storage.metadata() };
+        storage.promote_delegated_data(response->take_data());
+        it->value->async_clipboard_delegation_revoked();
+    }
     return { storage.buffer(), storage.mime_type(), storage.metadata() };
 }
 
@@ -31,6 +31,9 @@ private:
 
     virtual Messages::ClipboardServer::GetClipboardDataResponse get_clipboard_data() override;
     virtual void set_clipboard_data(Core::AnonymousBuffer const&, DeprecatedString const&, IPC::Dictionary const&) override;
+    virtual void set_clipboard_descriptor(DeprecatedString const&, IPC::Dictionary const&) override;
+
+    static void revoke_delegation_of_current_clip(ConnectionFromClient* new_owner);
 };
 
 }
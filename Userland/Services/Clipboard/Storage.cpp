@@ -17,12 +17,34 @@ Storage& Storage::the()
 void Storage::set_data(Core::AnonymousBuffer data, DeprecatedString const& mime_type, HashMap<DeprecatedString, DeprecatedString> const& metadata)
 {
     m_buffer = move(data);
-    m_data_size = data.size();
+    m_data_size = m_buffer.size();
     m_mime_type = mime_type;
     m_metadata = metadata;
+    m_delegate_client_id = -1;
 
     if (on_content_change)
         on_content_change();
 }
 
+void Storage::set_delegated_data(int delegate_client_id, DeprecatedString const& mime_type, HashMap<DeprecatedString, DeprecatedString> const& metadata)
+{
+    m_buffer = {};
+    m_data_size = 0;
+    m_mime_type = mime_type;
+    m_metadata = metadata;
+    m_delegate_client_id = delegate_client_id;
+
+    if (on_content_change)
+        on_content_change();
+}
+
+void Storage::promote_delegated_data(Core::AnonymousBuffer data)
+{
+    VERIFY(is_delegated());
+    m_buffer = move(data);
+    m_data_size = m_buffer.size();
+    m_delegate_client_id = -1;
+    // No content change notification: the clip itself hasn't changed.
+}
+
 }
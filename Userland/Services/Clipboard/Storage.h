@@ -18,7 +18,11 @@ public:
     static Storage& the();
     ~Storage() = default;
 
-    bool has_data() const { return m_buffer.is_valid(); }
+    bool has_data() const { return m_buffer.is_valid() || is_delegated(); }
+
+    // Whether the current clip's data still lives in the source application.
+    bool is_delegated() const { return m_delegate_client_id != -1; }
+    int delegate_client_id() const { return m_delegate_client_id; }
 
     DeprecatedString const& mime_type() const { return m_mime_type; }
     HashMap<DeprecatedString, DeprecatedString> const& metadata() const { return m_metadata; }
@@ -38,6 +42,9 @@ public:
     }
 
     void set_data(Core::AnonymousBuffer, DeprecatedString const& mime_type, HashMap<DeprecatedString, DeprecatedString> const& metadata);
+    void set_delegated_data(int delegate_client_id, DeprecatedString const& mime_type, HashMap<DeprecatedString, DeprecatedString> const& metadata);
+    // Attaches the rendered data of a delegated clip, so later pastes don't ask the source again.
+    void promote_delegated_data(Core::AnonymousBuffer);
 
     Function<void()> on_content_change;
 
@@ -50,6 +57,7 @@ private:
     Core::AnonymousBuffer m_buffer;
     size_t m_data_size { 0 };
     HashMap<DeprecatedString, DeprecatedString> m_metadata;
+    int m_delegate_client_id { -1 };
 };
 
 }
@@ -151,6 +151,30 @@ Messages::ConfigServer::ListConfigGroupsResponse ConnectionFromClient::list_conf
     return { config.groups() };
 }
 
+Messages::ConfigServer::DumpDomainValuesResponse ConnectionFromClient::dump_domain_values(DeprecatedString const& domain)
+{
+    Vector<DeprecatedString> groups;
+    Vector<DeprecatedString> keys;
+    Vector<DeprecatedString> values;
+
+    if (!validate_access(domain, "", ""))
+        return { move(groups), move(keys), move(values) };
+
+    auto& config = ensure_domain_config(domain);
+    for (auto& group : config.groups()) {
+        // An entry with an empty key marks the group itself, so empty groups survive the round-trip.
+        groups.append(group);
+        keys.append(DeprecatedString::empty());
+        values.append(DeprecatedString::empty());
+        for (auto& key : config.keys(group)) {
+            groups.append(group);
+            keys.append(key);
+            values.append(config.read_entry(group, key));
+        }
+    }
+    return { move(groups), move(keys), move(values) };
+}
+
 Messages::ConfigServer::ReadStringValueResponse ConnectionFromClient::read_string_value(DeprecatedString const& domain, DeprecatedString const& group, DeprecatedString const& key)
 {
     if (!validate_access(domain, group, key))
@@ -13,6 +13,7 @@
 #include <AK/JsonParser.h>
 #include <AK/Random.h>
 #include <AK/ScopeGuard.h>
+#include <AK/Time.h>
 #include <AK/Try.h>
 #include <LibCore/File.h>
 #include <LibCore/Timer.h>
@@ -120,6 +121,12 @@ static void set_params(InterfaceDescriptor const& iface, IPv4Address const& ipv4
 DHCPv4Client::DHCPv4Client(Vector<DeprecatedString> interfaces_with_dhcp_enabled)
     : m_interfaces_with_dhcp_enabled(move(interfaces_with_dhcp_enabled))
 {
+    auto lease_cache_or_error = Core::ConfigFile::open_for_system("DHCPLeases", Core::ConfigFile::AllowWriting::Yes);
+    if (lease_cache_or_error.is_error())
+        dbgln("Not persisting DHCP leases: {}", lease_cache_or_error.error());
+    else
+        m_lease_cache = lease_cache_or_error.release_value();
+
     m_server = Core::UDPServer::construct(this);
     m_server->on_ready_to_receive = [this] {
         // TODO: we need to handle possible errors here somehow
@@ -163,7 +170,8 @@ void DHCPv4Client::try_discover_ifs()
         if (iface.current_ip_address != IPv4Address { 0, 0, 0, 0 })
             continue;
 
-        dhcp_discover(iface);
+        if (!try_init_reboot(iface))
+            dhcp_discover(iface);
         sent_discover_request = true;
     }
 
@@ -267,8 +275,15 @@ void DHCPv4Client::handle_ack(DHCPv4Packet const& packet, ParsedDHCPv4Options co
     Optional<IPv4Address> gateway;
     if (auto routers = options.get_many<IPv4Address>(DHCPOption::Router, 1); !routers.is_empty())
         gateway = routers.first();
+    if (!gateway.has_value())
+        gateway = transaction->fallback_gateway;
 
-    set_params(transaction->interface, new_ip, options.get<IPv4Address>(DHCPOption::SubnetMask).value(), gateway);
+    auto netmask = transaction->fallback_netmask;
+    if (auto maybe_netmask = options.get<IPv4Address>(DHCPOption::SubnetMask); maybe_netmask.has_value())
+        netmask = maybe_netmask.value();
+
+    set_params(transaction->interface, new_ip, netmask.value(), gateway);
+    cache_lease(transaction->interface, netmask.value(), gateway, lease_time);
 }
 
 void DHCPv4Client::handle_nak(DHCPv4Packet const& packet, ParsedDHCPv4Options const& options)
@@ -284,6 +299,14 @@ void DHCPv4Client::handle_nak(DHCPv4Packet const& packet, ParsedDHCPv4Options co
     transaction->accepted_offer = false;
     transaction->has_ip = false;
     auto& iface = transaction->interface;
+    if (transaction->is_init_reboot) {
+        // Our cached lease is stale; undo the optimistic configuration and
+        // start over with a fresh DISCOVER right away.
+        transaction->is_init_reboot = false;
+        set_params(iface, IPv4Address { 0, 0, 0, 0 }, IPv4Address { 0, 0, 0, 0 }, {});
+        dhcp_discover(iface);
+        return;
+    }
     (void)Core::Timer::create_single_shot(
         10000,
         [this, iface = InterfaceDescriptor { iface }] {
@@ -361,6 +384,112 @@ void DHCPv4Client::dhcp_discover(InterfaceDescriptor const& iface)
     m_ongoing_transactions.set(transaction_id, make<DHCPv4Transaction>(iface));
 }
 
+bool DHCPv4Client::try_init_reboot(InterfaceDescriptor const& iface)
+{
+    if (!m_lease_cache)
+        return false;
+
+    auto const& group = iface.ifname;
+    if (!m_lease_cache->has_group(group))
+        return false;
+    if (m_lease_cache->read_entry(group, "MACAddress") != iface.mac_address.to_deprecated_string())
+        return false;
+
+    auto expiry = m_lease_cache->read_entry(group, "Expiry").to_int<i64>().value_or(0);
+    auto now = Time::now_realtime().to_seconds();
+    if (now >= expiry)
+        return false;
+
+    auto ip = IPv4Address::from_string(m_lease_cache->read_entry(group, "IPv4Address"));
+    auto netmask = IPv4Address::from_string(m_lease_cache->read_entry(group, "IPv4Netmask"));
+    if (!ip.has_value() || ip->is_zero() || !netmask.has_value())
+        return false;
+    auto gateway = IPv4Address::from_string(m_lease_cache->read_entry(group, "IPv4Gateway"));
+
+    auto transaction_id = get_random<u32>();
+    dbgln("Re-requesting cached lease {} for {} (INIT-REBOOT) with ID {}", ip->to_deprecated_string(), iface.ifname, transaction_id);
+
+    DHCPv4PacketBuilder builder;
+
+    DHCPv4Packet& packet = builder.peek();
+    packet.set_op(DHCPv4Op::BootRequest);
+    packet.set_htype(1); // 10mb ethernet
+    packet.set_hlen(sizeof(MACAddress));
+    packet.set_xid(transaction_id);
+    packet.set_flags(DHCPv4Flags::Broadcast);
+    packet.set_chaddr(iface.mac_address);
+    packet.set_secs(65535); // we lie
+
+    // set packet options
+    builder.set_message_type(DHCPMessageType::DHCPRequest);
+    builder.add_option(DHCPOption::RequestedIPAddress, sizeof(IPv4Address), &ip.value());
+
+    AK::Array<DHCPOption, 2> parameter_request_list = {
+        DHCPOption::SubnetMask,
+        DHCPOption::Router,
+    };
+    builder.add_option(DHCPOption::ParameterRequestList, parameter_request_list.size(), &parameter_request_list);
+
+    auto& dhcp_packet = builder.build();
+
+    if (!send(iface, dhcp_packet, this))
+        return false;
+
+    auto transaction = make<DHCPv4Transaction>(iface);
+    transaction->accepted_offer = true;
+    transaction->is_init_reboot = true;
+    transaction->fallback_netmask = netmask;
+    if (gateway.has_value() && !gateway->is_zero())
+        transaction->fallback_gateway = gateway;
+
+    // Configure the interface with the cached parameters right away; in the
+    // common case the server just confirms them, and a NAK rolls this back.
+    set_params(iface, *ip, *netmask, transaction->fallback_gateway);
+
+    m_ongoing_transactions.set(transaction_id, move(transaction));
+
+    (void)Core::Timer::create_single_shot(
+        3000,
+        [this, transaction_id, expiry, now] {
+            auto it = m_ongoing_transactions.find(transaction_id);
+            if (it == m_ongoing_transactions.end())
+                return;
+            auto& transaction = *it->value;
+            if (transaction.has_ip || !transaction.is_init_reboot)
+                return;
+            // Nobody answered. Per RFC 2131 section 3.2 we may keep using the
+            // lease until it expires; retry a full DISCOVER cycle then.
+            dbgln("No answer to INIT-REBOOT request for {}, keeping cached lease until expiry", transaction.interface.ifname);
+            (void)Core::Timer::create_single_shot(
+                static_cast<int>((expiry - now) * 1000),
+                [this, iface = InterfaceDescriptor { transaction.interface }] {
+                    dhcp_discover(iface);
+                },
+                this)
+                .release_value_but_fixme_should_propagate_errors();
+            m_ongoing_transactions.remove(transaction_id);
+        },
+        this)
+        .release_value_but_fixme_should_propagate_errors();
+
+    return true;
+}
+
+void DHCPv4Client::cache_lease(InterfaceDescriptor const& iface, IPv4Address const& netmask, Optional<IPv4Address> const& gateway, u32 lease_time)
+{
+    if (!m_lease_cache)
+        return;
+
+    auto const& group = iface.ifname;
+    m_lease_cache->write_entry(group, "MACAddress", iface.mac_address.to_deprecated_string());
+    m_lease_cache->write_entry(group, "IPv4Address", iface.current_ip_address.to_deprecated_string());
+    m_lease_cache->write_entry(group, "IPv4Netmask", netmask.to_deprecated_string());
+    m_lease_cache->write_entry(group, "IPv4Gateway", gateway.value_or(IPv4Address { 0, 0, 0, 0 }).to_deprecated_string());
+    m_lease_cache->write_entry(group, "Expiry", DeprecatedString::number(Time::now_realtime().to_seconds() + lease_time));
+    if (auto result = m_lease_cache->sync(); result.is_error())
+        dbgln("Failed to persist DHCP lease for {}: {}", iface.ifname, result.error());
+}
+
 void DHCPv4Client::dhcp_request(DHCPv4Transaction& transaction, DHCPv4Packet const& offer)
 {
     auto& iface = transaction.interface;
@@ -12,6 +12,7 @@
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/Vector.h>
+#include <LibCore/ConfigFile.h>
 #include <LibCore/UDPServer.h>
 #include <net/if.h>
 #include <net/route.h>
@@ -34,6 +35,11 @@ struct DHCPv4Transaction {
     bool accepted_offer { false };
     bool has_ip { false };
     u32 offered_lease_time { 0 };
+    // Set when we skipped DISCOVER and re-requested a cached lease (INIT-REBOOT).
+    bool is_init_reboot { false };
+    // Cached lease parameters, used when the server's answer omits them.
+    Optional<IPv4Address> fallback_netmask;
+    Optional<IPv4Address> fallback_gateway;
 };
 
 class DHCPv4Client final : public Core::Object {
@@ -57,11 +63,15 @@ private:
     explicit DHCPv4Client(Vector<DeprecatedString> interfaces_with_dhcp_enabled);
 
     void try_discover_ifs();
+    bool try_init_reboot(InterfaceDescriptor const&);
+    void cache_lease(InterfaceDescriptor const&, IPv4Address const& netmask, Optional<IPv4Address> const& gateway, u32 lease_time);
 
     Vector<DeprecatedString> m_interfaces_with_dhcp_enabled;
     HashMap<u32, OwnPtr<DHCPv4Transaction>> m_ongoing_transactions;
     RefPtr<Core::UDPServer> m_server;
     RefPtr<Core::Timer> m_check_timer;
+    // Leases that survived a restart, so we can re-request them without a full DISCOVER cycle.
+    RefPtr<Core::ConfigFile> m_lease_cache;
     int m_max_timer_backoff_interval { 600000 }; // 10 minutes
 
     void handle_offer(DHCPv4Packet const&, ParsedDHCPv4Options const&);
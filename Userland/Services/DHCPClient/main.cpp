@@ -18,14 +18,15 @@ ErrorOr<int> serenity_main(Main::Arguments args)
     parser.add_positional_argument(interfaces, "Interfaces to run DHCP server on", "interfaces");
     parser.parse(args);
 
-    TRY(Core::System::pledge("stdio unix inet cpath rpath"));
+    TRY(Core::System::pledge("stdio unix inet cpath rpath wpath"));
     Core::EventLoop event_loop;
 
     TRY(Core::System::unveil("/sys/kernel/net/", "r"));
+    TRY(Core::System::unveil("/etc/DHCPLeases.ini", "rwc"));
     TRY(Core::System::unveil(nullptr, nullptr));
 
     auto client = TRY(DHCPv4Client::try_create(interfaces));
 
-    TRY(Core::System::pledge("stdio inet cpath rpath"));
+    TRY(Core::System::pledge("stdio inet cpath rpath wpath"));
     return event_loop.exec();
 }
@@ -9,6 +9,7 @@
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageDecoder.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace ImageDecoder {
 
@@ -22,7 +23,26 @@ void ConnectionFromClient::die()
     Core::EventLoop::current().quit(0);
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
+static Gfx::ShareableBitmap downscaled_to_ideal_size_if_needed(Gfx::Bitmap const& bitmap, Optional<Gfx::IntSize> const& ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty())
+        return bitmap.to_shareable_bitmap();
+    if (bitmap.width() <= ideal_size->width() && bitmap.height() <= ideal_size->height())
+        return bitmap.to_shareable_bitmap();
+
+    // Scale down to fit within the ideal size, keeping the aspect ratio, so we
+    // don't share a full-resolution bitmap with a client that only wants a
+    // thumbnail.
+    float scale = min(static_cast<float>(ideal_size->width()) / bitmap.width(), static_cast<float>(ideal_size->height()) / bitmap.height());
+    auto scaled_or_error = bitmap.scaled(scale, scale);
+    if (scaled_or_error.is_error()) {
+        dbgln("Could not downscale decoded image: {}", scaled_or_error.error());
+        return bitmap.to_shareable_bitmap();
+    }
+    return scaled_or_error.value()->to_shareable_bitmap();
+}
+
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> const& ideal_size, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
 {
     for (size_t i = 0; i < decoder.frame_count(); ++i) {
         auto frame_or_error = decoder.frame(i);
@@ -31,18 +51,18 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
             durations.append(0);
         } else {
             auto frame = frame_or_error.release_value();
-            bitmaps.append(frame.image->to_shareable_bitmap());
+            bitmaps.append(downscaled_to_ideal_size_if_needed(*frame.image, ideal_size));
             durations.append(frame.duration);
         }
     }
 }
 
-static void decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<DeprecatedString> const& known_mime_type, bool& is_animated, u32& loop_count, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
+static void decode_image_to_details(ReadonlyBytes encoded_data, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& known_mime_type, bool& is_animated, u32& loop_count, Vector<Gfx::ShareableBitmap>& bitmaps, Vector<u32>& durations)
 {
     VERIFY(bitmaps.size() == 0);
     VERIFY(durations.size() == 0);
 
-    auto decoder = Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type);
+    auto decoder = Gfx::ImageDecoder::try_create_for_raw_bytes(encoded_data, known_mime_type);
     if (!decoder) {
         dbgln_if(IMAGE_DECODER_DEBUG, "Could not find suitable image decoder plugin for data");
         return;
@@ -54,10 +74,10 @@ static void decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer,
     }
     is_animated = decoder->is_animated();
     loop_count = decoder->loop_count();
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, bitmaps, durations);
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, bitmaps, durations);
 }
 
-Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer const& encoded_buffer, Optional<DeprecatedString> const& mime_type)
+Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& mime_type)
 {
     if (!encoded_buffer.is_valid()) {
         dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
@@ -68,8 +88,93 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
     u32 loop_count = 0;
     Vector<Gfx::ShareableBitmap> bitmaps;
     Vector<u32> durations;
-    decode_image_to_details(encoded_buffer, mime_type, is_animated, loop_count, bitmaps, durations);
+    decode_image_to_details(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, ideal_size, mime_type, is_animated, loop_count, bitmaps, durations);
     return { is_animated, loop_count, bitmaps, durations };
 }
 
+void ConnectionFromClient::enqueue_decoding(i64 job_id, Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& mime_type, i32 priority)
+{
+    if (!encoded_buffer.is_valid()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "Encoded data is invalid");
+        async_did_decode_image(job_id, false, 0, {}, {});
+        return;
+    }
+
+    // Copy the data out of the anonymous buffer: its reference count is not
+    // atomic, so the buffer handle must not outlive this (main-thread) scope.
+    auto data_or_error = ByteBuffer::copy(encoded_buffer.data<u8>(), encoded_buffer.size());
+    if (data_or_error.is_error()) {
+        dbgln("Could not copy encoded data for job {}: {}", job_id, data_or_error.error());
+        async_did_decode_image(job_id, false, 0, {}, {});
+        return;
+    }
+
+    {
+        Threading::MutexLocker locker(m_queue_mutex);
+        m_queued_jobs.append(make<Job>(job_id, data_or_error.release_value(), ideal_size, mime_type, priority));
+    }
+    // One pool task per queued job; each task drains whatever job has the
+    // highest priority by the time it runs, so priorities still apply even
+    // though the shared pool itself is FIFO.
+    Threading::ThreadPool::the().enqueue([this, &main_event_loop = Core::EventLoop::current()] {
+        decode_next_queued_job(main_event_loop);
+    });
+}
+
+void ConnectionFromClient::cancel_decoding(i64 job_id)
+{
+    {
+        Threading::MutexLocker locker(m_queue_mutex);
+        bool was_queued = false;
+        for (size_t i = 0; i < m_queued_jobs.size(); ++i) {
+            if (m_queued_jobs[i].id == job_id) {
+                (void)m_queued_jobs.take(i);
+                was_queued = true;
+                break;
+            }
+        }
+        if (was_queued)
+            return;
+    }
+    // A worker already picked this job up; remember to drop its result.
+    m_cancelled_running_jobs.set(job_id);
+}
+
+OwnPtr<ConnectionFromClient::Job> ConnectionFromClient::take_highest_priority_job()
+{
+    // Callers must hold m_queue_mutex. Jobs with equal priority decode in
+    // submission order.
+    size_t best_index = 0;
+    for (size_t i = 1; i < m_queued_jobs.size(); ++i) {
+        if (m_queued_jobs[i].priority > m_queued_jobs[best_index].priority)
+            best_index = i;
+    }
+    return m_queued_jobs.take(best_index);
+}
+
+void ConnectionFromClient::decode_next_queued_job(Core::EventLoop& main_event_loop)
+{
+    OwnPtr<Job> job;
+    {
+        Threading::MutexLocker locker(m_queue_mutex);
+        // The job this task was enqueued for may have been cancelled since.
+        if (m_queued_jobs.is_empty())
+            return;
+        job = take_highest_priority_job();
+    }
+
+    bool is_animated = false;
+    u32 loop_count = 0;
+    Vector<Gfx::ShareableBitmap> bitmaps;
+    Vector<u32> durations;
+    decode_image_to_details(job->data, job->ideal_size, job->mime_type, is_animated, loop_count, bitmaps, durations);
+
+    main_event_loop.deferred_invoke([this, job_id = job->id, is_animated, loop_count, bitmaps = move(bitmaps), durations = move(durations)] {
+        if (m_cancelled_running_jobs.remove(job_id))
+            return;
+        async_did_decode_image(job_id, is_animated, loop_count, bitmaps, durations);
+    });
+    main_event_loop.wake();
+}
+
 }
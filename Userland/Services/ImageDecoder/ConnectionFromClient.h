@@ -6,11 +6,17 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/NonnullOwnPtrVector.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
+#include <LibCore/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibThreading/Mutex.h>
 
 namespace ImageDecoder {
 
@@ -26,7 +32,32 @@ public:
 private:
     explicit ConnectionFromClient(NonnullOwnPtr<Core::Stream::LocalSocket>);
 
-    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer const&, Optional<DeprecatedString> const& mime_type) override;
+    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer const&, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& mime_type) override;
+    virtual void enqueue_decoding(i64 job_id, Core::AnonymousBuffer const&, Optional<Gfx::IntSize> const& ideal_size, Optional<DeprecatedString> const& mime_type, i32 priority) override;
+    virtual void cancel_decoding(i64 job_id) override;
+
+    struct Job {
+        i64 id { 0 };
+        // A copy of the encoded data rather than the anonymous buffer itself:
+        // AnonymousBuffer's reference count is not atomic, so its handles must
+        // not be shared with the thread pool workers.
+        ByteBuffer data;
+        Optional<Gfx::IntSize> ideal_size;
+        Optional<DeprecatedString> mime_type;
+        i32 priority { 0 };
+    };
+
+    void decode_next_queued_job(Core::EventLoop& main_event_loop);
+    OwnPtr<Job> take_highest_priority_job();
+
+    // The queue is shared with the thread pool workers; everything else on
+    // this object is only ever touched from the main thread.
+    Threading::Mutex m_queue_mutex;
+    NonnullOwnPtrVector<Job> m_queued_jobs;
+
+    // Jobs that were cancelled after a worker had already picked them up;
+    // their results are dropped instead of being sent to the client.
+    HashTable<i64> m_cancelled_running_jobs;
 };
 
 }
@@ -26,6 +26,11 @@ namespace LookupServer {
 static LookupServer* s_the;
 // NOTE: This is the TTL we return for the hostname or answers from /etc/hosts.
 static constexpr u32 s_static_ttl = 86400;
+// NOTE: This is how long we remember that a lookup yielded no answers.
+//       We don't parse the authority section, so we can't honor the SOA
+//       minimum TTL here; a short fixed TTL keeps us from hammering the
+//       upstream nameservers with questions they just said no to.
+static constexpr u32 s_negative_ttl = 60;
 
 LookupServer& LookupServer::the()
 {
@@ -171,18 +176,38 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
 
     // Third, try our cache.
     if (auto cached_answers = m_lookup_cache.find(name); cached_answers != m_lookup_cache.end()) {
+        cached_answers->value.remove_all_matching([](Answer const& answer) { return answer.has_expired(); });
         for (auto& answer : cached_answers->value) {
-            // TODO: Actually remove expired answers from the cache.
-            if (answer.type() == record_type && !answer.has_expired()) {
+            if (answer.type() == record_type) {
                 dbgln_if(LOOKUPSERVER_DEBUG, "Cache hit: {} -> {}", name.as_string(), answer.record_data());
                 add_answer(answer);
             }
         }
+        if (cached_answers->value.is_empty())
+            m_lookup_cache.remove(cached_answers);
         if (!answers.is_empty())
             return answers;
     }
 
-    // Fourth, look up .local names using mDNS instead of DNS nameservers.
+    // Fourth, check if this lookup failed recently, and if so, don't ask the
+    // upstream nameservers a question they just answered with nothing.
+    if (auto cached_failures = m_failed_lookup_cache.find(name); cached_failures != m_failed_lookup_cache.end()) {
+        auto now = time(nullptr);
+        cached_failures->value.remove_all_matching([&](CachedFailure const& failure) { return failure.expiry <= now; });
+        bool has_cached_failure = false;
+        for (auto& failure : cached_failures->value) {
+            if (failure.type == record_type)
+                has_cached_failure = true;
+        }
+        if (cached_failures->value.is_empty())
+            m_failed_lookup_cache.remove(cached_failures);
+        if (has_cached_failure) {
+            dbgln_if(LOOKUPSERVER_DEBUG, "Negative cache hit: {}", name.as_string());
+            return Vector<Answer> {};
+        }
+    }
+
+    // Fifth, look up .local names using mDNS instead of DNS nameservers.
     if (name.as_string().ends_with(".local"sv)) {
         answers = TRY(m_mdns->lookup(name, record_type));
         for (auto& answer : answers)
@@ -190,14 +215,15 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
         return answers;
     }
 
-    // Fifth, ask the upstream nameservers.
+    // Sixth, ask the upstream nameservers.
+    bool was_negative_response = false;
     for (auto& nameserver : m_nameservers) {
         dbgln_if(LOOKUPSERVER_DEBUG, "Doing lookup using nameserver '{}'", nameserver);
         bool did_get_response = false;
         int retries = 3;
         Vector<Answer> upstream_answers;
         do {
-            auto upstream_answers_or_error = lookup(name, nameserver, did_get_response, record_type);
+            auto upstream_answers_or_error = lookup(name, nameserver, did_get_response, was_negative_response, record_type);
             if (upstream_answers_or_error.is_error())
                 continue;
             upstream_answers = upstream_answers_or_error.release_value();
@@ -216,16 +242,18 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, RecordType record
         }
     }
 
-    // Sixth, fail.
+    // Seventh, fail.
     if (answers.is_empty()) {
         dbgln("Tried all nameservers but never got a response :(");
+        if (was_negative_response)
+            put_in_negative_cache(name, record_type);
         return Vector<Answer> {};
     }
 
     return answers;
 }
 
-ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString const& nameserver, bool& did_get_response, RecordType record_type, ShouldRandomizeCase should_randomize_case)
+ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString const& nameserver, bool& did_get_response, bool& was_negative_response, RecordType record_type, ShouldRandomizeCase should_randomize_case)
 {
     Packet request;
     request.set_is_query();
@@ -263,11 +291,16 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString
     if (response.code() == Packet::Code::REFUSED) {
         if (should_randomize_case == ShouldRandomizeCase::Yes) {
             // Retry with 0x20 case randomization turned off.
-            return lookup(name, nameserver, did_get_response, record_type, ShouldRandomizeCase::No);
+            return lookup(name, nameserver, did_get_response, was_negative_response, record_type, ShouldRandomizeCase::No);
         }
         return Vector<Answer> {};
     }
 
+    if (response.code() == Packet::Code::NXDOMAIN) {
+        was_negative_response = true;
+        return Vector<Answer> {};
+    }
+
     if (response.question_count() != request.question_count()) {
         dbgln("LookupServer: Question count ({} vs {}) :(", response.question_count(), request.question_count());
         return Vector<Answer> {};
@@ -290,6 +323,8 @@ ErrorOr<Vector<Answer>> LookupServer::lookup(Name const& name, DeprecatedString
 
     if (response.answer_count() < 1) {
         dbgln("LookupServer: No answers :(");
+        if (response.code() == Packet::Code::NOERROR)
+            was_negative_response = true;
         return Vector<Answer> {};
     }
 
@@ -309,6 +344,13 @@ void LookupServer::put_in_cache(Answer const& answer)
     if (answer.has_expired())
         return;
 
+    // If we have a cached failure for this name and type, it's now stale.
+    if (auto cached_failures = m_failed_lookup_cache.find(answer.name()); cached_failures != m_failed_lookup_cache.end()) {
+        cached_failures->value.remove_all_matching([&](CachedFailure const& failure) { return failure.type == answer.type(); });
+        if (cached_failures->value.is_empty())
+            m_failed_lookup_cache.remove(cached_failures);
+    }
+
     // Prevent the cache from growing too big.
     // TODO: Evict least used entries.
     if (m_lookup_cache.size() >= 256)
@@ -336,4 +378,14 @@ void LookupServer::put_in_cache(Answer const& answer)
     }
 }
 
+void LookupServer::put_in_negative_cache(Name const& name, RecordType record_type)
+{
+    // Prevent the cache from growing too big.
+    if (m_failed_lookup_cache.size() >= 256)
+        m_failed_lookup_cache.remove(m_failed_lookup_cache.begin());
+
+    dbgln_if(LOOKUPSERVER_DEBUG, "Caching negative response for '{}' for {} seconds", name.as_string(), s_negative_ttl);
+    m_failed_lookup_cache.ensure(name).append({ record_type, time(nullptr) + s_negative_ttl });
+}
+
 }
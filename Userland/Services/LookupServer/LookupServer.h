@@ -31,8 +31,14 @@ private:
 
     void load_etc_hosts();
     void put_in_cache(Answer const&);
+    void put_in_negative_cache(Name const&, RecordType);
 
-    ErrorOr<Vector<Answer>> lookup(Name const& hostname, DeprecatedString const& nameserver, bool& did_get_response, RecordType record_type, ShouldRandomizeCase = ShouldRandomizeCase::Yes);
+    ErrorOr<Vector<Answer>> lookup(Name const& hostname, DeprecatedString const& nameserver, bool& did_get_response, bool& was_negative_response, RecordType record_type, ShouldRandomizeCase = ShouldRandomizeCase::Yes);
+
+    struct CachedFailure {
+        RecordType type;
+        time_t expiry;
+    };
 
     OwnPtr<IPC::MultiServer<ConnectionFromClient>> m_server;
     RefPtr<DNSServer> m_dns_server;
@@ -41,6 +47,7 @@ private:
     RefPtr<Core::FileWatcher> m_file_watcher;
     HashMap<Name, Vector<Answer>, Name::Traits> m_etc_hosts;
     HashMap<Name, Vector<Answer>, Name::Traits> m_lookup_cache;
+    HashMap<Name, Vector<CachedFailure>, Name::Traits> m_failed_lookup_cache;
 };
 
 }
@@ -37,6 +37,25 @@ void request_did_finish(URL const& url, Core::Stream::Socket const* socket)
         }
 
         auto& connection = *connection_it;
+        if (connection->request_queue.is_empty()) {
+            // We're now idle; take a queued job from the busiest connection to
+            // the same host, if any. Jobs get pinned to a connection when
+            // they're enqueued, so without this, a connection would sit idle
+            // while its siblings still have small requests stuck in line
+            // behind a slow download.
+            decltype(connection.ptr()) busiest_connection = nullptr;
+            size_t longest_queue_size = 0;
+            for (auto& other_connection : *it->value) {
+                if (&other_connection != connection.ptr() && other_connection.request_queue.size() > longest_queue_size) {
+                    busiest_connection = &other_connection;
+                    longest_queue_size = other_connection.request_queue.size();
+                }
+            }
+            if (busiest_connection) {
+                dbgln_if(REQUESTSERVER_DEBUG, "Stealing a queued job for {} from connection {}", url, busiest_connection);
+                connection->request_queue.append(busiest_connection->request_queue.take_first());
+            }
+        }
         if (connection->request_queue.is_empty()) {
             Core::deferred_invoke([&connection, &cache_entry = *it->value, key = it->key, &cache] {
                 connection->socket->set_notifications_enabled(false);
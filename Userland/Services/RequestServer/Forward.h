@@ -8,8 +8,11 @@
 
 namespace RequestServer {
 
+class CacheSink;
+class CachedRequest;
 class ConnectionFromClient;
 class Request;
+class ResponseCache;
 class GeminiProtocol;
 class HttpRequest;
 class HttpProtocol;
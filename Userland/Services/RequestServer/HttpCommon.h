@@ -17,6 +17,7 @@
 #include <RequestServer/ConnectionCache.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
+#include <RequestServer/ResponseCache.h>
 
 namespace RequestServer::Detail {
 
@@ -24,6 +25,10 @@ template<typename TSelf, typename TJob>
 void init(TSelf* self, TJob job)
 {
     job->on_headers_received = [self](auto& headers, auto response_code) {
+        // A 304 to our own conditional request is answered from the cache once
+        // the job finishes; the client never sees the 304 itself.
+        if (self->awaiting_cache_revalidation() && response_code.has_value() && response_code.value() == 304)
+            return;
         if (response_code.has_value())
             self->set_status_code(response_code.value());
         self->set_response_headers(headers);
@@ -34,9 +39,19 @@ void init(TSelf* self, TJob job)
             ConnectionCache::request_did_finish(url, socket);
         });
         if (auto* response = self->job().response()) {
+            if (success && self->awaiting_cache_revalidation() && response->code() == 304) {
+                ResponseCache::the().refresh(self->url(), response->headers());
+                if (!self->serve_cached_response(self->url())) {
+                    self->did_progress(self->downloaded_size(), self->downloaded_size());
+                    self->did_finish(false);
+                }
+                return;
+            }
             self->set_status_code(response->code());
             self->set_response_headers(response->headers());
             self->set_downloaded_size(response->downloaded_size());
+            if (success)
+                self->commit_to_cache(response->code(), response->headers());
         }
 
         // if we didn't know the total size, pretend that the request finished successfully
@@ -92,15 +107,43 @@ OwnPtr<Request> start_request(TBadgedProtocol&& protocol, ConnectionFromClient&
     request.set_url(url);
     request.set_headers(headers);
 
+    bool may_cache_response = ResponseCache::is_cacheable_request(method, url, headers, body);
+    bool awaiting_cache_revalidation = false;
+    if (may_cache_response) {
+        if (auto const* entry = ResponseCache::the().lookup(url)) {
+            if (entry->is_fresh()) {
+                auto output_stream = MUST(Core::Stream::File::adopt_fd(pipe_result.value().write_fd, Core::Stream::OpenMode::Write));
+                auto cached_request = CachedRequest::create(client, url, move(output_stream));
+                cached_request->set_request_fd(pipe_result.value().read_fd);
+                return cached_request;
+            }
+            if (entry->has_validators()) {
+                auto conditional_headers = headers;
+                if (!entry->etag.is_empty())
+                    conditional_headers.set("If-None-Match", entry->etag);
+                else
+                    conditional_headers.set("If-Modified-Since", entry->last_modified);
+                request.set_headers(conditional_headers);
+                awaiting_cache_revalidation = true;
+            }
+        }
+    }
+
     auto allocated_body_result = ByteBuffer::copy(body);
     if (allocated_body_result.is_error())
         return {};
     request.set_body(allocated_body_result.release_value());
 
     auto output_stream = MUST(Core::Stream::File::adopt_fd(pipe_result.value().write_fd, Core::Stream::OpenMode::Write));
-    auto job = TJob::construct(move(request), *output_stream);
+    OwnPtr<CacheSink> cache_sink;
+    if (may_cache_response)
+        cache_sink = make<CacheSink>(*output_stream, url);
+    auto job = TJob::construct(move(request), cache_sink ? static_cast<AK::Stream&>(*cache_sink) : *output_stream);
     auto protocol_request = TRequest::create_with_job(forward<TBadgedProtocol>(protocol), client, (TJob&)*job, move(output_stream));
     protocol_request->set_request_fd(pipe_result.value().read_fd);
+    protocol_request->set_cache_sink(move(cache_sink));
+    if (awaiting_cache_revalidation)
+        protocol_request->set_awaiting_cache_revalidation();
 
     if constexpr (IsSame<typename TBadgedProtocol::Type, HttpsProtocol>)
         ConnectionCache::get_or_create_connection(ConnectionCache::g_tls_connection_cache, url, *job, proxy_data);
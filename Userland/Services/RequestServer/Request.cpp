@@ -4,8 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/MappedFile.h>
+#include <LibCore/Stream.h>
+#include <LibCore/Timer.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
+#include <RequestServer/ResponseCache.h>
+#include <errno.h>
 
 namespace RequestServer {
 
@@ -19,6 +24,8 @@ Request::Request(ConnectionFromClient& client, NonnullOwnPtr<Core::Stream::File>
 {
 }
 
+Request::~Request() = default;
+
 void Request::stop()
 {
     m_client.did_finish_request({}, *this, false);
@@ -51,4 +58,69 @@ void Request::did_request_certificates()
     m_client.did_request_certificates({}, *this);
 }
 
+void Request::set_cache_sink(OwnPtr<CacheSink> cache_sink)
+{
+    m_cache_sink = move(cache_sink);
+}
+
+void Request::commit_to_cache(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers)
+{
+    if (m_cache_sink)
+        m_cache_sink->commit(status_code, response_headers);
+}
+
+bool Request::serve_cached_response(URL const& url)
+{
+    auto const* entry = ResponseCache::the().lookup(url);
+    if (!entry)
+        return false;
+
+    set_status_code(entry->status_code);
+
+    if (entry->body_size == 0) {
+        set_response_headers(entry->response_headers);
+        did_progress(0u, 0);
+        did_finish(true);
+        return true;
+    }
+
+    auto mapped_body = Core::MappedFile::map(entry->body_path);
+    if (mapped_body.is_error()) {
+        ResponseCache::the().remove(url);
+        return false;
+    }
+    m_cached_body = mapped_body.release_value();
+    set_response_headers(entry->response_headers);
+    write_some_cached_body();
+    return true;
+}
+
+void Request::write_some_cached_body()
+{
+    auto data = m_cached_body->bytes();
+    while (m_cached_body_written < data.size()) {
+        auto result = m_output_stream->write(data.slice(m_cached_body_written));
+        if (result.is_error()) {
+            if (result.error().is_errno() && result.error().code() == EAGAIN) {
+                // The pipe is full; try again once the client has drained some of it.
+                if (!m_cached_body_timer) {
+                    auto timer_or_error = Core::Timer::create_repeating(50, [this] { write_some_cached_body(); });
+                    if (timer_or_error.is_error())
+                        break;
+                    m_cached_body_timer = timer_or_error.release_value();
+                    m_cached_body_timer->start();
+                }
+                return;
+            }
+            break;
+        }
+        m_cached_body_written += result.value();
+    }
+    if (m_cached_body_timer)
+        m_cached_body_timer->stop();
+    bool success = m_cached_body_written == data.size();
+    did_progress(static_cast<u32>(data.size()), static_cast<u32>(m_cached_body_written));
+    did_finish(success);
+}
+
 }
@@ -9,15 +9,17 @@
 #include <AK/HashMap.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Optional.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/URL.h>
+#include <LibCore/Forward.h>
 #include <RequestServer/Forward.h>
 
 namespace RequestServer {
 
 class Request {
 public:
-    virtual ~Request() = default;
+    virtual ~Request();
 
     i32 id() const { return m_id; }
     virtual URL url() const = 0;
@@ -42,6 +44,14 @@ public:
     void set_downloaded_size(size_t size) { m_downloaded_size = size; }
     Core::Stream::File const& output_stream() const { return *m_output_stream; }
 
+    void set_cache_sink(OwnPtr<CacheSink>);
+    void commit_to_cache(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers);
+    void set_awaiting_cache_revalidation() { m_awaiting_cache_revalidation = true; }
+    bool awaiting_cache_revalidation() const { return m_awaiting_cache_revalidation; }
+    // Streams the cached response for the given URL (headers, then the mapped
+    // body) into the client pipe. Returns false if the cache cannot serve it.
+    bool serve_cached_response(URL const&);
+
 protected:
     explicit Request(ConnectionFromClient&, NonnullOwnPtr<Core::Stream::File>&&);
 
@@ -54,6 +64,14 @@ private:
     size_t m_downloaded_size { 0 };
     NonnullOwnPtr<Core::Stream::File> m_output_stream;
     HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> m_response_headers;
+
+    void write_some_cached_body();
+
+    OwnPtr<CacheSink> m_cache_sink;
+    bool m_awaiting_cache_revalidation { false };
+    RefPtr<Core::MappedFile> m_cached_body;
+    size_t m_cached_body_written { 0 };
+    RefPtr<Core::Timer> m_cached_body_timer;
 };
 
 }
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Hex.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/Stream.h>
+#include <LibCore/System.h>
+#include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/ResponseCache.h>
+#include <time.h>
+
+namespace RequestServer {
+
+struct CacheControlDirectives {
+    bool no_store { false };
+    bool no_cache { false };
+    bool is_private { false };
+    Optional<u64> max_age;
+};
+
+static CacheControlDirectives parse_cache_control(StringView value)
+{
+    CacheControlDirectives directives;
+    value.for_each_split_view(',', SplitBehavior::Nothing, [&](StringView directive) {
+        directive = directive.trim_whitespace();
+        if (directive.equals_ignoring_case("no-store"sv))
+            directives.no_store = true;
+        else if (directive.equals_ignoring_case("no-cache"sv))
+            directives.no_cache = true;
+        else if (directive.equals_ignoring_case("private"sv))
+            directives.is_private = true;
+        else if (directive.starts_with("max-age="sv, CaseSensitivity::CaseInsensitive))
+            directives.max_age = directive.substring_view("max-age="sv.length()).to_uint<u64>();
+    });
+    return directives;
+}
+
+// Entries are named by the SHA-256 of the serialized URL, so distinct URLs
+// can never end up sharing their on-disk files; the URL recorded in the
+// metadata additionally makes sure a damaged entry is dropped at startup.
+static DeprecatedString file_path_for_url(URL const& url, StringView suffix)
+{
+    auto digest = Crypto::Hash::SHA256::hash(url.serialize());
+    return DeprecatedString::formatted("{}/{}{}", ResponseCache::directory_path, encode_hex(digest.bytes()), suffix);
+}
+
+static ErrorOr<ResponseCache::Entry> load_entry(DeprecatedString const& metadata_path)
+{
+    auto file = TRY(Core::Stream::File::open(metadata_path, Core::Stream::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+    auto json = TRY(JsonValue::from_string(contents));
+    if (!json.is_object())
+        return Error::from_string_literal("Metadata is not a JSON object");
+    auto const& object = json.as_object();
+
+    ResponseCache::Entry entry;
+    auto url = object.get_deprecated_string("url"sv);
+    auto headers = object.get_object("headers"sv);
+    if (!url.has_value() || !headers.has_value())
+        return Error::from_string_literal("Metadata is missing the URL or headers");
+    entry.url = url.release_value();
+    entry.status_code = object.get_u32("status_code"sv).value_or(0);
+    entry.stored_time = static_cast<time_t>(object.get_i64("stored_time"sv).value_or(0));
+    entry.freshness_lifetime = object.get_u64("freshness_lifetime"sv).value_or(0);
+    entry.body_size = object.get_u64("body_size"sv).value_or(0);
+    headers->for_each_member([&](auto const& key, JsonValue const& value) {
+        entry.response_headers.set(key, value.to_deprecated_string());
+    });
+    entry.etag = entry.response_headers.get("ETag"sv).value_or({});
+    entry.last_modified = entry.response_headers.get("Last-Modified"sv).value_or({});
+    entry.body_path = DeprecatedString::formatted("{}.body", metadata_path.substring_view(0, metadata_path.length() - ".meta"sv.length()));
+    if (entry.status_code == 0)
+        return Error::from_string_literal("Metadata has no status code");
+
+    auto stat = TRY(Core::System::stat(entry.body_path));
+    if (static_cast<size_t>(stat.st_size) != entry.body_size)
+        return Error::from_string_literal("Body size on disk does not match the metadata");
+
+    return entry;
+}
+
+ResponseCache& ResponseCache::the()
+{
+    static ResponseCache s_the;
+    return s_the;
+}
+
+ResponseCache::ResponseCache()
+{
+    if (auto result = Core::System::mkdir(directory_path, 0700); result.is_error() && result.error().code() != EEXIST) {
+        dbgln("ResponseCache: Cannot create {}, caching is disabled: {}", directory_path, result.error());
+        return;
+    }
+    m_enabled = true;
+
+    Core::DirIterator iterator(directory_path, Core::DirIterator::SkipParentAndBaseDir);
+    while (iterator.has_next()) {
+        auto path = iterator.next_full_path();
+        if (!path.ends_with(".meta"sv))
+            continue;
+        auto entry_or_error = load_entry(path);
+        if (entry_or_error.is_error()) {
+            (void)Core::System::unlink(path);
+            continue;
+        }
+        auto entry = entry_or_error.release_value();
+        m_index.set(entry.url, move(entry));
+    }
+}
+
+bool ResponseCache::Entry::is_fresh() const
+{
+    return time(nullptr) < stored_time + static_cast<time_t>(freshness_lifetime);
+}
+
+bool ResponseCache::is_cacheable_request(DeprecatedString const& method, URL const& url, HashMap<DeprecatedString, DeprecatedString> const& request_headers, ReadonlyBytes request_body)
+{
+    if (!method.equals_ignoring_case("get"sv) || !request_body.is_empty())
+        return false;
+    if (url.scheme() != "http" && url.scheme() != "https")
+        return false;
+    // Pass client-driven conditional and authenticated requests through untouched.
+    if (request_headers.contains("If-None-Match") || request_headers.contains("If-Modified-Since") || request_headers.contains("Authorization"))
+        return false;
+    if (auto cache_control = request_headers.get("Cache-Control"); cache_control.has_value()) {
+        auto directives = parse_cache_control(*cache_control);
+        if (directives.no_store || directives.no_cache)
+            return false;
+    }
+    return true;
+}
+
+ResponseCache::Entry const* ResponseCache::lookup(URL const& url)
+{
+    if (!m_enabled)
+        return nullptr;
+    auto it = m_index.find(url.serialize());
+    if (it == m_index.end())
+        return nullptr;
+    return &it->value;
+}
+
+void ResponseCache::store(URL const& url, u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, ReadonlyBytes body)
+{
+    if (!m_enabled || status_code != 200 || body.size() > maximum_body_size)
+        return;
+    // FIXME: Support Vary by storing one entry per seen request header combination.
+    if (response_headers.contains("Vary"))
+        return;
+
+    Optional<u64> freshness_lifetime;
+    if (auto cache_control = response_headers.get("Cache-Control"); cache_control.has_value()) {
+        auto directives = parse_cache_control(*cache_control);
+        if (directives.no_store || directives.is_private)
+            return;
+        if (!directives.no_cache)
+            freshness_lifetime = directives.max_age;
+    }
+
+    Entry entry;
+    entry.url = url.serialize();
+    entry.status_code = status_code;
+    entry.stored_time = time(nullptr);
+    entry.freshness_lifetime = freshness_lifetime.value_or(0);
+    entry.etag = response_headers.get("ETag"sv).value_or({});
+    entry.last_modified = response_headers.get("Last-Modified"sv).value_or({});
+    entry.response_headers = response_headers;
+    entry.body_path = file_path_for_url(url, ".body"sv);
+    entry.body_size = body.size();
+
+    // An entry that is never fresh and cannot be revalidated would always be refetched.
+    if (entry.freshness_lifetime == 0 && !entry.has_validators())
+        return;
+
+    while (m_index.size() >= maximum_entry_count)
+        evict_one_entry();
+
+    auto temporary_path = DeprecatedString::formatted("{}.tmp", entry.body_path);
+    {
+        auto file = Core::Stream::File::open(temporary_path, Core::Stream::OpenMode::Write);
+        if (file.is_error())
+            return;
+        if (file.value()->write_entire_buffer(body).is_error()) {
+            (void)Core::System::unlink(temporary_path);
+            return;
+        }
+    }
+    if (Core::System::rename(temporary_path, entry.body_path).is_error()) {
+        (void)Core::System::unlink(temporary_path);
+        return;
+    }
+    if (write_metadata(entry).is_error()) {
+        (void)Core::System::unlink(entry.body_path);
+        return;
+    }
+    m_index.set(entry.url, move(entry));
+}
+
+void ResponseCache::refresh(URL const& url, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& fresh_response_headers)
+{
+    auto it = m_index.find(url.serialize());
+    if (it == m_index.end())
+        return;
+    auto& entry = it->value;
+    for (auto const& header : fresh_response_headers)
+        entry.response_headers.set(header.key, header.value);
+    entry.etag = entry.response_headers.get("ETag"sv).value_or({});
+    entry.last_modified = entry.response_headers.get("Last-Modified"sv).value_or({});
+    entry.stored_time = time(nullptr);
+    if (auto cache_control = entry.response_headers.get("Cache-Control"); cache_control.has_value()) {
+        auto directives = parse_cache_control(*cache_control);
+        if (!directives.no_cache && directives.max_age.has_value())
+            entry.freshness_lifetime = directives.max_age.value();
+    }
+    (void)write_metadata(entry);
+}
+
+void ResponseCache::remove(URL const& url)
+{
+    auto it = m_index.find(url.serialize());
+    if (it == m_index.end())
+        return;
+    (void)Core::System::unlink(it->value.body_path);
+    (void)Core::System::unlink(file_path_for_url(url, ".meta"sv));
+    m_index.remove(it);
+}
+
+void ResponseCache::evict_one_entry()
+{
+    auto oldest = m_index.begin();
+    for (auto it = m_index.begin(); it != m_index.end(); ++it) {
+        if (it->value.stored_time < oldest->value.stored_time)
+            oldest = it;
+    }
+    if (oldest != m_index.end())
+        remove(URL(oldest->value.url));
+}
+
+ErrorOr<void> ResponseCache::write_metadata(Entry const& entry) const
+{
+    JsonObject headers_object;
+    for (auto const& header : entry.response_headers)
+        headers_object.set(header.key, header.value);
+
+    JsonObject object;
+    object.set("url", entry.url);
+    object.set("status_code", entry.status_code);
+    object.set("stored_time", static_cast<i64>(entry.stored_time));
+    object.set("freshness_lifetime", entry.freshness_lifetime);
+    object.set("body_size", entry.body_size);
+    object.set("headers", move(headers_object));
+
+    auto metadata_path = file_path_for_url(URL(entry.url), ".meta"sv);
+    auto temporary_path = DeprecatedString::formatted("{}.tmp", metadata_path);
+    auto file = TRY(Core::Stream::File::open(temporary_path, Core::Stream::OpenMode::Write));
+    TRY(file->write_entire_buffer(object.to_deprecated_string().bytes()));
+    TRY(Core::System::rename(temporary_path, metadata_path));
+    return {};
+}
+
+ErrorOr<size_t> CacheSink::write(ReadonlyBytes bytes)
+{
+    auto nwritten = TRY(m_pipe_stream.write(bytes));
+    if (!m_overflowed) {
+        if (m_body.size() + nwritten > ResponseCache::maximum_body_size || m_body.try_append(bytes.data(), nwritten).is_error()) {
+            m_overflowed = true;
+            m_body.clear();
+        }
+    }
+    return nwritten;
+}
+
+void CacheSink::commit(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers)
+{
+    if (m_overflowed)
+        return;
+    ResponseCache::the().store(m_url, status_code, response_headers, m_body);
+}
+
+NonnullOwnPtr<CachedRequest> CachedRequest::create(ConnectionFromClient& client, URL const& url, NonnullOwnPtr<Core::Stream::File>&& output_stream)
+{
+    return adopt_own(*new CachedRequest(client, url, move(output_stream)));
+}
+
+CachedRequest::CachedRequest(ConnectionFromClient& client, URL const& url, NonnullOwnPtr<Core::Stream::File>&& output_stream)
+    : Request(client, move(output_stream))
+    , m_url(url)
+{
+    // Serve only after the StartRequest response has gone out; the client
+    // cannot start draining the pipe before then.
+    Core::deferred_invoke([this] {
+        if (!serve_cached_response(m_url)) {
+            did_progress(0u, 0);
+            did_finish(false);
+        }
+    });
+}
+
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2023, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/DeprecatedString.h>
+#include <AK/HashMap.h>
+#include <AK/Stream.h>
+#include <AK/URL.h>
+#include <RequestServer/Request.h>
+#include <errno.h>
+
+namespace RequestServer {
+
+// A small RFC 9111-style cache for successful GET responses. Every entry is a
+// pair of files under /tmp/RequestServer-Cache: a JSON metadata file and the
+// raw body, which is mapped into memory when it is served. An index over the
+// metadata is kept in memory and rebuilt from disk on startup.
+class ResponseCache {
+public:
+    static constexpr auto directory_path = "/tmp/RequestServer-Cache"sv;
+    static constexpr size_t maximum_body_size = 2 * MiB;
+    static constexpr size_t maximum_entry_count = 64;
+
+    static ResponseCache& the();
+
+    struct Entry {
+        DeprecatedString url;
+        u32 status_code { 0 };
+        time_t stored_time { 0 };
+        u64 freshness_lifetime { 0 }; // Seconds.
+        DeprecatedString etag;
+        DeprecatedString last_modified;
+        HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> response_headers;
+        DeprecatedString body_path;
+        size_t body_size { 0 };
+
+        bool is_fresh() const;
+        bool has_validators() const { return !etag.is_empty() || !last_modified.is_empty(); }
+    };
+
+    static bool is_cacheable_request(DeprecatedString const& method, URL const&, HashMap<DeprecatedString, DeprecatedString> const& request_headers, ReadonlyBytes request_body);
+
+    Entry const* lookup(URL const&);
+    void store(URL const&, u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers, ReadonlyBytes body);
+    // Folds the headers of a 304 (Not Modified) response into a stored entry
+    // and restarts its freshness lifetime.
+    void refresh(URL const&, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& fresh_response_headers);
+    void remove(URL const&);
+
+private:
+    ResponseCache();
+
+    ErrorOr<void> write_metadata(Entry const&) const;
+    void evict_one_entry();
+
+    bool m_enabled { false };
+    HashMap<DeprecatedString, Entry> m_index;
+};
+
+// Tees everything the download job writes to the client pipe into a memory
+// buffer, so the response can be filed with the cache once it has finished.
+class CacheSink final : public AK::Stream {
+public:
+    CacheSink(AK::Stream& pipe_stream, URL url)
+        : m_pipe_stream(pipe_stream)
+        , m_url(move(url))
+    {
+    }
+
+    void commit(u32 status_code, HashMap<DeprecatedString, DeprecatedString, CaseInsensitiveStringTraits> const& response_headers);
+
+    virtual ErrorOr<Bytes> read(Bytes) override { return Error::from_errno(EBADF); }
+    virtual ErrorOr<size_t> write(ReadonlyBytes) override;
+    virtual bool is_eof() const override { return false; }
+    virtual bool is_open() const override { return m_pipe_stream.is_open(); }
+    virtual void close() override { m_pipe_stream.close(); }
+
+private:
+    AK::Stream& m_pipe_stream;
+    URL m_url;
+    ByteBuffer m_body;
+    bool m_overflowed { false };
+};
+
+// Stands in for a protocol download when a fresh cache entry can be served
+// without going to the network at all.
+class CachedRequest final : public Request {
+public:
+    static NonnullOwnPtr<CachedRequest> create(ConnectionFromClient&, URL const&, NonnullOwnPtr<Core::Stream::File>&& output_stream);
+
+    virtual URL url() const override { return m_url; }
+
+private:
+    CachedRequest(ConnectionFromClient&, URL const&, NonnullOwnPtr<Core::Stream::File>&&);
+
+    URL m_url;
+};
+
+}
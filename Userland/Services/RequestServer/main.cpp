@@ -15,6 +15,7 @@
 #include <RequestServer/GeminiProtocol.h>
 #include <RequestServer/HttpProtocol.h>
 #include <RequestServer/HttpsProtocol.h>
+#include <RequestServer/ResponseCache.h>
 #include <signal.h>
 
 ErrorOr<int> serenity_main(Main::Arguments)
@@ -22,7 +23,7 @@ ErrorOr<int> serenity_main(Main::Arguments)
     if constexpr (TLS_SSL_KEYLOG_DEBUG)
         TRY(Core::System::pledge("stdio inet accept unix cpath wpath rpath sendfd recvfd sigaction"));
     else
-        TRY(Core::System::pledge("stdio inet accept unix rpath sendfd recvfd sigaction"));
+        TRY(Core::System::pledge("stdio inet accept unix cpath wpath rpath sendfd recvfd sigaction"));
 
 #ifdef SIGINFO
     signal(SIGINFO, [](int) { RequestServer::ConnectionCache::dump_jobs(); });
@@ -31,7 +32,7 @@ ErrorOr<int> serenity_main(Main::Arguments)
     if constexpr (TLS_SSL_KEYLOG_DEBUG)
         TRY(Core::System::pledge("stdio inet accept unix cpath wpath rpath sendfd recvfd"));
     else
-        TRY(Core::System::pledge("stdio inet accept unix rpath sendfd recvfd"));
+        TRY(Core::System::pledge("stdio inet accept unix cpath wpath rpath sendfd recvfd"));
 
     // Ensure the certificates are read out here.
     [[maybe_unused]] auto& certs = DefaultRootCACertificates::the();
@@ -40,6 +41,8 @@ ErrorOr<int> serenity_main(Main::Arguments)
     // FIXME: Establish a connection to LookupServer and then drop "unix"?
     TRY(Core::System::unveil("/tmp/portal/lookup", "rw"));
     TRY(Core::System::unveil("/etc/timezone", "r"));
+    (void)Core::System::mkdir(RequestServer::ResponseCache::directory_path, 0700);
+    TRY(Core::System::unveil(RequestServer::ResponseCache::directory_path, "rwc"sv));
     if constexpr (TLS_SSL_KEYLOG_DEBUG)
         TRY(Core::System::unveil("/home/anon", "rwc"));
     TRY(Core::System::unveil(nullptr, nullptr));
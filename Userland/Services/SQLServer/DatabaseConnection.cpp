@@ -68,7 +68,20 @@ SQL::ResultOr<SQL::StatementID> DatabaseConnection::prepare_statement(StringView
 {
     dbgln_if(SQLSERVER_DEBUG, "DatabaseConnection::prepare_statement(connection_id {}, database '{}', sql '{}'", connection_id(), m_database_name, sql);
 
-    auto statement = TRY(SQLStatement::create(*this, sql));
+    // Clients tend to prepare the same statement text over and over (with
+    // different placeholder values); hand back the already-parsed statement
+    // in that case. We deliberately only strip surrounding whitespace, since
+    // anything smarter would have to understand string literals.
+    auto normalized_sql = DeprecatedString(sql.trim_whitespace());
+    if (auto cached_id = m_prepared_statements.get(normalized_sql); cached_id.has_value()) {
+        // The statement may have been discarded after an execution error.
+        if (SQLStatement::statement_for(*cached_id))
+            return *cached_id;
+        m_prepared_statements.remove(normalized_sql);
+    }
+
+    auto statement = TRY(SQLStatement::create(*this, normalized_sql));
+    m_prepared_statements.set(move(normalized_sql), statement->statement_id());
     return statement->statement_id();
 }
 
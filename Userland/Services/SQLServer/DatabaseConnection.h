@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <LibCore/Object.h>
 #include <LibSQL/Database.h>
@@ -37,6 +38,9 @@ private:
     DeprecatedString m_database_name;
     SQL::ConnectionID m_connection_id { 0 };
     int m_client_id { 0 };
+    // Statement IDs for already-parsed statement text, so repeated
+    // preparations of the same query reuse the parsed AST.
+    HashMap<DeprecatedString, SQL::StatementID> m_prepared_statements;
 };
 
 }
@@ -131,8 +131,18 @@ void SQLStatement::next(SQL::ExecutionID execution_id, SQL::ResultSet result, si
     }
 
     if (!result.is_empty()) {
-        auto result_row = result.take_first();
-        client_connection->async_next_result(statement_id(), execution_id, result_row.row.take_data());
+        // Ship rows in batches; one IPC message per row makes large result
+        // sets mostly round-trip overhead.
+        static constexpr size_t max_rows_per_batch = 64;
+
+        auto batch_size = min(max_rows_per_batch, result.size());
+        Vector<Vector<SQL::Value>> rows;
+        rows.ensure_capacity(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            auto result_row = result.take_first();
+            rows.unchecked_append(result_row.row.take_data());
+        }
+        client_connection->async_next_results(statement_id(), execution_id, move(rows));
 
         deferred_invoke([this, execution_id, result = move(result), result_size]() mutable {
             next(execution_id, move(result), result_size);
@@ -130,6 +130,7 @@ ErrorOr<void> Service::spawn(int socket_fd)
 
     dbgln_if(SERVICE_DEBUG, "Spawning {}", name());
 
+    m_last_spawn_time = Time::now_monotonic();
     m_run_timer.start();
     pid_t pid = TRY(Core::System::fork());
 
@@ -298,6 +299,9 @@ Service::Service(Core::ConfigFile const& config, StringView name)
 
     m_working_directory = config.read_entry(name, "WorkingDirectory");
     m_environment = config.read_entry(name, "Environment");
+    auto startup_dependencies = config.read_entry(name, "After");
+    if (!startup_dependencies.is_null())
+        m_startup_dependencies = startup_dependencies.split(',');
     m_system_modes = config.read_entry(name, "SystemModes", "graphical").split(',');
     m_multi_instance = config.read_bool_entry(name, "MultiInstance");
     m_accept_socket_connections = config.read_bool_entry(name, "AcceptSocketConnections");
@@ -394,6 +398,11 @@ void Service::save_to(JsonObject& json)
 
     json.set("restart_attempts", m_restart_attempts);
     json.set("working_directory", m_working_directory);
+
+    // Monotonic timestamp of the last spawn, so boot profiling can
+    // reconstruct the launch sequence.
+    if (!m_last_spawn_time.is_zero())
+        json.set("last_spawn_time_ms", m_last_spawn_time.to_milliseconds());
 }
 
 bool Service::is_enabled() const
@@ -8,6 +8,7 @@
 
 #include <AK/DeprecatedString.h>
 #include <AK/RefPtr.h>
+#include <AK/Time.h>
 #include <LibCore/Account.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/Notifier.h>
@@ -24,6 +25,9 @@ public:
     ErrorOr<void> activate();
     ErrorOr<void> did_exit(int exit_code);
 
+    // Names of services that have to be activated before this one.
+    Vector<DeprecatedString> const& startup_dependencies() const { return m_startup_dependencies; }
+
     static Service* find_by_pid(pid_t);
 
     // FIXME: Port to Core::Property
@@ -74,6 +78,8 @@ private:
     DeprecatedString m_environment;
     // Socket descriptors for this service.
     Vector<SocketDescriptor> m_sockets;
+    // Services that have to be activated before this one (the "After" config key).
+    Vector<DeprecatedString> m_startup_dependencies;
 
     // The resolved user account to run this service as.
     Optional<Core::Account> m_account;
@@ -84,6 +90,8 @@ private:
 
     // Timer since we last spawned the service.
     Core::ElapsedTimer m_run_timer;
+    // Monotonic timestamp of the last spawn, for boot profiling.
+    Time m_last_spawn_time {};
     // How many times we have tried to restart this service, only counting those
     // times where it has exited unsuccessfully and too quickly.
     int m_restart_attempts { 0 };
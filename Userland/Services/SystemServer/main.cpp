@@ -9,11 +9,14 @@
 #include <AK/Assertions.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Debug.h>
+#include <AK/Function.h>
+#include <AK/HashTable.h>
 #include <AK/String.h>
 #include <Kernel/API/DeviceEvent.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
 #include <LibCore/DirIterator.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/Event.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
@@ -542,11 +545,40 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     }
 
     // After we've set them all up, activate them!
+    // Activation doesn't wait for a service to finish starting (spawns run
+    // concurrently, and all sockets are already bound above, so dependents'
+    // connect()s simply queue until their provider accepts). An "After="
+    // entry holds a service back until the named services have at least been
+    // activated, for the rare case that needs a provider process running.
     dbgln("Activating {} services...", g_services.size());
-    for (auto& service : g_services) {
+    auto activation_timer = Core::ElapsedTimer::start_new();
+    HashTable<Service*> activated_services;
+    Function<void(Service&)> activate_service = [&](Service& service) {
+        if (activated_services.contains(&service))
+            return;
+        // Mark before recursing so a dependency cycle degrades into config
+        // order instead of looping forever.
+        activated_services.set(&service);
+        for (auto const& dependency_name : service.startup_dependencies()) {
+            Service* dependency = nullptr;
+            for (auto& entry : g_services) {
+                if (entry.name() == dependency_name) {
+                    dependency = &entry;
+                    break;
+                }
+            }
+            if (!dependency) {
+                dbgln("{}: unknown service \"{}\" in After=", service.name(), dependency_name);
+                continue;
+            }
+            activate_service(*dependency);
+        }
         if (auto result = service.activate(); result.is_error())
             dbgln("{}: {}", service.name(), result.release_error());
-    }
+    };
+    for (auto& service : g_services)
+        activate_service(service);
+    dbgln("Activated {} services in {} ms", g_services.size(), activation_timer.elapsed_time().to_milliseconds());
 
     return event_loop.exec();
 }
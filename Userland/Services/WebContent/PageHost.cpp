@@ -36,6 +36,7 @@ PageHost::~PageHost() = default;
 void PageHost::set_has_focus(bool has_focus)
 {
     m_has_focus = has_focus;
+    m_last_painted_bitmap_is_valid = false;
 }
 
 void PageHost::setup_palette()
@@ -63,6 +64,7 @@ Gfx::Palette PageHost::palette() const
 void PageHost::set_palette_impl(Gfx::PaletteImpl const& impl)
 {
     m_palette_impl = impl;
+    m_last_painted_bitmap_is_valid = false;
     if (auto* document = page().top_level_browsing_context().active_document())
         document->invalidate_style();
 }
@@ -70,6 +72,7 @@ void PageHost::set_palette_impl(Gfx::PaletteImpl const& impl)
 void PageHost::set_preferred_color_scheme(Web::CSS::PreferredColorScheme color_scheme)
 {
     m_preferred_color_scheme = color_scheme;
+    m_last_painted_bitmap_is_valid = false;
     if (auto* document = page().top_level_browsing_context().active_document())
         document->invalidate_style();
 }
@@ -104,6 +107,31 @@ Web::Layout::InitialContainingBlock* PageHost::layout_root()
     return document->layout_node();
 }
 
+static bool layout_tree_has_viewport_anchored_content(Web::Layout::Node& layout_root)
+{
+    // Fixed and sticky boxes, as well as fixed background attachments, paint
+    // relative to the viewport rather than the content, so a frame containing
+    // them cannot simply be shifted when the viewport scrolls.
+    bool has_viewport_anchored_content = false;
+    layout_root.for_each_in_inclusive_subtree([&](auto& node) {
+        if (!node.has_style())
+            return IterationDecision::Continue;
+        auto position = node.computed_values().position();
+        if (position == Web::CSS::Position::Fixed || position == Web::CSS::Position::Sticky) {
+            has_viewport_anchored_content = true;
+            return IterationDecision::Break;
+        }
+        for (auto const& layer : node.computed_values().background_layers()) {
+            if (layer.attachment == Web::CSS::BackgroundAttachment::Fixed) {
+                has_viewport_anchored_content = true;
+                return IterationDecision::Break;
+            }
+        }
+        return IterationDecision::Continue;
+    });
+    return has_viewport_anchored_content;
+}
+
 void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& target)
 {
     Gfx::Painter painter(target);
@@ -114,6 +142,7 @@ void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& targ
 
     auto* layout_root = this->layout_root();
     if (!layout_root) {
+        m_last_painted_bitmap_is_valid = false;
         painter.fill_rect(bitmap_rect, palette().base());
         return;
     }
@@ -122,7 +151,50 @@ void PageHost::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& targ
     context.set_should_show_line_box_borders(m_should_show_line_box_borders);
     context.set_device_viewport_rect(content_rect);
     context.set_has_focus(m_has_focus);
-    layout_root->paint_all_phases(context);
+
+    if (can_reuse_last_paint_for_scrolling(content_rect, target) && !layout_tree_has_viewport_anchored_content(*layout_root)) {
+        // Nothing was invalidated since the last paint, so the previous frame is
+        // still a correct rendering of the content; shift the part of it that is
+        // still visible into place and repaint only the strips the scroll exposed.
+        auto scroll_delta = (m_last_painted_rect.location() - content_rect.location()).to_type<int>();
+        auto reusable_rect = bitmap_rect.translated(scroll_delta).intersected(bitmap_rect);
+        painter.blit(reusable_rect.location(), *m_last_painted_bitmap, reusable_rect.translated(-scroll_delta));
+        for (auto const& exposed_rect : bitmap_rect.shatter(reusable_rect)) {
+            Gfx::PainterStateSaver saver(painter);
+            painter.add_clip_rect(exposed_rect);
+            layout_root->paint_all_phases(context);
+        }
+    } else {
+        layout_root->paint_all_phases(context);
+    }
+
+    update_paint_reuse_cache(content_rect, target);
+}
+
+bool PageHost::can_reuse_last_paint_for_scrolling(Web::DevicePixelRect const& content_rect, Gfx::Bitmap const& target) const
+{
+    return m_last_painted_bitmap_is_valid
+        && m_last_painted_bitmap
+        && m_last_painted_bitmap->size() == target.size()
+        && m_last_painted_rect.size() == content_rect.size();
+}
+
+void PageHost::update_paint_reuse_cache(Web::DevicePixelRect const& content_rect, Gfx::Bitmap const& target)
+{
+    if (!m_last_painted_bitmap || m_last_painted_bitmap->size() != target.size()) {
+        auto bitmap_or_error = target.clone();
+        if (bitmap_or_error.is_error()) {
+            m_last_painted_bitmap = nullptr;
+            m_last_painted_bitmap_is_valid = false;
+            return;
+        }
+        m_last_painted_bitmap = bitmap_or_error.release_value();
+    } else {
+        Gfx::Painter cache_painter(*m_last_painted_bitmap);
+        cache_painter.blit({}, target, target.rect());
+    }
+    m_last_painted_rect = content_rect;
+    m_last_painted_bitmap_is_valid = true;
 }
 
 void PageHost::set_viewport_rect(Web::DevicePixelRect const& rect)
@@ -132,6 +204,7 @@ void PageHost::set_viewport_rect(Web::DevicePixelRect const& rect)
 
 void PageHost::page_did_invalidate(Web::CSSPixelRect const& content_rect)
 {
+    m_last_painted_bitmap_is_valid = false;
     m_invalidation_rect = m_invalidation_rect.united(page().enclosing_device_rect(content_rect));
     if (!m_invalidation_coalescing_timer->is_active())
         m_invalidation_coalescing_timer->start();
@@ -139,6 +212,7 @@ void PageHost::page_did_invalidate(Web::CSSPixelRect const& content_rect)
 
 void PageHost::page_did_change_selection()
 {
+    m_last_painted_bitmap_is_valid = false;
     m_client.async_did_change_selection();
 }
 
@@ -149,6 +223,7 @@ void PageHost::page_did_request_cursor_change(Gfx::StandardCursor cursor)
 
 void PageHost::page_did_layout()
 {
+    m_last_painted_bitmap_is_valid = false;
     auto* layout_root = this->layout_root();
     VERIFY(layout_root);
     if (layout_root->paint_box()->has_overflow())
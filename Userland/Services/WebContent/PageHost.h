@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <LibGfx/Bitmap.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/PixelUnits.h>
@@ -34,7 +35,11 @@ public:
     void set_screen_rects(Vector<Gfx::IntRect, 4> const& rects, size_t main_screen_index) { m_screen_rect = rects[main_screen_index].to_type<Web::DevicePixels>(); }
     void set_device_pixels_per_css_pixel(float device_pixels_per_css_pixel) { m_device_pixels_per_css_pixel = device_pixels_per_css_pixel; }
     void set_preferred_color_scheme(Web::CSS::PreferredColorScheme);
-    void set_should_show_line_box_borders(bool b) { m_should_show_line_box_borders = b; }
+    void set_should_show_line_box_borders(bool b)
+    {
+        m_should_show_line_box_borders = b;
+        m_last_painted_bitmap_is_valid = false;
+    }
     void set_has_focus(bool);
     void set_is_scripting_enabled(bool);
     void set_window_position(Web::DevicePixelPoint);
@@ -104,6 +109,9 @@ private:
     Web::Layout::InitialContainingBlock* layout_root();
     void setup_palette();
 
+    bool can_reuse_last_paint_for_scrolling(Web::DevicePixelRect const& content_rect, Gfx::Bitmap const& target) const;
+    void update_paint_reuse_cache(Web::DevicePixelRect const& content_rect, Gfx::Bitmap const& target);
+
     ConnectionFromClient& m_client;
     NonnullOwnPtr<Web::Page> m_page;
     RefPtr<Gfx::PaletteImpl> m_palette_impl;
@@ -115,6 +123,12 @@ private:
 
     RefPtr<Web::Platform::Timer> m_invalidation_coalescing_timer;
     Web::DevicePixelRect m_invalidation_rect;
+
+    // A copy of the last painted frame, used to repaint only newly exposed
+    // strips when the viewport merely scrolled since then.
+    RefPtr<Gfx::Bitmap> m_last_painted_bitmap;
+    Web::DevicePixelRect m_last_painted_rect;
+    bool m_last_painted_bitmap_is_valid { false };
     Web::CSS::PreferredColorScheme m_preferred_color_scheme { Web::CSS::PreferredColorScheme::Auto };
 
     RefPtr<WebDriverConnection> m_webdriver;
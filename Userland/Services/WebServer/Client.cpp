@@ -18,11 +18,13 @@
 #include <LibCore/File.h>
 #include <LibCore/MappedFile.h>
 #include <LibCore/MimeData.h>
+#include <LibCore/System.h>
 #include <LibHTTP/HttpRequest.h>
 #include <LibHTTP/HttpResponse.h>
 #include <WebServer/Client.h>
 #include <WebServer/Configuration.h>
 #include <stdio.h>
+#include <sys/sendfile.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
@@ -43,8 +45,6 @@ void Client::die()
 void Client::start()
 {
     m_socket->on_ready_to_read = [this] {
-        StringBuilder builder;
-
         auto maybe_buffer = ByteBuffer::create_uninitialized(m_socket->buffer_size());
         if (maybe_buffer.is_error()) {
             warnln("Could not create buffer for client: {}", maybe_buffer.error());
@@ -76,22 +76,80 @@ void Client::start()
                 break;
             }
 
-            builder.append(StringView { maybe_bytes_read.value() });
-            builder.append("\r\n"sv);
-        }
+            auto line = StringView { maybe_bytes_read.value() };
+            if (!line.is_empty()) {
+                m_pending_request.append(line);
+                m_pending_request.append("\r\n"sv);
+                continue;
+            }
 
-        auto request = builder.to_byte_buffer();
-        dbgln_if(WEBSERVER_DEBUG, "Got raw request: '{}'", DeprecatedString::copy(request));
+            // An empty line ends the request headers; since we only serve GET
+            // there is no body to wait for. Any further lines in the buffer
+            // belong to the next pipelined request.
+            m_pending_request.append("\r\n"sv);
+            auto request = m_pending_request.to_byte_buffer();
+            m_pending_request.clear();
+            dbgln_if(WEBSERVER_DEBUG, "Got raw request: '{}'", DeprecatedString::copy(request));
+
+            m_should_close = true;
+            auto maybe_did_handle = handle_request(request);
+            if (maybe_did_handle.is_error()) {
+                warnln("Failed to handle the request: {}", maybe_did_handle.error());
+            }
 
-        auto maybe_did_handle = handle_request(request);
-        if (maybe_did_handle.is_error()) {
-            warnln("Failed to handle the request: {}", maybe_did_handle.error());
+            if (m_should_close) {
+                die();
+                return;
+            }
         }
-
-        die();
     };
 }
 
+static bool should_keep_alive(HTTP::HttpRequest const& request)
+{
+    if (auto it = request.headers().find_if([](auto& header) { return header.name.equals_ignoring_case("Connection"sv); }); !it.is_end())
+        return it->value.trim_whitespace().equals_ignoring_case("keep-alive"sv);
+    return false;
+}
+
+// Small static assets are kept mapped with their mime type precomputed, so
+// repeated requests are served straight out of memory.
+struct CachedFile {
+    NonnullRefPtr<Core::MappedFile> file;
+    String mime_type;
+    time_t mtime;
+    off_t size;
+};
+
+static HashMap<DeprecatedString, NonnullOwnPtr<CachedFile>> s_file_cache;
+static constexpr size_t s_file_cache_max_entries = 64;
+static constexpr size_t s_file_cache_max_file_size = 4 * MiB;
+
+static CachedFile* file_cache_entry(DeprecatedString const& path, struct stat const& st)
+{
+    auto it = s_file_cache.find(path);
+    if (it != s_file_cache.end()) {
+        if (it->value->mtime == st.st_mtime && it->value->size == st.st_size)
+            return it->value.ptr();
+        s_file_cache.remove(it);
+    }
+
+    auto file_or_error = Core::MappedFile::map(path);
+    if (file_or_error.is_error())
+        return nullptr;
+    auto mime_type_or_error = String::from_deprecated_string(Core::guess_mime_type_based_on_filename(path));
+    if (mime_type_or_error.is_error())
+        return nullptr;
+
+    if (s_file_cache.size() >= s_file_cache_max_entries)
+        s_file_cache.remove(s_file_cache.begin()->key);
+
+    auto entry = make<CachedFile>(CachedFile { file_or_error.release_value(), mime_type_or_error.release_value(), st.st_mtime, st.st_size });
+    auto* raw_entry = entry.ptr();
+    s_file_cache.set(path, move(entry));
+    return raw_entry;
+}
+
 ErrorOr<bool> Client::handle_request(ReadonlyBytes raw_request)
 {
     auto request_or_error = HTTP::HttpRequest::from_raw_request(raw_request);
@@ -154,35 +212,61 @@ ErrorOr<bool> Client::handle_request(ReadonlyBytes raw_request)
         real_path = index_html_path;
     }
 
-    auto file = Core::File::construct(real_path.bytes_as_string_view());
-    if (!file->open(Core::OpenMode::ReadOnly)) {
+    auto st_or_error = Core::System::stat(real_path.bytes_as_string_view());
+    if (st_or_error.is_error()) {
         TRY(send_error_response(404, request));
         return false;
     }
-
-    if (file->is_device()) {
+    auto st = st_or_error.release_value();
+    if (!S_ISREG(st.st_mode)) {
         TRY(send_error_response(403, request));
         return false;
     }
 
-    auto stream = TRY(Core::Stream::File::open(real_path.bytes_as_string_view(), Core::Stream::OpenMode::Read));
+    auto etag = DeprecatedString::formatted("\"{:x}-{:x}\"", st.st_mtime, st.st_size);
+    if (auto it = request.headers().find_if([](auto& header) { return header.name.equals_ignoring_case("If-None-Match"sv); }); !it.is_end() && it->value.trim_whitespace() == etag) {
+        TRY(send_not_modified(request, etag));
+        return true;
+    }
+
+    auto real_path_string = real_path.to_deprecated_string();
+    if (static_cast<size_t>(st.st_size) <= s_file_cache_max_file_size) {
+        if (auto* entry = file_cache_entry(real_path_string, st)) {
+            FixedMemoryStream stream { entry->file->bytes() };
+            TRY(send_response(stream, request, { .type = entry->mime_type, .length = entry->file->size(), .etag = move(etag) }));
+            return true;
+        }
+    }
+
+    auto stream_or_error = Core::Stream::File::open(real_path.bytes_as_string_view(), Core::Stream::OpenMode::Read);
+    if (stream_or_error.is_error()) {
+        TRY(send_error_response(404, request));
+        return false;
+    }
 
     auto const info = ContentInfo {
         .type = TRY(String::from_deprecated_string(Core::guess_mime_type_based_on_filename(real_path.bytes_as_string_view()))),
-        .length = TRY(Core::File::size(real_path.bytes_as_string_view()))
+        .length = static_cast<size_t>(st.st_size),
+        .etag = move(etag)
     };
-    TRY(send_response(*stream, request, move(info)));
+    TRY(send_response(*stream_or_error.value(), request, move(info)));
     return true;
 }
 
 ErrorOr<void> Client::send_response(AK::Stream& response, HTTP::HttpRequest const& request, ContentInfo content_info)
 {
+    auto keep_alive = should_keep_alive(request);
+
     StringBuilder builder;
     builder.append("HTTP/1.0 200 OK\r\n"sv);
     builder.append("Server: WebServer (SerenityOS)\r\n"sv);
     builder.append("X-Frame-Options: SAMEORIGIN\r\n"sv);
     builder.append("X-Content-Type-Options: nosniff\r\n"sv);
     builder.append("Pragma: no-cache\r\n"sv);
+    if (keep_alive)
+        builder.append("Connection: keep-alive\r\n"sv);
+    if (!content_info.etag.is_empty())
+        builder.appendff("ETag: {}\r\n", content_info.etag);
     if (content_info.type == "text/plain")
         builder.appendff("Content-Type: {}; charset=utf-8\r\n", content_info.type);
     else
@@ -194,32 +278,59 @@ ErrorOr<void> Client::send_response(AK::Stream& response, HTTP::HttpRequest cons
     TRY(m_socket->write(builder_contents));
     log_response(200, request);
 
-    char buffer[PAGE_SIZE];
-    do {
-        auto size = TRY(response.read({ buffer, sizeof(buffer) })).size();
-        if (response.is_eof() && size == 0)
-            break;
+    if (auto* file_response = dynamic_cast<Core::Stream::File*>(&response)) {
+        // When responding with a plain file, let the kernel stream it to the
+        // socket with sendfile() instead of bouncing every chunk through a
+        // userspace buffer.
+        size_t remaining = content_info.length;
+        while (remaining > 0) {
+            auto nsent = sendfile(m_socket->underlying_stream().fd(), file_response->fd(), nullptr, remaining);
+            if (nsent < 0)
+                return Error::from_syscall("sendfile"sv, -errno);
+            if (nsent == 0)
+                break;
+            remaining -= static_cast<size_t>(nsent);
+        }
+    } else {
+        char buffer[PAGE_SIZE];
+        do {
+            auto size = TRY(response.read({ buffer, sizeof(buffer) })).size();
+            if (response.is_eof() && size == 0)
+                break;
+
+            ReadonlyBytes write_buffer { buffer, size };
+            while (!write_buffer.is_empty()) {
+                auto nwritten = TRY(m_socket->write(write_buffer));
 
-        ReadonlyBytes write_buffer { buffer, size };
-        while (!write_buffer.is_empty()) {
-            auto nwritten = TRY(m_socket->write(write_buffer));
+                if (nwritten == 0) {
+                    dbgln("EEEEEE got 0 bytes written!");
+                }
 
-            if (nwritten == 0) {
-                dbgln("EEEEEE got 0 bytes written!");
+                write_buffer = write_buffer.slice(nwritten);
             }
+        } while (true);
+    }
 
-            write_buffer = write_buffer.slice(nwritten);
-        }
-    } while (true);
+    m_should_close = !keep_alive;
+    return {};
+}
 
-    auto keep_alive = false;
-    if (auto it = request.headers().find_if([](auto& header) { return header.name.equals_ignoring_case("Connection"sv); }); !it.is_end()) {
-        if (it->value.trim_whitespace().equals_ignoring_case("keep-alive"sv))
-            keep_alive = true;
-    }
-    if (!keep_alive)
-        m_socket->close();
+ErrorOr<void> Client::send_not_modified(HTTP::HttpRequest const& request, DeprecatedString const& etag)
+{
+    auto keep_alive = should_keep_alive(request);
+
+    StringBuilder builder;
+    builder.append("HTTP/1.0 304 Not Modified\r\n"sv);
+    builder.append("Server: WebServer (SerenityOS)\r\n"sv);
+    if (keep_alive)
+        builder.append("Connection: keep-alive\r\n"sv);
+    builder.appendff("ETag: {}\r\n", etag);
+    builder.append("\r\n"sv);
+
+    TRY(m_socket->write(builder.to_byte_buffer()));
 
+    log_response(304, request);
+    m_should_close = !keep_alive;
     return {};
 }
 
@@ -337,7 +448,7 @@ ErrorOr<void> Client::handle_directory_listing(String const& requested_path, Str
 
     auto response = builder.to_deprecated_string();
     FixedMemoryStream stream { response.bytes() };
-    return send_response(stream, request, { .type = TRY(String::from_utf8("text/html"sv)), .length = response.length() });
+    return send_response(stream, request, { .type = TRY(String::from_utf8("text/html"sv)), .length = response.length(), .etag = {} });
 }
 
 ErrorOr<void> Client::send_error_response(unsigned code, HTTP::HttpRequest const& request, Vector<String> const& headers)
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/String.h>
+#include <AK/StringBuilder.h>
 #include <LibCore/Object.h>
 #include <LibCore/Stream.h>
 #include <LibHTTP/Forward.h>
@@ -27,11 +28,13 @@ private:
     struct ContentInfo {
         String type;
         size_t length {};
+        DeprecatedString etag;
     };
 
     ErrorOr<bool> handle_request(ReadonlyBytes);
     ErrorOr<void> send_response(AK::Stream&, HTTP::HttpRequest const&, ContentInfo);
     ErrorOr<void> send_redirect(StringView redirect, HTTP::HttpRequest const&);
+    ErrorOr<void> send_not_modified(HTTP::HttpRequest const&, DeprecatedString const& etag);
     ErrorOr<void> send_error_response(unsigned code, HTTP::HttpRequest const&, Vector<String> const& headers = {});
     void die();
     void log_response(unsigned code, HTTP::HttpRequest const&);
@@ -39,6 +42,10 @@ private:
     bool verify_credentials(Vector<HTTP::HttpRequest::Header> const&);
 
     NonnullOwnPtr<Core::Stream::BufferedTCPSocket> m_socket;
+    // Header lines of a request we haven't fully received yet.
+    StringBuilder m_pending_request;
+    // Whether the connection should be torn down once the current request has been answered.
+    bool m_should_close { true };
 };
 
 }
@@ -120,16 +120,55 @@ void ConnectionFromClient::did_connect(i32 connection_id)
 
 void ConnectionFromClient::did_receive_message(i32 connection_id, Message message)
 {
-    async_received(connection_id, message.is_text(), message.data());
+    // Coalesce bursts of messages into one IPC delivery per event loop pump.
+    // A connection receiving thousands of small frames per second would
+    // otherwise cost one IPC message (and one peer wakeup) per frame.
+    m_pending_messages.ensure(connection_id).append(move(message));
+    if (m_message_flush_scheduled)
+        return;
+    m_message_flush_scheduled = true;
+    deferred_invoke([this] {
+        flush_pending_messages();
+    });
+}
+
+void ConnectionFromClient::flush_pending_messages()
+{
+    m_message_flush_scheduled = false;
+    auto pending_messages = move(m_pending_messages);
+    for (auto& it : pending_messages) {
+        auto& messages = it.value;
+        size_t i = 0;
+        while (i < messages.size()) {
+            // Batch runs of consecutive messages of the same type.
+            bool is_text = messages[i].is_text();
+            size_t run_end = i + 1;
+            while (run_end < messages.size() && messages[run_end].is_text() == is_text)
+                ++run_end;
+            if (run_end - i == 1) {
+                async_received(it.key, is_text, messages[i].data());
+            } else {
+                Vector<ByteBuffer> batch;
+                batch.ensure_capacity(run_end - i);
+                for (size_t j = i; j < run_end; ++j)
+                    batch.unchecked_append(messages[j].data());
+                async_received_batch(it.key, is_text, move(batch));
+            }
+            i = run_end;
+        }
+    }
 }
 
 void ConnectionFromClient::did_error(i32 connection_id, i32 message)
 {
+    flush_pending_messages();
     async_errored(connection_id, message);
 }
 
 void ConnectionFromClient::did_close(i32 connection_id, u16 code, DeprecatedString reason, bool was_clean)
 {
+    // Make sure no received message gets reordered after the close notification.
+    flush_pending_messages();
     async_closed(connection_id, code, reason, was_clean);
     deferred_invoke([this, connection_id] {
         m_connections.remove(connection_id);
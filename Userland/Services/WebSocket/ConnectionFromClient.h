@@ -39,8 +39,13 @@ private:
     void did_close(i32, u16 code, DeprecatedString reason, bool was_clean);
     void did_request_certificates(i32);
 
+    void flush_pending_messages();
+
     i32 m_connection_ids { 0 };
     HashMap<i32, RefPtr<WebSocket>> m_connections;
+
+    HashMap<i32, Vector<Message>> m_pending_messages;
+    bool m_message_flush_scheduled { false };
 };
 
 }
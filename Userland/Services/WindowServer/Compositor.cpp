@@ -44,6 +44,11 @@ static WallpaperMode mode_to_enum(DeprecatedString const& name)
 
 Compositor::Compositor()
 {
+    // Screen damage only needs to cover what changed, so let it degrade to a
+    // bounding box instead of fragmenting without bound (e.g. when cursors
+    // blink in many terminals at once).
+    m_dirty_screen_rects.set_fragmentation_threshold(128);
+
     m_display_link_notify_timer = add<Core::Timer>(
         1000 / 60, [this] {
             notify_display_links();
@@ -605,7 +610,7 @@ void Compositor::compose()
         start_compose_async_timer();
     }
 
-    if (need_to_draw_cursor) {
+    if (need_to_draw_cursor && !m_hardware_cursor_active) {
         auto& screen_data = cursor_screen.compositor_screen_data();
         screen_data.draw_cursor(cursor_screen, cursor_rect);
     }
@@ -876,11 +881,14 @@ void Compositor::screen_resolution_changed()
 {
     // Screens may be gone now, invalidate any references to them
     m_current_cursor_screen = nullptr;
+    m_hardware_cursor_screen = nullptr;
+    m_hardware_cursor_active = false;
 
     init_bitmaps();
     invalidate_occlusions();
     overlay_rects_changed();
     update_wallpaper_bitmap();
+    update_hardware_cursor();
     compose();
 }
 
@@ -902,6 +910,16 @@ Gfx::IntRect Compositor::current_cursor_rect() const
 
 void Compositor::invalidate_cursor(bool compose_immediately)
 {
+    if (m_hardware_cursor_active) {
+        if (!WindowManager::the().is_cursor_highlight_enabled()) {
+            // The device overlays the cursor plane for us, so moving the cursor
+            // doesn't require any compositing work at all.
+            update_hardware_cursor_position();
+            return;
+        }
+        // Cursor highlighting needs the software cursor, give up the cursor plane.
+        deactivate_hardware_cursor();
+    }
     if (m_invalidated_cursor && !compose_immediately)
         return;
     m_invalidated_cursor = true;
@@ -934,6 +952,81 @@ void Compositor::change_cursor(Cursor const* cursor)
                 invalidate_cursor(true);
             });
     }
+    update_hardware_cursor();
+}
+
+void Compositor::update_hardware_cursor()
+{
+    bool wants_hardware_cursor = m_current_cursor && m_current_cursor->params().frames() <= 1 && !WindowManager::the().is_cursor_highlight_enabled();
+    if (wants_hardware_cursor) {
+        Screen::for_each([&](auto& screen) {
+            if (!screen.can_set_hardware_cursor()) {
+                wants_hardware_cursor = false;
+                return IterationDecision::Break;
+            }
+            return IterationDecision::Continue;
+        });
+    }
+    if (!wants_hardware_cursor) {
+        deactivate_hardware_cursor();
+        return;
+    }
+
+    auto& cursor_screen = ScreenInput::the().cursor_location_screen();
+    auto const& cursor_bitmap = m_current_cursor->bitmap(cursor_screen.scale_factor());
+    // Note: The bitmap may be for a different scale factor than we asked for,
+    // so don't assume the screen's scale factor when scaling the hotspot.
+    int bitmap_scale = m_current_cursor->size().width() > 0 ? cursor_bitmap.width() / m_current_cursor->size().width() : 1;
+    auto hotspot = m_current_cursor->params().hotspot() * bitmap_scale;
+    if (cursor_screen.set_hardware_cursor_bitmap(cursor_bitmap, hotspot).is_error()) {
+        // E.g. the cursor may be too large for the device's cursor plane.
+        deactivate_hardware_cursor();
+        return;
+    }
+    if (m_hardware_cursor_screen && m_hardware_cursor_screen != &cursor_screen)
+        (void)m_hardware_cursor_screen->disable_hardware_cursor();
+    bool was_active = m_hardware_cursor_active;
+    m_hardware_cursor_active = true;
+    m_hardware_cursor_screen = &cursor_screen;
+    if (!was_active) {
+        // The last software-drawn cursor may still be on screen; schedule a
+        // compose so it gets restored from the back-store (the draw itself is
+        // skipped while the cursor plane is active).
+        m_invalidated_cursor = true;
+        m_invalidated_any = true;
+        start_compose_async_timer();
+    }
+    update_hardware_cursor_position();
+}
+
+void Compositor::update_hardware_cursor_position()
+{
+    if (!m_hardware_cursor_active)
+        return;
+    auto& cursor_screen = ScreenInput::the().cursor_location_screen();
+    if (&cursor_screen != m_hardware_cursor_screen) {
+        // The cursor crossed over to another screen, move the cursor plane along with it.
+        update_hardware_cursor();
+        return;
+    }
+    auto position = ScreenInput::the().cursor_location().translated(-cursor_screen.rect().location()) * cursor_screen.scale_factor();
+    if (cursor_screen.set_hardware_cursor_position(position).is_error())
+        deactivate_hardware_cursor();
+}
+
+void Compositor::deactivate_hardware_cursor()
+{
+    if (m_hardware_cursor_screen) {
+        (void)m_hardware_cursor_screen->disable_hardware_cursor();
+        m_hardware_cursor_screen = nullptr;
+    }
+    if (!m_hardware_cursor_active)
+        return;
+    m_hardware_cursor_active = false;
+    // Let the next compose draw the software cursor again.
+    m_invalidated_cursor = true;
+    m_invalidated_any = true;
+    start_compose_async_timer();
 }
 
 void Compositor::render_overlays()
@@ -207,6 +207,9 @@ private:
     void recompute_overlay_rects();
     void recompute_occlusions();
     void change_cursor(Cursor const*);
+    void update_hardware_cursor();
+    void update_hardware_cursor_position();
+    void deactivate_hardware_cursor();
     void flush(Screen&);
     Gfx::IntPoint window_transition_offset(Window&);
     void update_animations(Screen&, Gfx::DisjointIntRectSet& flush_rects);
@@ -239,6 +242,8 @@ private:
     Screen* m_current_cursor_screen { nullptr };
     unsigned m_current_cursor_frame { 0 };
     RefPtr<Core::Timer> m_cursor_timer;
+    bool m_hardware_cursor_active { false };
+    Screen* m_hardware_cursor_screen { nullptr };
 
     RefPtr<Core::Timer> m_display_link_notify_timer;
     size_t m_display_link_count { 0 };
@@ -8,8 +8,11 @@
 #include "HardwareScreenBackend.h"
 #include "ScreenBackend.h"
 #include <AK/Try.h>
+#include <AK/Vector.h>
 #include <Kernel/API/Graphics.h>
 #include <LibCore/System.h>
+#include <LibGfx/Bitmap.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
 #include <sys/mman.h>
@@ -33,6 +36,7 @@ ErrorOr<void> HardwareScreenBackend::open()
     m_can_device_flush_buffers = (properties.partial_flushing_support != 0);
     m_can_device_flush_entire_framebuffer = (properties.flushing_support != 0);
     m_can_set_head_buffer = (properties.doublebuffer_support != 0);
+    m_can_set_hardware_cursor = (properties.hardware_cursor_support != 0);
     m_max_size_in_bytes = properties.max_buffer_bytes;
     return {};
 }
@@ -162,6 +166,53 @@ ErrorOr<void> HardwareScreenBackend::flush_framebuffer_rects(int buffer_index, R
     return {};
 }
 
+ErrorOr<void> HardwareScreenBackend::set_hardware_cursor_bitmap(Gfx::Bitmap const& bitmap, Gfx::IntPoint hotspot)
+{
+    VERIFY(m_can_set_hardware_cursor);
+    if (bitmap.format() != Gfx::BitmapFormat::BGRA8888 && bitmap.format() != Gfx::BitmapFormat::BGRx8888)
+        return Error::from_errno(ENOTSUP);
+
+    // Note: The device expects the pixel rows to be contiguous, so copy them out
+    // of the (possibly padded) bitmap.
+    Vector<u32> pixels;
+    TRY(pixels.try_ensure_capacity(static_cast<size_t>(bitmap.width()) * bitmap.height()));
+    for (int y = 0; y < bitmap.height(); y++) {
+        for (int x = 0; x < bitmap.width(); x++)
+            pixels.unchecked_append(bitmap.get_pixel(x, y).value());
+    }
+
+    GraphicsHardwareCursorBitmap cursor_bitmap {
+        .enabled = 1,
+        .width = static_cast<unsigned>(bitmap.width()),
+        .height = static_cast<unsigned>(bitmap.height()),
+        .hotspot_x = static_cast<unsigned>(hotspot.x()),
+        .hotspot_y = static_cast<unsigned>(hotspot.y()),
+        .argb_pixels = pixels.data(),
+    };
+    if (graphics_connector_set_hardware_cursor_bitmap(m_display_connector_fd, &cursor_bitmap) < 0)
+        return Error::from_syscall("graphics_connector_set_hardware_cursor_bitmap"sv, -errno);
+    return {};
+}
+
+ErrorOr<void> HardwareScreenBackend::disable_hardware_cursor()
+{
+    VERIFY(m_can_set_hardware_cursor);
+    GraphicsHardwareCursorBitmap cursor_bitmap {};
+    cursor_bitmap.enabled = 0;
+    if (graphics_connector_set_hardware_cursor_bitmap(m_display_connector_fd, &cursor_bitmap) < 0)
+        return Error::from_syscall("graphics_connector_set_hardware_cursor_bitmap"sv, -errno);
+    return {};
+}
+
+ErrorOr<void> HardwareScreenBackend::set_hardware_cursor_position(Gfx::IntPoint position)
+{
+    VERIFY(m_can_set_hardware_cursor);
+    GraphicsHardwareCursorPosition cursor_position { position.x(), position.y() };
+    if (graphics_connector_set_hardware_cursor_position(m_display_connector_fd, &cursor_position) < 0)
+        return Error::from_syscall("graphics_connector_set_hardware_cursor_position"sv, -errno);
+    return {};
+}
+
 ErrorOr<void> HardwareScreenBackend::flush_framebuffer()
 {
     int rc = fb_flush_head(m_display_connector_fd);
@@ -36,6 +36,10 @@ public:
     virtual ErrorOr<void> set_head_mode_setting(GraphicsHeadModeSetting) override;
     virtual ErrorOr<GraphicsHeadModeSetting> get_head_mode_setting() override;
 
+    virtual ErrorOr<void> set_hardware_cursor_bitmap(Gfx::Bitmap const&, Gfx::IntPoint hotspot) override;
+    virtual ErrorOr<void> disable_hardware_cursor() override;
+    virtual ErrorOr<void> set_hardware_cursor_position(Gfx::IntPoint) override;
+
     DeprecatedString m_device {};
     int m_display_connector_fd { -1 };
 
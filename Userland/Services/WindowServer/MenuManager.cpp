@@ -282,22 +282,34 @@ void MenuManager::close_menu_and_descendants(Menu& menu)
     close_menus(menus_to_close);
 }
 
-void MenuManager::set_hovered_menu(Menu* menu)
+static void invalidate_menubar_item(Window& window, Menu& menu)
+{
+    auto menubar_rect = window.frame().menubar_rect();
+    window.frame().invalidate(menu.rect_in_window_menubar().translated(menubar_rect.location()));
+}
+
+void MenuManager::set_hovered_menu(Menu* menu, Window* menubar_window)
 {
     if (m_hovered_menu == menu)
         return;
+
+    // Only the two affected menubar items need repainting, not the whole menubar
+    // (or, worse, every menubar of the client).
+    if (m_hovered_menu) {
+        if (auto* previous_window = m_hovered_menu_window.ptr())
+            invalidate_menubar_item(*previous_window, *m_hovered_menu);
+    }
+
     if (menu) {
         m_hovered_menu = menu->make_weak_ptr<Menu>();
-    } else {
-        // FIXME: This is quite aggressive. If we knew which window the previously hovered menu was in,
-        //        we could just invalidate that one instead of iterating all windows in the client.
-        if (auto* client = m_hovered_menu->client()) {
-            client->for_each_window([&](Window& window) {
-                window.invalidate_menubar();
-                return IterationDecision::Continue;
-            });
+        m_hovered_menu_window = nullptr;
+        if (menubar_window) {
+            m_hovered_menu_window = menubar_window->make_weak_ptr<Window>();
+            invalidate_menubar_item(*menubar_window, *menu);
         }
+    } else {
         m_hovered_menu = nullptr;
+        m_hovered_menu_window = nullptr;
     }
 }
 
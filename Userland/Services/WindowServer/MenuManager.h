@@ -44,7 +44,7 @@ public:
 
     void did_change_theme();
 
-    void set_hovered_menu(Menu*);
+    void set_hovered_menu(Menu*, Window* menubar_window = nullptr);
     Menu* hovered_menu() { return m_hovered_menu; }
 
 private:
@@ -63,6 +63,7 @@ private:
     int m_theme_index { 0 };
 
     WeakPtr<Menu> m_hovered_menu;
+    WeakPtr<Window> m_hovered_menu_window;
 };
 
 }
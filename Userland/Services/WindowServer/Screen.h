@@ -169,6 +169,11 @@ public:
 
     bool can_device_flush_buffers() const { return m_backend->m_can_device_flush_buffers; }
     bool can_device_flush_entire_buffer() const { return m_backend->m_can_device_flush_entire_framebuffer; }
+
+    bool can_set_hardware_cursor() const { return m_backend->m_can_set_hardware_cursor; }
+    ErrorOr<void> set_hardware_cursor_bitmap(Gfx::Bitmap const& bitmap, Gfx::IntPoint hotspot) { return m_backend->set_hardware_cursor_bitmap(bitmap, hotspot); }
+    ErrorOr<void> disable_hardware_cursor() { return m_backend->disable_hardware_cursor(); }
+    ErrorOr<void> set_hardware_cursor_position(Gfx::IntPoint position) { return m_backend->set_hardware_cursor_position(position); }
     void queue_flush_display_rect(Gfx::IntRect const& rect);
     void flush_display(int buffer_index);
     void flush_display_front_buffer(int front_buffer_index, Gfx::IntRect&);
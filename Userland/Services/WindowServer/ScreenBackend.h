@@ -10,6 +10,8 @@
 #include <AK/Error.h>
 #include <AK/Span.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Point.h>
 #include <sys/ioctl.h>
 
 namespace WindowServer {
@@ -38,6 +40,12 @@ public:
     virtual ErrorOr<void> set_safe_head_mode_setting() = 0;
     virtual ErrorOr<GraphicsHeadModeSetting> get_head_mode_setting() = 0;
 
+    virtual ErrorOr<void> set_hardware_cursor_bitmap(Gfx::Bitmap const&, Gfx::IntPoint) { return Error::from_errno(ENOTSUP); }
+    virtual ErrorOr<void> disable_hardware_cursor() { return Error::from_errno(ENOTSUP); }
+    virtual ErrorOr<void> set_hardware_cursor_position(Gfx::IntPoint) { return Error::from_errno(ENOTSUP); }
+
+    bool m_can_set_hardware_cursor { false };
+
     bool m_can_device_flush_buffers { true };
     bool m_can_device_flush_entire_framebuffer { true };
     bool m_can_set_head_buffer { false };
@@ -19,6 +19,7 @@
 #include <LibCore/Account.h>
 #include <LibCore/ProcessStatisticsReader.h>
 #include <LibCore/SessionManagement.h>
+#include <LibCore/Timer.h>
 
 namespace WindowServer {
 
@@ -89,6 +90,7 @@ Window::Window(Core::Object& parent, WindowType type)
     , m_icon(default_window_icon())
     , m_frame(*this)
 {
+    m_dirty_rects.set_fragmentation_threshold(64);
     WindowManager::the().add_window(*this);
     frame().window_was_constructed({});
 }
@@ -114,6 +116,7 @@ Window::Window(ConnectionFromClient& client, WindowType window_type, WindowMode
         if (auto title_username_maybe = compute_title_username(&client); !title_username_maybe.is_error())
             m_title_username = title_username_maybe.release_value();
     }
+    m_dirty_rects.set_fragmentation_threshold(64);
     WindowManager::the().add_window(*this);
     frame().window_was_constructed({});
 }
@@ -197,13 +200,52 @@ void Window::set_minimum_size(Gfx::IntSize size)
     m_minimum_size = size;
 }
 
+void Window::send_mouse_move_to_client(MouseEvent const& event)
+{
+    m_client->async_mouse_move(m_window_id, event.position(), (u32)event.button(), event.buttons(), event.modifiers(), event.wheel_delta_x(), event.wheel_delta_y(), event.wheel_raw_delta_x(), event.wheel_raw_delta_y(), event.is_drag(), event.mime_types());
+}
+
+void Window::flush_pending_mouse_move_event()
+{
+    if (!m_pending_mouse_move_event)
+        return;
+    auto event = m_pending_mouse_move_event.release_nonnull();
+    send_mouse_move_to_client(*event);
+}
+
 void Window::handle_mouse_event(MouseEvent const& event)
 {
     set_automatic_cursor_tracking_enabled(event.buttons() != 0);
 
+    // Deliver any coalesced mouse move before other mouse events so the
+    // client always sees them in the order they happened.
+    if (event.type() != Event::MouseMove)
+        flush_pending_mouse_move_event();
+
     switch (event.type()) {
     case Event::MouseMove:
-        m_client->async_mouse_move(m_window_id, event.position(), (u32)event.button(), event.buttons(), event.modifiers(), event.wheel_delta_x(), event.wheel_delta_y(), event.wheel_raw_delta_x(), event.wheel_raw_delta_y(), event.is_drag(), event.mime_types());
+        // A fast mouse produces moves well above the display refresh rate.
+        // The first move in a frame interval goes out right away; any further
+        // ones are merged and the latest state is delivered when the timer
+        // fires, so clients repaint at most once per interval.
+        if (!m_mouse_move_flush_timer) {
+            m_mouse_move_flush_timer = Core::Timer::create_single_shot(
+                1000 / 60,
+                [this] {
+                    if (!m_pending_mouse_move_event)
+                        return;
+                    flush_pending_mouse_move_event();
+                    m_mouse_move_flush_timer->start();
+                },
+                this)
+                                           .release_value_but_fixme_should_propagate_errors();
+        }
+        if (m_mouse_move_flush_timer->is_active()) {
+            m_pending_mouse_move_event = make<MouseEvent>(event);
+        } else {
+            send_mouse_move_to_client(event);
+            m_mouse_move_flush_timer->start();
+        }
         break;
     case Event::MouseDown:
         m_client->async_mouse_down(m_window_id, event.position(), (u32)event.button(), event.buttons(), event.modifiers(), event.wheel_delta_x(), event.wheel_delta_y(), event.wheel_raw_delta_x(), event.wheel_raw_delta_y());
@@ -497,9 +539,30 @@ void Window::event(Core::Event& event)
     case Event::WindowCloseRequest:
         m_client->async_window_close_request(m_window_id);
         break;
-    case Event::WindowResized:
-        m_client->async_window_resized(m_window_id, static_cast<ResizeEvent const&>(event).rect());
+    case Event::WindowResized: {
+        // Interactive resizing produces a rect change per mouse move; pace the
+        // deliveries like mouse moves, always ending on the most recent rect.
+        auto rect = static_cast<ResizeEvent const&>(event).rect();
+        if (!m_resize_flush_timer) {
+            m_resize_flush_timer = Core::Timer::create_single_shot(
+                1000 / 60,
+                [this] {
+                    if (!m_pending_resize_rect.has_value())
+                        return;
+                    m_client->async_window_resized(m_window_id, m_pending_resize_rect.release_value());
+                    m_resize_flush_timer->start();
+                },
+                this)
+                                       .release_value_but_fixme_should_propagate_errors();
+        }
+        if (m_resize_flush_timer->is_active()) {
+            m_pending_resize_rect = rect;
+        } else {
+            m_client->async_window_resized(m_window_id, rect);
+            m_resize_flush_timer->start();
+        }
         break;
+    }
     case Event::WindowMoved:
         m_client->async_window_moved(m_window_id, static_cast<MoveEvent const&>(event).rect());
         break;
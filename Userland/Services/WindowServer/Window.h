@@ -8,6 +8,7 @@
 
 #include "HitTestResult.h"
 #include <AK/DeprecatedString.h>
+#include <AK/OwnPtr.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/Object.h>
 #include <LibGfx/Bitmap.h>
@@ -383,6 +384,8 @@ private:
     virtual void event(Core::Event&) override;
     void handle_mouse_event(MouseEvent const&);
     void handle_keydown_event(KeyEvent const&);
+    void send_mouse_move_to_client(MouseEvent const&);
+    void flush_pending_mouse_move_event();
     void add_child_window(Window&);
     void ensure_window_menu();
     void update_window_menu_items();
@@ -390,6 +393,15 @@ private:
 
     ConnectionFromClient* m_client { nullptr };
 
+    // Mouse moves and interactive resizes arrive much faster than clients can
+    // usefully repaint, so only the first event in a frame interval is sent
+    // right away; the rest are merged and delivered with the latest state when
+    // the corresponding timer fires.
+    RefPtr<Core::Timer> m_mouse_move_flush_timer;
+    OwnPtr<MouseEvent> m_pending_mouse_move_event;
+    RefPtr<Core::Timer> m_resize_flush_timer;
+    Optional<Gfx::IntRect> m_pending_resize_rect;
+
     WeakPtr<Window> m_parent_window;
     Vector<WeakPtr<Window>> m_child_windows;
 
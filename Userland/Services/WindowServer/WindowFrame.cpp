@@ -900,8 +900,9 @@ void WindowFrame::handle_menubar_mouse_event(MouseEvent const& event)
     if (!hovered_menu && event.type() == Event::Type::MouseDown)
         MenuManager::the().close_everyone();
     if (hovered_menu != MenuManager::the().hovered_menu()) {
-        MenuManager::the().set_hovered_menu(hovered_menu);
-        invalidate(menubar_rect);
+        // This takes care of invalidating both the previously and the newly
+        // hovered item, so there's nothing further to repaint here.
+        MenuManager::the().set_hovered_menu(hovered_menu, &m_window);
     }
 }
 
@@ -742,6 +742,12 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
 
     argv.append(nullptr);
 
+    // Resolve the program path before forking; the child inherits the warm
+    // cache, so repeated spawns of the same programs (think build scripts)
+    // skip the PATH walk entirely.
+    if (!command.argv.is_empty())
+        (void)resolve_program_from_cache(command.argv.first());
+
     auto sync_pipe = TRY(Core::System::pipe2(0));
     auto child = TRY(Core::System::fork());
 
@@ -875,6 +881,23 @@ ErrorOr<RefPtr<Job>> Shell::run_command(const AST::Command& command)
     return *job;
 }
 
+Optional<DeprecatedString> Shell::resolve_program_from_cache(DeprecatedString const& name)
+{
+    // Paths with a slash in them bypass PATH lookup entirely.
+    if (name.is_empty() || name.contains('/'))
+        return {};
+
+    if (auto cached = m_program_path_cache.get(name); cached.has_value())
+        return cached.value();
+
+    auto executable = Core::File::resolve_executable_from_environment(name);
+    if (!executable.has_value())
+        return {};
+
+    m_program_path_cache.set(name, *executable);
+    return executable.release_value();
+}
+
 void Shell::execute_process(Vector<char const*>&& argv)
 {
     for (auto& promise : m_active_promises) {
@@ -883,6 +906,12 @@ void Shell::execute_process(Vector<char const*>&& argv)
             MUST(Core::System::unveil(item.path, item.access));
     }
 
+    // If we (or our parent, pre-fork) already resolved this program, exec the
+    // full path directly instead of having execvp() walk PATH all over again.
+    // Should the cached path turn out to be stale, fall through to execvp().
+    if (auto resolved_path = resolve_program_from_cache(argv[0]); resolved_path.has_value())
+        execv(resolved_path->characters(), const_cast<char* const*>(argv.data()));
+
     int rc = execvp(argv[0], const_cast<char* const*>(argv.data()));
     if (rc < 0) {
         auto parts = StringView { argv[0], strlen(argv[0]) }.split_view('/');
@@ -1338,6 +1367,10 @@ DeprecatedString Shell::unescape_token(StringView token)
 
 void Shell::cache_path()
 {
+    // Note: This is also our invalidation point for resolved program paths,
+    //       since it runs whenever PATH (or the set of runnables) changes.
+    m_program_path_cache.clear();
+
     if (!m_is_interactive)
         return;
 
@@ -404,6 +404,8 @@ private:
 
     [[noreturn]] void execute_process(Vector<char const*>&& argv);
 
+    Optional<DeprecatedString> resolve_program_from_cache(DeprecatedString const& name);
+
     virtual void custom_event(Core::CustomEvent&) override;
 
 #define __ENUMERATE_SHELL_IMMEDIATE_FUNCTION(name) \
@@ -447,6 +449,8 @@ private:
     NonnullRefPtrVector<AST::Redirection> m_global_redirections;
 
     HashMap<DeprecatedString, DeprecatedString> m_aliases;
+    // Program name -> resolved PATH entry; cleared whenever cache_path() runs.
+    HashMap<DeprecatedString, DeprecatedString> m_program_path_cache;
     bool m_is_interactive { true };
     bool m_is_subshell { false };
     bool m_should_reinstall_signal_handlers { true };
@@ -59,7 +59,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         loader->num_channels() == 1 ? "Mono" : "Stereo");
     out("\033[34;1mProgress\033[0m: \033[s");
 
-    auto resampler = Audio::ResampleHelper<Audio::Sample>(loader->sample_rate(), audio_client->get_sample_rate());
+    auto resampler = TRY(Audio::PolyphaseResampler::create(loader->sample_rate(), audio_client->get_sample_rate()));
 
     // If we're downsampling, we need to appropriately load more samples at once.
     size_t const load_size = static_cast<size_t>(LOAD_CHUNK_SIZE * static_cast<double>(loader->sample_rate()) / static_cast<double>(audio_client->get_sample_rate()));
@@ -96,8 +96,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             if (samples.value().size() > 0) {
                 print_playback_update();
                 // We can read and enqueue more samples
-                resampler.reset();
-                auto resampled_samples = resampler.resample(move(samples.value()));
+                auto resampled_samples = TRY(resampler.resample(samples.value().span()));
                 TRY(audio_client->async_enqueue(move(resampled_samples)));
             } else if (should_loop) {
                 // We're done: now loop
@@ -53,7 +53,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         if (decompress)
             output_bytes = TRY(Compress::GzipDecompressor::decompress_all(input_bytes));
         else
-            output_bytes = TRY(Compress::GzipCompressor::compress_all(input_bytes));
+            output_bytes = TRY(Compress::GzipCompressor::compress_all_parallel(input_bytes));
 
         auto output_stream = write_to_stdout ? TRY(Core::Stream::File::standard_output()) : TRY(Core::Stream::File::open(output_filename, Core::Stream::OpenMode::Write));
         TRY(output_stream->write_entire_buffer(output_bytes));
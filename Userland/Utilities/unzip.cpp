@@ -5,6 +5,8 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Atomic.h>
+#include <AK/MemoryStream.h>
 #include <AK/NumberFormat.h>
 #include <AK/StringUtils.h>
 #include <LibArchive/Zip.h>
@@ -15,6 +17,7 @@
 #include <LibCore/MappedFile.h>
 #include <LibCore/System.h>
 #include <LibCrypto/Checksum/CRC32.h>
+#include <LibThreading/ThreadPool.h>
 #include <sys/stat.h>
 
 static bool unpack_zip_member(Archive::ZipMember zip_member, bool quiet)
@@ -49,20 +52,32 @@ static bool unpack_zip_member(Archive::ZipMember zip_member, bool quiet)
         break;
     }
     case Archive::ZipCompressionMethod::Deflate: {
-        auto decompressed_data = Compress::DeflateDecompressor::decompress_all(zip_member.compressed_data);
-        if (decompressed_data.is_error()) {
-            warnln("Failed decompressing file {}: {}", zip_member.name, decompressed_data.error());
+        // Stream the inflated data to the destination in chunks instead of
+        // inflating the whole member into an intermediate buffer first; that
+        // keeps memory use bounded no matter how large the member is.
+        auto decompress_to_file = [&]() -> ErrorOr<size_t> {
+            auto memory_stream = TRY(try_make<FixedMemoryStream>(zip_member.compressed_data));
+            auto deflate_stream = TRY(Compress::DeflateDecompressor::construct(move(memory_stream)));
+            auto buffer = TRY(ByteBuffer::create_uninitialized(64 * KiB));
+            size_t decompressed_size = 0;
+            while (!deflate_stream->is_eof()) {
+                auto slice = TRY(deflate_stream->read(buffer));
+                if (!new_file->write(slice.data(), slice.size()))
+                    return Error::from_string_literal("Failed writing to destination");
+                checksum.update(slice);
+                decompressed_size += slice.size();
+            }
+            return decompressed_size;
+        };
+        auto decompressed_size = decompress_to_file();
+        if (decompressed_size.is_error()) {
+            warnln("Failed decompressing file {}: {}", zip_member.name, decompressed_size.error());
             return false;
         }
-        if (decompressed_data.value().size() != zip_member.uncompressed_size) {
+        if (decompressed_size.value() != zip_member.uncompressed_size) {
             warnln("Failed decompressing file {}", zip_member.name);
             return false;
         }
-        if (!new_file->write(decompressed_data.value().data(), decompressed_data.value().size())) {
-            warnln("Can't write file contents in {}: {}", zip_member.name, new_file->error_string());
-            return false;
-        }
-        checksum.update({ decompressed_data.value().data(), decompressed_data.value().size() });
         break;
     }
     default:
@@ -123,6 +138,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         TRY(Core::System::chdir(output_directory_path));
     }
 
+    Vector<Archive::ZipMember> members_to_extract;
     auto success = TRY(zip_file->for_each_member([&](auto zip_member) {
         bool keep_file = false;
 
@@ -140,12 +156,31 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         }
 
         if (keep_file) {
-            if (!unpack_zip_member(zip_member, quiet))
-                return IterationDecision::Break;
+            // Directories have to exist before the files inside them get
+            // extracted, so create them as we walk the central directory and
+            // only queue the files themselves.
+            if (zip_member.is_directory) {
+                if (!unpack_zip_member(zip_member, quiet))
+                    return IterationDecision::Break;
+            } else {
+                members_to_extract.append(move(zip_member));
+            }
         }
 
         return IterationDecision::Continue;
     }));
 
-    return success ? 0 : 1;
+    if (!success)
+        return 1;
+
+    // Zip members are compressed independently, so extraction parallelizes
+    // cleanly across the worker pool. One member per slice: member sizes vary
+    // wildly, and the queueing overhead is trivial next to inflating.
+    Atomic<bool> any_member_failed { false };
+    Threading::ThreadPool::the().parallel_for_each(members_to_extract.span(), 1, [&](Archive::ZipMember const& zip_member) {
+        if (!unpack_zip_member(zip_member, quiet))
+            any_member_failed.store(true, AK::MemoryOrder::memory_order_relaxed);
+    });
+
+    return any_member_failed.load() ? 1 : 0;
 }